@@ -16,22 +16,61 @@ $(SONG_BUILDDIR)/%.o: $(SONG_SUBDIR)/%.s
 $(MID_BUILDDIR)/%.o: $(MID_ASM_DIR)/%.s
 	$(AS) $(ASFLAGS) -I sound -o $@ $<
 
-$(CRY_BIN_DIR)/%.bin: $(CRY_SUBDIR)/%.wav
 # NOTE: If using ipatix's High Quality Audio Mixer, remove "--no-pad" below.
-	$(WAV2AGB) -b -c -l 1 --no-pad $< $@
-
+CRY_WAV2AGB_FLAGS := -b -c -l $(CRY_LOOKAHEAD) --no-pad
 # Uncompressed sounds
+SOUND_WAV2AGB_FLAGS := -b
+
+ifeq ($(WAV_BATCH),1)
+# One wav2agb process converts every .wav and only rewrites the .bin files
+# that changed, so the stamp tracks when they were last brought up to date.
+CRY_WAVS := $(wildcard $(CRY_SUBDIR)/*.wav)
+SOUND_WAVS := $(filter-out $(CRY_WAVS),$(wildcard sound/direct_sound_samples/*.wav))
+WAV_BINS := $(CRY_WAVS:$(CRY_SUBDIR)/%.wav=$(CRY_BIN_DIR)/%.bin) $(SOUND_WAVS:sound/%.wav=$(SOUND_BIN_DIR)/%.bin)
+
+$(WAV_BINS): $(OBJ_DIR)/wav_batch.stamp ; @:
+
+$(OBJ_DIR)/wav_batch.stamp: $(CRY_WAVS) $(SOUND_WAVS) $(WAV2AGB_BIN) $(call stamp_force,$(WAV_BINS))
+	$(file >$(OBJ_DIR)/wav_batch.txt)
+	$(foreach wav,$(CRY_WAVS),$(file >>$(OBJ_DIR)/wav_batch.txt,$(CRY_WAV2AGB_FLAGS) $(wav) $(wav:$(CRY_SUBDIR)/%.wav=$(CRY_BIN_DIR)/%.bin)))
+	$(foreach wav,$(SOUND_WAVS),$(file >>$(OBJ_DIR)/wav_batch.txt,$(SOUND_WAV2AGB_FLAGS) $(wav) $(wav:sound/%.wav=$(SOUND_BIN_DIR)/%.bin)))
+	$(WAV2AGB_BIN) --batch $(OBJ_DIR)/wav_batch.txt
+	@touch $@
+else
+$(CRY_BIN_DIR)/%.bin: $(CRY_SUBDIR)/%.wav
+	$(WAV2AGB) $(CRY_WAV2AGB_FLAGS) $< $@
+
 $(SOUND_BIN_DIR)/%.bin: sound/%.wav
-	$(WAV2AGB) -b $< $@
+	$(WAV2AGB) $(SOUND_WAV2AGB_FLAGS) $< $@
+endif
 
 # For each line in midi.cfg, we do some trickery to convert it into a make rule for the `.mid` file described on the line
 # Data following the colon in said file corresponds to arguments passed into mid2agb
 MID_CFG_PATH := $(MID_SUBDIR)/midi.cfg
 
+ifeq ($(MID_PATTERNS),1)
+MID_FLAGS := -O
+endif
+
+ifeq ($(MID_BATCH),1)
+# One mid2agb process converts every song in midi.cfg and only rewrites the .s
+# files that changed, so the stamp tracks when they were last brought up to date.
+# Like mid2agb, only the entries that have a .mid file are built; any other .mid
+# is left to the warning rule below.
+MID_CFG_MIDS := $(shell sed -n "s/[[:space:]]*:.*//p" $(MID_CFG_PATH))
+MID_MIDS := $(addprefix $(MID_SUBDIR)/,$(filter $(notdir $(wildcard $(MID_SUBDIR)/*.mid)),$(MID_CFG_MIDS)))
+MID_ASMS := $(patsubst $(MID_SUBDIR)/%.mid,$(MID_ASM_DIR)/%.s,$(MID_MIDS))
+
+$(MID_ASMS): $(OBJ_DIR)/mid_batch.stamp ; @:
+
+$(OBJ_DIR)/mid_batch.stamp: $(MID_MIDS) $(MID_CFG_PATH) $(MID_BIN) $(call stamp_force,$(MID_ASMS))
+	$(MID_BIN) --cfg $(MID_CFG_PATH) $(MID_FLAGS)
+	@mkdir -p $(@D) && touch $@
+else
 # $1: Source path no extension, $2 Options
 define MID_RULE
 $(MID_ASM_DIR)/$1.s: $(MID_SUBDIR)/$1.mid $(MID_CFG_PATH)
-	$(MID) $$< $$@ $2
+	$(MID) $$< $$@ $2 $(MID_FLAGS)
 endef
 #                            source path,                             remaining text (options)
 define MID_EXPANSION
@@ -39,6 +78,7 @@ define MID_EXPANSION
 endef
 
 $(foreach line,$(shell cat $(MID_CFG_PATH) | sed "s/ /__SPACE__/g"),$(call MID_EXPANSION,$(subst __SPACE__, ,$(line))))
+endif
 
 # Warn users building without a .cfg - build will fail at link time
 $(MID_ASM_DIR)/%.s: $(MID_SUBDIR)/%.mid
@@ -0,0 +1,2 @@
+GFX_REFS := data/tilesets/primary/building/palettes/00.gbapal data/tilesets/primary/building/palettes/01.gbapal data/tilesets/primary/building/palettes/02.gbapal data/tilesets/primary/building/palettes/03.gbapal data/tilesets/primary/building/palettes/04.gbapal data/tilesets/primary/building/palettes/05.gbapal data/tilesets/primary/building/palettes/06.gbapal data/tilesets/primary/building/palettes/07.gbapal data/tilesets/primary/building/palettes/08.gbapal data/tilesets/primary/building/palettes/09.gbapal data/tilesets/primary/building/palettes/10.gbapal data/tilesets/primary/building/palettes/11.gbapal data/tilesets/primary/building/palettes/12.gbapal data/tilesets/primary/building/palettes/13.gbapal data/tilesets/primary/building/palettes/14.gbapal data/tilesets/primary/building/palettes/15.gbapal data/tilesets/primary/building/tiles.4bpp.lz data/tilesets/primary/general/anim/flower/0.4bpp data/tilesets/primary/general/anim/flower/1.4bpp data/tilesets/primary/general/anim/flower/2.4bpp data/tilesets/primary/general/anim/flower/3.4bpp data/tilesets/primary/general/anim/flower/4.4bpp data/tilesets/primary/general/anim/sandwatersedge/0.4bpp data/tilesets/primary/general/anim/sandwatersedge/1.4bpp data/tilesets/primary/general/anim/sandwatersedge/2.4bpp data/tilesets/primary/general/anim/sandwatersedge/3.4bpp data/tilesets/primary/general/anim/sandwatersedge/4.4bpp data/tilesets/primary/general/anim/sandwatersedge/5.4bpp data/tilesets/primary/general/anim/sandwatersedge/6.4bpp data/tilesets/primary/general/anim/sandwatersedge/7.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/0.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/1.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/2.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/3.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/4.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/5.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/6.4bpp data/tilesets/primary/general/anim/water_current_landwatersedge/7.4bpp data/tilesets/primary/general/palettes/00.gbapal data/tilesets/primary/general/palettes/01.gbapal data/tilesets/primary/general/palettes/02.gbapal data/tilesets/primary/general/palettes/03.gbapal data/tilesets/primary/general/palettes/04.gbapal data/tilesets/primary/general/palettes/05.gbapal data/tilesets/primary/general/palettes/06.gbapal data/tilesets/primary/general/palettes/07.gbapal data/tilesets/primary/general/palettes/08.gbapal data/tilesets/primary/general/palettes/09.gbapal data/tilesets/primary/general/palettes/10.gbapal data/tilesets/primary/general/palettes/11.gbapal data/tilesets/primary/general/palettes/12.gbapal data/tilesets/primary/general/palettes/13.gbapal data/tilesets/primary/general/palettes/14.gbapal data/tilesets/primary/general/palettes/15.gbapal data/tilesets/primary/general/tiles.4bpp.lz data/tilesets/secondary/berry_forest/palettes/00.gbapal data/tilesets/secondary/berry_forest/palettes/01.gbapal data/tilesets/secondary/berry_forest/palettes/02.gbapal data/tilesets/secondary/berry_forest/palettes/03.gbapal data/tilesets/secondary/berry_forest/palettes/04.gbapal data/tilesets/secondary/berry_forest/palettes/05.gbapal data/tilesets/secondary/berry_forest/palettes/06.gbapal data/tilesets/secondary/berry_forest/palettes/07.gbapal data/tilesets/secondary/berry_forest/palettes/08.gbapal data/tilesets/secondary/berry_forest/palettes/09.gbapal data/tilesets/secondary/berry_forest/palettes/10.gbapal data/tilesets/secondary/berry_forest/palettes/11.gbapal data/tilesets/secondary/berry_forest/palettes/12.gbapal data/tilesets/secondary/berry_forest/palettes/13.gbapal data/tilesets/secondary/berry_forest/palettes/14.gbapal data/tilesets/secondary/berry_forest/palettes/15.gbapal data/tilesets/secondary/berry_forest/tiles.4bpp.lz data/tilesets/secondary/bike_shop/palettes/00.gbapal data/tilesets/secondary/bike_shop/palettes/01.gbapal data/tilesets/secondary/bike_shop/palettes/02.gbapal data/tilesets/secondary/bike_shop/palettes/03.gbapal data/tilesets/secondary/bike_shop/palettes/04.gbapal data/tilesets/secondary/bike_shop/palettes/05.gbapal data/tilesets/secondary/bike_shop/palettes/06.gbapal data/tilesets/secondary/bike_shop/palettes/07.gbapal data/tilesets/secondary/bike_shop/palettes/08.gbapal data/tilesets/secondary/bike_shop/palettes/09.gbapal data/tilesets/secondary/bike_shop/palettes/10.gbapal data/tilesets/secondary/bike_shop/palettes/11.gbapal data/tilesets/secondary/bike_shop/palettes/12.gbapal data/tilesets/secondary/bike_shop/palettes/13.gbapal data/tilesets/secondary/bike_shop/palettes/14.gbapal data/tilesets/secondary/bike_shop/palettes/15.gbapal data/tilesets/secondary/bike_shop/tiles.4bpp.lz data/tilesets/secondary/burgled_house/palettes/00.gbapal data/tilesets/secondary/burgled_house/palettes/01.gbapal data/tilesets/secondary/burgled_house/palettes/02.gbapal data/tilesets/secondary/burgled_house/palettes/03.gbapal data/tilesets/secondary/burgled_house/palettes/04.gbapal data/tilesets/secondary/burgled_house/palettes/05.gbapal data/tilesets/secondary/burgled_house/palettes/06.gbapal data/tilesets/secondary/burgled_house/palettes/07.gbapal data/tilesets/secondary/burgled_house/palettes/08.gbapal data/tilesets/secondary/burgled_house/palettes/09.gbapal data/tilesets/secondary/burgled_house/palettes/10.gbapal data/tilesets/secondary/burgled_house/palettes/11.gbapal data/tilesets/secondary/burgled_house/palettes/12.gbapal data/tilesets/secondary/burgled_house/palettes/13.gbapal data/tilesets/secondary/burgled_house/palettes/14.gbapal data/tilesets/secondary/burgled_house/palettes/15.gbapal data/tilesets/secondary/burgled_house/tiles.4bpp.lz data/tilesets/secondary/cable_club/palettes/00.gbapal data/tilesets/secondary/cable_club/palettes/01.gbapal data/tilesets/secondary/cable_club/palettes/02.gbapal data/tilesets/secondary/cable_club/palettes/03.gbapal data/tilesets/secondary/cable_club/palettes/04.gbapal data/tilesets/secondary/cable_club/palettes/05.gbapal data/tilesets/secondary/cable_club/palettes/06.gbapal data/tilesets/secondary/cable_club/palettes/07.gbapal data/tilesets/secondary/cable_club/palettes/08.gbapal data/tilesets/secondary/cable_club/palettes/09.gbapal data/tilesets/secondary/cable_club/palettes/10.gbapal data/tilesets/secondary/cable_club/palettes/11.gbapal data/tilesets/secondary/cable_club/palettes/12.gbapal data/tilesets/secondary/cable_club/palettes/13.gbapal data/tilesets/secondary/cable_club/palettes/14.gbapal data/tilesets/secondary/cable_club/palettes/15.gbapal data/tilesets/secondary/cable_club/tiles.4bpp data/tilesets/secondary/cave/palettes/00.gbapal data/tilesets/secondary/cave/palettes/01.gbapal data/tilesets/secondary/cave/palettes/02.gbapal data/tilesets/secondary/cave/palettes/03.gbapal data/tilesets/secondary/cave/palettes/04.gbapal data/tilesets/secondary/cave/palettes/05.gbapal data/tilesets/secondary/cave/palettes/06.gbapal data/tilesets/secondary/cave/palettes/07.gbapal data/tilesets/secondary/cave/palettes/08.gbapal data/tilesets/secondary/cave/palettes/09.gbapal data/tilesets/secondary/cave/palettes/10.gbapal data/tilesets/secondary/cave/palettes/11.gbapal data/tilesets/secondary/cave/palettes/12.gbapal data/tilesets/secondary/cave/palettes/13.gbapal data/tilesets/secondary/cave/palettes/14.gbapal data/tilesets/secondary/cave/palettes/15.gbapal data/tilesets/secondary/cave/tiles.4bpp.lz data/tilesets/secondary/celadon_city/anim/fountain/0.4bpp data/tilesets/secondary/celadon_city/anim/fountain/1.4bpp data/tilesets/secondary/celadon_city/anim/fountain/2.4bpp data/tilesets/secondary/celadon_city/anim/fountain/3.4bpp data/tilesets/secondary/celadon_city/anim/fountain/4.4bpp data/tilesets/secondary/celadon_city/palettes/00.gbapal data/tilesets/secondary/celadon_city/palettes/01.gbapal data/tilesets/secondary/celadon_city/palettes/02.gbapal data/tilesets/secondary/celadon_city/palettes/03.gbapal data/tilesets/secondary/celadon_city/palettes/04.gbapal data/tilesets/secondary/celadon_city/palettes/05.gbapal data/tilesets/secondary/celadon_city/palettes/06.gbapal data/tilesets/secondary/celadon_city/palettes/07.gbapal data/tilesets/secondary/celadon_city/palettes/08.gbapal data/tilesets/secondary/celadon_city/palettes/09.gbapal data/tilesets/secondary/celadon_city/palettes/10.gbapal data/tilesets/secondary/celadon_city/palettes/11.gbapal data/tilesets/secondary/celadon_city/palettes/12.gbapal data/tilesets/secondary/celadon_city/palettes/13.gbapal data/tilesets/secondary/celadon_city/palettes/14.gbapal data/tilesets/secondary/celadon_city/palettes/15.gbapal data/tilesets/secondary/celadon_city/tiles.4bpp.lz data/tilesets/secondary/celadon_gym/anim/flowers/0.4bpp data/tilesets/secondary/celadon_gym/anim/flowers/1.4bpp data/tilesets/secondary/celadon_gym/anim/flowers/2.4bpp data/tilesets/secondary/celadon_gym/palettes/00.gbapal data/tilesets/secondary/celadon_gym/palettes/01.gbapal data/tilesets/secondary/celadon_gym/palettes/02.gbapal data/tilesets/secondary/celadon_gym/palettes/03.gbapal data/tilesets/secondary/celadon_gym/palettes/04.gbapal data/tilesets/secondary/celadon_gym/palettes/05.gbapal data/tilesets/secondary/celadon_gym/palettes/06.gbapal data/tilesets/secondary/celadon_gym/palettes/07.gbapal data/tilesets/secondary/celadon_gym/palettes/08.gbapal data/tilesets/secondary/celadon_gym/palettes/09.gbapal data/tilesets/secondary/celadon_gym/palettes/10.gbapal data/tilesets/secondary/celadon_gym/palettes/11.gbapal data/tilesets/secondary/celadon_gym/palettes/12.gbapal data/tilesets/secondary/celadon_gym/palettes/13.gbapal data/tilesets/secondary/celadon_gym/palettes/14.gbapal data/tilesets/secondary/celadon_gym/palettes/15.gbapal data/tilesets/secondary/celadon_gym/tiles.4bpp.lz data/tilesets/secondary/cerulean_cave/palettes/00.gbapal data/tilesets/secondary/cerulean_cave/palettes/01.gbapal data/tilesets/secondary/cerulean_cave/palettes/02.gbapal data/tilesets/secondary/cerulean_cave/palettes/03.gbapal data/tilesets/secondary/cerulean_cave/palettes/04.gbapal data/tilesets/secondary/cerulean_cave/palettes/05.gbapal data/tilesets/secondary/cerulean_cave/palettes/06.gbapal data/tilesets/secondary/cerulean_cave/palettes/07.gbapal data/tilesets/secondary/cerulean_cave/palettes/08.gbapal data/tilesets/secondary/cerulean_cave/palettes/09.gbapal data/tilesets/secondary/cerulean_cave/palettes/10.gbapal data/tilesets/secondary/cerulean_cave/palettes/11.gbapal data/tilesets/secondary/cerulean_cave/palettes/12.gbapal data/tilesets/secondary/cerulean_cave/palettes/13.gbapal data/tilesets/secondary/cerulean_cave/palettes/14.gbapal data/tilesets/secondary/cerulean_cave/palettes/15.gbapal data/tilesets/secondary/cerulean_cave/tiles.4bpp.lz data/tilesets/secondary/cerulean_city/palettes/00.gbapal data/tilesets/secondary/cerulean_city/palettes/01.gbapal data/tilesets/secondary/cerulean_city/palettes/02.gbapal data/tilesets/secondary/cerulean_city/palettes/03.gbapal data/tilesets/secondary/cerulean_city/palettes/04.gbapal data/tilesets/secondary/cerulean_city/palettes/05.gbapal data/tilesets/secondary/cerulean_city/palettes/06.gbapal data/tilesets/secondary/cerulean_city/palettes/07.gbapal data/tilesets/secondary/cerulean_city/palettes/08.gbapal data/tilesets/secondary/cerulean_city/palettes/09.gbapal data/tilesets/secondary/cerulean_city/palettes/10.gbapal data/tilesets/secondary/cerulean_city/palettes/11.gbapal data/tilesets/secondary/cerulean_city/palettes/12.gbapal data/tilesets/secondary/cerulean_city/palettes/13.gbapal data/tilesets/secondary/cerulean_city/palettes/14.gbapal data/tilesets/secondary/cerulean_city/palettes/15.gbapal data/tilesets/secondary/cerulean_city/tiles.4bpp.lz data/tilesets/secondary/cerulean_gym/palettes/00.gbapal data/tilesets/secondary/cerulean_gym/palettes/01.gbapal data/tilesets/secondary/cerulean_gym/palettes/02.gbapal data/tilesets/secondary/cerulean_gym/palettes/03.gbapal data/tilesets/secondary/cerulean_gym/palettes/04.gbapal data/tilesets/secondary/cerulean_gym/palettes/05.gbapal data/tilesets/secondary/cerulean_gym/palettes/06.gbapal data/tilesets/secondary/cerulean_gym/palettes/07.gbapal data/tilesets/secondary/cerulean_gym/palettes/08.gbapal data/tilesets/secondary/cerulean_gym/palettes/09.gbapal data/tilesets/secondary/cerulean_gym/palettes/10.gbapal data/tilesets/secondary/cerulean_gym/palettes/11.gbapal data/tilesets/secondary/cerulean_gym/palettes/12.gbapal data/tilesets/secondary/cerulean_gym/palettes/13.gbapal data/tilesets/secondary/cerulean_gym/palettes/14.gbapal data/tilesets/secondary/cerulean_gym/palettes/15.gbapal data/tilesets/secondary/cerulean_gym/tiles.4bpp.lz data/tilesets/secondary/cinnabar_gym/palettes/00.gbapal data/tilesets/secondary/cinnabar_gym/palettes/01.gbapal data/tilesets/secondary/cinnabar_gym/palettes/02.gbapal data/tilesets/secondary/cinnabar_gym/palettes/03.gbapal data/tilesets/secondary/cinnabar_gym/palettes/04.gbapal data/tilesets/secondary/cinnabar_gym/palettes/05.gbapal data/tilesets/secondary/cinnabar_gym/palettes/06.gbapal data/tilesets/secondary/cinnabar_gym/palettes/07.gbapal data/tilesets/secondary/cinnabar_gym/palettes/08.gbapal data/tilesets/secondary/cinnabar_gym/palettes/09.gbapal data/tilesets/secondary/cinnabar_gym/palettes/10.gbapal data/tilesets/secondary/cinnabar_gym/palettes/11.gbapal data/tilesets/secondary/cinnabar_gym/palettes/12.gbapal data/tilesets/secondary/cinnabar_gym/palettes/13.gbapal data/tilesets/secondary/cinnabar_gym/palettes/14.gbapal data/tilesets/secondary/cinnabar_gym/palettes/15.gbapal data/tilesets/secondary/cinnabar_gym/tiles.4bpp.lz data/tilesets/secondary/cinnabar_island/palettes/00.gbapal data/tilesets/secondary/cinnabar_island/palettes/01.gbapal data/tilesets/secondary/cinnabar_island/palettes/02.gbapal data/tilesets/secondary/cinnabar_island/palettes/03.gbapal data/tilesets/secondary/cinnabar_island/palettes/04.gbapal data/tilesets/secondary/cinnabar_island/palettes/05.gbapal data/tilesets/secondary/cinnabar_island/palettes/06.gbapal data/tilesets/secondary/cinnabar_island/palettes/07.gbapal data/tilesets/secondary/cinnabar_island/palettes/08.gbapal data/tilesets/secondary/cinnabar_island/palettes/09.gbapal data/tilesets/secondary/cinnabar_island/palettes/10.gbapal data/tilesets/secondary/cinnabar_island/palettes/11.gbapal data/tilesets/secondary/cinnabar_island/palettes/12.gbapal data/tilesets/secondary/cinnabar_island/palettes/13.gbapal data/tilesets/secondary/cinnabar_island/palettes/14.gbapal data/tilesets/secondary/cinnabar_island/palettes/15.gbapal data/tilesets/secondary/cinnabar_island/tiles.4bpp.lz data/tilesets/secondary/condominiums/palettes/00.gbapal data/tilesets/secondary/condominiums/palettes/01.gbapal data/tilesets/secondary/condominiums/palettes/02.gbapal data/tilesets/secondary/condominiums/palettes/03.gbapal data/tilesets/secondary/condominiums/palettes/04.gbapal data/tilesets/secondary/condominiums/palettes/05.gbapal data/tilesets/secondary/condominiums/palettes/06.gbapal data/tilesets/secondary/condominiums/palettes/07.gbapal data/tilesets/secondary/condominiums/palettes/08.gbapal data/tilesets/secondary/condominiums/palettes/09.gbapal data/tilesets/secondary/condominiums/palettes/10.gbapal data/tilesets/secondary/condominiums/palettes/11.gbapal data/tilesets/secondary/condominiums/palettes/12.gbapal data/tilesets/secondary/condominiums/palettes/13.gbapal data/tilesets/secondary/condominiums/palettes/14.gbapal data/tilesets/secondary/condominiums/palettes/15.gbapal data/tilesets/secondary/condominiums/tiles.4bpp.lz data/tilesets/secondary/department_store/palettes/00.gbapal data/tilesets/secondary/department_store/palettes/01.gbapal data/tilesets/secondary/department_store/palettes/02.gbapal data/tilesets/secondary/department_store/palettes/03.gbapal data/tilesets/secondary/department_store/palettes/04.gbapal data/tilesets/secondary/department_store/palettes/05.gbapal data/tilesets/secondary/department_store/palettes/06.gbapal data/tilesets/secondary/department_store/palettes/07.gbapal data/tilesets/secondary/department_store/palettes/08.gbapal data/tilesets/secondary/department_store/palettes/09.gbapal data/tilesets/secondary/department_store/palettes/10.gbapal data/tilesets/secondary/department_store/palettes/11.gbapal data/tilesets/secondary/department_store/palettes/12.gbapal data/tilesets/secondary/department_store/palettes/13.gbapal data/tilesets/secondary/department_store/palettes/14.gbapal data/tilesets/secondary/department_store/palettes/15.gbapal data/tilesets/secondary/department_store/tiles.4bpp.lz data/tilesets/secondary/digletts_cave/palettes/00.gbapal data/tilesets/secondary/digletts_cave/palettes/01.gbapal data/tilesets/secondary/digletts_cave/palettes/02.gbapal data/tilesets/secondary/digletts_cave/palettes/03.gbapal data/tilesets/secondary/digletts_cave/palettes/04.gbapal data/tilesets/secondary/digletts_cave/palettes/05.gbapal data/tilesets/secondary/digletts_cave/palettes/06.gbapal data/tilesets/secondary/digletts_cave/palettes/07.gbapal data/tilesets/secondary/digletts_cave/palettes/08.gbapal data/tilesets/secondary/digletts_cave/palettes/09.gbapal data/tilesets/secondary/digletts_cave/palettes/10.gbapal data/tilesets/secondary/digletts_cave/palettes/11.gbapal data/tilesets/secondary/digletts_cave/palettes/12.gbapal data/tilesets/secondary/digletts_cave/palettes/13.gbapal data/tilesets/secondary/digletts_cave/palettes/14.gbapal data/tilesets/secondary/digletts_cave/palettes/15.gbapal data/tilesets/secondary/digletts_cave/tiles.4bpp.lz data/tilesets/secondary/dummy_1/palettes/00.gbapal data/tilesets/secondary/dummy_1/palettes/01.gbapal data/tilesets/secondary/dummy_1/palettes/02.gbapal data/tilesets/secondary/dummy_1/palettes/03.gbapal data/tilesets/secondary/dummy_1/palettes/04.gbapal data/tilesets/secondary/dummy_1/palettes/05.gbapal data/tilesets/secondary/dummy_1/palettes/06.gbapal data/tilesets/secondary/dummy_1/palettes/07.gbapal data/tilesets/secondary/dummy_1/palettes/08.gbapal data/tilesets/secondary/dummy_1/palettes/09.gbapal data/tilesets/secondary/dummy_1/palettes/10.gbapal data/tilesets/secondary/dummy_1/palettes/11.gbapal data/tilesets/secondary/dummy_1/palettes/12.gbapal data/tilesets/secondary/dummy_1/palettes/13.gbapal data/tilesets/secondary/dummy_1/palettes/14.gbapal data/tilesets/secondary/dummy_1/palettes/15.gbapal data/tilesets/secondary/dummy_1/tiles.4bpp.lz data/tilesets/secondary/dummy_2/palettes/00.gbapal data/tilesets/secondary/dummy_2/palettes/01.gbapal data/tilesets/secondary/dummy_2/palettes/02.gbapal data/tilesets/secondary/dummy_2/palettes/03.gbapal data/tilesets/secondary/dummy_2/palettes/04.gbapal data/tilesets/secondary/dummy_2/palettes/05.gbapal data/tilesets/secondary/dummy_2/palettes/06.gbapal data/tilesets/secondary/dummy_2/palettes/07.gbapal data/tilesets/secondary/dummy_2/palettes/08.gbapal data/tilesets/secondary/dummy_2/palettes/09.gbapal data/tilesets/secondary/dummy_2/palettes/10.gbapal data/tilesets/secondary/dummy_2/palettes/11.gbapal data/tilesets/secondary/dummy_2/palettes/12.gbapal data/tilesets/secondary/dummy_2/palettes/13.gbapal data/tilesets/secondary/dummy_2/palettes/14.gbapal data/tilesets/secondary/dummy_2/palettes/15.gbapal data/tilesets/secondary/dummy_2/tiles.4bpp.lz data/tilesets/secondary/dummy_3/palettes/00.gbapal data/tilesets/secondary/dummy_3/palettes/01.gbapal data/tilesets/secondary/dummy_3/palettes/02.gbapal data/tilesets/secondary/dummy_3/palettes/03.gbapal data/tilesets/secondary/dummy_3/palettes/04.gbapal data/tilesets/secondary/dummy_3/palettes/05.gbapal data/tilesets/secondary/dummy_3/palettes/06.gbapal data/tilesets/secondary/dummy_3/palettes/07.gbapal data/tilesets/secondary/dummy_3/palettes/08.gbapal data/tilesets/secondary/dummy_3/palettes/09.gbapal data/tilesets/secondary/dummy_3/palettes/10.gbapal data/tilesets/secondary/dummy_3/palettes/11.gbapal data/tilesets/secondary/dummy_3/palettes/12.gbapal data/tilesets/secondary/dummy_3/palettes/13.gbapal data/tilesets/secondary/dummy_3/palettes/14.gbapal data/tilesets/secondary/dummy_3/palettes/15.gbapal data/tilesets/secondary/dummy_3/tiles.4bpp.lz data/tilesets/secondary/dummy_4/palettes/00.gbapal data/tilesets/secondary/dummy_4/palettes/01.gbapal data/tilesets/secondary/dummy_4/palettes/02.gbapal data/tilesets/secondary/dummy_4/palettes/03.gbapal data/tilesets/secondary/dummy_4/palettes/04.gbapal data/tilesets/secondary/dummy_4/palettes/05.gbapal data/tilesets/secondary/dummy_4/palettes/06.gbapal data/tilesets/secondary/dummy_4/palettes/07.gbapal data/tilesets/secondary/dummy_4/palettes/08.gbapal data/tilesets/secondary/dummy_4/palettes/09.gbapal data/tilesets/secondary/dummy_4/palettes/10.gbapal data/tilesets/secondary/dummy_4/palettes/11.gbapal data/tilesets/secondary/dummy_4/palettes/12.gbapal data/tilesets/secondary/dummy_4/palettes/13.gbapal data/tilesets/secondary/dummy_4/palettes/14.gbapal data/tilesets/secondary/dummy_4/palettes/15.gbapal data/tilesets/secondary/dummy_4/tiles.4bpp.lz data/tilesets/secondary/fan_club_daycare/palettes/00.gbapal data/tilesets/secondary/fan_club_daycare/palettes/01.gbapal data/tilesets/secondary/fan_club_daycare/palettes/02.gbapal data/tilesets/secondary/fan_club_daycare/palettes/03.gbapal data/tilesets/secondary/fan_club_daycare/palettes/04.gbapal data/tilesets/secondary/fan_club_daycare/palettes/05.gbapal data/tilesets/secondary/fan_club_daycare/palettes/06.gbapal data/tilesets/secondary/fan_club_daycare/palettes/07.gbapal data/tilesets/secondary/fan_club_daycare/palettes/08.gbapal data/tilesets/secondary/fan_club_daycare/palettes/09.gbapal data/tilesets/secondary/fan_club_daycare/palettes/10.gbapal data/tilesets/secondary/fan_club_daycare/palettes/11.gbapal data/tilesets/secondary/fan_club_daycare/palettes/12.gbapal data/tilesets/secondary/fan_club_daycare/palettes/13.gbapal data/tilesets/secondary/fan_club_daycare/palettes/14.gbapal data/tilesets/secondary/fan_club_daycare/palettes/15.gbapal data/tilesets/secondary/fan_club_daycare/tiles.4bpp.lz data/tilesets/secondary/fuchsia_city/palettes/00.gbapal data/tilesets/secondary/fuchsia_city/palettes/01.gbapal data/tilesets/secondary/fuchsia_city/palettes/02.gbapal data/tilesets/secondary/fuchsia_city/palettes/03.gbapal data/tilesets/secondary/fuchsia_city/palettes/04.gbapal data/tilesets/secondary/fuchsia_city/palettes/05.gbapal data/tilesets/secondary/fuchsia_city/palettes/06.gbapal data/tilesets/secondary/fuchsia_city/palettes/07.gbapal data/tilesets/secondary/fuchsia_city/palettes/08.gbapal data/tilesets/secondary/fuchsia_city/palettes/09.gbapal data/tilesets/secondary/fuchsia_city/palettes/10.gbapal data/tilesets/secondary/fuchsia_city/palettes/11.gbapal data/tilesets/secondary/fuchsia_city/palettes/12.gbapal data/tilesets/secondary/fuchsia_city/palettes/13.gbapal data/tilesets/secondary/fuchsia_city/palettes/14.gbapal data/tilesets/secondary/fuchsia_city/palettes/15.gbapal data/tilesets/secondary/fuchsia_city/tiles.4bpp.lz data/tilesets/secondary/fuchsia_gym/palettes/00.gbapal data/tilesets/secondary/fuchsia_gym/palettes/01.gbapal data/tilesets/secondary/fuchsia_gym/palettes/02.gbapal data/tilesets/secondary/fuchsia_gym/palettes/03.gbapal data/tilesets/secondary/fuchsia_gym/palettes/04.gbapal data/tilesets/secondary/fuchsia_gym/palettes/05.gbapal data/tilesets/secondary/fuchsia_gym/palettes/06.gbapal data/tilesets/secondary/fuchsia_gym/palettes/07.gbapal data/tilesets/secondary/fuchsia_gym/palettes/08.gbapal data/tilesets/secondary/fuchsia_gym/palettes/09.gbapal data/tilesets/secondary/fuchsia_gym/palettes/10.gbapal data/tilesets/secondary/fuchsia_gym/palettes/11.gbapal data/tilesets/secondary/fuchsia_gym/palettes/12.gbapal data/tilesets/secondary/fuchsia_gym/palettes/13.gbapal data/tilesets/secondary/fuchsia_gym/palettes/14.gbapal data/tilesets/secondary/fuchsia_gym/palettes/15.gbapal data/tilesets/secondary/fuchsia_gym/tiles.4bpp.lz data/tilesets/secondary/game_corner/palettes/00.gbapal data/tilesets/secondary/game_corner/palettes/01.gbapal data/tilesets/secondary/game_corner/palettes/02.gbapal data/tilesets/secondary/game_corner/palettes/03.gbapal data/tilesets/secondary/game_corner/palettes/04.gbapal data/tilesets/secondary/game_corner/palettes/05.gbapal data/tilesets/secondary/game_corner/palettes/06.gbapal data/tilesets/secondary/game_corner/palettes/07.gbapal data/tilesets/secondary/game_corner/palettes/08.gbapal data/tilesets/secondary/game_corner/palettes/09.gbapal data/tilesets/secondary/game_corner/palettes/10.gbapal data/tilesets/secondary/game_corner/palettes/11.gbapal data/tilesets/secondary/game_corner/palettes/12.gbapal data/tilesets/secondary/game_corner/palettes/13.gbapal data/tilesets/secondary/game_corner/palettes/14.gbapal data/tilesets/secondary/game_corner/palettes/15.gbapal data/tilesets/secondary/game_corner/tiles.4bpp.lz data/tilesets/secondary/generic_building_1/palettes/00.gbapal data/tilesets/secondary/generic_building_1/palettes/01.gbapal data/tilesets/secondary/generic_building_1/palettes/02.gbapal data/tilesets/secondary/generic_building_1/palettes/03.gbapal data/tilesets/secondary/generic_building_1/palettes/04.gbapal data/tilesets/secondary/generic_building_1/palettes/05.gbapal data/tilesets/secondary/generic_building_1/palettes/06.gbapal data/tilesets/secondary/generic_building_1/palettes/07.gbapal data/tilesets/secondary/generic_building_1/palettes/08.gbapal data/tilesets/secondary/generic_building_1/palettes/09.gbapal data/tilesets/secondary/generic_building_1/palettes/10.gbapal data/tilesets/secondary/generic_building_1/palettes/11.gbapal data/tilesets/secondary/generic_building_1/palettes/12.gbapal data/tilesets/secondary/generic_building_1/palettes/13.gbapal data/tilesets/secondary/generic_building_1/palettes/14.gbapal data/tilesets/secondary/generic_building_1/palettes/15.gbapal data/tilesets/secondary/generic_building_1/tiles.4bpp.lz data/tilesets/secondary/generic_building_2/palettes/00.gbapal data/tilesets/secondary/generic_building_2/palettes/01.gbapal data/tilesets/secondary/generic_building_2/palettes/02.gbapal data/tilesets/secondary/generic_building_2/palettes/03.gbapal data/tilesets/secondary/generic_building_2/palettes/04.gbapal data/tilesets/secondary/generic_building_2/palettes/05.gbapal data/tilesets/secondary/generic_building_2/palettes/06.gbapal data/tilesets/secondary/generic_building_2/palettes/07.gbapal data/tilesets/secondary/generic_building_2/palettes/08.gbapal data/tilesets/secondary/generic_building_2/palettes/09.gbapal data/tilesets/secondary/generic_building_2/palettes/10.gbapal data/tilesets/secondary/generic_building_2/palettes/11.gbapal data/tilesets/secondary/generic_building_2/palettes/12.gbapal data/tilesets/secondary/generic_building_2/palettes/13.gbapal data/tilesets/secondary/generic_building_2/palettes/14.gbapal data/tilesets/secondary/generic_building_2/palettes/15.gbapal data/tilesets/secondary/generic_building_2/tiles.4bpp.lz data/tilesets/secondary/hall_of_fame/palettes/00.gbapal data/tilesets/secondary/hall_of_fame/palettes/01.gbapal data/tilesets/secondary/hall_of_fame/palettes/02.gbapal data/tilesets/secondary/hall_of_fame/palettes/03.gbapal data/tilesets/secondary/hall_of_fame/palettes/04.gbapal data/tilesets/secondary/hall_of_fame/palettes/05.gbapal data/tilesets/secondary/hall_of_fame/palettes/06.gbapal data/tilesets/secondary/hall_of_fame/palettes/07.gbapal data/tilesets/secondary/hall_of_fame/palettes/08.gbapal data/tilesets/secondary/hall_of_fame/palettes/09.gbapal data/tilesets/secondary/hall_of_fame/palettes/10.gbapal data/tilesets/secondary/hall_of_fame/palettes/11.gbapal data/tilesets/secondary/hall_of_fame/palettes/12.gbapal data/tilesets/secondary/hall_of_fame/palettes/13.gbapal data/tilesets/secondary/hall_of_fame/palettes/14.gbapal data/tilesets/secondary/hall_of_fame/palettes/15.gbapal data/tilesets/secondary/hall_of_fame/tiles.4bpp.lz data/tilesets/secondary/hoenn_building/palettes/00.gbapal data/tilesets/secondary/hoenn_building/palettes/01.gbapal data/tilesets/secondary/hoenn_building/palettes/02.gbapal data/tilesets/secondary/hoenn_building/palettes/03.gbapal data/tilesets/secondary/hoenn_building/palettes/04.gbapal data/tilesets/secondary/hoenn_building/palettes/05.gbapal data/tilesets/secondary/hoenn_building/palettes/06.gbapal data/tilesets/secondary/hoenn_building/palettes/07.gbapal data/tilesets/secondary/hoenn_building/palettes/08.gbapal data/tilesets/secondary/hoenn_building/palettes/09.gbapal data/tilesets/secondary/hoenn_building/palettes/10.gbapal data/tilesets/secondary/hoenn_building/palettes/11.gbapal data/tilesets/secondary/hoenn_building/palettes/12.gbapal data/tilesets/secondary/hoenn_building/palettes/13.gbapal data/tilesets/secondary/hoenn_building/palettes/14.gbapal data/tilesets/secondary/hoenn_building/palettes/15.gbapal data/tilesets/secondary/hoenn_building/tiles.4bpp.lz data/tilesets/secondary/indigo_plateau/palettes/00.gbapal data/tilesets/secondary/indigo_plateau/palettes/01.gbapal data/tilesets/secondary/indigo_plateau/palettes/02.gbapal data/tilesets/secondary/indigo_plateau/palettes/03.gbapal data/tilesets/secondary/indigo_plateau/palettes/04.gbapal data/tilesets/secondary/indigo_plateau/palettes/05.gbapal data/tilesets/secondary/indigo_plateau/palettes/06.gbapal data/tilesets/secondary/indigo_plateau/palettes/07.gbapal data/tilesets/secondary/indigo_plateau/palettes/08.gbapal data/tilesets/secondary/indigo_plateau/palettes/09.gbapal data/tilesets/secondary/indigo_plateau/palettes/10.gbapal data/tilesets/secondary/indigo_plateau/palettes/11.gbapal data/tilesets/secondary/indigo_plateau/palettes/12.gbapal data/tilesets/secondary/indigo_plateau/palettes/13.gbapal data/tilesets/secondary/indigo_plateau/palettes/14.gbapal data/tilesets/secondary/indigo_plateau/palettes/15.gbapal data/tilesets/secondary/indigo_plateau/tiles.4bpp.lz data/tilesets/secondary/island_harbor/palettes/00.gbapal data/tilesets/secondary/island_harbor/palettes/01.gbapal data/tilesets/secondary/island_harbor/palettes/02.gbapal data/tilesets/secondary/island_harbor/palettes/03.gbapal data/tilesets/secondary/island_harbor/palettes/04.gbapal data/tilesets/secondary/island_harbor/palettes/05.gbapal data/tilesets/secondary/island_harbor/palettes/06.gbapal data/tilesets/secondary/island_harbor/palettes/07.gbapal data/tilesets/secondary/island_harbor/palettes/08.gbapal data/tilesets/secondary/island_harbor/palettes/09.gbapal data/tilesets/secondary/island_harbor/palettes/10.gbapal data/tilesets/secondary/island_harbor/palettes/11.gbapal data/tilesets/secondary/island_harbor/palettes/12.gbapal data/tilesets/secondary/island_harbor/palettes/13.gbapal data/tilesets/secondary/island_harbor/palettes/14.gbapal data/tilesets/secondary/island_harbor/palettes/15.gbapal data/tilesets/secondary/island_harbor/tiles.4bpp.lz data/tilesets/secondary/lab/palettes/00.gbapal data/tilesets/secondary/lab/palettes/01.gbapal data/tilesets/secondary/lab/palettes/02.gbapal data/tilesets/secondary/lab/palettes/03.gbapal data/tilesets/secondary/lab/palettes/04.gbapal data/tilesets/secondary/lab/palettes/05.gbapal data/tilesets/secondary/lab/palettes/06.gbapal data/tilesets/secondary/lab/palettes/07.gbapal data/tilesets/secondary/lab/palettes/08.gbapal data/tilesets/secondary/lab/palettes/09.gbapal data/tilesets/secondary/lab/palettes/10.gbapal data/tilesets/secondary/lab/palettes/11.gbapal data/tilesets/secondary/lab/palettes/12.gbapal data/tilesets/secondary/lab/palettes/13.gbapal data/tilesets/secondary/lab/palettes/14.gbapal data/tilesets/secondary/lab/palettes/15.gbapal data/tilesets/secondary/lab/tiles.4bpp.lz data/tilesets/secondary/lavender_town/palettes/00.gbapal data/tilesets/secondary/lavender_town/palettes/01.gbapal data/tilesets/secondary/lavender_town/palettes/02.gbapal data/tilesets/secondary/lavender_town/palettes/03.gbapal data/tilesets/secondary/lavender_town/palettes/04.gbapal data/tilesets/secondary/lavender_town/palettes/05.gbapal data/tilesets/secondary/lavender_town/palettes/06.gbapal data/tilesets/secondary/lavender_town/palettes/07.gbapal data/tilesets/secondary/lavender_town/palettes/08.gbapal data/tilesets/secondary/lavender_town/palettes/09.gbapal data/tilesets/secondary/lavender_town/palettes/10.gbapal data/tilesets/secondary/lavender_town/palettes/11.gbapal data/tilesets/secondary/lavender_town/palettes/12.gbapal data/tilesets/secondary/lavender_town/palettes/13.gbapal data/tilesets/secondary/lavender_town/palettes/14.gbapal data/tilesets/secondary/lavender_town/palettes/15.gbapal data/tilesets/secondary/lavender_town/tiles.4bpp.lz data/tilesets/secondary/mart/palettes/00.gbapal data/tilesets/secondary/mart/palettes/01.gbapal data/tilesets/secondary/mart/palettes/02.gbapal data/tilesets/secondary/mart/palettes/03.gbapal data/tilesets/secondary/mart/palettes/04.gbapal data/tilesets/secondary/mart/palettes/05.gbapal data/tilesets/secondary/mart/palettes/06.gbapal data/tilesets/secondary/mart/palettes/07.gbapal data/tilesets/secondary/mart/palettes/08.gbapal data/tilesets/secondary/mart/palettes/09.gbapal data/tilesets/secondary/mart/palettes/10.gbapal data/tilesets/secondary/mart/palettes/11.gbapal data/tilesets/secondary/mart/palettes/12.gbapal data/tilesets/secondary/mart/palettes/13.gbapal data/tilesets/secondary/mart/palettes/14.gbapal data/tilesets/secondary/mart/palettes/15.gbapal data/tilesets/secondary/mart/tiles.4bpp.lz data/tilesets/secondary/mt_ember/anim/steam/0.4bpp data/tilesets/secondary/mt_ember/anim/steam/1.4bpp data/tilesets/secondary/mt_ember/anim/steam/2.4bpp data/tilesets/secondary/mt_ember/anim/steam/3.4bpp data/tilesets/secondary/mt_ember/palettes/00.gbapal data/tilesets/secondary/mt_ember/palettes/01.gbapal data/tilesets/secondary/mt_ember/palettes/02.gbapal data/tilesets/secondary/mt_ember/palettes/03.gbapal data/tilesets/secondary/mt_ember/palettes/04.gbapal data/tilesets/secondary/mt_ember/palettes/05.gbapal data/tilesets/secondary/mt_ember/palettes/06.gbapal data/tilesets/secondary/mt_ember/palettes/07.gbapal data/tilesets/secondary/mt_ember/palettes/08.gbapal data/tilesets/secondary/mt_ember/palettes/09.gbapal data/tilesets/secondary/mt_ember/palettes/10.gbapal data/tilesets/secondary/mt_ember/palettes/11.gbapal data/tilesets/secondary/mt_ember/palettes/12.gbapal data/tilesets/secondary/mt_ember/palettes/13.gbapal data/tilesets/secondary/mt_ember/palettes/14.gbapal data/tilesets/secondary/mt_ember/palettes/15.gbapal data/tilesets/secondary/mt_ember/tiles.4bpp.lz data/tilesets/secondary/museum/palettes/00.gbapal data/tilesets/secondary/museum/palettes/01.gbapal data/tilesets/secondary/museum/palettes/02.gbapal data/tilesets/secondary/museum/palettes/03.gbapal data/tilesets/secondary/museum/palettes/04.gbapal data/tilesets/secondary/museum/palettes/05.gbapal data/tilesets/secondary/museum/palettes/06.gbapal data/tilesets/secondary/museum/palettes/07.gbapal data/tilesets/secondary/museum/palettes/08.gbapal data/tilesets/secondary/museum/palettes/09.gbapal data/tilesets/secondary/museum/palettes/10.gbapal data/tilesets/secondary/museum/palettes/11.gbapal data/tilesets/secondary/museum/palettes/12.gbapal data/tilesets/secondary/museum/palettes/13.gbapal data/tilesets/secondary/museum/palettes/14.gbapal data/tilesets/secondary/museum/palettes/15.gbapal data/tilesets/secondary/museum/tiles.4bpp.lz data/tilesets/secondary/navel_rock/palettes/00.gbapal data/tilesets/secondary/navel_rock/palettes/01.gbapal data/tilesets/secondary/navel_rock/palettes/02.gbapal data/tilesets/secondary/navel_rock/palettes/03.gbapal data/tilesets/secondary/navel_rock/palettes/04.gbapal data/tilesets/secondary/navel_rock/palettes/05.gbapal data/tilesets/secondary/navel_rock/palettes/06.gbapal data/tilesets/secondary/navel_rock/palettes/07.gbapal data/tilesets/secondary/navel_rock/palettes/08.gbapal data/tilesets/secondary/navel_rock/palettes/09.gbapal data/tilesets/secondary/navel_rock/palettes/10.gbapal data/tilesets/secondary/navel_rock/palettes/11.gbapal data/tilesets/secondary/navel_rock/palettes/12.gbapal data/tilesets/secondary/navel_rock/palettes/13.gbapal data/tilesets/secondary/navel_rock/palettes/14.gbapal data/tilesets/secondary/navel_rock/palettes/15.gbapal data/tilesets/secondary/navel_rock/tiles.4bpp.lz data/tilesets/secondary/pallet_town/palettes/00.gbapal data/tilesets/secondary/pallet_town/palettes/01.gbapal data/tilesets/secondary/pallet_town/palettes/02.gbapal data/tilesets/secondary/pallet_town/palettes/03.gbapal data/tilesets/secondary/pallet_town/palettes/04.gbapal data/tilesets/secondary/pallet_town/palettes/05.gbapal data/tilesets/secondary/pallet_town/palettes/06.gbapal data/tilesets/secondary/pallet_town/palettes/07.gbapal data/tilesets/secondary/pallet_town/palettes/08.gbapal data/tilesets/secondary/pallet_town/palettes/09.gbapal data/tilesets/secondary/pallet_town/palettes/10.gbapal data/tilesets/secondary/pallet_town/palettes/11.gbapal data/tilesets/secondary/pallet_town/palettes/12.gbapal data/tilesets/secondary/pallet_town/palettes/13.gbapal data/tilesets/secondary/pallet_town/palettes/14.gbapal data/tilesets/secondary/pallet_town/palettes/15.gbapal data/tilesets/secondary/pallet_town/tiles.4bpp.lz data/tilesets/secondary/pewter_city/palettes/00.gbapal data/tilesets/secondary/pewter_city/palettes/01.gbapal data/tilesets/secondary/pewter_city/palettes/02.gbapal data/tilesets/secondary/pewter_city/palettes/03.gbapal data/tilesets/secondary/pewter_city/palettes/04.gbapal data/tilesets/secondary/pewter_city/palettes/05.gbapal data/tilesets/secondary/pewter_city/palettes/06.gbapal data/tilesets/secondary/pewter_city/palettes/07.gbapal data/tilesets/secondary/pewter_city/palettes/08.gbapal data/tilesets/secondary/pewter_city/palettes/09.gbapal data/tilesets/secondary/pewter_city/palettes/10.gbapal data/tilesets/secondary/pewter_city/palettes/11.gbapal data/tilesets/secondary/pewter_city/palettes/12.gbapal data/tilesets/secondary/pewter_city/palettes/13.gbapal data/tilesets/secondary/pewter_city/palettes/14.gbapal data/tilesets/secondary/pewter_city/palettes/15.gbapal data/tilesets/secondary/pewter_city/tiles.4bpp.lz data/tilesets/secondary/pewter_gym/palettes/00.gbapal data/tilesets/secondary/pewter_gym/palettes/01.gbapal data/tilesets/secondary/pewter_gym/palettes/02.gbapal data/tilesets/secondary/pewter_gym/palettes/03.gbapal data/tilesets/secondary/pewter_gym/palettes/04.gbapal data/tilesets/secondary/pewter_gym/palettes/05.gbapal data/tilesets/secondary/pewter_gym/palettes/06.gbapal data/tilesets/secondary/pewter_gym/palettes/07.gbapal data/tilesets/secondary/pewter_gym/palettes/08.gbapal data/tilesets/secondary/pewter_gym/palettes/09.gbapal data/tilesets/secondary/pewter_gym/palettes/10.gbapal data/tilesets/secondary/pewter_gym/palettes/11.gbapal data/tilesets/secondary/pewter_gym/palettes/12.gbapal data/tilesets/secondary/pewter_gym/palettes/13.gbapal data/tilesets/secondary/pewter_gym/palettes/14.gbapal data/tilesets/secondary/pewter_gym/palettes/15.gbapal data/tilesets/secondary/pewter_gym/tiles.4bpp.lz data/tilesets/secondary/pokemon_center/palettes/00.gbapal data/tilesets/secondary/pokemon_center/palettes/01.gbapal data/tilesets/secondary/pokemon_center/palettes/02.gbapal data/tilesets/secondary/pokemon_center/palettes/03.gbapal data/tilesets/secondary/pokemon_center/palettes/04.gbapal data/tilesets/secondary/pokemon_center/palettes/05.gbapal data/tilesets/secondary/pokemon_center/palettes/06.gbapal data/tilesets/secondary/pokemon_center/palettes/07.gbapal data/tilesets/secondary/pokemon_center/palettes/08.gbapal data/tilesets/secondary/pokemon_center/palettes/09.gbapal data/tilesets/secondary/pokemon_center/palettes/10.gbapal data/tilesets/secondary/pokemon_center/palettes/11.gbapal data/tilesets/secondary/pokemon_center/palettes/12.gbapal data/tilesets/secondary/pokemon_center/palettes/13.gbapal data/tilesets/secondary/pokemon_center/palettes/14.gbapal data/tilesets/secondary/pokemon_center/palettes/15.gbapal data/tilesets/secondary/pokemon_center/tiles.4bpp.lz data/tilesets/secondary/pokemon_league/palettes/00.gbapal data/tilesets/secondary/pokemon_league/palettes/01.gbapal data/tilesets/secondary/pokemon_league/palettes/02.gbapal data/tilesets/secondary/pokemon_league/palettes/03.gbapal data/tilesets/secondary/pokemon_league/palettes/04.gbapal data/tilesets/secondary/pokemon_league/palettes/05.gbapal data/tilesets/secondary/pokemon_league/palettes/06.gbapal data/tilesets/secondary/pokemon_league/palettes/07.gbapal data/tilesets/secondary/pokemon_league/palettes/08.gbapal data/tilesets/secondary/pokemon_league/palettes/09.gbapal data/tilesets/secondary/pokemon_league/palettes/10.gbapal data/tilesets/secondary/pokemon_league/palettes/11.gbapal data/tilesets/secondary/pokemon_league/palettes/12.gbapal data/tilesets/secondary/pokemon_league/palettes/13.gbapal data/tilesets/secondary/pokemon_league/palettes/14.gbapal data/tilesets/secondary/pokemon_league/palettes/15.gbapal data/tilesets/secondary/pokemon_league/tiles.4bpp.lz data/tilesets/secondary/pokemon_mansion/palettes/00.gbapal data/tilesets/secondary/pokemon_mansion/palettes/01.gbapal data/tilesets/secondary/pokemon_mansion/palettes/02.gbapal data/tilesets/secondary/pokemon_mansion/palettes/03.gbapal data/tilesets/secondary/pokemon_mansion/palettes/04.gbapal data/tilesets/secondary/pokemon_mansion/palettes/05.gbapal data/tilesets/secondary/pokemon_mansion/palettes/06.gbapal data/tilesets/secondary/pokemon_mansion/palettes/07.gbapal data/tilesets/secondary/pokemon_mansion/palettes/08.gbapal data/tilesets/secondary/pokemon_mansion/palettes/09.gbapal data/tilesets/secondary/pokemon_mansion/palettes/10.gbapal data/tilesets/secondary/pokemon_mansion/palettes/11.gbapal data/tilesets/secondary/pokemon_mansion/palettes/12.gbapal data/tilesets/secondary/pokemon_mansion/palettes/13.gbapal data/tilesets/secondary/pokemon_mansion/palettes/14.gbapal data/tilesets/secondary/pokemon_mansion/palettes/15.gbapal data/tilesets/secondary/pokemon_mansion/tiles.4bpp.lz data/tilesets/secondary/pokemon_tower/palettes/00.gbapal data/tilesets/secondary/pokemon_tower/palettes/01.gbapal data/tilesets/secondary/pokemon_tower/palettes/02.gbapal data/tilesets/secondary/pokemon_tower/palettes/03.gbapal data/tilesets/secondary/pokemon_tower/palettes/04.gbapal data/tilesets/secondary/pokemon_tower/palettes/05.gbapal data/tilesets/secondary/pokemon_tower/palettes/06.gbapal data/tilesets/secondary/pokemon_tower/palettes/07.gbapal data/tilesets/secondary/pokemon_tower/palettes/08.gbapal data/tilesets/secondary/pokemon_tower/palettes/09.gbapal data/tilesets/secondary/pokemon_tower/palettes/10.gbapal data/tilesets/secondary/pokemon_tower/palettes/11.gbapal data/tilesets/secondary/pokemon_tower/palettes/12.gbapal data/tilesets/secondary/pokemon_tower/palettes/13.gbapal data/tilesets/secondary/pokemon_tower/palettes/14.gbapal data/tilesets/secondary/pokemon_tower/palettes/15.gbapal data/tilesets/secondary/pokemon_tower/tiles.4bpp.lz data/tilesets/secondary/power_plant/palettes/00.gbapal data/tilesets/secondary/power_plant/palettes/01.gbapal data/tilesets/secondary/power_plant/palettes/02.gbapal data/tilesets/secondary/power_plant/palettes/03.gbapal data/tilesets/secondary/power_plant/palettes/04.gbapal data/tilesets/secondary/power_plant/palettes/05.gbapal data/tilesets/secondary/power_plant/palettes/06.gbapal data/tilesets/secondary/power_plant/palettes/07.gbapal data/tilesets/secondary/power_plant/palettes/08.gbapal data/tilesets/secondary/power_plant/palettes/09.gbapal data/tilesets/secondary/power_plant/palettes/10.gbapal data/tilesets/secondary/power_plant/palettes/11.gbapal data/tilesets/secondary/power_plant/palettes/12.gbapal data/tilesets/secondary/power_plant/palettes/13.gbapal data/tilesets/secondary/power_plant/palettes/14.gbapal data/tilesets/secondary/power_plant/palettes/15.gbapal data/tilesets/secondary/power_plant/tiles.4bpp.lz data/tilesets/secondary/restaurant_hotel/palettes/00.gbapal data/tilesets/secondary/restaurant_hotel/palettes/01.gbapal data/tilesets/secondary/restaurant_hotel/palettes/02.gbapal data/tilesets/secondary/restaurant_hotel/palettes/03.gbapal data/tilesets/secondary/restaurant_hotel/palettes/04.gbapal data/tilesets/secondary/restaurant_hotel/palettes/05.gbapal data/tilesets/secondary/restaurant_hotel/palettes/06.gbapal data/tilesets/secondary/restaurant_hotel/palettes/07.gbapal data/tilesets/secondary/restaurant_hotel/palettes/08.gbapal data/tilesets/secondary/restaurant_hotel/palettes/09.gbapal data/tilesets/secondary/restaurant_hotel/palettes/10.gbapal data/tilesets/secondary/restaurant_hotel/palettes/11.gbapal data/tilesets/secondary/restaurant_hotel/palettes/12.gbapal data/tilesets/secondary/restaurant_hotel/palettes/13.gbapal data/tilesets/secondary/restaurant_hotel/palettes/14.gbapal data/tilesets/secondary/restaurant_hotel/palettes/15.gbapal data/tilesets/secondary/restaurant_hotel/tiles.4bpp.lz data/tilesets/secondary/rock_tunnel/palettes/00.gbapal data/tilesets/secondary/rock_tunnel/palettes/01.gbapal data/tilesets/secondary/rock_tunnel/palettes/02.gbapal data/tilesets/secondary/rock_tunnel/palettes/03.gbapal data/tilesets/secondary/rock_tunnel/palettes/04.gbapal data/tilesets/secondary/rock_tunnel/palettes/05.gbapal data/tilesets/secondary/rock_tunnel/palettes/06.gbapal data/tilesets/secondary/rock_tunnel/palettes/07.gbapal data/tilesets/secondary/rock_tunnel/palettes/08.gbapal data/tilesets/secondary/rock_tunnel/palettes/09.gbapal data/tilesets/secondary/rock_tunnel/palettes/10.gbapal data/tilesets/secondary/rock_tunnel/palettes/11.gbapal data/tilesets/secondary/rock_tunnel/palettes/12.gbapal data/tilesets/secondary/rock_tunnel/palettes/13.gbapal data/tilesets/secondary/rock_tunnel/palettes/14.gbapal data/tilesets/secondary/rock_tunnel/palettes/15.gbapal data/tilesets/secondary/rock_tunnel/tiles.4bpp.lz data/tilesets/secondary/safari_zone_building/palettes/00.gbapal data/tilesets/secondary/safari_zone_building/palettes/01.gbapal data/tilesets/secondary/safari_zone_building/palettes/02.gbapal data/tilesets/secondary/safari_zone_building/palettes/03.gbapal data/tilesets/secondary/safari_zone_building/palettes/04.gbapal data/tilesets/secondary/safari_zone_building/palettes/05.gbapal data/tilesets/secondary/safari_zone_building/palettes/06.gbapal data/tilesets/secondary/safari_zone_building/palettes/07.gbapal data/tilesets/secondary/safari_zone_building/palettes/08.gbapal data/tilesets/secondary/safari_zone_building/palettes/09.gbapal data/tilesets/secondary/safari_zone_building/palettes/10.gbapal data/tilesets/secondary/safari_zone_building/palettes/11.gbapal data/tilesets/secondary/safari_zone_building/palettes/12.gbapal data/tilesets/secondary/safari_zone_building/palettes/13.gbapal data/tilesets/secondary/safari_zone_building/palettes/14.gbapal data/tilesets/secondary/safari_zone_building/palettes/15.gbapal data/tilesets/secondary/safari_zone_building/tiles.4bpp.lz data/tilesets/secondary/saffron_city/palettes/00.gbapal data/tilesets/secondary/saffron_city/palettes/01.gbapal data/tilesets/secondary/saffron_city/palettes/02.gbapal data/tilesets/secondary/saffron_city/palettes/03.gbapal data/tilesets/secondary/saffron_city/palettes/04.gbapal data/tilesets/secondary/saffron_city/palettes/05.gbapal data/tilesets/secondary/saffron_city/palettes/06.gbapal data/tilesets/secondary/saffron_city/palettes/07.gbapal data/tilesets/secondary/saffron_city/palettes/08.gbapal data/tilesets/secondary/saffron_city/palettes/09.gbapal data/tilesets/secondary/saffron_city/palettes/10.gbapal data/tilesets/secondary/saffron_city/palettes/11.gbapal data/tilesets/secondary/saffron_city/palettes/12.gbapal data/tilesets/secondary/saffron_city/palettes/13.gbapal data/tilesets/secondary/saffron_city/palettes/14.gbapal data/tilesets/secondary/saffron_city/palettes/15.gbapal data/tilesets/secondary/saffron_city/tiles.4bpp.lz data/tilesets/secondary/saffron_gym/palettes/00.gbapal data/tilesets/secondary/saffron_gym/palettes/01.gbapal data/tilesets/secondary/saffron_gym/palettes/02.gbapal data/tilesets/secondary/saffron_gym/palettes/03.gbapal data/tilesets/secondary/saffron_gym/palettes/04.gbapal data/tilesets/secondary/saffron_gym/palettes/05.gbapal data/tilesets/secondary/saffron_gym/palettes/06.gbapal data/tilesets/secondary/saffron_gym/palettes/07.gbapal data/tilesets/secondary/saffron_gym/palettes/08.gbapal data/tilesets/secondary/saffron_gym/palettes/09.gbapal data/tilesets/secondary/saffron_gym/palettes/10.gbapal data/tilesets/secondary/saffron_gym/palettes/11.gbapal data/tilesets/secondary/saffron_gym/palettes/12.gbapal data/tilesets/secondary/saffron_gym/palettes/13.gbapal data/tilesets/secondary/saffron_gym/palettes/14.gbapal data/tilesets/secondary/saffron_gym/palettes/15.gbapal data/tilesets/secondary/saffron_gym/tiles.4bpp.lz data/tilesets/secondary/school/palettes/00.gbapal data/tilesets/secondary/school/palettes/01.gbapal data/tilesets/secondary/school/palettes/02.gbapal data/tilesets/secondary/school/palettes/03.gbapal data/tilesets/secondary/school/palettes/04.gbapal data/tilesets/secondary/school/palettes/05.gbapal data/tilesets/secondary/school/palettes/06.gbapal data/tilesets/secondary/school/palettes/07.gbapal data/tilesets/secondary/school/palettes/08.gbapal data/tilesets/secondary/school/palettes/09.gbapal data/tilesets/secondary/school/palettes/10.gbapal data/tilesets/secondary/school/palettes/11.gbapal data/tilesets/secondary/school/palettes/12.gbapal data/tilesets/secondary/school/palettes/13.gbapal data/tilesets/secondary/school/palettes/14.gbapal data/tilesets/secondary/school/palettes/15.gbapal data/tilesets/secondary/school/tiles.4bpp.lz data/tilesets/secondary/sea_cottage/palettes/00.gbapal data/tilesets/secondary/sea_cottage/palettes/01.gbapal data/tilesets/secondary/sea_cottage/palettes/02.gbapal data/tilesets/secondary/sea_cottage/palettes/03.gbapal data/tilesets/secondary/sea_cottage/palettes/04.gbapal data/tilesets/secondary/sea_cottage/palettes/05.gbapal data/tilesets/secondary/sea_cottage/palettes/06.gbapal data/tilesets/secondary/sea_cottage/palettes/07.gbapal data/tilesets/secondary/sea_cottage/palettes/08.gbapal data/tilesets/secondary/sea_cottage/palettes/09.gbapal data/tilesets/secondary/sea_cottage/palettes/10.gbapal data/tilesets/secondary/sea_cottage/palettes/11.gbapal data/tilesets/secondary/sea_cottage/palettes/12.gbapal data/tilesets/secondary/sea_cottage/palettes/13.gbapal data/tilesets/secondary/sea_cottage/palettes/14.gbapal data/tilesets/secondary/sea_cottage/palettes/15.gbapal data/tilesets/secondary/sea_cottage/tiles.4bpp.lz data/tilesets/secondary/seafoam_islands/palettes/00.gbapal data/tilesets/secondary/seafoam_islands/palettes/01.gbapal data/tilesets/secondary/seafoam_islands/palettes/02.gbapal data/tilesets/secondary/seafoam_islands/palettes/03.gbapal data/tilesets/secondary/seafoam_islands/palettes/04.gbapal data/tilesets/secondary/seafoam_islands/palettes/05.gbapal data/tilesets/secondary/seafoam_islands/palettes/06.gbapal data/tilesets/secondary/seafoam_islands/palettes/07.gbapal data/tilesets/secondary/seafoam_islands/palettes/08.gbapal data/tilesets/secondary/seafoam_islands/palettes/09.gbapal data/tilesets/secondary/seafoam_islands/palettes/10.gbapal data/tilesets/secondary/seafoam_islands/palettes/11.gbapal data/tilesets/secondary/seafoam_islands/palettes/12.gbapal data/tilesets/secondary/seafoam_islands/palettes/13.gbapal data/tilesets/secondary/seafoam_islands/palettes/14.gbapal data/tilesets/secondary/seafoam_islands/palettes/15.gbapal data/tilesets/secondary/seafoam_islands/tiles.4bpp.lz data/tilesets/secondary/sevii_islands_123/palettes/00.gbapal data/tilesets/secondary/sevii_islands_123/palettes/01.gbapal data/tilesets/secondary/sevii_islands_123/palettes/02.gbapal data/tilesets/secondary/sevii_islands_123/palettes/03.gbapal data/tilesets/secondary/sevii_islands_123/palettes/04.gbapal data/tilesets/secondary/sevii_islands_123/palettes/05.gbapal data/tilesets/secondary/sevii_islands_123/palettes/06.gbapal data/tilesets/secondary/sevii_islands_123/palettes/07.gbapal data/tilesets/secondary/sevii_islands_123/palettes/08.gbapal data/tilesets/secondary/sevii_islands_123/palettes/09.gbapal data/tilesets/secondary/sevii_islands_123/palettes/10.gbapal data/tilesets/secondary/sevii_islands_123/palettes/11.gbapal data/tilesets/secondary/sevii_islands_123/palettes/12.gbapal data/tilesets/secondary/sevii_islands_123/palettes/13.gbapal data/tilesets/secondary/sevii_islands_123/palettes/14.gbapal data/tilesets/secondary/sevii_islands_123/palettes/15.gbapal data/tilesets/secondary/sevii_islands_123/tiles.4bpp.lz data/tilesets/secondary/sevii_islands_45/palettes/00.gbapal data/tilesets/secondary/sevii_islands_45/palettes/01.gbapal data/tilesets/secondary/sevii_islands_45/palettes/02.gbapal data/tilesets/secondary/sevii_islands_45/palettes/03.gbapal data/tilesets/secondary/sevii_islands_45/palettes/04.gbapal data/tilesets/secondary/sevii_islands_45/palettes/05.gbapal data/tilesets/secondary/sevii_islands_45/palettes/06.gbapal data/tilesets/secondary/sevii_islands_45/palettes/07.gbapal data/tilesets/secondary/sevii_islands_45/palettes/08.gbapal data/tilesets/secondary/sevii_islands_45/palettes/09.gbapal data/tilesets/secondary/sevii_islands_45/palettes/10.gbapal data/tilesets/secondary/sevii_islands_45/palettes/11.gbapal data/tilesets/secondary/sevii_islands_45/palettes/12.gbapal data/tilesets/secondary/sevii_islands_45/palettes/13.gbapal data/tilesets/secondary/sevii_islands_45/palettes/14.gbapal data/tilesets/secondary/sevii_islands_45/palettes/15.gbapal data/tilesets/secondary/sevii_islands_45/tiles.4bpp.lz data/tilesets/secondary/sevii_islands_67/palettes/00.gbapal data/tilesets/secondary/sevii_islands_67/palettes/01.gbapal data/tilesets/secondary/sevii_islands_67/palettes/02.gbapal data/tilesets/secondary/sevii_islands_67/palettes/03.gbapal data/tilesets/secondary/sevii_islands_67/palettes/04.gbapal data/tilesets/secondary/sevii_islands_67/palettes/05.gbapal data/tilesets/secondary/sevii_islands_67/palettes/06.gbapal data/tilesets/secondary/sevii_islands_67/palettes/07.gbapal data/tilesets/secondary/sevii_islands_67/palettes/08.gbapal data/tilesets/secondary/sevii_islands_67/palettes/09.gbapal data/tilesets/secondary/sevii_islands_67/palettes/10.gbapal data/tilesets/secondary/sevii_islands_67/palettes/11.gbapal data/tilesets/secondary/sevii_islands_67/palettes/12.gbapal data/tilesets/secondary/sevii_islands_67/palettes/13.gbapal data/tilesets/secondary/sevii_islands_67/palettes/14.gbapal data/tilesets/secondary/sevii_islands_67/palettes/15.gbapal data/tilesets/secondary/sevii_islands_67/tiles.4bpp.lz data/tilesets/secondary/silph_co/anim/fountain/0.4bpp data/tilesets/secondary/silph_co/anim/fountain/1.4bpp data/tilesets/secondary/silph_co/anim/fountain/2.4bpp data/tilesets/secondary/silph_co/anim/fountain/3.4bpp data/tilesets/secondary/ss_anne/palettes/00.gbapal data/tilesets/secondary/ss_anne/palettes/01.gbapal data/tilesets/secondary/ss_anne/palettes/02.gbapal data/tilesets/secondary/ss_anne/palettes/03.gbapal data/tilesets/secondary/ss_anne/palettes/04.gbapal data/tilesets/secondary/ss_anne/palettes/05.gbapal data/tilesets/secondary/ss_anne/palettes/06.gbapal data/tilesets/secondary/ss_anne/palettes/07.gbapal data/tilesets/secondary/ss_anne/palettes/08.gbapal data/tilesets/secondary/ss_anne/palettes/09.gbapal data/tilesets/secondary/ss_anne/palettes/10.gbapal data/tilesets/secondary/ss_anne/palettes/11.gbapal data/tilesets/secondary/ss_anne/palettes/12.gbapal data/tilesets/secondary/ss_anne/palettes/13.gbapal data/tilesets/secondary/ss_anne/palettes/14.gbapal data/tilesets/secondary/ss_anne/palettes/15.gbapal data/tilesets/secondary/ss_anne/tiles.4bpp.lz data/tilesets/secondary/tanoby_ruins/palettes/00.gbapal data/tilesets/secondary/tanoby_ruins/palettes/01.gbapal data/tilesets/secondary/tanoby_ruins/palettes/02.gbapal data/tilesets/secondary/tanoby_ruins/palettes/03.gbapal data/tilesets/secondary/tanoby_ruins/palettes/04.gbapal data/tilesets/secondary/tanoby_ruins/palettes/05.gbapal data/tilesets/secondary/tanoby_ruins/palettes/06.gbapal data/tilesets/secondary/tanoby_ruins/palettes/07.gbapal data/tilesets/secondary/tanoby_ruins/palettes/08.gbapal data/tilesets/secondary/tanoby_ruins/palettes/09.gbapal data/tilesets/secondary/tanoby_ruins/palettes/10.gbapal data/tilesets/secondary/tanoby_ruins/palettes/11.gbapal data/tilesets/secondary/tanoby_ruins/palettes/12.gbapal data/tilesets/secondary/tanoby_ruins/palettes/13.gbapal data/tilesets/secondary/tanoby_ruins/palettes/14.gbapal data/tilesets/secondary/tanoby_ruins/palettes/15.gbapal data/tilesets/secondary/tanoby_ruins/tiles.4bpp.lz data/tilesets/secondary/trainer_tower/palettes/00.gbapal data/tilesets/secondary/trainer_tower/palettes/01.gbapal data/tilesets/secondary/trainer_tower/palettes/02.gbapal data/tilesets/secondary/trainer_tower/palettes/03.gbapal data/tilesets/secondary/trainer_tower/palettes/04.gbapal data/tilesets/secondary/trainer_tower/palettes/05.gbapal data/tilesets/secondary/trainer_tower/palettes/06.gbapal data/tilesets/secondary/trainer_tower/palettes/07.gbapal data/tilesets/secondary/trainer_tower/palettes/08.gbapal data/tilesets/secondary/trainer_tower/palettes/09.gbapal data/tilesets/secondary/trainer_tower/palettes/10.gbapal data/tilesets/secondary/trainer_tower/palettes/11.gbapal data/tilesets/secondary/trainer_tower/palettes/12.gbapal data/tilesets/secondary/trainer_tower/palettes/13.gbapal data/tilesets/secondary/trainer_tower/palettes/14.gbapal data/tilesets/secondary/trainer_tower/palettes/15.gbapal data/tilesets/secondary/trainer_tower/tiles.4bpp.lz data/tilesets/secondary/underground_path/palettes/00.gbapal data/tilesets/secondary/underground_path/palettes/01.gbapal data/tilesets/secondary/underground_path/palettes/02.gbapal data/tilesets/secondary/underground_path/palettes/03.gbapal data/tilesets/secondary/underground_path/palettes/04.gbapal data/tilesets/secondary/underground_path/palettes/05.gbapal data/tilesets/secondary/underground_path/palettes/06.gbapal data/tilesets/secondary/underground_path/palettes/07.gbapal data/tilesets/secondary/underground_path/palettes/08.gbapal data/tilesets/secondary/underground_path/palettes/09.gbapal data/tilesets/secondary/underground_path/palettes/10.gbapal data/tilesets/secondary/underground_path/palettes/11.gbapal data/tilesets/secondary/underground_path/palettes/12.gbapal data/tilesets/secondary/underground_path/palettes/13.gbapal data/tilesets/secondary/underground_path/palettes/14.gbapal data/tilesets/secondary/underground_path/palettes/15.gbapal data/tilesets/secondary/underground_path/tiles.4bpp.lz data/tilesets/secondary/unused_gatehouse_1/palettes/00.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/01.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/02.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/03.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/04.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/05.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/06.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/07.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/08.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/09.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/10.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/11.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/12.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/13.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/14.gbapal data/tilesets/secondary/unused_gatehouse_1/palettes/15.gbapal data/tilesets/secondary/unused_gatehouse_1/tiles.4bpp.lz data/tilesets/secondary/unused_gatehouse_2/palettes/00.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/01.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/02.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/03.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/04.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/05.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/06.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/07.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/08.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/09.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/10.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/11.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/12.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/13.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/14.gbapal data/tilesets/secondary/unused_gatehouse_2/palettes/15.gbapal data/tilesets/secondary/unused_gatehouse_2/tiles.4bpp.lz data/tilesets/secondary/vermilion_city/palettes/00.gbapal data/tilesets/secondary/vermilion_city/palettes/01.gbapal data/tilesets/secondary/vermilion_city/palettes/02.gbapal data/tilesets/secondary/vermilion_city/palettes/03.gbapal data/tilesets/secondary/vermilion_city/palettes/04.gbapal data/tilesets/secondary/vermilion_city/palettes/05.gbapal data/tilesets/secondary/vermilion_city/palettes/06.gbapal data/tilesets/secondary/vermilion_city/palettes/07.gbapal data/tilesets/secondary/vermilion_city/palettes/08.gbapal data/tilesets/secondary/vermilion_city/palettes/09.gbapal data/tilesets/secondary/vermilion_city/palettes/10.gbapal data/tilesets/secondary/vermilion_city/palettes/11.gbapal data/tilesets/secondary/vermilion_city/palettes/12.gbapal data/tilesets/secondary/vermilion_city/palettes/13.gbapal data/tilesets/secondary/vermilion_city/palettes/14.gbapal data/tilesets/secondary/vermilion_city/palettes/15.gbapal data/tilesets/secondary/vermilion_city/tiles.4bpp.lz data/tilesets/secondary/vermilion_gym/anim/motorizeddoor/0.4bpp data/tilesets/secondary/vermilion_gym/anim/motorizeddoor/1.4bpp data/tilesets/secondary/vermilion_gym/palettes/00.gbapal data/tilesets/secondary/vermilion_gym/palettes/01.gbapal data/tilesets/secondary/vermilion_gym/palettes/02.gbapal data/tilesets/secondary/vermilion_gym/palettes/03.gbapal data/tilesets/secondary/vermilion_gym/palettes/04.gbapal data/tilesets/secondary/vermilion_gym/palettes/05.gbapal data/tilesets/secondary/vermilion_gym/palettes/06.gbapal data/tilesets/secondary/vermilion_gym/palettes/07.gbapal data/tilesets/secondary/vermilion_gym/palettes/08.gbapal data/tilesets/secondary/vermilion_gym/palettes/09.gbapal data/tilesets/secondary/vermilion_gym/palettes/10.gbapal data/tilesets/secondary/vermilion_gym/palettes/11.gbapal data/tilesets/secondary/vermilion_gym/palettes/12.gbapal data/tilesets/secondary/vermilion_gym/palettes/13.gbapal data/tilesets/secondary/vermilion_gym/palettes/14.gbapal data/tilesets/secondary/vermilion_gym/palettes/15.gbapal data/tilesets/secondary/vermilion_gym/tiles.4bpp.lz data/tilesets/secondary/viridian_city/palettes/00.gbapal data/tilesets/secondary/viridian_city/palettes/01.gbapal data/tilesets/secondary/viridian_city/palettes/02.gbapal data/tilesets/secondary/viridian_city/palettes/03.gbapal data/tilesets/secondary/viridian_city/palettes/04.gbapal data/tilesets/secondary/viridian_city/palettes/05.gbapal data/tilesets/secondary/viridian_city/palettes/06.gbapal data/tilesets/secondary/viridian_city/palettes/07.gbapal data/tilesets/secondary/viridian_city/palettes/08.gbapal data/tilesets/secondary/viridian_city/palettes/09.gbapal data/tilesets/secondary/viridian_city/palettes/10.gbapal data/tilesets/secondary/viridian_city/palettes/11.gbapal data/tilesets/secondary/viridian_city/palettes/12.gbapal data/tilesets/secondary/viridian_city/palettes/13.gbapal data/tilesets/secondary/viridian_city/palettes/14.gbapal data/tilesets/secondary/viridian_city/palettes/15.gbapal data/tilesets/secondary/viridian_city/tiles.4bpp.lz data/tilesets/secondary/viridian_forest/palettes/00.gbapal data/tilesets/secondary/viridian_forest/palettes/01.gbapal data/tilesets/secondary/viridian_forest/palettes/02.gbapal data/tilesets/secondary/viridian_forest/palettes/03.gbapal data/tilesets/secondary/viridian_forest/palettes/04.gbapal data/tilesets/secondary/viridian_forest/palettes/05.gbapal data/tilesets/secondary/viridian_forest/palettes/06.gbapal data/tilesets/secondary/viridian_forest/palettes/07.gbapal data/tilesets/secondary/viridian_forest/palettes/08.gbapal data/tilesets/secondary/viridian_forest/palettes/09.gbapal data/tilesets/secondary/viridian_forest/palettes/10.gbapal data/tilesets/secondary/viridian_forest/palettes/11.gbapal data/tilesets/secondary/viridian_forest/palettes/12.gbapal data/tilesets/secondary/viridian_forest/palettes/13.gbapal data/tilesets/secondary/viridian_forest/palettes/14.gbapal data/tilesets/secondary/viridian_forest/palettes/15.gbapal data/tilesets/secondary/viridian_forest/tiles.4bpp.lz data/tilesets/secondary/viridian_gym/palettes/00.gbapal data/tilesets/secondary/viridian_gym/palettes/01.gbapal data/tilesets/secondary/viridian_gym/palettes/02.gbapal data/tilesets/secondary/viridian_gym/palettes/03.gbapal data/tilesets/secondary/viridian_gym/palettes/04.gbapal data/tilesets/secondary/viridian_gym/palettes/05.gbapal data/tilesets/secondary/viridian_gym/palettes/06.gbapal data/tilesets/secondary/viridian_gym/palettes/07.gbapal data/tilesets/secondary/viridian_gym/palettes/08.gbapal data/tilesets/secondary/viridian_gym/palettes/09.gbapal data/tilesets/secondary/viridian_gym/palettes/10.gbapal data/tilesets/secondary/viridian_gym/palettes/11.gbapal data/tilesets/secondary/viridian_gym/palettes/12.gbapal data/tilesets/secondary/viridian_gym/palettes/13.gbapal data/tilesets/secondary/viridian_gym/palettes/14.gbapal data/tilesets/secondary/viridian_gym/palettes/15.gbapal data/tilesets/secondary/viridian_gym/tiles.4bpp.lz graphics/battle_anims/backgrounds/attract.4bpp.lz graphics/battle_anims/backgrounds/attract.bin.lz graphics/battle_anims/backgrounds/attract.gbapal.lz graphics/battle_anims/backgrounds/aurora.4bpp.lz graphics/battle_anims/backgrounds/aurora.bin.lz graphics/battle_anims/backgrounds/aurora.gbapal.lz graphics/battle_anims/backgrounds/bug.gbapal.lz graphics/battle_anims/backgrounds/cosmic.4bpp.lz graphics/battle_anims/backgrounds/cosmic.bin.lz graphics/battle_anims/backgrounds/cosmic.gbapal.lz graphics/battle_anims/backgrounds/dark.4bpp.lz graphics/battle_anims/backgrounds/dark.bin.lz graphics/battle_anims/backgrounds/dark.gbapal.lz graphics/battle_anims/backgrounds/drill.4bpp.lz graphics/battle_anims/backgrounds/drill.bin.lz graphics/battle_anims/backgrounds/drill.gbapal.lz graphics/battle_anims/backgrounds/drill_contests.bin.lz graphics/battle_anims/backgrounds/fissure.4bpp.lz graphics/battle_anims/backgrounds/fissure.bin.lz graphics/battle_anims/backgrounds/fissure.gbapal.lz graphics/battle_anims/backgrounds/fog.bin.lz graphics/battle_anims/backgrounds/ghost.4bpp.lz graphics/battle_anims/backgrounds/ghost.bin.lz graphics/battle_anims/backgrounds/ghost.gbapal.lz graphics/battle_anims/backgrounds/guillotine.4bpp.lz graphics/battle_anims/backgrounds/guillotine.gbapal.lz graphics/battle_anims/backgrounds/guillotine_contests.bin.lz graphics/battle_anims/backgrounds/guillotine_opponent.bin.lz graphics/battle_anims/backgrounds/guillotine_player.bin.lz graphics/battle_anims/backgrounds/highspeed.4bpp.lz graphics/battle_anims/backgrounds/highspeed.gbapal.lz graphics/battle_anims/backgrounds/highspeed_opponent.bin.lz graphics/battle_anims/backgrounds/highspeed_player.bin.lz graphics/battle_anims/backgrounds/ice.4bpp.lz graphics/battle_anims/backgrounds/ice.bin.lz graphics/battle_anims/backgrounds/ice.gbapal.lz graphics/battle_anims/backgrounds/impact.4bpp.lz graphics/battle_anims/backgrounds/impact.gbapal.lz graphics/battle_anims/backgrounds/impact_contests.bin.lz graphics/battle_anims/backgrounds/impact_opponent.bin.lz graphics/battle_anims/backgrounds/impact_player.bin.lz graphics/battle_anims/backgrounds/in_air.4bpp.lz graphics/battle_anims/backgrounds/in_air.bin.lz graphics/battle_anims/backgrounds/in_air.gbapal.lz graphics/battle_anims/backgrounds/psychic.4bpp.lz graphics/battle_anims/backgrounds/psychic.bin.lz graphics/battle_anims/backgrounds/psychic.gbapal.lz graphics/battle_anims/backgrounds/sandstorm_brew.4bpp.lz graphics/battle_anims/backgrounds/sandstorm_brew.bin.lz graphics/battle_anims/backgrounds/scary_face.4bpp.lz graphics/battle_anims/backgrounds/scary_face.gbapal.lz graphics/battle_anims/backgrounds/scary_face_contest.bin.lz graphics/battle_anims/backgrounds/scary_face_opponent.bin.lz graphics/battle_anims/backgrounds/scary_face_player.bin.lz graphics/battle_anims/backgrounds/sky.gbapal.lz graphics/battle_anims/backgrounds/solarbeam.bin.lz graphics/battle_anims/backgrounds/solarbeam.gbapal.lz graphics/battle_anims/backgrounds/thunder.4bpp.lz graphics/battle_anims/backgrounds/thunder.bin.lz graphics/battle_anims/backgrounds/thunder.gbapal.lz graphics/battle_anims/backgrounds/water.4bpp.lz graphics/battle_anims/backgrounds/water.gbapal.lz graphics/battle_anims/backgrounds/water_contest.bin.lz graphics/battle_anims/backgrounds/water_muddy.gbapal.lz graphics/battle_anims/backgrounds/water_opponent.bin.lz graphics/battle_anims/backgrounds/water_player.bin.lz graphics/battle_anims/masks/cure_bubbles.4bpp.lz graphics/battle_anims/masks/cure_bubbles.bin.lz graphics/battle_anims/masks/cure_bubbles.gbapal.lz graphics/battle_anims/masks/curse.4bpp.lz graphics/battle_anims/masks/curse.bin.lz graphics/battle_anims/masks/light_beam.4bpp.lz graphics/battle_anims/masks/light_beam.bin.lz graphics/battle_anims/masks/light_beam.gbapal.lz graphics/battle_anims/masks/metal_shine.4bpp.lz graphics/battle_anims/masks/metal_shine.bin.lz graphics/battle_anims/masks/metal_shine.gbapal.lz graphics/battle_anims/masks/stat.4bpp.lz graphics/battle_anims/masks/stat1.gbapal.lz graphics/battle_anims/masks/stat2.gbapal.lz graphics/battle_anims/masks/stat3.gbapal.lz graphics/battle_anims/masks/stat4.gbapal.lz graphics/battle_anims/masks/stat5.gbapal.lz graphics/battle_anims/masks/stat6.gbapal.lz graphics/battle_anims/masks/stat7.gbapal.lz graphics/battle_anims/masks/stat8.gbapal.lz graphics/battle_anims/masks/stat_tilemap_1.bin.lz graphics/battle_anims/masks/stat_tilemap_2.bin.lz graphics/battle_anims/masks/unused_level_up.4bpp.lz graphics/battle_anims/masks/unused_level_up.bin.lz graphics/battle_anims/sprites/air_slash.4bpp.lz graphics/battle_anims/sprites/air_slash.gbapal.lz graphics/battle_anims/sprites/air_wave.4bpp.lz graphics/battle_anims/sprites/air_wave.gbapal.lz graphics/battle_anims/sprites/air_wave_2.4bpp.lz graphics/battle_anims/sprites/air_wave_2.gbapal.lz graphics/battle_anims/sprites/alert.4bpp.lz graphics/battle_anims/sprites/alert.gbapal.lz graphics/battle_anims/sprites/amnesia.4bpp.lz graphics/battle_anims/sprites/amnesia.gbapal.lz graphics/battle_anims/sprites/angel.4bpp.lz graphics/battle_anims/sprites/angel.gbapal.lz graphics/battle_anims/sprites/anger.4bpp.lz graphics/battle_anims/sprites/anger.gbapal.lz graphics/battle_anims/sprites/bell.4bpp.lz graphics/battle_anims/sprites/bell.gbapal.lz graphics/battle_anims/sprites/bell_2.4bpp.lz graphics/battle_anims/sprites/bell_2.gbapal.lz graphics/battle_anims/sprites/bent_spoon.4bpp.lz graphics/battle_anims/sprites/bent_spoon.gbapal.lz graphics/battle_anims/sprites/bird.4bpp.lz graphics/battle_anims/sprites/bird.gbapal.lz graphics/battle_anims/sprites/black_ball.4bpp.lz graphics/battle_anims/sprites/black_ball.gbapal.lz graphics/battle_anims/sprites/black_ball_2.4bpp.lz graphics/battle_anims/sprites/black_ball_2.gbapal.lz graphics/battle_anims/sprites/black_smoke.4bpp.lz graphics/battle_anims/sprites/black_smoke.gbapal.lz graphics/battle_anims/sprites/blue_burst.4bpp.lz graphics/battle_anims/sprites/blue_burst.gbapal.lz graphics/battle_anims/sprites/blue_flames.4bpp.lz graphics/battle_anims/sprites/blue_flames.gbapal.lz graphics/battle_anims/sprites/blue_flames_2.4bpp.lz graphics/battle_anims/sprites/blue_light_wall.gbapal.lz graphics/battle_anims/sprites/blue_lines.4bpp.lz graphics/battle_anims/sprites/blue_lines.gbapal.lz graphics/battle_anims/sprites/blue_orb.gbapal.lz graphics/battle_anims/sprites/blue_ring.gbapal.lz graphics/battle_anims/sprites/blue_ring_2.gbapal.lz graphics/battle_anims/sprites/blue_shards.4bpp.lz graphics/battle_anims/sprites/blue_shards.gbapal.lz graphics/battle_anims/sprites/blue_star.4bpp.lz graphics/battle_anims/sprites/blue_star.gbapal.lz graphics/battle_anims/sprites/bluegreen_orb.4bpp.lz graphics/battle_anims/sprites/bluegreen_orb.gbapal.lz graphics/battle_anims/sprites/bone.4bpp.lz graphics/battle_anims/sprites/bone.gbapal.lz graphics/battle_anims/sprites/bone_2.4bpp.lz graphics/battle_anims/sprites/bone_2.gbapal.lz graphics/battle_anims/sprites/breaking_egg.4bpp.lz graphics/battle_anims/sprites/breaking_egg.gbapal.lz graphics/battle_anims/sprites/breath.4bpp.lz graphics/battle_anims/sprites/breath.gbapal.lz graphics/battle_anims/sprites/brown_orb.gbapal.lz graphics/battle_anims/sprites/brown_triangle.4bpp.lz graphics/battle_anims/sprites/brown_triangle.gbapal.lz graphics/battle_anims/sprites/bubble.4bpp.lz graphics/battle_anims/sprites/bubble_burst.4bpp.lz graphics/battle_anims/sprites/bubble_burst.gbapal.lz graphics/battle_anims/sprites/bubble_burst_2.4bpp.lz graphics/battle_anims/sprites/bubble_burst_2.gbapal.lz graphics/battle_anims/sprites/circle_impact.4bpp.lz graphics/battle_anims/sprites/circle_impact.gbapal.lz graphics/battle_anims/sprites/circle_of_light.4bpp.lz graphics/battle_anims/sprites/clamp.4bpp.lz graphics/battle_anims/sprites/clapping.4bpp.lz graphics/battle_anims/sprites/clapping.gbapal.lz graphics/battle_anims/sprites/claw_slash.4bpp.lz graphics/battle_anims/sprites/claw_slash.gbapal.lz graphics/battle_anims/sprites/claw_slash_2.4bpp.lz graphics/battle_anims/sprites/claw_slash_2.gbapal.lz graphics/battle_anims/sprites/closing_eye.4bpp.lz graphics/battle_anims/sprites/closing_eye.gbapal.lz graphics/battle_anims/sprites/closing_eye_2.4bpp.lz graphics/battle_anims/sprites/closing_eye_2.gbapal.lz graphics/battle_anims/sprites/coin.4bpp.lz graphics/battle_anims/sprites/coin.gbapal.lz graphics/battle_anims/sprites/confetti.4bpp.lz graphics/battle_anims/sprites/confetti.gbapal.lz graphics/battle_anims/sprites/conversion.4bpp.lz graphics/battle_anims/sprites/conversion.gbapal.lz graphics/battle_anims/sprites/cracked_egg.4bpp.lz graphics/battle_anims/sprites/cracked_egg.gbapal.lz graphics/battle_anims/sprites/cross_impact.4bpp.lz graphics/battle_anims/sprites/cross_impact.gbapal.lz graphics/battle_anims/sprites/cut.4bpp.lz graphics/battle_anims/sprites/devil.4bpp.lz graphics/battle_anims/sprites/devil.gbapal.lz graphics/battle_anims/sprites/dirt_mound.4bpp.lz graphics/battle_anims/sprites/dirt_mound.gbapal.lz graphics/battle_anims/sprites/duck.4bpp.lz graphics/battle_anims/sprites/duck.gbapal.lz graphics/battle_anims/sprites/eclipsing_orb.4bpp.lz graphics/battle_anims/sprites/eclipsing_orb.gbapal.lz graphics/battle_anims/sprites/electric_orbs.4bpp.lz graphics/battle_anims/sprites/electric_orbs.gbapal.lz graphics/battle_anims/sprites/electricity.4bpp.lz graphics/battle_anims/sprites/explosion.4bpp.lz graphics/battle_anims/sprites/explosion.gbapal.lz graphics/battle_anims/sprites/explosion_2.4bpp.lz graphics/battle_anims/sprites/explosion_2.gbapal.lz graphics/battle_anims/sprites/explosion_3.4bpp.lz graphics/battle_anims/sprites/explosion_4.4bpp.lz graphics/battle_anims/sprites/explosion_4.gbapal.lz graphics/battle_anims/sprites/explosion_5.4bpp.lz graphics/battle_anims/sprites/explosion_6.4bpp.lz graphics/battle_anims/sprites/explosion_6.gbapal.lz graphics/battle_anims/sprites/eye.4bpp.lz graphics/battle_anims/sprites/eye.gbapal.lz graphics/battle_anims/sprites/eye_sparkle.4bpp.lz graphics/battle_anims/sprites/eye_sparkle.gbapal.lz graphics/battle_anims/sprites/fang_attack.4bpp.lz graphics/battle_anims/sprites/fang_attack.gbapal.lz graphics/battle_anims/sprites/fangs.4bpp.lz graphics/battle_anims/sprites/fangs.gbapal.lz graphics/battle_anims/sprites/finger.4bpp.lz graphics/battle_anims/sprites/finger.gbapal.lz graphics/battle_anims/sprites/finger_2.4bpp.lz graphics/battle_anims/sprites/fire.4bpp.lz graphics/battle_anims/sprites/fire.gbapal.lz graphics/battle_anims/sprites/fire_plume.4bpp.lz graphics/battle_anims/sprites/flat_rock.4bpp.lz graphics/battle_anims/sprites/flat_rock.gbapal.lz graphics/battle_anims/sprites/flower.4bpp.lz graphics/battle_anims/sprites/flower.gbapal.lz graphics/battle_anims/sprites/flying_dirt.4bpp.lz graphics/battle_anims/sprites/flying_dirt.gbapal.lz graphics/battle_anims/sprites/focus_energy.4bpp.lz graphics/battle_anims/sprites/focus_energy.gbapal.lz graphics/battle_anims/sprites/fresh_egg.4bpp.lz graphics/battle_anims/sprites/fresh_egg.gbapal.lz graphics/battle_anims/sprites/fury_swipes.4bpp.lz graphics/battle_anims/sprites/fury_swipes.gbapal.lz graphics/battle_anims/sprites/gem_1.4bpp.lz graphics/battle_anims/sprites/gem_1.gbapal.lz graphics/battle_anims/sprites/gem_2.4bpp.lz graphics/battle_anims/sprites/gem_3.4bpp.lz graphics/battle_anims/sprites/ghostly_spirit.4bpp.lz graphics/battle_anims/sprites/ghostly_spirit.gbapal.lz graphics/battle_anims/sprites/glass.4bpp.lz graphics/battle_anims/sprites/glass.gbapal.lz graphics/battle_anims/sprites/glass_2.4bpp.lz graphics/battle_anims/sprites/glass_2.gbapal.lz graphics/battle_anims/sprites/glowy_blue_orb.gbapal.lz graphics/battle_anims/sprites/glowy_green_orb.gbapal.lz graphics/battle_anims/sprites/glowy_red_orb.4bpp.lz graphics/battle_anims/sprites/glowy_red_orb.gbapal.lz graphics/battle_anims/sprites/gold_ring.4bpp.lz graphics/battle_anims/sprites/gold_ring.gbapal.lz graphics/battle_anims/sprites/gold_stars.4bpp.lz graphics/battle_anims/sprites/gold_stars.gbapal.lz graphics/battle_anims/sprites/gray_light_wall.gbapal.lz graphics/battle_anims/sprites/gray_orb.4bpp.lz graphics/battle_anims/sprites/gray_orb.gbapal.lz graphics/battle_anims/sprites/gray_smoke.4bpp.lz graphics/battle_anims/sprites/gray_smoke.gbapal.lz graphics/battle_anims/sprites/green_light_wall.4bpp.lz graphics/battle_anims/sprites/green_light_wall.gbapal.lz graphics/battle_anims/sprites/green_sparkle.4bpp.lz graphics/battle_anims/sprites/green_sparkle.gbapal.lz graphics/battle_anims/sprites/green_spike.4bpp.lz graphics/battle_anims/sprites/green_spike.gbapal.lz graphics/battle_anims/sprites/green_star.4bpp.lz graphics/battle_anims/sprites/green_star.gbapal.lz graphics/battle_anims/sprites/guard_ring.4bpp.lz graphics/battle_anims/sprites/guard_ring.gbapal.lz graphics/battle_anims/sprites/gust.4bpp.lz graphics/battle_anims/sprites/gust.gbapal.lz graphics/battle_anims/sprites/hail.4bpp.lz graphics/battle_anims/sprites/hail.gbapal.lz graphics/battle_anims/sprites/hands_and_feet.4bpp.lz graphics/battle_anims/sprites/hands_and_feet.gbapal.lz graphics/battle_anims/sprites/hatched_egg.4bpp.lz graphics/battle_anims/sprites/hit.4bpp.lz graphics/battle_anims/sprites/hit.gbapal.lz graphics/battle_anims/sprites/hit_2.gbapal.lz graphics/battle_anims/sprites/hit_duplicate.4bpp.lz graphics/battle_anims/sprites/hit_duplicate.gbapal.lz graphics/battle_anims/sprites/hollow_orb.4bpp.lz graphics/battle_anims/sprites/hollow_orb.gbapal.lz graphics/battle_anims/sprites/horn_hit.4bpp.lz graphics/battle_anims/sprites/horn_hit.gbapal.lz graphics/battle_anims/sprites/horn_hit_2.4bpp.lz graphics/battle_anims/sprites/horn_hit_2.gbapal.lz graphics/battle_anims/sprites/humanoid_foot.4bpp.lz graphics/battle_anims/sprites/humanoid_foot.gbapal.lz graphics/battle_anims/sprites/humanoid_hand.4bpp.lz graphics/battle_anims/sprites/ice_chunk.4bpp.lz graphics/battle_anims/sprites/ice_chunk.gbapal.lz graphics/battle_anims/sprites/ice_crystals.4bpp.lz graphics/battle_anims/sprites/ice_crystals.gbapal.lz graphics/battle_anims/sprites/ice_cube.4bpp.lz graphics/battle_anims/sprites/ice_cube.gbapal.lz graphics/battle_anims/sprites/ice_spikes.4bpp.lz graphics/battle_anims/sprites/icicle_spear.4bpp.lz graphics/battle_anims/sprites/icicle_spear.gbapal.lz graphics/battle_anims/sprites/impact.4bpp.lz graphics/battle_anims/sprites/impact.gbapal.lz graphics/battle_anims/sprites/impact_2.4bpp.lz graphics/battle_anims/sprites/impact_2.gbapal.lz graphics/battle_anims/sprites/impact_3.4bpp.lz graphics/battle_anims/sprites/impact_3.gbapal.lz graphics/battle_anims/sprites/item_bag.4bpp.lz graphics/battle_anims/sprites/item_bag.gbapal.lz graphics/battle_anims/sprites/jagged_music_note.4bpp.lz graphics/battle_anims/sprites/jagged_music_note.gbapal.lz graphics/battle_anims/sprites/large_fresh_egg.4bpp.lz graphics/battle_anims/sprites/large_fresh_egg.gbapal.lz graphics/battle_anims/sprites/leaf.4bpp.lz graphics/battle_anims/sprites/leaf.gbapal.lz graphics/battle_anims/sprites/leer.4bpp.lz graphics/battle_anims/sprites/leer.gbapal.lz graphics/battle_anims/sprites/letter_z.4bpp.lz graphics/battle_anims/sprites/letter_z.gbapal.lz graphics/battle_anims/sprites/lick.4bpp.lz graphics/battle_anims/sprites/lick.gbapal.lz graphics/battle_anims/sprites/lightbulb.4bpp.lz graphics/battle_anims/sprites/lightbulb.gbapal.lz graphics/battle_anims/sprites/lightning.4bpp.lz graphics/battle_anims/sprites/lightning_2.4bpp.lz graphics/battle_anims/sprites/lightning_2.gbapal.lz graphics/battle_anims/sprites/lock_on.4bpp.lz graphics/battle_anims/sprites/lock_on.gbapal.lz graphics/battle_anims/sprites/magenta_heart.4bpp.lz graphics/battle_anims/sprites/magenta_heart.gbapal.lz graphics/battle_anims/sprites/magnifying_glass.4bpp.lz graphics/battle_anims/sprites/magnifying_glass.gbapal.lz graphics/battle_anims/sprites/metal_ball.4bpp.lz graphics/battle_anims/sprites/metal_ball.gbapal.lz graphics/battle_anims/sprites/metal_sound_waves.4bpp.lz graphics/battle_anims/sprites/metal_sound_waves.gbapal.lz graphics/battle_anims/sprites/meteor.4bpp.lz graphics/battle_anims/sprites/meteor.gbapal.lz graphics/battle_anims/sprites/milk_bottle.4bpp.lz graphics/battle_anims/sprites/milk_bottle.gbapal.lz graphics/battle_anims/sprites/mist_cloud.4bpp.lz graphics/battle_anims/sprites/mist_cloud.gbapal.lz graphics/battle_anims/sprites/monster_doll.4bpp.lz graphics/battle_anims/sprites/monster_doll.gbapal.lz graphics/battle_anims/sprites/monster_foot.4bpp.lz graphics/battle_anims/sprites/moon.4bpp.lz graphics/battle_anims/sprites/moon.gbapal.lz graphics/battle_anims/sprites/movement_waves.4bpp.lz graphics/battle_anims/sprites/movement_waves.gbapal.lz graphics/battle_anims/sprites/mud_sand.4bpp.lz graphics/battle_anims/sprites/mud_sand.gbapal.lz graphics/battle_anims/sprites/mud_unk.4bpp.lz graphics/battle_anims/sprites/mud_unk.gbapal.lz graphics/battle_anims/sprites/music_notes.4bpp.lz graphics/battle_anims/sprites/music_notes.gbapal.lz graphics/battle_anims/sprites/music_notes_2.4bpp.lz graphics/battle_anims/sprites/music_notes_2.gbapal.lz graphics/battle_anims/sprites/nail.4bpp.lz graphics/battle_anims/sprites/nail.gbapal.lz graphics/battle_anims/sprites/needle.4bpp.lz graphics/battle_anims/sprites/needle.gbapal.lz graphics/battle_anims/sprites/noise_line.4bpp.lz graphics/battle_anims/sprites/opening_eye.4bpp.lz graphics/battle_anims/sprites/opening_eye.gbapal.lz graphics/battle_anims/sprites/orange.4bpp.lz graphics/battle_anims/sprites/orange.gbapal.lz graphics/battle_anims/sprites/orange_light_wall.gbapal.lz graphics/battle_anims/sprites/orb.4bpp.lz graphics/battle_anims/sprites/orb.gbapal.lz graphics/battle_anims/sprites/orbs.4bpp.lz graphics/battle_anims/sprites/orbs.gbapal.lz graphics/battle_anims/sprites/pain_split.4bpp.lz graphics/battle_anims/sprites/pain_split.gbapal.lz graphics/battle_anims/sprites/particles.4bpp.lz graphics/battle_anims/sprites/paw_print.4bpp.lz graphics/battle_anims/sprites/paw_print.gbapal.lz graphics/battle_anims/sprites/pencil.4bpp.lz graphics/battle_anims/sprites/pencil.gbapal.lz graphics/battle_anims/sprites/pencil_2.4bpp.lz graphics/battle_anims/sprites/pencil_2.gbapal.lz graphics/battle_anims/sprites/petal.4bpp.lz graphics/battle_anims/sprites/petal.gbapal.lz graphics/battle_anims/sprites/pink_cloud.4bpp.lz graphics/battle_anims/sprites/pink_cloud.gbapal.lz graphics/battle_anims/sprites/pink_glove.4bpp.lz graphics/battle_anims/sprites/pink_glove.gbapal.lz graphics/battle_anims/sprites/pink_heart.gbapal.lz graphics/battle_anims/sprites/pink_heart_2.4bpp.lz graphics/battle_anims/sprites/pink_heart_2.gbapal.lz graphics/battle_anims/sprites/pink_orb.4bpp.lz graphics/battle_anims/sprites/pink_orb.gbapal.lz graphics/battle_anims/sprites/pink_petal.4bpp.lz graphics/battle_anims/sprites/pink_petal.gbapal.lz graphics/battle_anims/sprites/poison_bubble.4bpp.lz graphics/battle_anims/sprites/poison_bubble.gbapal.lz graphics/battle_anims/sprites/poison_powder.4bpp.lz graphics/battle_anims/sprites/poison_powder.gbapal.lz graphics/battle_anims/sprites/pokeball.4bpp.lz graphics/battle_anims/sprites/pokeball.gbapal.lz graphics/battle_anims/sprites/protect.4bpp.lz graphics/battle_anims/sprites/protect.gbapal.lz graphics/battle_anims/sprites/punch_impact.4bpp.lz graphics/battle_anims/sprites/punch_impact.gbapal.lz graphics/battle_anims/sprites/purple_coral.4bpp.lz graphics/battle_anims/sprites/purple_coral.gbapal.lz graphics/battle_anims/sprites/purple_droplet.4bpp.lz graphics/battle_anims/sprites/purple_flame.4bpp.lz graphics/battle_anims/sprites/purple_flame.gbapal.lz graphics/battle_anims/sprites/purple_gas_cloud.gbapal.lz graphics/battle_anims/sprites/purple_green_unk.4bpp.lz graphics/battle_anims/sprites/purple_green_unk.gbapal.lz graphics/battle_anims/sprites/purple_hand_outline.4bpp.lz graphics/battle_anims/sprites/purple_hand_outline.gbapal.lz graphics/battle_anims/sprites/purple_ring.gbapal.lz graphics/battle_anims/sprites/purple_scratch.4bpp.lz graphics/battle_anims/sprites/purple_scratch.gbapal.lz graphics/battle_anims/sprites/purple_swipe.4bpp.lz graphics/battle_anims/sprites/rain_drops.4bpp.lz graphics/battle_anims/sprites/rain_drops.gbapal.lz graphics/battle_anims/sprites/rainbow_rings.4bpp.lz graphics/battle_anims/sprites/rainbow_rings.gbapal.lz graphics/battle_anims/sprites/rapid_spin.4bpp.lz graphics/battle_anims/sprites/rapid_spin.gbapal.lz graphics/battle_anims/sprites/razor_leaf.4bpp.lz graphics/battle_anims/sprites/razor_leaf.gbapal.lz graphics/battle_anims/sprites/recycle.4bpp.lz graphics/battle_anims/sprites/recycle.gbapal.lz graphics/battle_anims/sprites/red_ball.4bpp.lz graphics/battle_anims/sprites/red_ball.gbapal.lz graphics/battle_anims/sprites/red_fist.4bpp.lz graphics/battle_anims/sprites/red_heart.gbapal.lz graphics/battle_anims/sprites/red_light_wall.gbapal.lz graphics/battle_anims/sprites/red_orb.4bpp.lz graphics/battle_anims/sprites/red_orb.gbapal.lz graphics/battle_anims/sprites/red_orb_2.gbapal.lz graphics/battle_anims/sprites/red_particles.4bpp.lz graphics/battle_anims/sprites/red_particles.gbapal.lz graphics/battle_anims/sprites/red_tube.4bpp.lz graphics/battle_anims/sprites/red_tube.gbapal.lz graphics/battle_anims/sprites/red_wand.4bpp.lz graphics/battle_anims/sprites/red_wand.gbapal.lz graphics/battle_anims/sprites/reticle.4bpp.lz graphics/battle_anims/sprites/reticle.gbapal.lz graphics/battle_anims/sprites/ring.4bpp.lz graphics/battle_anims/sprites/ring.gbapal.lz graphics/battle_anims/sprites/rocks.4bpp.lz graphics/battle_anims/sprites/rocks.gbapal.lz graphics/battle_anims/sprites/roots.4bpp.lz graphics/battle_anims/sprites/roots.gbapal.lz graphics/battle_anims/sprites/round_shadow.4bpp.lz graphics/battle_anims/sprites/round_shadow.gbapal.lz graphics/battle_anims/sprites/round_white_halo.4bpp.lz graphics/battle_anims/sprites/round_white_halo.gbapal.lz graphics/battle_anims/sprites/safari_bait.4bpp.lz graphics/battle_anims/sprites/safari_bait.gbapal.lz graphics/battle_anims/sprites/sap_drip.4bpp.lz graphics/battle_anims/sprites/sap_drip.gbapal.lz graphics/battle_anims/sprites/sap_drip_2.gbapal.lz graphics/battle_anims/sprites/scratch.4bpp.lz graphics/battle_anims/sprites/scratch_2.4bpp.lz graphics/battle_anims/sprites/scratch_3.4bpp.lz graphics/battle_anims/sprites/seed.4bpp.lz graphics/battle_anims/sprites/seed.gbapal.lz graphics/battle_anims/sprites/seed_2.4bpp.lz graphics/battle_anims/sprites/seed_2.gbapal.lz graphics/battle_anims/sprites/shadow_ball.4bpp.lz graphics/battle_anims/sprites/shadow_ball.gbapal.lz graphics/battle_anims/sprites/sharp_teeth.4bpp.lz graphics/battle_anims/sprites/sharp_teeth.gbapal.lz graphics/battle_anims/sprites/shock.4bpp.lz graphics/battle_anims/sprites/shock_2.4bpp.lz graphics/battle_anims/sprites/shock_2.gbapal.lz graphics/battle_anims/sprites/shock_3.4bpp.lz graphics/battle_anims/sprites/shock_3.gbapal.lz graphics/battle_anims/sprites/shock_4.4bpp.lz graphics/battle_anims/sprites/shock_4.gbapal.lz graphics/battle_anims/sprites/slam_hit.4bpp.lz graphics/battle_anims/sprites/slam_hit.gbapal.lz graphics/battle_anims/sprites/slam_hit_2.4bpp.lz graphics/battle_anims/sprites/slam_hit_2.gbapal.lz graphics/battle_anims/sprites/slash.4bpp.lz graphics/battle_anims/sprites/slash.gbapal.lz graphics/battle_anims/sprites/slash_2.gbapal.lz graphics/battle_anims/sprites/sleep_powder.gbapal.lz graphics/battle_anims/sprites/small_bubbles.4bpp.lz graphics/battle_anims/sprites/small_bubbles.gbapal.lz graphics/battle_anims/sprites/small_ember.4bpp.lz graphics/battle_anims/sprites/small_ember.gbapal.lz graphics/battle_anims/sprites/small_red_eye.4bpp.lz graphics/battle_anims/sprites/small_red_eye.gbapal.lz graphics/battle_anims/sprites/smellingsalt_effect.4bpp.lz graphics/battle_anims/sprites/smellingsalt_effect.gbapal.lz graphics/battle_anims/sprites/smoke.4bpp.lz graphics/battle_anims/sprites/smoke.gbapal.lz graphics/battle_anims/sprites/smoke_2.4bpp.lz graphics/battle_anims/sprites/smokescreen_impact.4bpp.lz graphics/battle_anims/sprites/smokescreen_impact.gbapal.lz graphics/battle_anims/sprites/snore_z.4bpp.lz graphics/battle_anims/sprites/snore_z.gbapal.lz graphics/battle_anims/sprites/snowball.4bpp.lz graphics/battle_anims/sprites/snowball.gbapal.lz graphics/battle_anims/sprites/spark.4bpp.lz graphics/battle_anims/sprites/spark.gbapal.lz graphics/battle_anims/sprites/spark_2.4bpp.lz graphics/battle_anims/sprites/spark_2.gbapal.lz graphics/battle_anims/sprites/spark_h.4bpp.lz graphics/battle_anims/sprites/sparkle_1.4bpp.lz graphics/battle_anims/sprites/sparkle_1.gbapal.lz graphics/battle_anims/sprites/sparkle_2.gbapal.lz graphics/battle_anims/sprites/sparkle_3.4bpp.lz graphics/battle_anims/sprites/sparkle_3.gbapal.lz graphics/battle_anims/sprites/sparkle_4.4bpp.lz graphics/battle_anims/sprites/sparkle_6.4bpp.lz graphics/battle_anims/sprites/sparkle_6.gbapal.lz graphics/battle_anims/sprites/speed_dust.4bpp.lz graphics/battle_anims/sprites/speed_dust.gbapal.lz graphics/battle_anims/sprites/sphere_to_cube.4bpp.lz graphics/battle_anims/sprites/sphere_to_cube.gbapal.lz graphics/battle_anims/sprites/spider_web.4bpp.lz graphics/battle_anims/sprites/spikes.4bpp.lz graphics/battle_anims/sprites/spikes.gbapal.lz graphics/battle_anims/sprites/spinning_fire.4bpp.lz graphics/battle_anims/sprites/spinning_green_orbs.4bpp.lz graphics/battle_anims/sprites/spinning_green_orbs.gbapal.lz graphics/battle_anims/sprites/spiral.4bpp.lz graphics/battle_anims/sprites/spiral.gbapal.lz graphics/battle_anims/sprites/splash.4bpp.lz graphics/battle_anims/sprites/splash.gbapal.lz graphics/battle_anims/sprites/spore.4bpp.lz graphics/battle_anims/sprites/spore.gbapal.lz graphics/battle_anims/sprites/spotlight.4bpp.lz graphics/battle_anims/sprites/sprout.4bpp.lz graphics/battle_anims/sprites/string.4bpp.lz graphics/battle_anims/sprites/string.gbapal.lz graphics/battle_anims/sprites/string_2.4bpp.lz graphics/battle_anims/sprites/string_2.gbapal.lz graphics/battle_anims/sprites/stun_spore.gbapal.lz graphics/battle_anims/sprites/substitute.4bpp.lz graphics/battle_anims/sprites/substitute.gbapal.lz graphics/battle_anims/sprites/substitute_back.4bpp.lz graphics/battle_anims/sprites/sunlight.4bpp.lz graphics/battle_anims/sprites/sunlight.gbapal.lz graphics/battle_anims/sprites/sweat_bead.4bpp.lz graphics/battle_anims/sprites/sweat_drop.4bpp.lz graphics/battle_anims/sprites/sweat_drop.gbapal.lz graphics/battle_anims/sprites/swipe.4bpp.lz graphics/battle_anims/sprites/swipe.gbapal.lz graphics/battle_anims/sprites/sword.4bpp.lz graphics/battle_anims/sprites/sword.gbapal.lz graphics/battle_anims/sprites/sword_2.4bpp.lz graphics/battle_anims/sprites/sword_2.gbapal.lz graphics/battle_anims/sprites/tag_hand.4bpp.lz graphics/battle_anims/sprites/teal_alert.4bpp.lz graphics/battle_anims/sprites/teal_alert.gbapal.lz graphics/battle_anims/sprites/teeth.4bpp.lz graphics/battle_anims/sprites/teeth.gbapal.lz graphics/battle_anims/sprites/tendrils.4bpp.lz graphics/battle_anims/sprites/tendrils.gbapal.lz graphics/battle_anims/sprites/thin_ring.4bpp.lz graphics/battle_anims/sprites/thin_ring.gbapal.lz graphics/battle_anims/sprites/thought_bubble.4bpp.lz graphics/battle_anims/sprites/thought_bubble.gbapal.lz graphics/battle_anims/sprites/tied_bag.4bpp.lz graphics/battle_anims/sprites/tied_bag.gbapal.lz graphics/battle_anims/sprites/tongue.4bpp.lz graphics/battle_anims/sprites/tongue.gbapal.lz graphics/battle_anims/sprites/torn_metal.4bpp.lz graphics/battle_anims/sprites/toxic_bubble.4bpp.lz graphics/battle_anims/sprites/tri_attack_triangle.4bpp.lz graphics/battle_anims/sprites/tri_attack_triangle.gbapal.lz graphics/battle_anims/sprites/unknown.4bpp.lz graphics/battle_anims/sprites/unknown.gbapal.lz graphics/battle_anims/sprites/vine.4bpp.lz graphics/battle_anims/sprites/vine.gbapal.lz graphics/battle_anims/sprites/vine_2.4bpp.lz graphics/battle_anims/sprites/vine_2.gbapal.lz graphics/battle_anims/sprites/void_lines.4bpp.lz graphics/battle_anims/sprites/void_lines.gbapal.lz graphics/battle_anims/sprites/warm_rock.4bpp.lz graphics/battle_anims/sprites/warm_rock.gbapal.lz graphics/battle_anims/sprites/water_column.4bpp.lz graphics/battle_anims/sprites/water_column.gbapal.lz graphics/battle_anims/sprites/water_droplet.4bpp.lz graphics/battle_anims/sprites/water_droplet.gbapal.lz graphics/battle_anims/sprites/water_droplet_2.4bpp.lz graphics/battle_anims/sprites/water_impact.4bpp.lz graphics/battle_anims/sprites/water_impact.gbapal.lz graphics/battle_anims/sprites/water_orb.4bpp.lz graphics/battle_anims/sprites/waving_hand.4bpp.lz graphics/battle_anims/sprites/waving_hand.gbapal.lz graphics/battle_anims/sprites/weather_ball.4bpp.lz graphics/battle_anims/sprites/weather_ball.gbapal.lz graphics/battle_anims/sprites/web.4bpp.lz graphics/battle_anims/sprites/web_thread.4bpp.lz graphics/battle_anims/sprites/whip_hit.gbapal.lz graphics/battle_anims/sprites/whirlwind.4bpp.lz graphics/battle_anims/sprites/whirlwind.gbapal.lz graphics/battle_anims/sprites/whirlwind_2.4bpp.lz graphics/battle_anims/sprites/whirlwind_lines.4bpp.lz graphics/battle_anims/sprites/whirlwind_lines.gbapal.lz graphics/battle_anims/sprites/white_bag.4bpp.lz graphics/battle_anims/sprites/white_bag.gbapal.lz graphics/battle_anims/sprites/white_circle_of_light.gbapal.lz graphics/battle_anims/sprites/white_feather.4bpp.lz graphics/battle_anims/sprites/white_feather.gbapal.lz graphics/battle_anims/sprites/white_shadow.4bpp.lz graphics/battle_anims/sprites/white_shadow.gbapal.lz graphics/battle_anims/sprites/wisp_fire.4bpp.lz graphics/battle_anims/sprites/wisp_orb.4bpp.lz graphics/battle_anims/sprites/wisp_orb.gbapal.lz graphics/battle_anims/sprites/x_sign.4bpp.lz graphics/battle_anims/sprites/yellow_ball.4bpp.lz graphics/battle_anims/sprites/yellow_ball.gbapal.lz graphics/battle_anims/sprites/yellow_star.4bpp.lz graphics/battle_anims/sprites/yellow_star.gbapal.lz graphics/battle_anims/sprites/yellow_unk.4bpp.lz graphics/battle_anims/sprites/yellow_unk.gbapal.lz graphics/battle_anims/sprites/yellow_unk_2.4bpp.lz graphics/battle_anims/sprites/yellow_unk_2.gbapal.lz graphics/battle_anims/sprites/z.4bpp.lz graphics/battle_anims/sprites/z.gbapal.lz graphics/battle_anims/unused/flying.gbapal graphics/battle_anims/unused/lights.4bpp.lz graphics/battle_anims/unused/lights.bin.lz graphics/battle_anims/unused/lights.gbapal.lz graphics/battle_anims/unused/line_sketch_2.8bpp.lz graphics/battle_anims/unused/line_sketch_2.bin.lz graphics/battle_anims/unused/line_sketch_2.gbapal.lz graphics/battle_anims/unused/spinning_ball.4bpp.lz graphics/battle_anims/unused/spinning_ball.gbapal.lz graphics/battle_anims/unused/spinning_ball_2.gbapal.lz graphics/battle_anims/unused/unknown.gbapal graphics/battle_anims/unused/unknown_4.bin.lz graphics/battle_anims/unused/water.4bpp graphics/battle_interface/enemy_mon_shadow.4bpp.lz graphics/battle_interface/healthbar.gbapal graphics/battle_interface/healthbox.gbapal graphics/battle_interface/healthbox_doubles_opponent.4bpp.lz graphics/battle_interface/healthbox_doubles_player.4bpp.lz graphics/battle_interface/healthbox_elements.4bpp graphics/battle_interface/healthbox_safari.4bpp.lz graphics/battle_interface/healthbox_singles_opponent.4bpp.lz graphics/battle_interface/healthbox_singles_player.4bpp.lz graphics/battle_interface/level_up_banner.4bpp.lz graphics/battle_interface/level_up_banner.gbapal graphics/battle_interface/party_summary_bar.4bpp.lz graphics/battle_interface/textbox.4bpp.lz graphics/battle_interface/textbox.bin.lz graphics/battle_interface/textbox.gbapal.lz graphics/battle_interface/unused.4bpp graphics/battle_interface/unused_window.4bpp.lz graphics/battle_interface/unused_window.gbapal.lz graphics/battle_interface/unused_window2.4bpp.lz graphics/battle_interface/unused_window2bar.4bpp.lz graphics/battle_interface/unused_window3.4bpp.lz graphics/battle_interface/unused_window4.4bpp.lz graphics/battle_records/bg_tiles.4bpp graphics/battle_records/bg_tiles.gbapal graphics/battle_terrain/building/anim.4bpp.lz graphics/battle_terrain/building/anim.bin.lz graphics/battle_terrain/building/terrain.4bpp.lz graphics/battle_terrain/building/terrain.bin.lz graphics/battle_terrain/building/terrain.gbapal.lz graphics/battle_terrain/cave/anim.4bpp.lz graphics/battle_terrain/cave/anim.bin.lz graphics/battle_terrain/cave/terrain.4bpp.lz graphics/battle_terrain/cave/terrain.bin.lz graphics/battle_terrain/cave/terrain.gbapal.lz graphics/battle_terrain/grass/anim.4bpp.lz graphics/battle_terrain/grass/anim.bin.lz graphics/battle_terrain/grass/terrain.4bpp.lz graphics/battle_terrain/grass/terrain.bin.lz graphics/battle_terrain/grass/terrain.gbapal.lz graphics/battle_terrain/indoor/1.gbapal.lz graphics/battle_terrain/indoor/2.gbapal.lz graphics/battle_terrain/indoor/agatha.gbapal.lz graphics/battle_terrain/indoor/bruno.gbapal.lz graphics/battle_terrain/indoor/champion.gbapal.lz graphics/battle_terrain/indoor/gym.gbapal.lz graphics/battle_terrain/indoor/lance.gbapal.lz graphics/battle_terrain/indoor/leader.gbapal.lz graphics/battle_terrain/indoor/link.gbapal.lz graphics/battle_terrain/indoor/lorelei.gbapal.lz graphics/battle_terrain/indoor/plain.gbapal.lz graphics/battle_terrain/indoor/terrain.4bpp.lz graphics/battle_terrain/indoor/terrain.bin.lz graphics/battle_terrain/longgrass/anim.4bpp.lz graphics/battle_terrain/longgrass/anim.bin.lz graphics/battle_terrain/longgrass/terrain.4bpp.lz graphics/battle_terrain/longgrass/terrain.bin.lz graphics/battle_terrain/longgrass/terrain.gbapal.lz graphics/battle_terrain/mountain/anim.4bpp.lz graphics/battle_terrain/mountain/anim.bin.lz graphics/battle_terrain/mountain/terrain.4bpp.lz graphics/battle_terrain/mountain/terrain.bin.lz graphics/battle_terrain/mountain/terrain.gbapal.lz graphics/battle_terrain/pond/anim.4bpp.lz graphics/battle_terrain/pond/anim.bin.lz graphics/battle_terrain/pond/terrain.4bpp.lz graphics/battle_terrain/pond/terrain.bin.lz graphics/battle_terrain/pond/terrain.gbapal.lz graphics/battle_terrain/sand/anim.4bpp.lz graphics/battle_terrain/sand/anim.bin.lz graphics/battle_terrain/sand/terrain.4bpp.lz graphics/battle_terrain/sand/terrain.bin.lz graphics/battle_terrain/sand/terrain.gbapal.lz graphics/battle_terrain/underwater/anim.4bpp.lz graphics/battle_terrain/underwater/anim.bin.lz graphics/battle_terrain/underwater/terrain.4bpp.lz graphics/battle_terrain/underwater/terrain.bin.lz graphics/battle_terrain/underwater/terrain.gbapal.lz graphics/battle_terrain/unused/building/anim_map.bin.lz graphics/battle_terrain/unused/building/anim_tiles.4bpp.lz graphics/battle_terrain/unused/building/map.bin.lz graphics/battle_terrain/unused/building/palette.gbapal.lz graphics/battle_terrain/unused/building/palette2.gbapal.lz graphics/battle_terrain/unused/building/palette3.gbapal.lz graphics/battle_terrain/unused/building/tiles.4bpp.lz graphics/battle_terrain/unused/groudon.gbapal.lz graphics/battle_terrain/unused/kyogre.gbapal.lz graphics/battle_terrain/unused/plain.gbapal.lz graphics/battle_terrain/unused/stadium/battle_frontier.gbapal.lz graphics/battle_terrain/unused/stadium/map.bin.lz graphics/battle_terrain/unused/stadium/palette1.gbapal.lz graphics/battle_terrain/unused/stadium/palette2.gbapal.lz graphics/battle_terrain/unused/stadium/palette3.gbapal.lz graphics/battle_terrain/unused/stadium/palette4.gbapal.lz graphics/battle_terrain/unused/stadium/palette5.gbapal.lz graphics/battle_terrain/unused/stadium/palette6.gbapal.lz graphics/battle_terrain/unused/stadium/palette7.gbapal.lz graphics/battle_terrain/unused/stadium/tiles.4bpp.lz graphics/battle_terrain/water/anim.4bpp.lz graphics/battle_terrain/water/anim.bin.lz graphics/battle_terrain/water/terrain.4bpp.lz graphics/battle_terrain/water/terrain.bin.lz graphics/battle_terrain/water/terrain.gbapal.lz graphics/battle_transitions/agatha_bg.gbapal graphics/battle_transitions/big_pokeball.4bpp graphics/battle_transitions/blue_bg.gbapal graphics/battle_transitions/bruno_bg.gbapal graphics/battle_transitions/green_bg.gbapal graphics/battle_transitions/grid_square.4bpp graphics/battle_transitions/lance_bg.gbapal graphics/battle_transitions/lorelei_bg.gbapal graphics/battle_transitions/mugshot_banner.4bpp graphics/battle_transitions/red_bg.gbapal graphics/battle_transitions/sliding_pokeball.4bpp graphics/battle_transitions/sliding_pokeball.gbapal graphics/battle_transitions/unused_brendan.4bpp graphics/battle_transitions/unused_lass.4bpp graphics/battle_transitions/unused_trainer.gbapal graphics/battle_transitions/vs.4bpp.lz graphics/battle_transitions/vs_frame.4bpp.lz graphics/battle_transitions/vs_frame.bin.lz graphics/battle_transitions/vs_frame.gbapal.lz graphics/berry_blender/center.8bpp.lz graphics/berry_blender/outer.4bpp.lz graphics/berry_blender/outer_map.bin.lz graphics/berry_crush/bg.bin.lz graphics/berry_crush/container_cap.bin.lz graphics/berry_crush/crusher.4bpp.lz graphics/berry_crush/crusher.gbapal graphics/berry_crush/crusher_base.4bpp.lz graphics/berry_crush/crusher_base.gbapal graphics/berry_crush/crusher_top.bin.lz graphics/berry_crush/impact.4bpp.lz graphics/berry_crush/impact.gbapal graphics/berry_crush/sparkle.4bpp.lz graphics/berry_crush/text_windows.bin.lz graphics/berry_crush/timer_digits.4bpp.lz graphics/berry_crush/timer_digits.gbapal graphics/berry_fix/gba_small.4bpp.lz graphics/berry_fix/gba_small.bin.lz graphics/berry_fix/gba_small.gbapal graphics/berry_fix/gba_transfer.4bpp.lz graphics/berry_fix/gba_transfer.bin.lz graphics/berry_fix/gba_transfer.gbapal graphics/berry_fix/gba_transfer_error.4bpp.lz graphics/berry_fix/gba_transfer_error.bin.lz graphics/berry_fix/gba_transfer_error.gbapal graphics/berry_fix/gba_transfer_highlight.4bpp.lz graphics/berry_fix/gba_transfer_highlight.bin.lz graphics/berry_fix/gba_transfer_highlight.gbapal graphics/berry_fix/logo.4bpp.lz graphics/berry_fix/logo.bin.lz graphics/berry_fix/logo.gbapal graphics/berry_fix/window.4bpp.lz graphics/berry_fix/window.bin.lz graphics/berry_fix/window.gbapal graphics/berry_pouch/background.4bpp.lz graphics/berry_pouch/background.bin.lz graphics/berry_pouch/background.gbapal.lz graphics/berry_pouch/background_female.gbapal.lz graphics/berry_pouch/berry_pouch.4bpp.lz graphics/berry_pouch/berry_pouch.gbapal.lz graphics/cave_transition/black.gbapal graphics/cave_transition/enter.gbapal graphics/cave_transition/exit.gbapal graphics/cave_transition/tilemap.bin.lz graphics/cave_transition/tiles.4bpp.lz graphics/cave_transition/white.gbapal graphics/contest/applause.4bpp.lz graphics/contest/applause_meter.4bpp graphics/contest/audience.4bpp.lz graphics/contest/audience.bin.lz graphics/contest/curtain.bin.lz graphics/contest/faces.4bpp.lz graphics/contest/interface.4bpp.lz graphics/contest/interface.bin.lz graphics/contest/interface.gbapal.lz graphics/contest/japanese/audience.bin.lz graphics/contest/japanese/bg.bin.lz graphics/contest/japanese/composite_1.4bpp.lz graphics/contest/japanese/composite_2.4bpp.lz graphics/contest/japanese/interface.bin.lz graphics/contest/japanese/numbers.4bpp.lz graphics/contest/japanese/numbers.gbapal.lz graphics/contest/japanese/palette.gbapal.lz graphics/contest/japanese/results.4bpp.lz graphics/contest/japanese/voltage.4bpp.lz graphics/contest/japanese/voltage.gbapal.lz graphics/contest/japanese/windows.bin.lz graphics/contest/judge.4bpp.lz graphics/contest/judge.gbapal.lz graphics/contest/judge_symbols.4bpp.lz graphics/contest/judge_symbols.gbapal.lz graphics/contest/next_turn.4bpp.lz graphics/contest/next_turn.gbapal graphics/contest/next_turn_numbers.4bpp graphics/contest/next_turn_random.4bpp graphics/contest/results.gbapal.lz graphics/contest/results_bg.bin.lz graphics/contest/results_interface.bin.lz graphics/contest/results_winner_banner.bin.lz graphics/contest/slider_heart.4bpp graphics/credits/blastoise_1.4bpp.lz graphics/credits/blastoise_2.4bpp.lz graphics/credits/charizard_1.4bpp.lz graphics/credits/charizard_2.4bpp.lz graphics/credits/copyright.4bpp.lz graphics/credits/copyright.bin.lz graphics/credits/copyright.gbapal graphics/credits/ground_city.4bpp.lz graphics/credits/ground_city.gbapal graphics/credits/ground_dirt.4bpp.lz graphics/credits/ground_dirt.gbapal graphics/credits/ground_grass.4bpp.lz graphics/credits/ground_grass.gbapal graphics/credits/pikachu_1.4bpp.lz graphics/credits/pikachu_2.4bpp.lz graphics/credits/player_female.4bpp.lz graphics/credits/player_female.gbapal graphics/credits/player_male.4bpp.lz graphics/credits/player_male.gbapal graphics/credits/pokeball.4bpp.lz graphics/credits/pokeball.bin.lz graphics/credits/pokeball_blastoise.gbapal graphics/credits/pokeball_charizard.gbapal graphics/credits/pokeball_pikachu.gbapal graphics/credits/pokeball_venusaur.gbapal graphics/credits/rival.4bpp.lz graphics/credits/rival.gbapal graphics/credits/the_end.4bpp.lz graphics/credits/the_end.bin.lz graphics/credits/the_end.gbapal graphics/credits/venusaur_1.4bpp.lz graphics/credits/venusaur_2.4bpp.lz graphics/credits/venusaur_unused.4bpp.lz graphics/credits/white_circle.8bpp.lz graphics/credits/white_circle.bin.lz graphics/credits/white_circle.gbapal graphics/diploma/diploma.4bpp.lz graphics/diploma/diploma.bin.lz graphics/diploma/diploma.gbapal graphics/dodrio_berry_picking/berries.4bpp.lz graphics/dodrio_berry_picking/berries.gbapal graphics/dodrio_berry_picking/bg.4bpp.lz graphics/dodrio_berry_picking/bg.bin.lz graphics/dodrio_berry_picking/bg.gbapal graphics/dodrio_berry_picking/cloud.4bpp.lz graphics/dodrio_berry_picking/cloud.gbapal graphics/dodrio_berry_picking/dodrio.4bpp.lz graphics/dodrio_berry_picking/dodrio.gbapal graphics/dodrio_berry_picking/shiny.gbapal graphics/dodrio_berry_picking/status.4bpp.lz graphics/dodrio_berry_picking/status.gbapal graphics/dodrio_berry_picking/tree_border.4bpp.lz graphics/dodrio_berry_picking/tree_border.gbapal graphics/dodrio_berry_picking/tree_border_left.bin.lz graphics/dodrio_berry_picking/tree_border_right.bin.lz graphics/door_anims/cable_club.4bpp graphics/door_anims/cerulean.4bpp graphics/door_anims/cinnabar_lab.4bpp graphics/door_anims/dept_store.4bpp graphics/door_anims/dept_store_elevator.4bpp graphics/door_anims/four_island_day_care.4bpp graphics/door_anims/fuchsia.4bpp graphics/door_anims/general.4bpp graphics/door_anims/hideout_elevator.4bpp graphics/door_anims/joyful_game_corner.4bpp graphics/door_anims/lavender.4bpp graphics/door_anims/oaks_lab.4bpp graphics/door_anims/one_island_poke_center.4bpp graphics/door_anims/pallet.4bpp graphics/door_anims/pewter.4bpp graphics/door_anims/pokemon_fan_club.4bpp graphics/door_anims/rocket_warehouse.4bpp graphics/door_anims/safari_zone.4bpp graphics/door_anims/saffron.4bpp graphics/door_anims/sevii_123.4bpp graphics/door_anims/sevii_45.4bpp graphics/door_anims/sevii_67.4bpp graphics/door_anims/silph_co.4bpp graphics/door_anims/silph_co_elevator.4bpp graphics/door_anims/sliding_double.4bpp graphics/door_anims/sliding_single.4bpp graphics/door_anims/ss_anne.4bpp graphics/door_anims/teleporter.4bpp graphics/door_anims/trainer_tower_lobby_elevator.4bpp graphics/door_anims/trainer_tower_roof_elevator.4bpp graphics/door_anims/unused_bottom.4bpp graphics/door_anims/unused_midbottom.4bpp graphics/door_anims/unused_midtop.4bpp graphics/door_anims/unused_top.4bpp graphics/door_anims/vermilion.4bpp graphics/door_anims/viridian.4bpp graphics/easy_chat/button_window.4bpp.lz graphics/easy_chat/button_window.gbapal graphics/easy_chat/interview_frame.4bpp.lz graphics/easy_chat/interview_frame.gbapal graphics/easy_chat/mode.4bpp.lz graphics/easy_chat/rectangle_cursor.4bpp.lz graphics/easy_chat/rectangle_cursor.gbapal graphics/easy_chat/scroll_indicator.4bpp graphics/easy_chat/start_select_buttons.4bpp graphics/easy_chat/text.gbapal graphics/easy_chat/text_input_frame.4bpp.lz graphics/easy_chat/text_input_frame_green.gbapal graphics/easy_chat/text_input_frame_orange.gbapal graphics/easy_chat/title_text.gbapal graphics/easy_chat/triangle_cursor.4bpp graphics/easy_chat/triangle_cursor.gbapal graphics/easy_chat/window.4bpp.lz graphics/easy_chat/window.bin.lz graphics/easy_chat/window.gbapal graphics/evolution_scene/bg.4bpp.lz graphics/evolution_scene/bg.bin.lz graphics/evolution_scene/bg2.bin.lz graphics/evolution_scene/gray_transition_intro.gbapal graphics/evolution_scene/sparkle.4bpp.lz graphics/evolution_scene/sparkle.gbapal graphics/evolution_scene/transition.gbapal graphics/evolution_scene/unused.gbapal graphics/fame_checker/bg.4bpp graphics/fame_checker/bg.gbapal graphics/fame_checker/bill.4bpp graphics/fame_checker/bill.gbapal graphics/fame_checker/cursor.4bpp graphics/fame_checker/cursor.gbapal graphics/fame_checker/daisy.4bpp graphics/fame_checker/daisy.gbapal graphics/fame_checker/mr_fuji.4bpp graphics/fame_checker/mr_fuji.gbapal graphics/fame_checker/prof_oak.4bpp graphics/fame_checker/prof_oak.gbapal graphics/fame_checker/question_mark.4bpp graphics/fame_checker/silhouette.gbapal graphics/fame_checker/spinning_pokeball.4bpp graphics/fame_checker/spinning_pokeball.gbapal graphics/fame_checker/unk.gbapal graphics/field_effects/fldeff_cut.4bpp graphics/field_effects/fldeff_cut.gbapal graphics/field_effects/palettes/ash.gbapal graphics/field_effects/palettes/general_0.gbapal graphics/field_effects/palettes/general_1.gbapal graphics/field_effects/palettes/small_sparkle.gbapal graphics/field_effects/pics/arrow.4bpp graphics/field_effects/pics/ash.4bpp graphics/field_effects/pics/bike_tire_tracks.4bpp graphics/field_effects/pics/bird.4bpp graphics/field_effects/pics/deep_sand_footprints.4bpp graphics/field_effects/pics/deoxys_rock_fragment_bottom_left.4bpp graphics/field_effects/pics/deoxys_rock_fragment_bottom_right.4bpp graphics/field_effects/pics/deoxys_rock_fragment_top_left.4bpp graphics/field_effects/pics/deoxys_rock_fragment_top_right.4bpp graphics/field_effects/pics/field_move_streaks_indoors.4bpp graphics/field_effects/pics/field_move_streaks_indoors.gbapal graphics/field_effects/pics/field_move_streaks_outdoors.4bpp graphics/field_effects/pics/field_move_streaks_outdoors.gbapal graphics/field_effects/pics/ground_impact_dust.4bpp graphics/field_effects/pics/hof_monitor.4bpp graphics/field_effects/pics/hof_monitor.gbapal graphics/field_effects/pics/hot_springs_water.4bpp graphics/field_effects/pics/jump_big_splash.4bpp graphics/field_effects/pics/jump_long_grass.4bpp graphics/field_effects/pics/jump_small_splash.4bpp graphics/field_effects/pics/jump_tall_grass.4bpp graphics/field_effects/pics/lavaridge_warp.4bpp graphics/field_effects/pics/long_grass.4bpp graphics/field_effects/pics/mountain_disguise.4bpp graphics/field_effects/pics/new_game_oak.4bpp graphics/field_effects/pics/new_game_oak.gbapal graphics/field_effects/pics/pokeball_glow.4bpp graphics/field_effects/pics/pokeball_glow.gbapal graphics/field_effects/pics/pokemoncenter_monitor.4bpp graphics/field_effects/pics/pop_out_of_ash.4bpp graphics/field_effects/pics/ripple.4bpp graphics/field_effects/pics/sand_disguise.4bpp graphics/field_effects/pics/sand_footprints.4bpp graphics/field_effects/pics/sand_pile.4bpp graphics/field_effects/pics/shadow_extra_large.4bpp graphics/field_effects/pics/shadow_large.4bpp graphics/field_effects/pics/shadow_medium.4bpp graphics/field_effects/pics/shadow_small.4bpp graphics/field_effects/pics/short_grass.4bpp graphics/field_effects/pics/small_sparkle.4bpp graphics/field_effects/pics/splash.4bpp graphics/field_effects/pics/tall_grass.4bpp graphics/field_effects/pics/tree_disguise.4bpp graphics/field_effects/pics/underwater_bubbles.4bpp graphics/field_effects/pics/unused_grass.4bpp graphics/field_effects/pics/unused_grass_2.4bpp graphics/field_effects/pics/unused_grass_3.4bpp graphics/field_effects/pics/unused_grass_4.4bpp graphics/field_effects/pics/unused_sand.4bpp graphics/field_effects/pics/water_surfacing.4bpp graphics/field_specials/champion_room_lighting_0.gbapal graphics/field_specials/champion_room_lighting_1.gbapal graphics/field_specials/champion_room_lighting_2.gbapal graphics/field_specials/champion_room_lighting_3.gbapal graphics/field_specials/champion_room_lighting_4.gbapal graphics/field_specials/champion_room_lighting_5.gbapal graphics/field_specials/champion_room_lighting_6.gbapal graphics/field_specials/champion_room_lighting_7.gbapal graphics/field_specials/champion_room_lighting_8.gbapal graphics/field_specials/deoxys_rock_0.gbapal graphics/field_specials/deoxys_rock_1.gbapal graphics/field_specials/deoxys_rock_10.gbapal graphics/field_specials/deoxys_rock_2.gbapal graphics/field_specials/deoxys_rock_3.gbapal graphics/field_specials/deoxys_rock_4.gbapal graphics/field_specials/deoxys_rock_5.gbapal graphics/field_specials/deoxys_rock_6.gbapal graphics/field_specials/deoxys_rock_7.gbapal graphics/field_specials/deoxys_rock_8.gbapal graphics/field_specials/deoxys_rock_9.gbapal graphics/field_specials/elite_four_lighting_0.gbapal graphics/field_specials/elite_four_lighting_1.gbapal graphics/field_specials/elite_four_lighting_10.gbapal graphics/field_specials/elite_four_lighting_11.gbapal graphics/field_specials/elite_four_lighting_2.gbapal graphics/field_specials/elite_four_lighting_3.gbapal graphics/field_specials/elite_four_lighting_4.gbapal graphics/field_specials/elite_four_lighting_5.gbapal graphics/field_specials/elite_four_lighting_6.gbapal graphics/field_specials/elite_four_lighting_7.gbapal graphics/field_specials/elite_four_lighting_8.gbapal graphics/field_specials/elite_four_lighting_9.gbapal graphics/fonts/down_arrow_3.4bpp graphics/fonts/down_arrow_4.4bpp graphics/fonts/down_arrows.4bpp graphics/fonts/keypad_icons.4bpp graphics/hall_of_fame/hall_of_fame.4bpp.lz graphics/hall_of_fame/hall_of_fame.gbapal graphics/help_system/bg_tiles.4bpp graphics/help_system/bg_tiles.gbapal graphics/help_system/msg_window.4bpp graphics/interface/bag.gbapal.lz graphics/interface/bag_female.4bpp.lz graphics/interface/bag_male.4bpp.lz graphics/interface/bag_swap.4bpp.lz graphics/interface/bag_swap.gbapal.lz graphics/interface/ball/dive.4bpp.lz graphics/interface/ball/dive.gbapal.lz graphics/interface/ball/great.4bpp.lz graphics/interface/ball/great.gbapal.lz graphics/interface/ball/luxury.4bpp.lz graphics/interface/ball/luxury.gbapal.lz graphics/interface/ball/master.4bpp.lz graphics/interface/ball/master.gbapal.lz graphics/interface/ball/nest.4bpp.lz graphics/interface/ball/nest.gbapal.lz graphics/interface/ball/net.4bpp.lz graphics/interface/ball/net.gbapal.lz graphics/interface/ball/poke.4bpp.lz graphics/interface/ball/poke.gbapal.lz graphics/interface/ball/premier.4bpp.lz graphics/interface/ball/premier.gbapal.lz graphics/interface/ball/repeat.4bpp.lz graphics/interface/ball/repeat.gbapal.lz graphics/interface/ball/safari.4bpp.lz graphics/interface/ball/safari.gbapal.lz graphics/interface/ball/timer.4bpp.lz graphics/interface/ball/timer.gbapal.lz graphics/interface/ball/ultra.4bpp.lz graphics/interface/ball/ultra.gbapal.lz graphics/interface/ball_open.4bpp.lz graphics/interface/blank.4bpp graphics/interface/blank.4bpp.lz graphics/interface/dex_caught_pokeball.gbapal graphics/interface/hp_numbers.4bpp.lz graphics/interface/hpbar_unused.4bpp.lz graphics/interface/learn_move.4bpp.lz graphics/interface/learn_move.bin.lz graphics/interface/learn_move.gbapal graphics/interface/menu_info.4bpp graphics/interface/mystery_gift_textbox_border.4bpp.lz graphics/interface/mystery_gift_textbox_border.gbapal graphics/interface/pokemon_types.gbapal graphics/interface/red_arrow.4bpp.lz graphics/interface/red_arrow.gbapal graphics/interface/red_arrow_other.4bpp.lz graphics/interface/save_failed_screen.gbapal graphics/interface/select_button.4bpp graphics/interface/selector_outline.4bpp.lz graphics/interface/status_icons.4bpp.lz graphics/interface/status_icons.gbapal.lz graphics/interface/std_menu.gbapal graphics/interface/text_pp.gbapal graphics/intro/copyright.4bpp.lz graphics/intro/copyright.bin.lz graphics/intro/copyright.gbapal graphics/intro/game_freak/bg.4bpp.lz graphics/intro/game_freak/bg.bin.lz graphics/intro/game_freak/bg.gbapal graphics/intro/game_freak/game_freak.4bpp.lz graphics/intro/game_freak/logo.4bpp.lz graphics/intro/game_freak/logo.gbapal graphics/intro/game_freak/presents.4bpp.lz graphics/intro/game_freak/sparkles.gbapal graphics/intro/game_freak/sparkles_big.4bpp.lz graphics/intro/game_freak/sparkles_small.4bpp.lz graphics/intro/game_freak/star.4bpp.lz graphics/intro/game_freak/star.gbapal graphics/intro/gengar.gbapal graphics/intro/nidorino.gbapal graphics/intro/scene_1/bg.4bpp.lz graphics/intro/scene_1/bg.bin.lz graphics/intro/scene_1/bg.gbapal graphics/intro/scene_1/grass.4bpp.lz graphics/intro/scene_1/grass.bin.lz graphics/intro/scene_1/grass.gbapal graphics/intro/scene_2/bg.4bpp.lz graphics/intro/scene_2/bg.bin.lz graphics/intro/scene_2/bg.gbapal graphics/intro/scene_2/gengar.4bpp.lz graphics/intro/scene_2/gengar_close.4bpp.lz graphics/intro/scene_2/gengar_close.bin.lz graphics/intro/scene_2/nidorino.4bpp.lz graphics/intro/scene_2/nidorino_close.4bpp.lz graphics/intro/scene_2/nidorino_close.bin.lz graphics/intro/scene_2/nidorino_close.gbapal graphics/intro/scene_2/plants.4bpp.lz graphics/intro/scene_2/plants.bin.lz graphics/intro/scene_2/plants.gbapal graphics/intro/scene_3/bg.4bpp.lz graphics/intro/scene_3/bg.bin.lz graphics/intro/scene_3/bg.gbapal graphics/intro/scene_3/gengar_anim.4bpp.lz graphics/intro/scene_3/gengar_anim.bin.lz graphics/intro/scene_3/gengar_static.4bpp.lz graphics/intro/scene_3/grass.4bpp.lz graphics/intro/scene_3/grass.gbapal graphics/intro/scene_3/nidorino.4bpp.lz graphics/intro/scene_3/recoil_dust.4bpp.lz graphics/intro/scene_3/recoil_dust.gbapal graphics/intro/scene_3/swipe.4bpp.lz graphics/intro/scene_3/swipe.gbapal graphics/item_menu/bag_window_pal.gbapal graphics/item_menu/bg.4bpp.lz graphics/item_menu/bg.bin.lz graphics/item_menu/bg.gbapal.lz graphics/item_menu/bg_female.gbapal.lz graphics/item_menu/bg_item_pc.bin.lz graphics/item_pc/bg.4bpp.lz graphics/item_pc/bg.bin.lz graphics/item_pc/bg.gbapal.lz graphics/itemfinder/spr_tiles.4bpp graphics/items/icon_palettes/acro_bike.gbapal.lz graphics/items/icon_palettes/aguav_berry.gbapal.lz graphics/items/icon_palettes/amulet_coin.gbapal.lz graphics/items/icon_palettes/antidote.gbapal.lz graphics/items/icon_palettes/apicot_berry.gbapal.lz graphics/items/icon_palettes/aspear_berry.gbapal.lz graphics/items/icon_palettes/aurora_ticket.gbapal.lz graphics/items/icon_palettes/awakening.gbapal.lz graphics/items/icon_palettes/bead_mail.gbapal.lz graphics/items/icon_palettes/belue_berry.gbapal.lz graphics/items/icon_palettes/berry_juice.gbapal.lz graphics/items/icon_palettes/berry_pouch.gbapal.lz graphics/items/icon_palettes/bicycle.gbapal.lz graphics/items/icon_palettes/bike_voucher.gbapal.lz graphics/items/icon_palettes/black_flute.gbapal.lz graphics/items/icon_palettes/black_type_enhancing_item.gbapal.lz graphics/items/icon_palettes/blue_flute.gbapal.lz graphics/items/icon_palettes/blue_orb.gbapal.lz graphics/items/icon_palettes/blue_scarf.gbapal.lz graphics/items/icon_palettes/blue_shard.gbapal.lz graphics/items/icon_palettes/bluk_berry.gbapal.lz graphics/items/icon_palettes/bright_powder.gbapal.lz graphics/items/icon_palettes/burn_heal.gbapal.lz graphics/items/icon_palettes/calcium.gbapal.lz graphics/items/icon_palettes/carbos.gbapal.lz graphics/items/icon_palettes/card_key.gbapal.lz graphics/items/icon_palettes/charcoal.gbapal.lz graphics/items/icon_palettes/cheri_berry.gbapal.lz graphics/items/icon_palettes/chesto_berry.gbapal.lz graphics/items/icon_palettes/choice_band.gbapal.lz graphics/items/icon_palettes/cleanse_tag.gbapal.lz graphics/items/icon_palettes/coin_case.gbapal.lz graphics/items/icon_palettes/contest_pass.gbapal.lz graphics/items/icon_palettes/cornn_berry.gbapal.lz graphics/items/icon_palettes/dark_tm_hm.gbapal.lz graphics/items/icon_palettes/deep_sea_scale.gbapal.lz graphics/items/icon_palettes/deep_sea_tooth.gbapal.lz graphics/items/icon_palettes/devon_goods.gbapal.lz graphics/items/icon_palettes/devon_scope.gbapal.lz graphics/items/icon_palettes/dire_hit.gbapal.lz graphics/items/icon_palettes/dive_ball.gbapal.lz graphics/items/icon_palettes/dragon_fang.gbapal.lz graphics/items/icon_palettes/dragon_scale.gbapal.lz graphics/items/icon_palettes/dragon_tm_hm.gbapal.lz graphics/items/icon_palettes/dream_mail.gbapal.lz graphics/items/icon_palettes/durin_berry.gbapal.lz graphics/items/icon_palettes/electric_tm_hm.gbapal.lz graphics/items/icon_palettes/elixir.gbapal.lz graphics/items/icon_palettes/energy_powder.gbapal.lz graphics/items/icon_palettes/energy_root.gbapal.lz graphics/items/icon_palettes/enigma_berry.gbapal.lz graphics/items/icon_palettes/eon_ticket.gbapal.lz graphics/items/icon_palettes/escape_rope.gbapal.lz graphics/items/icon_palettes/ether.gbapal.lz graphics/items/icon_palettes/everstone.gbapal.lz graphics/items/icon_palettes/exp_share.gbapal.lz graphics/items/icon_palettes/fab_mail.gbapal.lz graphics/items/icon_palettes/fame_checker.gbapal.lz graphics/items/icon_palettes/fighting_tm_hm.gbapal.lz graphics/items/icon_palettes/figy_berry.gbapal.lz graphics/items/icon_palettes/fire_stone.gbapal.lz graphics/items/icon_palettes/fire_tm_hm.gbapal.lz graphics/items/icon_palettes/fluffy_tail.gbapal.lz graphics/items/icon_palettes/flying_tm_hm.gbapal.lz graphics/items/icon_palettes/focus_band.gbapal.lz graphics/items/icon_palettes/fresh_water.gbapal.lz graphics/items/icon_palettes/full_heal.gbapal.lz graphics/items/icon_palettes/full_restore.gbapal.lz graphics/items/icon_palettes/ganlon_berry.gbapal.lz graphics/items/icon_palettes/ghost_tm_hm.gbapal.lz graphics/items/icon_palettes/glitter_mail.gbapal.lz graphics/items/icon_palettes/go_goggles.gbapal.lz graphics/items/icon_palettes/gold_teeth.gbapal.lz graphics/items/icon_palettes/good_rod.gbapal.lz graphics/items/icon_palettes/grass_tm_hm.gbapal.lz graphics/items/icon_palettes/great_ball.gbapal.lz graphics/items/icon_palettes/green_scarf.gbapal.lz graphics/items/icon_palettes/green_shard.gbapal.lz graphics/items/icon_palettes/grepa_berry.gbapal.lz graphics/items/icon_palettes/ground_tm_hm.gbapal.lz graphics/items/icon_palettes/guard_spec.gbapal.lz graphics/items/icon_palettes/harbor_mail.gbapal.lz graphics/items/icon_palettes/hard_stone.gbapal.lz graphics/items/icon_palettes/heal_powder.gbapal.lz graphics/items/icon_palettes/heart_scale.gbapal.lz graphics/items/icon_palettes/hoenn_fossil.gbapal.lz graphics/items/icon_palettes/hondew_berry.gbapal.lz graphics/items/icon_palettes/hp_up.gbapal.lz graphics/items/icon_palettes/hyper_potion.gbapal.lz graphics/items/icon_palettes/iapapa_berry.gbapal.lz graphics/items/icon_palettes/ice_heal.gbapal.lz graphics/items/icon_palettes/ice_tm_hm.gbapal.lz graphics/items/icon_palettes/iron.gbapal.lz graphics/items/icon_palettes/itemfinder.gbapal.lz graphics/items/icon_palettes/kanto_fossil.gbapal.lz graphics/items/icon_palettes/kelpsy_berry.gbapal.lz graphics/items/icon_palettes/key.gbapal.lz graphics/items/icon_palettes/kings_rock.gbapal.lz graphics/items/icon_palettes/lansat_berry.gbapal.lz graphics/items/icon_palettes/lava_cookie_and_letter.gbapal.lz graphics/items/icon_palettes/lax_incense.gbapal.lz graphics/items/icon_palettes/leaf_stone.gbapal.lz graphics/items/icon_palettes/leftovers.gbapal.lz graphics/items/icon_palettes/lemonade.gbapal.lz graphics/items/icon_palettes/leppa_berry.gbapal.lz graphics/items/icon_palettes/liechi_berry.gbapal.lz graphics/items/icon_palettes/light_ball.gbapal.lz graphics/items/icon_palettes/lucky_egg.gbapal.lz graphics/items/icon_palettes/lucky_punch.gbapal.lz graphics/items/icon_palettes/lum_berry.gbapal.lz graphics/items/icon_palettes/luxury_ball.gbapal.lz graphics/items/icon_palettes/mach_bike.gbapal.lz graphics/items/icon_palettes/macho_brace.gbapal.lz graphics/items/icon_palettes/magnet.gbapal.lz graphics/items/icon_palettes/mago_berry.gbapal.lz graphics/items/icon_palettes/magost_berry.gbapal.lz graphics/items/icon_palettes/master_ball.gbapal.lz graphics/items/icon_palettes/max_elixir.gbapal.lz graphics/items/icon_palettes/max_ether.gbapal.lz graphics/items/icon_palettes/max_potion.gbapal.lz graphics/items/icon_palettes/max_repel.gbapal.lz graphics/items/icon_palettes/mech_mail.gbapal.lz graphics/items/icon_palettes/mental_herb.gbapal.lz graphics/items/icon_palettes/metal_coat.gbapal.lz graphics/items/icon_palettes/metal_powder.gbapal.lz graphics/items/icon_palettes/meteorite.gbapal.lz graphics/items/icon_palettes/miracle_seed.gbapal.lz graphics/items/icon_palettes/moomoo_milk.gbapal.lz graphics/items/icon_palettes/moon_stone.gbapal.lz graphics/items/icon_palettes/mushroom.gbapal.lz graphics/items/icon_palettes/mystic_ticket.gbapal.lz graphics/items/icon_palettes/mystic_water.gbapal.lz graphics/items/icon_palettes/nanab_berry.gbapal.lz graphics/items/icon_palettes/nest_ball.gbapal.lz graphics/items/icon_palettes/net_ball.gbapal.lz graphics/items/icon_palettes/never_melt_ice.gbapal.lz graphics/items/icon_palettes/nomel_berry.gbapal.lz graphics/items/icon_palettes/normal_tm_hm.gbapal.lz graphics/items/icon_palettes/nugget.gbapal.lz graphics/items/icon_palettes/oaks_parcel.gbapal.lz graphics/items/icon_palettes/old_amber.gbapal.lz graphics/items/icon_palettes/old_key.gbapal.lz graphics/items/icon_palettes/old_rod.gbapal.lz graphics/items/icon_palettes/oran_berry.gbapal.lz graphics/items/icon_palettes/orange_mail.gbapal.lz graphics/items/icon_palettes/pamtre_berry.gbapal.lz graphics/items/icon_palettes/paralyze_heal.gbapal.lz graphics/items/icon_palettes/pearl.gbapal.lz graphics/items/icon_palettes/pecha_berry.gbapal.lz graphics/items/icon_palettes/persim_berry.gbapal.lz graphics/items/icon_palettes/petaya_berry.gbapal.lz graphics/items/icon_palettes/pinap_berry.gbapal.lz graphics/items/icon_palettes/pink_scarf.gbapal.lz graphics/items/icon_palettes/poison_barb.gbapal.lz graphics/items/icon_palettes/poison_tm_hm.gbapal.lz graphics/items/icon_palettes/poke_ball.gbapal.lz graphics/items/icon_palettes/poke_doll.gbapal.lz graphics/items/icon_palettes/poke_flute.gbapal.lz graphics/items/icon_palettes/pokeblock_case.gbapal.lz graphics/items/icon_palettes/pomeg_berry.gbapal.lz graphics/items/icon_palettes/potion.gbapal.lz graphics/items/icon_palettes/powder_jar.gbapal.lz graphics/items/icon_palettes/pp_max.gbapal.lz graphics/items/icon_palettes/pp_up.gbapal.lz graphics/items/icon_palettes/protein.gbapal.lz graphics/items/icon_palettes/psychic_tm_hm.gbapal.lz graphics/items/icon_palettes/qualot_berry.gbapal.lz graphics/items/icon_palettes/question_mark.gbapal.lz graphics/items/icon_palettes/quick_claw.gbapal.lz graphics/items/icon_palettes/rabuta_berry.gbapal.lz graphics/items/icon_palettes/rainbow_pass.gbapal.lz graphics/items/icon_palettes/rare_candy.gbapal.lz graphics/items/icon_palettes/rawst_berry.gbapal.lz graphics/items/icon_palettes/razz_berry.gbapal.lz graphics/items/icon_palettes/red_flute.gbapal.lz graphics/items/icon_palettes/red_orb.gbapal.lz graphics/items/icon_palettes/red_scarf.gbapal.lz graphics/items/icon_palettes/red_shard.gbapal.lz graphics/items/icon_palettes/repeat_ball.gbapal.lz graphics/items/icon_palettes/repel.gbapal.lz graphics/items/icon_palettes/retro_mail.gbapal.lz graphics/items/icon_palettes/return_to_field_arrow.gbapal.lz graphics/items/icon_palettes/revival_herb.gbapal.lz graphics/items/icon_palettes/revive.gbapal.lz graphics/items/icon_palettes/rock_tm_hm.gbapal.lz graphics/items/icon_palettes/ruby.gbapal.lz graphics/items/icon_palettes/sacred_ash.gbapal.lz graphics/items/icon_palettes/safari_ball.gbapal.lz graphics/items/icon_palettes/salac_berry.gbapal.lz graphics/items/icon_palettes/sapphire.gbapal.lz graphics/items/icon_palettes/scanner.gbapal.lz graphics/items/icon_palettes/scope_lens.gbapal.lz graphics/items/icon_palettes/sea_incense.gbapal.lz graphics/items/icon_palettes/secret_key.gbapal.lz graphics/items/icon_palettes/shadow_mail.gbapal.lz graphics/items/icon_palettes/sharp_beak.gbapal.lz graphics/items/icon_palettes/shell.gbapal.lz graphics/items/icon_palettes/shoal_salt.gbapal.lz graphics/items/icon_palettes/silk_scarf.gbapal.lz graphics/items/icon_palettes/silph_scope.gbapal.lz graphics/items/icon_palettes/silver_powder.gbapal.lz graphics/items/icon_palettes/sitrus_berry.gbapal.lz graphics/items/icon_palettes/smoke_ball.gbapal.lz graphics/items/icon_palettes/soda_pop.gbapal.lz graphics/items/icon_palettes/soft_sand.gbapal.lz graphics/items/icon_palettes/soot_sack.gbapal.lz graphics/items/icon_palettes/soothe_bell.gbapal.lz graphics/items/icon_palettes/soul_dew.gbapal.lz graphics/items/icon_palettes/spell_tag.gbapal.lz graphics/items/icon_palettes/spelon_berry.gbapal.lz graphics/items/icon_palettes/ss_ticket.gbapal.lz graphics/items/icon_palettes/star.gbapal.lz graphics/items/icon_palettes/starf_berry.gbapal.lz graphics/items/icon_palettes/steel_tm_hm.gbapal.lz graphics/items/icon_palettes/stick.gbapal.lz graphics/items/icon_palettes/sun_stone.gbapal.lz graphics/items/icon_palettes/super_potion.gbapal.lz graphics/items/icon_palettes/super_repel.gbapal.lz graphics/items/icon_palettes/super_rod.gbapal.lz graphics/items/icon_palettes/tamato_berry.gbapal.lz graphics/items/icon_palettes/tea.gbapal.lz graphics/items/icon_palettes/teachy_tv.gbapal.lz graphics/items/icon_palettes/thick_club.gbapal.lz graphics/items/icon_palettes/thunder_stone.gbapal.lz graphics/items/icon_palettes/tm_case.gbapal.lz graphics/items/icon_palettes/town_map.gbapal.lz graphics/items/icon_palettes/tri_pass.gbapal.lz graphics/items/icon_palettes/tropic_mail.gbapal.lz graphics/items/icon_palettes/twisted_spoon.gbapal.lz graphics/items/icon_palettes/ultra_ball.gbapal.lz graphics/items/icon_palettes/up_grade.gbapal.lz graphics/items/icon_palettes/vs_seeker.gbapal.lz graphics/items/icon_palettes/wailmer_pail.gbapal.lz graphics/items/icon_palettes/water_stone.gbapal.lz graphics/items/icon_palettes/water_tm_hm.gbapal.lz graphics/items/icon_palettes/watmel_berry.gbapal.lz graphics/items/icon_palettes/wave_mail.gbapal.lz graphics/items/icon_palettes/wepear_berry.gbapal.lz graphics/items/icon_palettes/white_flute.gbapal.lz graphics/items/icon_palettes/white_herb.gbapal.lz graphics/items/icon_palettes/wiki_berry.gbapal.lz graphics/items/icon_palettes/wood_mail.gbapal.lz graphics/items/icon_palettes/x_accuracy.gbapal.lz graphics/items/icon_palettes/x_attack.gbapal.lz graphics/items/icon_palettes/x_defend.gbapal.lz graphics/items/icon_palettes/x_special.gbapal.lz graphics/items/icon_palettes/x_speed.gbapal.lz graphics/items/icon_palettes/yellow_flute.gbapal.lz graphics/items/icon_palettes/yellow_scarf.gbapal.lz graphics/items/icon_palettes/yellow_shard.gbapal.lz graphics/items/icon_palettes/zinc.gbapal.lz graphics/items/icons/acro_bike.4bpp.lz graphics/items/icons/aguav_berry.4bpp.lz graphics/items/icons/amulet_coin.4bpp.lz graphics/items/icons/antidote.4bpp.lz graphics/items/icons/apicot_berry.4bpp.lz graphics/items/icons/aspear_berry.4bpp.lz graphics/items/icons/aurora_ticket.4bpp.lz graphics/items/icons/basement_key.4bpp.lz graphics/items/icons/battle_stat_item.4bpp.lz graphics/items/icons/bead_mail.4bpp.lz graphics/items/icons/belue_berry.4bpp.lz graphics/items/icons/berry_juice.4bpp.lz graphics/items/icons/berry_pouch.4bpp.lz graphics/items/icons/bicycle.4bpp.lz graphics/items/icons/big_mushroom.4bpp.lz graphics/items/icons/big_pearl.4bpp.lz graphics/items/icons/bike_voucher.4bpp.lz graphics/items/icons/black_belt.4bpp.lz graphics/items/icons/black_glasses.4bpp.lz graphics/items/icons/bluk_berry.4bpp.lz graphics/items/icons/bright_powder.4bpp.lz graphics/items/icons/card_key.4bpp.lz graphics/items/icons/charcoal.4bpp.lz graphics/items/icons/cheri_berry.4bpp.lz graphics/items/icons/chesto_berry.4bpp.lz graphics/items/icons/choice_band.4bpp.lz graphics/items/icons/claw_fossil.4bpp.lz graphics/items/icons/cleanse_tag.4bpp.lz graphics/items/icons/coin_case.4bpp.lz graphics/items/icons/contest_pass.4bpp.lz graphics/items/icons/cornn_berry.4bpp.lz graphics/items/icons/deep_sea_scale.4bpp.lz graphics/items/icons/deep_sea_tooth.4bpp.lz graphics/items/icons/devon_goods.4bpp.lz graphics/items/icons/devon_scope.4bpp.lz graphics/items/icons/dive_ball.4bpp.lz graphics/items/icons/dome_fossil.4bpp.lz graphics/items/icons/dragon_fang.4bpp.lz graphics/items/icons/dragon_scale.4bpp.lz graphics/items/icons/dream_mail.4bpp.lz graphics/items/icons/durin_berry.4bpp.lz graphics/items/icons/energy_root.4bpp.lz graphics/items/icons/enigma_berry.4bpp.lz graphics/items/icons/eon_ticket.4bpp.lz graphics/items/icons/escape_rope.4bpp.lz graphics/items/icons/ether.4bpp.lz graphics/items/icons/everstone.4bpp.lz graphics/items/icons/exp_share.4bpp.lz graphics/items/icons/fab_mail.4bpp.lz graphics/items/icons/fame_checker.4bpp.lz graphics/items/icons/figy_berry.4bpp.lz graphics/items/icons/fire_stone.4bpp.lz graphics/items/icons/fluffy_tail.4bpp.lz graphics/items/icons/flute.4bpp.lz graphics/items/icons/focus_band.4bpp.lz graphics/items/icons/fresh_water.4bpp.lz graphics/items/icons/full_heal.4bpp.lz graphics/items/icons/ganlon_berry.4bpp.lz graphics/items/icons/gem.4bpp.lz graphics/items/icons/glitter_mail.4bpp.lz graphics/items/icons/go_goggles.4bpp.lz graphics/items/icons/gold_teeth.4bpp.lz graphics/items/icons/good_rod.4bpp.lz graphics/items/icons/great_ball.4bpp.lz graphics/items/icons/grepa_berry.4bpp.lz graphics/items/icons/harbor_mail.4bpp.lz graphics/items/icons/hard_stone.4bpp.lz graphics/items/icons/heart_scale.4bpp.lz graphics/items/icons/helix_fossil.4bpp.lz graphics/items/icons/hondew_berry.4bpp.lz graphics/items/icons/hp_up.4bpp.lz graphics/items/icons/iapapa_berry.4bpp.lz graphics/items/icons/in_battle_herb.4bpp.lz graphics/items/icons/itemfinder.4bpp.lz graphics/items/icons/kelpsy_berry.4bpp.lz graphics/items/icons/kings_rock.4bpp.lz graphics/items/icons/lansat_berry.4bpp.lz graphics/items/icons/large_potion.4bpp.lz graphics/items/icons/lava_cookie.4bpp.lz graphics/items/icons/lax_incense.4bpp.lz graphics/items/icons/leaf_stone.4bpp.lz graphics/items/icons/leftovers.4bpp.lz graphics/items/icons/lemonade.4bpp.lz graphics/items/icons/leppa_berry.4bpp.lz graphics/items/icons/letter.4bpp.lz graphics/items/icons/liechi_berry.4bpp.lz graphics/items/icons/lift_key.4bpp.lz graphics/items/icons/light_ball.4bpp.lz graphics/items/icons/lucky_egg.4bpp.lz graphics/items/icons/lucky_punch.4bpp.lz graphics/items/icons/lum_berry.4bpp.lz graphics/items/icons/luxury_ball.4bpp.lz graphics/items/icons/mach_bike.4bpp.lz graphics/items/icons/macho_brace.4bpp.lz graphics/items/icons/magnet.4bpp.lz graphics/items/icons/mago_berry.4bpp.lz graphics/items/icons/magost_berry.4bpp.lz graphics/items/icons/master_ball.4bpp.lz graphics/items/icons/max_revive.4bpp.lz graphics/items/icons/mech_mail.4bpp.lz graphics/items/icons/metal_coat.4bpp.lz graphics/items/icons/metal_powder.4bpp.lz graphics/items/icons/meteorite.4bpp.lz graphics/items/icons/miracle_seed.4bpp.lz graphics/items/icons/moomoo_milk.4bpp.lz graphics/items/icons/moon_stone.4bpp.lz graphics/items/icons/mystic_ticket.4bpp.lz graphics/items/icons/mystic_water.4bpp.lz graphics/items/icons/nanab_berry.4bpp.lz graphics/items/icons/nest_ball.4bpp.lz graphics/items/icons/net_ball.4bpp.lz graphics/items/icons/never_melt_ice.4bpp.lz graphics/items/icons/nomel_berry.4bpp.lz graphics/items/icons/nugget.4bpp.lz graphics/items/icons/oaks_parcel.4bpp.lz graphics/items/icons/old_amber.4bpp.lz graphics/items/icons/old_rod.4bpp.lz graphics/items/icons/oran_berry.4bpp.lz graphics/items/icons/orange_mail.4bpp.lz graphics/items/icons/orb.4bpp.lz graphics/items/icons/pamtre_berry.4bpp.lz graphics/items/icons/pearl.4bpp.lz graphics/items/icons/pecha_berry.4bpp.lz graphics/items/icons/persim_berry.4bpp.lz graphics/items/icons/petaya_berry.4bpp.lz graphics/items/icons/pinap_berry.4bpp.lz graphics/items/icons/poison_barb.4bpp.lz graphics/items/icons/poke_ball.4bpp.lz graphics/items/icons/poke_doll.4bpp.lz graphics/items/icons/poke_flute.4bpp.lz graphics/items/icons/pokeblock_case.4bpp.lz graphics/items/icons/pomeg_berry.4bpp.lz graphics/items/icons/potion.4bpp.lz graphics/items/icons/powder.4bpp.lz graphics/items/icons/powder_jar.4bpp.lz graphics/items/icons/pp_max.4bpp.lz graphics/items/icons/pp_up.4bpp.lz graphics/items/icons/premier_ball.4bpp.lz graphics/items/icons/qualot_berry.4bpp.lz graphics/items/icons/question_mark.4bpp.lz graphics/items/icons/quick_claw.4bpp.lz graphics/items/icons/rabuta_berry.4bpp.lz graphics/items/icons/rainbow_pass.4bpp.lz graphics/items/icons/rare_candy.4bpp.lz graphics/items/icons/rawst_berry.4bpp.lz graphics/items/icons/razz_berry.4bpp.lz graphics/items/icons/repeat_ball.4bpp.lz graphics/items/icons/repel.4bpp.lz graphics/items/icons/retro_mail.4bpp.lz graphics/items/icons/return_to_field_arrow.4bpp.lz graphics/items/icons/revival_herb.4bpp.lz graphics/items/icons/revive.4bpp.lz graphics/items/icons/room1_key.4bpp.lz graphics/items/icons/room2_key.4bpp.lz graphics/items/icons/room4_key.4bpp.lz graphics/items/icons/room6_key.4bpp.lz graphics/items/icons/root_fossil.4bpp.lz graphics/items/icons/sacred_ash.4bpp.lz graphics/items/icons/safari_ball.4bpp.lz graphics/items/icons/salac_berry.4bpp.lz graphics/items/icons/scanner.4bpp.lz graphics/items/icons/scarf.4bpp.lz graphics/items/icons/scope_lens.4bpp.lz graphics/items/icons/sea_incense.4bpp.lz graphics/items/icons/secret_key.4bpp.lz graphics/items/icons/shadow_mail.4bpp.lz graphics/items/icons/shard.4bpp.lz graphics/items/icons/sharp_beak.4bpp.lz graphics/items/icons/shell_bell.4bpp.lz graphics/items/icons/shoal_shell.4bpp.lz graphics/items/icons/silk_scarf.4bpp.lz graphics/items/icons/silph_scope.4bpp.lz graphics/items/icons/silver_powder.4bpp.lz graphics/items/icons/sitrus_berry.4bpp.lz graphics/items/icons/smoke_ball.4bpp.lz graphics/items/icons/soda_pop.4bpp.lz graphics/items/icons/soft_sand.4bpp.lz graphics/items/icons/soot_sack.4bpp.lz graphics/items/icons/soothe_bell.4bpp.lz graphics/items/icons/soul_dew.4bpp.lz graphics/items/icons/spell_tag.4bpp.lz graphics/items/icons/spelon_berry.4bpp.lz graphics/items/icons/ss_ticket.4bpp.lz graphics/items/icons/star_piece.4bpp.lz graphics/items/icons/stardust.4bpp.lz graphics/items/icons/starf_berry.4bpp.lz graphics/items/icons/status_heal.4bpp.lz graphics/items/icons/stick.4bpp.lz graphics/items/icons/storage_key.4bpp.lz graphics/items/icons/sun_stone.4bpp.lz graphics/items/icons/super_rod.4bpp.lz graphics/items/icons/tamato_berry.4bpp.lz graphics/items/icons/tea.4bpp.lz graphics/items/icons/teachy_tv.4bpp.lz graphics/items/icons/thick_club.4bpp.lz graphics/items/icons/thunder_stone.4bpp.lz graphics/items/icons/timer_ball.4bpp.lz graphics/items/icons/tiny_mushroom.4bpp.lz graphics/items/icons/tm_case.4bpp.lz graphics/items/icons/tm_hm.4bpp.lz graphics/items/icons/town_map.4bpp.lz graphics/items/icons/tri_pass.4bpp.lz graphics/items/icons/tropic_mail.4bpp.lz graphics/items/icons/twisted_spoon.4bpp.lz graphics/items/icons/ultra_ball.4bpp.lz graphics/items/icons/up_grade.4bpp.lz graphics/items/icons/vitamin.4bpp.lz graphics/items/icons/vs_seeker.4bpp.lz graphics/items/icons/wailmer_pail.4bpp.lz graphics/items/icons/water_stone.4bpp.lz graphics/items/icons/watmel_berry.4bpp.lz graphics/items/icons/wave_mail.4bpp.lz graphics/items/icons/wepear_berry.4bpp.lz graphics/items/icons/wiki_berry.4bpp.lz graphics/items/icons/wood_mail.4bpp.lz graphics/learn_move/interface_sprites.4bpp graphics/learn_move/interface_sprites.gbapal graphics/link/321start.4bpp.lz graphics/link/321start.gbapal graphics/link/test_font.4bpp graphics/link/test_font.gbapal graphics/link/wireless_display.4bpp.lz graphics/link/wireless_display.bin.lz graphics/link/wireless_display.gbapal graphics/link/wireless_icon.4bpp.lz graphics/link/wireless_icon.gbapal graphics/mail/bead/map.bin.lz graphics/mail/bead/palette.gbapal graphics/mail/bead/tiles.4bpp.lz graphics/mail/dream/map.bin.lz graphics/mail/dream/palette.gbapal graphics/mail/dream/tiles.4bpp.lz graphics/mail/fab/map.bin.lz graphics/mail/fab/palette.gbapal graphics/mail/fab/tiles.4bpp.lz graphics/mail/glitter/map.bin.lz graphics/mail/glitter/palette.gbapal graphics/mail/glitter/tiles.4bpp.lz graphics/mail/harbor/map.bin.lz graphics/mail/harbor/palette.gbapal graphics/mail/harbor/tiles.4bpp.lz graphics/mail/mech/map.bin.lz graphics/mail/mech/palette.gbapal graphics/mail/mech/tiles.4bpp.lz graphics/mail/orange/map.bin.lz graphics/mail/orange/palette.gbapal graphics/mail/orange/tiles.4bpp.lz graphics/mail/retro/map.bin.lz graphics/mail/retro/palette.gbapal graphics/mail/retro/tiles.4bpp.lz graphics/mail/shadow/map.bin.lz graphics/mail/shadow/palette.gbapal graphics/mail/shadow/tiles.4bpp.lz graphics/mail/tropic/map.bin.lz graphics/mail/tropic/palette.gbapal graphics/mail/tropic/tiles.4bpp.lz graphics/mail/wave/map.bin.lz graphics/mail/wave/palette.gbapal graphics/mail/wave/tiles.4bpp.lz graphics/mail/wood/map.bin.lz graphics/mail/wood/palette.gbapal graphics/mail/wood/tiles.4bpp.lz graphics/main_menu/bg.gbapal graphics/main_menu/textbox.gbapal graphics/map_preview/altering_cave/tilemap.bin.lz graphics/map_preview/altering_cave/tiles.4bpp.lz graphics/map_preview/altering_cave/tiles.gbapal graphics/map_preview/berry_forest/tilemap.bin.lz graphics/map_preview/berry_forest/tiles.4bpp.lz graphics/map_preview/berry_forest/tiles.gbapal graphics/map_preview/cerulean_cave/tilemap.bin.lz graphics/map_preview/cerulean_cave/tiles.4bpp.lz graphics/map_preview/cerulean_cave/tiles.gbapal graphics/map_preview/digletts_cave/tilemap.bin.lz graphics/map_preview/digletts_cave/tiles.4bpp.lz graphics/map_preview/digletts_cave/tiles.gbapal graphics/map_preview/dotted_hole/tilemap.bin.lz graphics/map_preview/dotted_hole/tiles.4bpp.lz graphics/map_preview/dotted_hole/tiles.gbapal graphics/map_preview/icefall_cave/tilemap.bin.lz graphics/map_preview/icefall_cave/tiles.4bpp.lz graphics/map_preview/icefall_cave/tiles.gbapal graphics/map_preview/lost_cave/tilemap.bin.lz graphics/map_preview/lost_cave/tiles.4bpp.lz graphics/map_preview/lost_cave/tiles.gbapal graphics/map_preview/monean_chamber/tilemap.bin.lz graphics/map_preview/monean_chamber/tiles.4bpp.lz graphics/map_preview/monean_chamber/tiles.gbapal graphics/map_preview/mt_ember/tilemap.bin.lz graphics/map_preview/mt_ember/tiles.4bpp.lz graphics/map_preview/mt_ember/tiles.gbapal graphics/map_preview/mt_moon/tilemap.bin.lz graphics/map_preview/mt_moon/tiles.4bpp.lz graphics/map_preview/mt_moon/tiles.gbapal graphics/map_preview/pokemon_mansion/tilemap.bin.lz graphics/map_preview/pokemon_mansion/tiles.4bpp.lz graphics/map_preview/pokemon_mansion/tiles.gbapal graphics/map_preview/pokemon_tower/tilemap.bin.lz graphics/map_preview/pokemon_tower/tiles.4bpp.lz graphics/map_preview/pokemon_tower/tiles.gbapal graphics/map_preview/power_plant/tilemap.bin.lz graphics/map_preview/power_plant/tiles.4bpp.lz graphics/map_preview/power_plant/tiles.gbapal graphics/map_preview/rock_tunnel/tilemap.bin.lz graphics/map_preview/rock_tunnel/tiles.4bpp.lz graphics/map_preview/rock_tunnel/tiles.gbapal graphics/map_preview/rocket_hideout/tilemap.bin.lz graphics/map_preview/rocket_hideout/tiles.4bpp.lz graphics/map_preview/rocket_hideout/tiles.gbapal graphics/map_preview/rocket_warehouse/tilemap.bin.lz graphics/map_preview/rocket_warehouse/tiles.4bpp.lz graphics/map_preview/rocket_warehouse/tiles.gbapal graphics/map_preview/safari_zone/tilemap.bin.lz graphics/map_preview/safari_zone/tiles.4bpp.lz graphics/map_preview/safari_zone/tiles.gbapal graphics/map_preview/seafoam_islands/tilemap.bin.lz graphics/map_preview/seafoam_islands/tiles.4bpp.lz graphics/map_preview/seafoam_islands/tiles.gbapal graphics/map_preview/silph_co/tilemap.bin.lz graphics/map_preview/silph_co/tiles.4bpp.lz graphics/map_preview/silph_co/tiles.gbapal graphics/map_preview/victory_road/tilemap.bin.lz graphics/map_preview/victory_road/tiles.4bpp.lz graphics/map_preview/victory_road/tiles.gbapal graphics/map_preview/viridian_forest/tilemap.bin.lz graphics/map_preview/viridian_forest/tiles.4bpp.lz graphics/map_preview/viridian_forest/tiles.gbapal graphics/misc/confetti.4bpp.lz graphics/misc/confetti.gbapal.lz graphics/misc/egg_hatch.4bpp graphics/misc/egg_shard.4bpp graphics/misc/emoticons.4bpp graphics/misc/markings2.4bpp graphics/misc/markings2.gbapal graphics/misc/minigame_countdown.4bpp.lz graphics/misc/minigame_countdown.gbapal graphics/misc/minigame_digits.4bpp.lz graphics/misc/minigame_digits.gbapal graphics/misc/minigame_digits_unused.4bpp.lz graphics/misc/mon_markings.4bpp graphics/misc/mon_markings.gbapal graphics/misc/option_menu.gbapal graphics/naming_screen/back_button.4bpp graphics/naming_screen/background.bin.lz graphics/naming_screen/buttons.gbapal graphics/naming_screen/cursor.4bpp graphics/naming_screen/cursor.gbapal graphics/naming_screen/cursor_filled.4bpp graphics/naming_screen/cursor_squished.4bpp graphics/naming_screen/input_arrow.4bpp graphics/naming_screen/keyboard.gbapal graphics/naming_screen/keyboard_lower.bin.lz graphics/naming_screen/keyboard_symbols.bin.lz graphics/naming_screen/keyboard_upper.bin.lz graphics/naming_screen/menu.4bpp.lz graphics/naming_screen/menu.gbapal graphics/naming_screen/ok_button.4bpp graphics/naming_screen/page_swap_button.4bpp graphics/naming_screen/page_swap_frame.4bpp graphics/naming_screen/page_swap_lower.4bpp graphics/naming_screen/page_swap_lower.gbapal graphics/naming_screen/page_swap_others.4bpp graphics/naming_screen/page_swap_others.gbapal graphics/naming_screen/page_swap_upper.4bpp graphics/naming_screen/page_swap_upper.gbapal graphics/naming_screen/pc_icon_off.4bpp graphics/naming_screen/pc_icon_on.4bpp graphics/naming_screen/rival.4bpp graphics/naming_screen/rival.gbapal graphics/naming_screen/underscore.4bpp graphics/oak_speech/bg_tiles.4bpp.lz graphics/oak_speech/bg_tiles.gbapal graphics/oak_speech/leaf/pal.gbapal graphics/oak_speech/leaf/pic.8bpp.lz graphics/oak_speech/oak/pal.gbapal graphics/oak_speech/oak/pic.8bpp.lz graphics/oak_speech/oak_speech_bg.4bpp.lz graphics/oak_speech/oak_speech_bg.bin.lz graphics/oak_speech/pikachu_intro/body.4bpp.lz graphics/oak_speech/pikachu_intro/ears.4bpp.lz graphics/oak_speech/pikachu_intro/eyes.4bpp.lz graphics/oak_speech/pikachu_intro/pikachu.gbapal graphics/oak_speech/pikachu_intro/tilemap.bin.lz graphics/oak_speech/platform.4bpp.lz graphics/oak_speech/platform.gbapal graphics/oak_speech/red/pal.gbapal graphics/oak_speech/red/pic.8bpp.lz graphics/oak_speech/rival/pal.gbapal graphics/oak_speech/rival/pic.8bpp.lz graphics/object_events/palettes/bridge_reflection.gbapal graphics/object_events/palettes/meteorite.gbapal graphics/object_events/palettes/npc_blue.gbapal graphics/object_events/palettes/npc_blue_reflection.gbapal graphics/object_events/palettes/npc_green.gbapal graphics/object_events/palettes/npc_green_reflection.gbapal graphics/object_events/palettes/npc_pink.gbapal graphics/object_events/palettes/npc_pink_reflection.gbapal graphics/object_events/palettes/npc_white.gbapal graphics/object_events/palettes/npc_white_reflection.gbapal graphics/object_events/palettes/player.gbapal graphics/object_events/palettes/player_reflection.gbapal graphics/object_events/palettes/player_unused.gbapal graphics/object_events/palettes/rs_quinty_plump.gbapal graphics/object_events/palettes/rs_quinty_plump_reflection.gbapal graphics/object_events/palettes/seagallop.gbapal graphics/object_events/palettes/ss_anne.gbapal graphics/object_events/pics/misc/birth_island_stone.4bpp graphics/object_events/pics/misc/clipboard.4bpp graphics/object_events/pics/misc/cut_tree.4bpp graphics/object_events/pics/misc/fossil.4bpp graphics/object_events/pics/misc/gym_sign.4bpp graphics/object_events/pics/misc/item_ball.4bpp graphics/object_events/pics/misc/lapras_doll.4bpp graphics/object_events/pics/misc/old_amber.4bpp graphics/object_events/pics/misc/pokedex.4bpp graphics/object_events/pics/misc/rock_smash_rock.4bpp graphics/object_events/pics/misc/ruby.4bpp graphics/object_events/pics/misc/sapphire.4bpp graphics/object_events/pics/misc/seagallop.4bpp graphics/object_events/pics/misc/sign.4bpp graphics/object_events/pics/misc/ss_anne.4bpp graphics/object_events/pics/misc/strength_boulder.4bpp graphics/object_events/pics/misc/surf_blob.4bpp graphics/object_events/pics/misc/town_map.4bpp graphics/object_events/pics/misc/wooden_sign.4bpp graphics/object_events/pics/people/agatha.4bpp graphics/object_events/pics/people/balding_man.4bpp graphics/object_events/pics/people/battle_girl.4bpp graphics/object_events/pics/people/beauty.4bpp graphics/object_events/pics/people/biker.4bpp graphics/object_events/pics/people/bill.4bpp graphics/object_events/pics/people/blackbelt.4bpp graphics/object_events/pics/people/blaine.4bpp graphics/object_events/pics/people/blue.4bpp graphics/object_events/pics/people/boy.4bpp graphics/object_events/pics/people/brock.4bpp graphics/object_events/pics/people/bruno.4bpp graphics/object_events/pics/people/bug_catcher.4bpp graphics/object_events/pics/people/cable_club_receptionist.4bpp graphics/object_events/pics/people/cameraman.4bpp graphics/object_events/pics/people/camper.4bpp graphics/object_events/pics/people/captain.4bpp graphics/object_events/pics/people/celio.4bpp graphics/object_events/pics/people/channeler.4bpp graphics/object_events/pics/people/chef.4bpp graphics/object_events/pics/people/clerk.4bpp graphics/object_events/pics/people/cooltrainer_f.4bpp graphics/object_events/pics/people/cooltrainer_m.4bpp graphics/object_events/pics/people/daisy.4bpp graphics/object_events/pics/people/erika.4bpp graphics/object_events/pics/people/fat_man.4bpp graphics/object_events/pics/people/fisher.4bpp graphics/object_events/pics/people/gba_kid.4bpp graphics/object_events/pics/people/gentleman.4bpp graphics/object_events/pics/people/giovanni.4bpp graphics/object_events/pics/people/green_bike.4bpp graphics/object_events/pics/people/green_fish.4bpp graphics/object_events/pics/people/green_item.4bpp graphics/object_events/pics/people/green_normal.4bpp graphics/object_events/pics/people/green_surf.4bpp graphics/object_events/pics/people/green_surf_run.4bpp graphics/object_events/pics/people/green_vs_seeker_bike.4bpp graphics/object_events/pics/people/gym_guy.4bpp graphics/object_events/pics/people/hiker.4bpp graphics/object_events/pics/people/koga.4bpp graphics/object_events/pics/people/lance.4bpp graphics/object_events/pics/people/lass.4bpp graphics/object_events/pics/people/little_boy.4bpp graphics/object_events/pics/people/little_girl.4bpp graphics/object_events/pics/people/lorelei.4bpp graphics/object_events/pics/people/lt_surge.4bpp graphics/object_events/pics/people/man.4bpp graphics/object_events/pics/people/mg_deliveryman.4bpp graphics/object_events/pics/people/misty.4bpp graphics/object_events/pics/people/mom.4bpp graphics/object_events/pics/people/mr_fuji.4bpp graphics/object_events/pics/people/nurse.4bpp graphics/object_events/pics/people/old_man_1.4bpp graphics/object_events/pics/people/old_man_2.4bpp graphics/object_events/pics/people/old_man_lying_down.4bpp graphics/object_events/pics/people/old_woman.4bpp graphics/object_events/pics/people/picnicker.4bpp graphics/object_events/pics/people/policeman.4bpp graphics/object_events/pics/people/prof_oak.4bpp graphics/object_events/pics/people/red_bike.4bpp graphics/object_events/pics/people/red_fish.4bpp graphics/object_events/pics/people/red_item.4bpp graphics/object_events/pics/people/red_normal.4bpp graphics/object_events/pics/people/red_surf.4bpp graphics/object_events/pics/people/red_surf_run.4bpp graphics/object_events/pics/people/red_vs_seeker_bike.4bpp graphics/object_events/pics/people/rich_boy.4bpp graphics/object_events/pics/people/rocker.4bpp graphics/object_events/pics/people/rocket_f.4bpp graphics/object_events/pics/people/rocket_m.4bpp graphics/object_events/pics/people/rs_brendan.4bpp graphics/object_events/pics/people/rs_may.4bpp graphics/object_events/pics/people/sabrina.4bpp graphics/object_events/pics/people/sailor.4bpp graphics/object_events/pics/people/scientist.4bpp graphics/object_events/pics/people/sitting_boy.4bpp graphics/object_events/pics/people/super_nerd.4bpp graphics/object_events/pics/people/swimmer_f_land.4bpp graphics/object_events/pics/people/swimmer_f_water.4bpp graphics/object_events/pics/people/swimmer_m_land.4bpp graphics/object_events/pics/people/swimmer_m_water.4bpp graphics/object_events/pics/people/teachy_tv_host.4bpp graphics/object_events/pics/people/trainer_tower_dude.4bpp graphics/object_events/pics/people/tuber_f.4bpp graphics/object_events/pics/people/tuber_m_land.4bpp graphics/object_events/pics/people/tuber_m_water.4bpp graphics/object_events/pics/people/union_room_receptionist.4bpp graphics/object_events/pics/people/unused_male_receptionist.4bpp graphics/object_events/pics/people/unused_man.4bpp graphics/object_events/pics/people/unused_woman.4bpp graphics/object_events/pics/people/woman_1.4bpp graphics/object_events/pics/people/woman_2.4bpp graphics/object_events/pics/people/woman_3.4bpp graphics/object_events/pics/people/worker_f.4bpp graphics/object_events/pics/people/worker_m.4bpp graphics/object_events/pics/people/youngster.4bpp graphics/object_events/pics/pokemon/articuno.4bpp graphics/object_events/pics/pokemon/celebi.4bpp graphics/object_events/pics/pokemon/chansey.4bpp graphics/object_events/pics/pokemon/clefairy.4bpp graphics/object_events/pics/pokemon/cubone.4bpp graphics/object_events/pics/pokemon/deoxys_a.4bpp graphics/object_events/pics/pokemon/deoxys_d.4bpp graphics/object_events/pics/pokemon/deoxys_n.4bpp graphics/object_events/pics/pokemon/doduo.4bpp graphics/object_events/pics/pokemon/entei.4bpp graphics/object_events/pics/pokemon/fearow.4bpp graphics/object_events/pics/pokemon/ho_oh.4bpp graphics/object_events/pics/pokemon/jigglypuff.4bpp graphics/object_events/pics/pokemon/kabuto.4bpp graphics/object_events/pics/pokemon/kangaskhan.4bpp graphics/object_events/pics/pokemon/lapras.4bpp graphics/object_events/pics/pokemon/lugia.4bpp graphics/object_events/pics/pokemon/machoke.4bpp graphics/object_events/pics/pokemon/machop.4bpp graphics/object_events/pics/pokemon/meowth.4bpp graphics/object_events/pics/pokemon/mew.4bpp graphics/object_events/pics/pokemon/mewtwo.4bpp graphics/object_events/pics/pokemon/moltres.4bpp graphics/object_events/pics/pokemon/nidoran_f.4bpp graphics/object_events/pics/pokemon/nidoran_m.4bpp graphics/object_events/pics/pokemon/nidorino.4bpp graphics/object_events/pics/pokemon/omanyte.4bpp graphics/object_events/pics/pokemon/pidgeot.4bpp graphics/object_events/pics/pokemon/pidgey.4bpp graphics/object_events/pics/pokemon/pikachu.4bpp graphics/object_events/pics/pokemon/poliwrath.4bpp graphics/object_events/pics/pokemon/psyduck.4bpp graphics/object_events/pics/pokemon/raikou.4bpp graphics/object_events/pics/pokemon/seel.4bpp graphics/object_events/pics/pokemon/slowbro.4bpp graphics/object_events/pics/pokemon/slowpoke.4bpp graphics/object_events/pics/pokemon/snorlax.4bpp graphics/object_events/pics/pokemon/spearow.4bpp graphics/object_events/pics/pokemon/suicune.4bpp graphics/object_events/pics/pokemon/voltorb.4bpp graphics/object_events/pics/pokemon/wigglytuff.4bpp graphics/object_events/pics/pokemon/zapdos.4bpp graphics/party_menu/bg.4bpp.lz graphics/party_menu/bg.bin.lz graphics/party_menu/bg.gbapal.lz graphics/party_menu/hold_icons.4bpp graphics/party_menu/hold_icons.gbapal graphics/party_menu/pokeball.4bpp.lz graphics/party_menu/pokeball.gbapal.lz graphics/party_menu/pokeball_small.4bpp.lz graphics/pokedex/area_markers/marker.4bpp.lz graphics/pokedex/area_markers/marker.gbapal graphics/pokedex/blit_wide_ellipse.4bpp graphics/pokedex/cat_icon_abc.4bpp.lz graphics/pokedex/cat_icon_abc.gbapal graphics/pokedex/cat_icon_cancel.4bpp.lz graphics/pokedex/cat_icon_cancel.gbapal graphics/pokedex/cat_icon_cave.4bpp.lz graphics/pokedex/cat_icon_cave.gbapal graphics/pokedex/cat_icon_forest.4bpp.lz graphics/pokedex/cat_icon_forest.gbapal graphics/pokedex/cat_icon_grassland.4bpp.lz graphics/pokedex/cat_icon_grassland.gbapal graphics/pokedex/cat_icon_lightest.4bpp.lz graphics/pokedex/cat_icon_lightest.gbapal graphics/pokedex/cat_icon_mountain.4bpp.lz graphics/pokedex/cat_icon_mountain.gbapal graphics/pokedex/cat_icon_numerical.4bpp.lz graphics/pokedex/cat_icon_numerical.gbapal graphics/pokedex/cat_icon_qmark.4bpp.lz graphics/pokedex/cat_icon_qmark.gbapal graphics/pokedex/cat_icon_rare.4bpp.lz graphics/pokedex/cat_icon_rare.gbapal graphics/pokedex/cat_icon_rough_terrain.4bpp.lz graphics/pokedex/cat_icon_rough_terrain.gbapal graphics/pokedex/cat_icon_sea.4bpp.lz graphics/pokedex/cat_icon_sea.gbapal graphics/pokedex/cat_icon_smallest.4bpp.lz graphics/pokedex/cat_icon_smallest.gbapal graphics/pokedex/cat_icon_type.4bpp.lz graphics/pokedex/cat_icon_type.gbapal graphics/pokedex/cat_icon_urban.4bpp.lz graphics/pokedex/cat_icon_urban.gbapal graphics/pokedex/cat_icon_waters_edge.4bpp.lz graphics/pokedex/cat_icon_waters_edge.gbapal graphics/pokedex/caught_marker.4bpp graphics/pokedex/kanto_dex_bgpals.gbapal graphics/pokedex/kanto_dex_bgtiles.4bpp.lz graphics/pokedex/map_five_island.4bpp.lz graphics/pokedex/map_four_island.4bpp.lz graphics/pokedex/map_kanto.4bpp.lz graphics/pokedex/map_one_island.4bpp.lz graphics/pokedex/map_seven_island.4bpp.lz graphics/pokedex/map_six_island.4bpp.lz graphics/pokedex/map_three_island.4bpp.lz graphics/pokedex/map_two_island.4bpp.lz graphics/pokedex/mini_page.4bpp.lz graphics/pokedex/national_dex_bgpals.gbapal graphics/pokedex/national_dex_bgtiles.4bpp.lz graphics/pokedex/silhouette_sprite_pal.gbapal graphics/pokemon/abra/back.4bpp.lz graphics/pokemon/abra/footprint.1bpp graphics/pokemon/abra/front.4bpp.lz graphics/pokemon/abra/icon.4bpp graphics/pokemon/abra/normal.gbapal.lz graphics/pokemon/abra/shiny.gbapal.lz graphics/pokemon/absol/back.4bpp.lz graphics/pokemon/absol/footprint.1bpp graphics/pokemon/absol/front.4bpp.lz graphics/pokemon/absol/icon.4bpp graphics/pokemon/absol/normal.gbapal.lz graphics/pokemon/absol/shiny.gbapal.lz graphics/pokemon/aerodactyl/back.4bpp.lz graphics/pokemon/aerodactyl/footprint.1bpp graphics/pokemon/aerodactyl/front.4bpp.lz graphics/pokemon/aerodactyl/icon.4bpp graphics/pokemon/aerodactyl/normal.gbapal.lz graphics/pokemon/aerodactyl/shiny.gbapal.lz graphics/pokemon/aggron/back.4bpp.lz graphics/pokemon/aggron/footprint.1bpp graphics/pokemon/aggron/front.4bpp.lz graphics/pokemon/aggron/icon.4bpp graphics/pokemon/aggron/normal.gbapal.lz graphics/pokemon/aggron/shiny.gbapal.lz graphics/pokemon/aipom/back.4bpp.lz graphics/pokemon/aipom/footprint.1bpp graphics/pokemon/aipom/front.4bpp.lz graphics/pokemon/aipom/icon.4bpp graphics/pokemon/aipom/normal.gbapal.lz graphics/pokemon/aipom/shiny.gbapal.lz graphics/pokemon/alakazam/back.4bpp.lz graphics/pokemon/alakazam/footprint.1bpp graphics/pokemon/alakazam/front.4bpp.lz graphics/pokemon/alakazam/icon.4bpp graphics/pokemon/alakazam/normal.gbapal.lz graphics/pokemon/alakazam/shiny.gbapal.lz graphics/pokemon/altaria/back.4bpp.lz graphics/pokemon/altaria/footprint.1bpp graphics/pokemon/altaria/front.4bpp.lz graphics/pokemon/altaria/icon.4bpp graphics/pokemon/altaria/normal.gbapal.lz graphics/pokemon/altaria/shiny.gbapal.lz graphics/pokemon/ampharos/back.4bpp.lz graphics/pokemon/ampharos/footprint.1bpp graphics/pokemon/ampharos/front.4bpp.lz graphics/pokemon/ampharos/icon.4bpp graphics/pokemon/ampharos/normal.gbapal.lz graphics/pokemon/ampharos/shiny.gbapal.lz graphics/pokemon/anorith/back.4bpp.lz graphics/pokemon/anorith/footprint.1bpp graphics/pokemon/anorith/front.4bpp.lz graphics/pokemon/anorith/icon.4bpp graphics/pokemon/anorith/normal.gbapal.lz graphics/pokemon/anorith/shiny.gbapal.lz graphics/pokemon/arbok/back.4bpp.lz graphics/pokemon/arbok/footprint.1bpp graphics/pokemon/arbok/front.4bpp.lz graphics/pokemon/arbok/icon.4bpp graphics/pokemon/arbok/normal.gbapal.lz graphics/pokemon/arbok/shiny.gbapal.lz graphics/pokemon/arcanine/back.4bpp.lz graphics/pokemon/arcanine/footprint.1bpp graphics/pokemon/arcanine/front.4bpp.lz graphics/pokemon/arcanine/icon.4bpp graphics/pokemon/arcanine/normal.gbapal.lz graphics/pokemon/arcanine/shiny.gbapal.lz graphics/pokemon/ariados/back.4bpp.lz graphics/pokemon/ariados/footprint.1bpp graphics/pokemon/ariados/front.4bpp.lz graphics/pokemon/ariados/icon.4bpp graphics/pokemon/ariados/normal.gbapal.lz graphics/pokemon/ariados/shiny.gbapal.lz graphics/pokemon/armaldo/back.4bpp.lz graphics/pokemon/armaldo/footprint.1bpp graphics/pokemon/armaldo/front.4bpp.lz graphics/pokemon/armaldo/icon.4bpp graphics/pokemon/armaldo/normal.gbapal.lz graphics/pokemon/armaldo/shiny.gbapal.lz graphics/pokemon/aron/back.4bpp.lz graphics/pokemon/aron/footprint.1bpp graphics/pokemon/aron/front.4bpp.lz graphics/pokemon/aron/icon.4bpp graphics/pokemon/aron/normal.gbapal.lz graphics/pokemon/aron/shiny.gbapal.lz graphics/pokemon/articuno/back.4bpp.lz graphics/pokemon/articuno/footprint.1bpp graphics/pokemon/articuno/front.4bpp.lz graphics/pokemon/articuno/icon.4bpp graphics/pokemon/articuno/normal.gbapal.lz graphics/pokemon/articuno/shiny.gbapal.lz graphics/pokemon/azumarill/back.4bpp.lz graphics/pokemon/azumarill/footprint.1bpp graphics/pokemon/azumarill/front.4bpp.lz graphics/pokemon/azumarill/icon.4bpp graphics/pokemon/azumarill/normal.gbapal.lz graphics/pokemon/azumarill/shiny.gbapal.lz graphics/pokemon/azurill/back.4bpp.lz graphics/pokemon/azurill/footprint.1bpp graphics/pokemon/azurill/front.4bpp.lz graphics/pokemon/azurill/icon.4bpp graphics/pokemon/azurill/normal.gbapal.lz graphics/pokemon/azurill/shiny.gbapal.lz graphics/pokemon/bagon/back.4bpp.lz graphics/pokemon/bagon/footprint.1bpp graphics/pokemon/bagon/front.4bpp.lz graphics/pokemon/bagon/icon.4bpp graphics/pokemon/bagon/normal.gbapal.lz graphics/pokemon/bagon/shiny.gbapal.lz graphics/pokemon/baltoy/back.4bpp.lz graphics/pokemon/baltoy/footprint.1bpp graphics/pokemon/baltoy/front.4bpp.lz graphics/pokemon/baltoy/icon.4bpp graphics/pokemon/baltoy/normal.gbapal.lz graphics/pokemon/baltoy/shiny.gbapal.lz graphics/pokemon/banette/back.4bpp.lz graphics/pokemon/banette/footprint.1bpp graphics/pokemon/banette/front.4bpp.lz graphics/pokemon/banette/icon.4bpp graphics/pokemon/banette/normal.gbapal.lz graphics/pokemon/banette/shiny.gbapal.lz graphics/pokemon/barboach/back.4bpp.lz graphics/pokemon/barboach/footprint.1bpp graphics/pokemon/barboach/front.4bpp.lz graphics/pokemon/barboach/icon.4bpp graphics/pokemon/barboach/normal.gbapal.lz graphics/pokemon/barboach/shiny.gbapal.lz graphics/pokemon/bayleef/back.4bpp.lz graphics/pokemon/bayleef/footprint.1bpp graphics/pokemon/bayleef/front.4bpp.lz graphics/pokemon/bayleef/icon.4bpp graphics/pokemon/bayleef/normal.gbapal.lz graphics/pokemon/bayleef/shiny.gbapal.lz graphics/pokemon/beautifly/back.4bpp.lz graphics/pokemon/beautifly/footprint.1bpp graphics/pokemon/beautifly/front.4bpp.lz graphics/pokemon/beautifly/icon.4bpp graphics/pokemon/beautifly/normal.gbapal.lz graphics/pokemon/beautifly/shiny.gbapal.lz graphics/pokemon/beedrill/back.4bpp.lz graphics/pokemon/beedrill/footprint.1bpp graphics/pokemon/beedrill/front.4bpp.lz graphics/pokemon/beedrill/icon.4bpp graphics/pokemon/beedrill/normal.gbapal.lz graphics/pokemon/beedrill/shiny.gbapal.lz graphics/pokemon/beldum/back.4bpp.lz graphics/pokemon/beldum/footprint.1bpp graphics/pokemon/beldum/front.4bpp.lz graphics/pokemon/beldum/icon.4bpp graphics/pokemon/beldum/normal.gbapal.lz graphics/pokemon/beldum/shiny.gbapal.lz graphics/pokemon/bellossom/back.4bpp.lz graphics/pokemon/bellossom/footprint.1bpp graphics/pokemon/bellossom/front.4bpp.lz graphics/pokemon/bellossom/icon.4bpp graphics/pokemon/bellossom/normal.gbapal.lz graphics/pokemon/bellossom/shiny.gbapal.lz graphics/pokemon/bellsprout/back.4bpp.lz graphics/pokemon/bellsprout/footprint.1bpp graphics/pokemon/bellsprout/front.4bpp.lz graphics/pokemon/bellsprout/icon.4bpp graphics/pokemon/bellsprout/normal.gbapal.lz graphics/pokemon/bellsprout/shiny.gbapal.lz graphics/pokemon/blastoise/back.4bpp.lz graphics/pokemon/blastoise/footprint.1bpp graphics/pokemon/blastoise/front.4bpp.lz graphics/pokemon/blastoise/icon.4bpp graphics/pokemon/blastoise/normal.gbapal.lz graphics/pokemon/blastoise/shiny.gbapal.lz graphics/pokemon/blaziken/back.4bpp.lz graphics/pokemon/blaziken/footprint.1bpp graphics/pokemon/blaziken/front.4bpp.lz graphics/pokemon/blaziken/icon.4bpp graphics/pokemon/blaziken/normal.gbapal.lz graphics/pokemon/blaziken/shiny.gbapal.lz graphics/pokemon/blissey/back.4bpp.lz graphics/pokemon/blissey/footprint.1bpp graphics/pokemon/blissey/front.4bpp.lz graphics/pokemon/blissey/icon.4bpp graphics/pokemon/blissey/normal.gbapal.lz graphics/pokemon/blissey/shiny.gbapal.lz graphics/pokemon/breloom/back.4bpp.lz graphics/pokemon/breloom/footprint.1bpp graphics/pokemon/breloom/front.4bpp.lz graphics/pokemon/breloom/icon.4bpp graphics/pokemon/breloom/normal.gbapal.lz graphics/pokemon/breloom/shiny.gbapal.lz graphics/pokemon/bulbasaur/back.4bpp.lz graphics/pokemon/bulbasaur/footprint.1bpp graphics/pokemon/bulbasaur/front.4bpp.lz graphics/pokemon/bulbasaur/icon.4bpp graphics/pokemon/bulbasaur/normal.gbapal.lz graphics/pokemon/bulbasaur/shiny.gbapal.lz graphics/pokemon/butterfree/back.4bpp.lz graphics/pokemon/butterfree/footprint.1bpp graphics/pokemon/butterfree/front.4bpp.lz graphics/pokemon/butterfree/icon.4bpp graphics/pokemon/butterfree/normal.gbapal.lz graphics/pokemon/butterfree/shiny.gbapal.lz graphics/pokemon/cacnea/back.4bpp.lz graphics/pokemon/cacnea/footprint.1bpp graphics/pokemon/cacnea/front.4bpp.lz graphics/pokemon/cacnea/icon.4bpp graphics/pokemon/cacnea/normal.gbapal.lz graphics/pokemon/cacnea/shiny.gbapal.lz graphics/pokemon/cacturne/back.4bpp.lz graphics/pokemon/cacturne/footprint.1bpp graphics/pokemon/cacturne/front.4bpp.lz graphics/pokemon/cacturne/icon.4bpp graphics/pokemon/cacturne/normal.gbapal.lz graphics/pokemon/cacturne/shiny.gbapal.lz graphics/pokemon/camerupt/back.4bpp.lz graphics/pokemon/camerupt/footprint.1bpp graphics/pokemon/camerupt/front.4bpp.lz graphics/pokemon/camerupt/icon.4bpp graphics/pokemon/camerupt/normal.gbapal.lz graphics/pokemon/camerupt/shiny.gbapal.lz graphics/pokemon/carvanha/back.4bpp.lz graphics/pokemon/carvanha/footprint.1bpp graphics/pokemon/carvanha/front.4bpp.lz graphics/pokemon/carvanha/icon.4bpp graphics/pokemon/carvanha/normal.gbapal.lz graphics/pokemon/carvanha/shiny.gbapal.lz graphics/pokemon/cascoon/back.4bpp.lz graphics/pokemon/cascoon/footprint.1bpp graphics/pokemon/cascoon/front.4bpp.lz graphics/pokemon/cascoon/icon.4bpp graphics/pokemon/cascoon/normal.gbapal.lz graphics/pokemon/cascoon/shiny.gbapal.lz graphics/pokemon/castform/back.4bpp.lz graphics/pokemon/castform/footprint.1bpp graphics/pokemon/castform/front.4bpp.lz graphics/pokemon/castform/icon.4bpp graphics/pokemon/castform/normal.gbapal.lz graphics/pokemon/castform/shiny.gbapal.lz graphics/pokemon/caterpie/back.4bpp.lz graphics/pokemon/caterpie/footprint.1bpp graphics/pokemon/caterpie/front.4bpp.lz graphics/pokemon/caterpie/icon.4bpp graphics/pokemon/caterpie/normal.gbapal.lz graphics/pokemon/caterpie/shiny.gbapal.lz graphics/pokemon/celebi/back.4bpp.lz graphics/pokemon/celebi/footprint.1bpp graphics/pokemon/celebi/front.4bpp.lz graphics/pokemon/celebi/icon.4bpp graphics/pokemon/celebi/normal.gbapal.lz graphics/pokemon/celebi/shiny.gbapal.lz graphics/pokemon/chansey/back.4bpp.lz graphics/pokemon/chansey/footprint.1bpp graphics/pokemon/chansey/front.4bpp.lz graphics/pokemon/chansey/icon.4bpp graphics/pokemon/chansey/normal.gbapal.lz graphics/pokemon/chansey/shiny.gbapal.lz graphics/pokemon/charizard/back.4bpp.lz graphics/pokemon/charizard/footprint.1bpp graphics/pokemon/charizard/front.4bpp.lz graphics/pokemon/charizard/icon.4bpp graphics/pokemon/charizard/normal.gbapal.lz graphics/pokemon/charizard/shiny.gbapal.lz graphics/pokemon/charmander/back.4bpp.lz graphics/pokemon/charmander/footprint.1bpp graphics/pokemon/charmander/front.4bpp.lz graphics/pokemon/charmander/icon.4bpp graphics/pokemon/charmander/normal.gbapal.lz graphics/pokemon/charmander/shiny.gbapal.lz graphics/pokemon/charmeleon/back.4bpp.lz graphics/pokemon/charmeleon/footprint.1bpp graphics/pokemon/charmeleon/front.4bpp.lz graphics/pokemon/charmeleon/icon.4bpp graphics/pokemon/charmeleon/normal.gbapal.lz graphics/pokemon/charmeleon/shiny.gbapal.lz graphics/pokemon/chikorita/back.4bpp.lz graphics/pokemon/chikorita/footprint.1bpp graphics/pokemon/chikorita/front.4bpp.lz graphics/pokemon/chikorita/icon.4bpp graphics/pokemon/chikorita/normal.gbapal.lz graphics/pokemon/chikorita/shiny.gbapal.lz graphics/pokemon/chimecho/back.4bpp.lz graphics/pokemon/chimecho/footprint.1bpp graphics/pokemon/chimecho/front.4bpp.lz graphics/pokemon/chimecho/icon.4bpp graphics/pokemon/chimecho/normal.gbapal.lz graphics/pokemon/chimecho/shiny.gbapal.lz graphics/pokemon/chinchou/back.4bpp.lz graphics/pokemon/chinchou/footprint.1bpp graphics/pokemon/chinchou/front.4bpp.lz graphics/pokemon/chinchou/icon.4bpp graphics/pokemon/chinchou/normal.gbapal.lz graphics/pokemon/chinchou/shiny.gbapal.lz graphics/pokemon/clamperl/back.4bpp.lz graphics/pokemon/clamperl/footprint.1bpp graphics/pokemon/clamperl/front.4bpp.lz graphics/pokemon/clamperl/icon.4bpp graphics/pokemon/clamperl/normal.gbapal.lz graphics/pokemon/clamperl/shiny.gbapal.lz graphics/pokemon/claydol/back.4bpp.lz graphics/pokemon/claydol/footprint.1bpp graphics/pokemon/claydol/front.4bpp.lz graphics/pokemon/claydol/icon.4bpp graphics/pokemon/claydol/normal.gbapal.lz graphics/pokemon/claydol/shiny.gbapal.lz graphics/pokemon/clefable/back.4bpp.lz graphics/pokemon/clefable/footprint.1bpp graphics/pokemon/clefable/front.4bpp.lz graphics/pokemon/clefable/icon.4bpp graphics/pokemon/clefable/normal.gbapal.lz graphics/pokemon/clefable/shiny.gbapal.lz graphics/pokemon/clefairy/back.4bpp.lz graphics/pokemon/clefairy/footprint.1bpp graphics/pokemon/clefairy/front.4bpp.lz graphics/pokemon/clefairy/icon.4bpp graphics/pokemon/clefairy/normal.gbapal.lz graphics/pokemon/clefairy/shiny.gbapal.lz graphics/pokemon/cleffa/back.4bpp.lz graphics/pokemon/cleffa/footprint.1bpp graphics/pokemon/cleffa/front.4bpp.lz graphics/pokemon/cleffa/icon.4bpp graphics/pokemon/cleffa/normal.gbapal.lz graphics/pokemon/cleffa/shiny.gbapal.lz graphics/pokemon/cloyster/back.4bpp.lz graphics/pokemon/cloyster/footprint.1bpp graphics/pokemon/cloyster/front.4bpp.lz graphics/pokemon/cloyster/icon.4bpp graphics/pokemon/cloyster/normal.gbapal.lz graphics/pokemon/cloyster/shiny.gbapal.lz graphics/pokemon/combusken/back.4bpp.lz graphics/pokemon/combusken/footprint.1bpp graphics/pokemon/combusken/front.4bpp.lz graphics/pokemon/combusken/icon.4bpp graphics/pokemon/combusken/normal.gbapal.lz graphics/pokemon/combusken/shiny.gbapal.lz graphics/pokemon/corphish/back.4bpp.lz graphics/pokemon/corphish/footprint.1bpp graphics/pokemon/corphish/front.4bpp.lz graphics/pokemon/corphish/icon.4bpp graphics/pokemon/corphish/normal.gbapal.lz graphics/pokemon/corphish/shiny.gbapal.lz graphics/pokemon/corsola/back.4bpp.lz graphics/pokemon/corsola/footprint.1bpp graphics/pokemon/corsola/front.4bpp.lz graphics/pokemon/corsola/icon.4bpp graphics/pokemon/corsola/normal.gbapal.lz graphics/pokemon/corsola/shiny.gbapal.lz graphics/pokemon/cradily/back.4bpp.lz graphics/pokemon/cradily/footprint.1bpp graphics/pokemon/cradily/front.4bpp.lz graphics/pokemon/cradily/icon.4bpp graphics/pokemon/cradily/normal.gbapal.lz graphics/pokemon/cradily/shiny.gbapal.lz graphics/pokemon/crawdaunt/back.4bpp.lz graphics/pokemon/crawdaunt/footprint.1bpp graphics/pokemon/crawdaunt/front.4bpp.lz graphics/pokemon/crawdaunt/icon.4bpp graphics/pokemon/crawdaunt/normal.gbapal.lz graphics/pokemon/crawdaunt/shiny.gbapal.lz graphics/pokemon/crobat/back.4bpp.lz graphics/pokemon/crobat/footprint.1bpp graphics/pokemon/crobat/front.4bpp.lz graphics/pokemon/crobat/icon.4bpp graphics/pokemon/crobat/normal.gbapal.lz graphics/pokemon/crobat/shiny.gbapal.lz graphics/pokemon/croconaw/back.4bpp.lz graphics/pokemon/croconaw/footprint.1bpp graphics/pokemon/croconaw/front.4bpp.lz graphics/pokemon/croconaw/icon.4bpp graphics/pokemon/croconaw/normal.gbapal.lz graphics/pokemon/croconaw/shiny.gbapal.lz graphics/pokemon/cubone/back.4bpp.lz graphics/pokemon/cubone/footprint.1bpp graphics/pokemon/cubone/front.4bpp.lz graphics/pokemon/cubone/icon.4bpp graphics/pokemon/cubone/normal.gbapal.lz graphics/pokemon/cubone/shiny.gbapal.lz graphics/pokemon/cyndaquil/back.4bpp.lz graphics/pokemon/cyndaquil/footprint.1bpp graphics/pokemon/cyndaquil/front.4bpp.lz graphics/pokemon/cyndaquil/icon.4bpp graphics/pokemon/cyndaquil/normal.gbapal.lz graphics/pokemon/cyndaquil/shiny.gbapal.lz graphics/pokemon/delcatty/back.4bpp.lz graphics/pokemon/delcatty/footprint.1bpp graphics/pokemon/delcatty/front.4bpp.lz graphics/pokemon/delcatty/icon.4bpp graphics/pokemon/delcatty/normal.gbapal.lz graphics/pokemon/delcatty/shiny.gbapal.lz graphics/pokemon/delibird/back.4bpp.lz graphics/pokemon/delibird/footprint.1bpp graphics/pokemon/delibird/front.4bpp.lz graphics/pokemon/delibird/icon.4bpp graphics/pokemon/delibird/normal.gbapal.lz graphics/pokemon/delibird/shiny.gbapal.lz graphics/pokemon/deoxys/back.4bpp.lz graphics/pokemon/deoxys/back_def.4bpp.lz graphics/pokemon/deoxys/footprint.1bpp graphics/pokemon/deoxys/front.4bpp.lz graphics/pokemon/deoxys/front_def.4bpp.lz graphics/pokemon/deoxys/icon.4bpp graphics/pokemon/deoxys/icon_attack.4bpp graphics/pokemon/deoxys/icon_defense.4bpp graphics/pokemon/deoxys/normal.gbapal.lz graphics/pokemon/deoxys/shiny.gbapal.lz graphics/pokemon/dewgong/back.4bpp.lz graphics/pokemon/dewgong/footprint.1bpp graphics/pokemon/dewgong/front.4bpp.lz graphics/pokemon/dewgong/icon.4bpp graphics/pokemon/dewgong/normal.gbapal.lz graphics/pokemon/dewgong/shiny.gbapal.lz graphics/pokemon/diglett/back.4bpp.lz graphics/pokemon/diglett/footprint.1bpp graphics/pokemon/diglett/front.4bpp.lz graphics/pokemon/diglett/icon.4bpp graphics/pokemon/diglett/normal.gbapal.lz graphics/pokemon/diglett/shiny.gbapal.lz graphics/pokemon/ditto/back.4bpp.lz graphics/pokemon/ditto/footprint.1bpp graphics/pokemon/ditto/front.4bpp.lz graphics/pokemon/ditto/icon.4bpp graphics/pokemon/ditto/normal.gbapal.lz graphics/pokemon/ditto/shiny.gbapal.lz graphics/pokemon/dodrio/back.4bpp.lz graphics/pokemon/dodrio/footprint.1bpp graphics/pokemon/dodrio/front.4bpp.lz graphics/pokemon/dodrio/icon.4bpp graphics/pokemon/dodrio/normal.gbapal.lz graphics/pokemon/dodrio/shiny.gbapal.lz graphics/pokemon/doduo/back.4bpp.lz graphics/pokemon/doduo/footprint.1bpp graphics/pokemon/doduo/front.4bpp.lz graphics/pokemon/doduo/icon.4bpp graphics/pokemon/doduo/normal.gbapal.lz graphics/pokemon/doduo/shiny.gbapal.lz graphics/pokemon/donphan/back.4bpp.lz graphics/pokemon/donphan/footprint.1bpp graphics/pokemon/donphan/front.4bpp.lz graphics/pokemon/donphan/icon.4bpp graphics/pokemon/donphan/normal.gbapal.lz graphics/pokemon/donphan/shiny.gbapal.lz graphics/pokemon/dragonair/back.4bpp.lz graphics/pokemon/dragonair/footprint.1bpp graphics/pokemon/dragonair/front.4bpp.lz graphics/pokemon/dragonair/icon.4bpp graphics/pokemon/dragonair/normal.gbapal.lz graphics/pokemon/dragonair/shiny.gbapal.lz graphics/pokemon/dragonite/back.4bpp.lz graphics/pokemon/dragonite/footprint.1bpp graphics/pokemon/dragonite/front.4bpp.lz graphics/pokemon/dragonite/icon.4bpp graphics/pokemon/dragonite/normal.gbapal.lz graphics/pokemon/dragonite/shiny.gbapal.lz graphics/pokemon/dratini/back.4bpp.lz graphics/pokemon/dratini/footprint.1bpp graphics/pokemon/dratini/front.4bpp.lz graphics/pokemon/dratini/icon.4bpp graphics/pokemon/dratini/normal.gbapal.lz graphics/pokemon/dratini/shiny.gbapal.lz graphics/pokemon/drowzee/back.4bpp.lz graphics/pokemon/drowzee/footprint.1bpp graphics/pokemon/drowzee/front.4bpp.lz graphics/pokemon/drowzee/icon.4bpp graphics/pokemon/drowzee/normal.gbapal.lz graphics/pokemon/drowzee/shiny.gbapal.lz graphics/pokemon/dugtrio/back.4bpp.lz graphics/pokemon/dugtrio/footprint.1bpp graphics/pokemon/dugtrio/front.4bpp.lz graphics/pokemon/dugtrio/icon.4bpp graphics/pokemon/dugtrio/normal.gbapal.lz graphics/pokemon/dugtrio/shiny.gbapal.lz graphics/pokemon/dunsparce/back.4bpp.lz graphics/pokemon/dunsparce/footprint.1bpp graphics/pokemon/dunsparce/front.4bpp.lz graphics/pokemon/dunsparce/icon.4bpp graphics/pokemon/dunsparce/normal.gbapal.lz graphics/pokemon/dunsparce/shiny.gbapal.lz graphics/pokemon/dusclops/back.4bpp.lz graphics/pokemon/dusclops/footprint.1bpp graphics/pokemon/dusclops/front.4bpp.lz graphics/pokemon/dusclops/icon.4bpp graphics/pokemon/dusclops/normal.gbapal.lz graphics/pokemon/dusclops/shiny.gbapal.lz graphics/pokemon/duskull/back.4bpp.lz graphics/pokemon/duskull/footprint.1bpp graphics/pokemon/duskull/front.4bpp.lz graphics/pokemon/duskull/icon.4bpp graphics/pokemon/duskull/normal.gbapal.lz graphics/pokemon/duskull/shiny.gbapal.lz graphics/pokemon/dustox/back.4bpp.lz graphics/pokemon/dustox/footprint.1bpp graphics/pokemon/dustox/front.4bpp.lz graphics/pokemon/dustox/icon.4bpp graphics/pokemon/dustox/normal.gbapal.lz graphics/pokemon/dustox/shiny.gbapal.lz graphics/pokemon/eevee/back.4bpp.lz graphics/pokemon/eevee/footprint.1bpp graphics/pokemon/eevee/front.4bpp.lz graphics/pokemon/eevee/icon.4bpp graphics/pokemon/eevee/normal.gbapal.lz graphics/pokemon/eevee/shiny.gbapal.lz graphics/pokemon/egg/front.4bpp.lz graphics/pokemon/egg/icon.4bpp graphics/pokemon/egg/normal.gbapal graphics/pokemon/egg/normal.gbapal.lz graphics/pokemon/ekans/back.4bpp.lz graphics/pokemon/ekans/footprint.1bpp graphics/pokemon/ekans/front.4bpp.lz graphics/pokemon/ekans/icon.4bpp graphics/pokemon/ekans/normal.gbapal.lz graphics/pokemon/ekans/shiny.gbapal.lz graphics/pokemon/electabuzz/back.4bpp.lz graphics/pokemon/electabuzz/footprint.1bpp graphics/pokemon/electabuzz/front.4bpp.lz graphics/pokemon/electabuzz/icon.4bpp graphics/pokemon/electabuzz/normal.gbapal.lz graphics/pokemon/electabuzz/shiny.gbapal.lz graphics/pokemon/electrike/back.4bpp.lz graphics/pokemon/electrike/footprint.1bpp graphics/pokemon/electrike/front.4bpp.lz graphics/pokemon/electrike/icon.4bpp graphics/pokemon/electrike/normal.gbapal.lz graphics/pokemon/electrike/shiny.gbapal.lz graphics/pokemon/electrode/back.4bpp.lz graphics/pokemon/electrode/footprint.1bpp graphics/pokemon/electrode/front.4bpp.lz graphics/pokemon/electrode/icon.4bpp graphics/pokemon/electrode/normal.gbapal.lz graphics/pokemon/electrode/shiny.gbapal.lz graphics/pokemon/elekid/back.4bpp.lz graphics/pokemon/elekid/footprint.1bpp graphics/pokemon/elekid/front.4bpp.lz graphics/pokemon/elekid/icon.4bpp graphics/pokemon/elekid/normal.gbapal.lz graphics/pokemon/elekid/shiny.gbapal.lz graphics/pokemon/entei/back.4bpp.lz graphics/pokemon/entei/footprint.1bpp graphics/pokemon/entei/front.4bpp.lz graphics/pokemon/entei/icon.4bpp graphics/pokemon/entei/normal.gbapal.lz graphics/pokemon/entei/shiny.gbapal.lz graphics/pokemon/espeon/back.4bpp.lz graphics/pokemon/espeon/footprint.1bpp graphics/pokemon/espeon/front.4bpp.lz graphics/pokemon/espeon/icon.4bpp graphics/pokemon/espeon/normal.gbapal.lz graphics/pokemon/espeon/shiny.gbapal.lz graphics/pokemon/exeggcute/back.4bpp.lz graphics/pokemon/exeggcute/footprint.1bpp graphics/pokemon/exeggcute/front.4bpp.lz graphics/pokemon/exeggcute/icon.4bpp graphics/pokemon/exeggcute/normal.gbapal.lz graphics/pokemon/exeggcute/shiny.gbapal.lz graphics/pokemon/exeggutor/back.4bpp.lz graphics/pokemon/exeggutor/footprint.1bpp graphics/pokemon/exeggutor/front.4bpp.lz graphics/pokemon/exeggutor/icon.4bpp graphics/pokemon/exeggutor/normal.gbapal.lz graphics/pokemon/exeggutor/shiny.gbapal.lz graphics/pokemon/exploud/back.4bpp.lz graphics/pokemon/exploud/footprint.1bpp graphics/pokemon/exploud/front.4bpp.lz graphics/pokemon/exploud/icon.4bpp graphics/pokemon/exploud/normal.gbapal.lz graphics/pokemon/exploud/shiny.gbapal.lz graphics/pokemon/farfetchd/back.4bpp.lz graphics/pokemon/farfetchd/footprint.1bpp graphics/pokemon/farfetchd/front.4bpp.lz graphics/pokemon/farfetchd/icon.4bpp graphics/pokemon/farfetchd/normal.gbapal.lz graphics/pokemon/farfetchd/shiny.gbapal.lz graphics/pokemon/fearow/back.4bpp.lz graphics/pokemon/fearow/footprint.1bpp graphics/pokemon/fearow/front.4bpp.lz graphics/pokemon/fearow/icon.4bpp graphics/pokemon/fearow/normal.gbapal.lz graphics/pokemon/fearow/shiny.gbapal.lz graphics/pokemon/feebas/back.4bpp.lz graphics/pokemon/feebas/footprint.1bpp graphics/pokemon/feebas/front.4bpp.lz graphics/pokemon/feebas/icon.4bpp graphics/pokemon/feebas/normal.gbapal.lz graphics/pokemon/feebas/shiny.gbapal.lz graphics/pokemon/feraligatr/back.4bpp.lz graphics/pokemon/feraligatr/footprint.1bpp graphics/pokemon/feraligatr/front.4bpp.lz graphics/pokemon/feraligatr/icon.4bpp graphics/pokemon/feraligatr/normal.gbapal.lz graphics/pokemon/feraligatr/shiny.gbapal.lz graphics/pokemon/flaaffy/back.4bpp.lz graphics/pokemon/flaaffy/footprint.1bpp graphics/pokemon/flaaffy/front.4bpp.lz graphics/pokemon/flaaffy/icon.4bpp graphics/pokemon/flaaffy/normal.gbapal.lz graphics/pokemon/flaaffy/shiny.gbapal.lz graphics/pokemon/flareon/back.4bpp.lz graphics/pokemon/flareon/footprint.1bpp graphics/pokemon/flareon/front.4bpp.lz graphics/pokemon/flareon/icon.4bpp graphics/pokemon/flareon/normal.gbapal.lz graphics/pokemon/flareon/shiny.gbapal.lz graphics/pokemon/flygon/back.4bpp.lz graphics/pokemon/flygon/footprint.1bpp graphics/pokemon/flygon/front.4bpp.lz graphics/pokemon/flygon/icon.4bpp graphics/pokemon/flygon/normal.gbapal.lz graphics/pokemon/flygon/shiny.gbapal.lz graphics/pokemon/forretress/back.4bpp.lz graphics/pokemon/forretress/footprint.1bpp graphics/pokemon/forretress/front.4bpp.lz graphics/pokemon/forretress/icon.4bpp graphics/pokemon/forretress/normal.gbapal.lz graphics/pokemon/forretress/shiny.gbapal.lz graphics/pokemon/furret/back.4bpp.lz graphics/pokemon/furret/footprint.1bpp graphics/pokemon/furret/front.4bpp.lz graphics/pokemon/furret/icon.4bpp graphics/pokemon/furret/normal.gbapal.lz graphics/pokemon/furret/shiny.gbapal.lz graphics/pokemon/gardevoir/back.4bpp.lz graphics/pokemon/gardevoir/footprint.1bpp graphics/pokemon/gardevoir/front.4bpp.lz graphics/pokemon/gardevoir/icon.4bpp graphics/pokemon/gardevoir/normal.gbapal.lz graphics/pokemon/gardevoir/shiny.gbapal.lz graphics/pokemon/gastly/back.4bpp.lz graphics/pokemon/gastly/footprint.1bpp graphics/pokemon/gastly/front.4bpp.lz graphics/pokemon/gastly/icon.4bpp graphics/pokemon/gastly/normal.gbapal.lz graphics/pokemon/gastly/shiny.gbapal.lz graphics/pokemon/gengar/back.4bpp.lz graphics/pokemon/gengar/footprint.1bpp graphics/pokemon/gengar/front.4bpp.lz graphics/pokemon/gengar/icon.4bpp graphics/pokemon/gengar/normal.gbapal.lz graphics/pokemon/gengar/shiny.gbapal.lz graphics/pokemon/geodude/back.4bpp.lz graphics/pokemon/geodude/footprint.1bpp graphics/pokemon/geodude/front.4bpp.lz graphics/pokemon/geodude/icon.4bpp graphics/pokemon/geodude/normal.gbapal.lz graphics/pokemon/geodude/shiny.gbapal.lz graphics/pokemon/ghost/front.4bpp.lz graphics/pokemon/ghost/front.gbapal.lz graphics/pokemon/girafarig/back.4bpp.lz graphics/pokemon/girafarig/footprint.1bpp graphics/pokemon/girafarig/front.4bpp.lz graphics/pokemon/girafarig/icon.4bpp graphics/pokemon/girafarig/normal.gbapal.lz graphics/pokemon/girafarig/shiny.gbapal.lz graphics/pokemon/glalie/back.4bpp.lz graphics/pokemon/glalie/footprint.1bpp graphics/pokemon/glalie/front.4bpp.lz graphics/pokemon/glalie/icon.4bpp graphics/pokemon/glalie/normal.gbapal.lz graphics/pokemon/glalie/shiny.gbapal.lz graphics/pokemon/gligar/back.4bpp.lz graphics/pokemon/gligar/footprint.1bpp graphics/pokemon/gligar/front.4bpp.lz graphics/pokemon/gligar/icon.4bpp graphics/pokemon/gligar/normal.gbapal.lz graphics/pokemon/gligar/shiny.gbapal.lz graphics/pokemon/gloom/back.4bpp.lz graphics/pokemon/gloom/footprint.1bpp graphics/pokemon/gloom/front.4bpp.lz graphics/pokemon/gloom/icon.4bpp graphics/pokemon/gloom/normal.gbapal.lz graphics/pokemon/gloom/shiny.gbapal.lz graphics/pokemon/golbat/back.4bpp.lz graphics/pokemon/golbat/footprint.1bpp graphics/pokemon/golbat/front.4bpp.lz graphics/pokemon/golbat/icon.4bpp graphics/pokemon/golbat/normal.gbapal.lz graphics/pokemon/golbat/shiny.gbapal.lz graphics/pokemon/goldeen/back.4bpp.lz graphics/pokemon/goldeen/footprint.1bpp graphics/pokemon/goldeen/front.4bpp.lz graphics/pokemon/goldeen/icon.4bpp graphics/pokemon/goldeen/normal.gbapal.lz graphics/pokemon/goldeen/shiny.gbapal.lz graphics/pokemon/golduck/back.4bpp.lz graphics/pokemon/golduck/footprint.1bpp graphics/pokemon/golduck/front.4bpp.lz graphics/pokemon/golduck/icon.4bpp graphics/pokemon/golduck/normal.gbapal.lz graphics/pokemon/golduck/shiny.gbapal.lz graphics/pokemon/golem/back.4bpp.lz graphics/pokemon/golem/footprint.1bpp graphics/pokemon/golem/front.4bpp.lz graphics/pokemon/golem/icon.4bpp graphics/pokemon/golem/normal.gbapal.lz graphics/pokemon/golem/shiny.gbapal.lz graphics/pokemon/gorebyss/back.4bpp.lz graphics/pokemon/gorebyss/footprint.1bpp graphics/pokemon/gorebyss/front.4bpp.lz graphics/pokemon/gorebyss/icon.4bpp graphics/pokemon/gorebyss/normal.gbapal.lz graphics/pokemon/gorebyss/shiny.gbapal.lz graphics/pokemon/granbull/back.4bpp.lz graphics/pokemon/granbull/footprint.1bpp graphics/pokemon/granbull/front.4bpp.lz graphics/pokemon/granbull/icon.4bpp graphics/pokemon/granbull/normal.gbapal.lz graphics/pokemon/granbull/shiny.gbapal.lz graphics/pokemon/graveler/back.4bpp.lz graphics/pokemon/graveler/footprint.1bpp graphics/pokemon/graveler/front.4bpp.lz graphics/pokemon/graveler/icon.4bpp graphics/pokemon/graveler/normal.gbapal.lz graphics/pokemon/graveler/shiny.gbapal.lz graphics/pokemon/grimer/back.4bpp.lz graphics/pokemon/grimer/footprint.1bpp graphics/pokemon/grimer/front.4bpp.lz graphics/pokemon/grimer/icon.4bpp graphics/pokemon/grimer/normal.gbapal.lz graphics/pokemon/grimer/shiny.gbapal.lz graphics/pokemon/groudon/back.4bpp.lz graphics/pokemon/groudon/footprint.1bpp graphics/pokemon/groudon/front.4bpp.lz graphics/pokemon/groudon/icon.4bpp graphics/pokemon/groudon/normal.gbapal.lz graphics/pokemon/groudon/shiny.gbapal.lz graphics/pokemon/grovyle/back.4bpp.lz graphics/pokemon/grovyle/footprint.1bpp graphics/pokemon/grovyle/front.4bpp.lz graphics/pokemon/grovyle/icon.4bpp graphics/pokemon/grovyle/normal.gbapal.lz graphics/pokemon/grovyle/shiny.gbapal.lz graphics/pokemon/growlithe/back.4bpp.lz graphics/pokemon/growlithe/footprint.1bpp graphics/pokemon/growlithe/front.4bpp.lz graphics/pokemon/growlithe/icon.4bpp graphics/pokemon/growlithe/normal.gbapal.lz graphics/pokemon/growlithe/shiny.gbapal.lz graphics/pokemon/grumpig/back.4bpp.lz graphics/pokemon/grumpig/footprint.1bpp graphics/pokemon/grumpig/front.4bpp.lz graphics/pokemon/grumpig/icon.4bpp graphics/pokemon/grumpig/normal.gbapal.lz graphics/pokemon/grumpig/shiny.gbapal.lz graphics/pokemon/gulpin/back.4bpp.lz graphics/pokemon/gulpin/footprint.1bpp graphics/pokemon/gulpin/front.4bpp.lz graphics/pokemon/gulpin/icon.4bpp graphics/pokemon/gulpin/normal.gbapal.lz graphics/pokemon/gulpin/shiny.gbapal.lz graphics/pokemon/gyarados/back.4bpp.lz graphics/pokemon/gyarados/footprint.1bpp graphics/pokemon/gyarados/front.4bpp.lz graphics/pokemon/gyarados/icon.4bpp graphics/pokemon/gyarados/normal.gbapal.lz graphics/pokemon/gyarados/shiny.gbapal.lz graphics/pokemon/hariyama/back.4bpp.lz graphics/pokemon/hariyama/footprint.1bpp graphics/pokemon/hariyama/front.4bpp.lz graphics/pokemon/hariyama/icon.4bpp graphics/pokemon/hariyama/normal.gbapal.lz graphics/pokemon/hariyama/shiny.gbapal.lz graphics/pokemon/haunter/back.4bpp.lz graphics/pokemon/haunter/footprint.1bpp graphics/pokemon/haunter/front.4bpp.lz graphics/pokemon/haunter/icon.4bpp graphics/pokemon/haunter/normal.gbapal.lz graphics/pokemon/haunter/shiny.gbapal.lz graphics/pokemon/heracross/back.4bpp.lz graphics/pokemon/heracross/footprint.1bpp graphics/pokemon/heracross/front.4bpp.lz graphics/pokemon/heracross/icon.4bpp graphics/pokemon/heracross/normal.gbapal.lz graphics/pokemon/heracross/shiny.gbapal.lz graphics/pokemon/heracross/unk_icon.4bpp graphics/pokemon/hitmonchan/back.4bpp.lz graphics/pokemon/hitmonchan/footprint.1bpp graphics/pokemon/hitmonchan/front.4bpp.lz graphics/pokemon/hitmonchan/icon.4bpp graphics/pokemon/hitmonchan/normal.gbapal.lz graphics/pokemon/hitmonchan/shiny.gbapal.lz graphics/pokemon/hitmonlee/back.4bpp.lz graphics/pokemon/hitmonlee/footprint.1bpp graphics/pokemon/hitmonlee/front.4bpp.lz graphics/pokemon/hitmonlee/icon.4bpp graphics/pokemon/hitmonlee/normal.gbapal.lz graphics/pokemon/hitmonlee/shiny.gbapal.lz graphics/pokemon/hitmontop/back.4bpp.lz graphics/pokemon/hitmontop/footprint.1bpp graphics/pokemon/hitmontop/front.4bpp.lz graphics/pokemon/hitmontop/icon.4bpp graphics/pokemon/hitmontop/normal.gbapal.lz graphics/pokemon/hitmontop/shiny.gbapal.lz graphics/pokemon/ho_oh/back.4bpp.lz graphics/pokemon/ho_oh/footprint.1bpp graphics/pokemon/ho_oh/front.4bpp.lz graphics/pokemon/ho_oh/icon.4bpp graphics/pokemon/ho_oh/normal.gbapal.lz graphics/pokemon/ho_oh/shiny.gbapal.lz graphics/pokemon/hoothoot/back.4bpp.lz graphics/pokemon/hoothoot/footprint.1bpp graphics/pokemon/hoothoot/front.4bpp.lz graphics/pokemon/hoothoot/icon.4bpp graphics/pokemon/hoothoot/normal.gbapal.lz graphics/pokemon/hoothoot/shiny.gbapal.lz graphics/pokemon/hoppip/back.4bpp.lz graphics/pokemon/hoppip/footprint.1bpp graphics/pokemon/hoppip/front.4bpp.lz graphics/pokemon/hoppip/icon.4bpp graphics/pokemon/hoppip/normal.gbapal.lz graphics/pokemon/hoppip/shiny.gbapal.lz graphics/pokemon/horsea/back.4bpp.lz graphics/pokemon/horsea/footprint.1bpp graphics/pokemon/horsea/front.4bpp.lz graphics/pokemon/horsea/icon.4bpp graphics/pokemon/horsea/normal.gbapal.lz graphics/pokemon/horsea/shiny.gbapal.lz graphics/pokemon/houndoom/back.4bpp.lz graphics/pokemon/houndoom/footprint.1bpp graphics/pokemon/houndoom/front.4bpp.lz graphics/pokemon/houndoom/icon.4bpp graphics/pokemon/houndoom/normal.gbapal.lz graphics/pokemon/houndoom/shiny.gbapal.lz graphics/pokemon/houndour/back.4bpp.lz graphics/pokemon/houndour/footprint.1bpp graphics/pokemon/houndour/front.4bpp.lz graphics/pokemon/houndour/icon.4bpp graphics/pokemon/houndour/normal.gbapal.lz graphics/pokemon/houndour/shiny.gbapal.lz graphics/pokemon/huntail/back.4bpp.lz graphics/pokemon/huntail/footprint.1bpp graphics/pokemon/huntail/front.4bpp.lz graphics/pokemon/huntail/icon.4bpp graphics/pokemon/huntail/normal.gbapal.lz graphics/pokemon/huntail/shiny.gbapal.lz graphics/pokemon/hypno/back.4bpp.lz graphics/pokemon/hypno/footprint.1bpp graphics/pokemon/hypno/front.4bpp.lz graphics/pokemon/hypno/icon.4bpp graphics/pokemon/hypno/normal.gbapal.lz graphics/pokemon/hypno/shiny.gbapal.lz graphics/pokemon/icon_palettes/icon_palette_0.gbapal graphics/pokemon/icon_palettes/icon_palette_1.gbapal graphics/pokemon/icon_palettes/icon_palette_2.gbapal graphics/pokemon/igglybuff/back.4bpp.lz graphics/pokemon/igglybuff/footprint.1bpp graphics/pokemon/igglybuff/front.4bpp.lz graphics/pokemon/igglybuff/icon.4bpp graphics/pokemon/igglybuff/normal.gbapal.lz graphics/pokemon/igglybuff/shiny.gbapal.lz graphics/pokemon/illumise/back.4bpp.lz graphics/pokemon/illumise/footprint.1bpp graphics/pokemon/illumise/front.4bpp.lz graphics/pokemon/illumise/icon.4bpp graphics/pokemon/illumise/normal.gbapal.lz graphics/pokemon/illumise/shiny.gbapal.lz graphics/pokemon/ivysaur/back.4bpp.lz graphics/pokemon/ivysaur/footprint.1bpp graphics/pokemon/ivysaur/front.4bpp.lz graphics/pokemon/ivysaur/icon.4bpp graphics/pokemon/ivysaur/normal.gbapal.lz graphics/pokemon/ivysaur/shiny.gbapal.lz graphics/pokemon/jigglypuff/back.4bpp.lz graphics/pokemon/jigglypuff/footprint.1bpp graphics/pokemon/jigglypuff/front.4bpp.lz graphics/pokemon/jigglypuff/icon.4bpp graphics/pokemon/jigglypuff/normal.gbapal.lz graphics/pokemon/jigglypuff/shiny.gbapal.lz graphics/pokemon/jirachi/back.4bpp.lz graphics/pokemon/jirachi/footprint.1bpp graphics/pokemon/jirachi/front.4bpp.lz graphics/pokemon/jirachi/icon.4bpp graphics/pokemon/jirachi/normal.gbapal.lz graphics/pokemon/jirachi/shiny.gbapal.lz graphics/pokemon/jolteon/back.4bpp.lz graphics/pokemon/jolteon/footprint.1bpp graphics/pokemon/jolteon/front.4bpp.lz graphics/pokemon/jolteon/icon.4bpp graphics/pokemon/jolteon/normal.gbapal.lz graphics/pokemon/jolteon/shiny.gbapal.lz graphics/pokemon/jumpluff/back.4bpp.lz graphics/pokemon/jumpluff/footprint.1bpp graphics/pokemon/jumpluff/front.4bpp.lz graphics/pokemon/jumpluff/icon.4bpp graphics/pokemon/jumpluff/normal.gbapal.lz graphics/pokemon/jumpluff/shiny.gbapal.lz graphics/pokemon/jynx/back.4bpp.lz graphics/pokemon/jynx/footprint.1bpp graphics/pokemon/jynx/front.4bpp.lz graphics/pokemon/jynx/icon.4bpp graphics/pokemon/jynx/normal.gbapal.lz graphics/pokemon/jynx/shiny.gbapal.lz graphics/pokemon/kabuto/back.4bpp.lz graphics/pokemon/kabuto/footprint.1bpp graphics/pokemon/kabuto/front.4bpp.lz graphics/pokemon/kabuto/icon.4bpp graphics/pokemon/kabuto/normal.gbapal.lz graphics/pokemon/kabuto/shiny.gbapal.lz graphics/pokemon/kabutops/back.4bpp.lz graphics/pokemon/kabutops/footprint.1bpp graphics/pokemon/kabutops/front.4bpp.lz graphics/pokemon/kabutops/icon.4bpp graphics/pokemon/kabutops/normal.gbapal.lz graphics/pokemon/kabutops/shiny.gbapal.lz graphics/pokemon/kadabra/back.4bpp.lz graphics/pokemon/kadabra/footprint.1bpp graphics/pokemon/kadabra/front.4bpp.lz graphics/pokemon/kadabra/icon.4bpp graphics/pokemon/kadabra/normal.gbapal.lz graphics/pokemon/kadabra/shiny.gbapal.lz graphics/pokemon/kakuna/back.4bpp.lz graphics/pokemon/kakuna/footprint.1bpp graphics/pokemon/kakuna/front.4bpp.lz graphics/pokemon/kakuna/icon.4bpp graphics/pokemon/kakuna/normal.gbapal.lz graphics/pokemon/kakuna/shiny.gbapal.lz graphics/pokemon/kangaskhan/back.4bpp.lz graphics/pokemon/kangaskhan/footprint.1bpp graphics/pokemon/kangaskhan/front.4bpp.lz graphics/pokemon/kangaskhan/icon.4bpp graphics/pokemon/kangaskhan/normal.gbapal.lz graphics/pokemon/kangaskhan/shiny.gbapal.lz graphics/pokemon/kecleon/back.4bpp.lz graphics/pokemon/kecleon/footprint.1bpp graphics/pokemon/kecleon/front.4bpp.lz graphics/pokemon/kecleon/icon.4bpp graphics/pokemon/kecleon/normal.gbapal.lz graphics/pokemon/kecleon/shiny.gbapal.lz graphics/pokemon/kingdra/back.4bpp.lz graphics/pokemon/kingdra/footprint.1bpp graphics/pokemon/kingdra/front.4bpp.lz graphics/pokemon/kingdra/icon.4bpp graphics/pokemon/kingdra/normal.gbapal.lz graphics/pokemon/kingdra/shiny.gbapal.lz graphics/pokemon/kingler/back.4bpp.lz graphics/pokemon/kingler/footprint.1bpp graphics/pokemon/kingler/front.4bpp.lz graphics/pokemon/kingler/icon.4bpp graphics/pokemon/kingler/normal.gbapal.lz graphics/pokemon/kingler/shiny.gbapal.lz graphics/pokemon/kirlia/back.4bpp.lz graphics/pokemon/kirlia/footprint.1bpp graphics/pokemon/kirlia/front.4bpp.lz graphics/pokemon/kirlia/icon.4bpp graphics/pokemon/kirlia/normal.gbapal.lz graphics/pokemon/kirlia/shiny.gbapal.lz graphics/pokemon/koffing/back.4bpp.lz graphics/pokemon/koffing/footprint.1bpp graphics/pokemon/koffing/front.4bpp.lz graphics/pokemon/koffing/icon.4bpp graphics/pokemon/koffing/normal.gbapal.lz graphics/pokemon/koffing/shiny.gbapal.lz graphics/pokemon/krabby/back.4bpp.lz graphics/pokemon/krabby/footprint.1bpp graphics/pokemon/krabby/front.4bpp.lz graphics/pokemon/krabby/icon.4bpp graphics/pokemon/krabby/normal.gbapal.lz graphics/pokemon/krabby/shiny.gbapal.lz graphics/pokemon/kyogre/back.4bpp.lz graphics/pokemon/kyogre/footprint.1bpp graphics/pokemon/kyogre/front.4bpp.lz graphics/pokemon/kyogre/icon.4bpp graphics/pokemon/kyogre/normal.gbapal.lz graphics/pokemon/kyogre/shiny.gbapal.lz graphics/pokemon/lairon/back.4bpp.lz graphics/pokemon/lairon/footprint.1bpp graphics/pokemon/lairon/front.4bpp.lz graphics/pokemon/lairon/icon.4bpp graphics/pokemon/lairon/normal.gbapal.lz graphics/pokemon/lairon/shiny.gbapal.lz graphics/pokemon/lanturn/back.4bpp.lz graphics/pokemon/lanturn/footprint.1bpp graphics/pokemon/lanturn/front.4bpp.lz graphics/pokemon/lanturn/icon.4bpp graphics/pokemon/lanturn/normal.gbapal.lz graphics/pokemon/lanturn/shiny.gbapal.lz graphics/pokemon/lapras/back.4bpp.lz graphics/pokemon/lapras/footprint.1bpp graphics/pokemon/lapras/front.4bpp.lz graphics/pokemon/lapras/icon.4bpp graphics/pokemon/lapras/normal.gbapal.lz graphics/pokemon/lapras/shiny.gbapal.lz graphics/pokemon/larvitar/back.4bpp.lz graphics/pokemon/larvitar/footprint.1bpp graphics/pokemon/larvitar/front.4bpp.lz graphics/pokemon/larvitar/icon.4bpp graphics/pokemon/larvitar/normal.gbapal.lz graphics/pokemon/larvitar/shiny.gbapal.lz graphics/pokemon/latias/back.4bpp.lz graphics/pokemon/latias/footprint.1bpp graphics/pokemon/latias/front.4bpp.lz graphics/pokemon/latias/icon.4bpp graphics/pokemon/latias/normal.gbapal.lz graphics/pokemon/latias/shiny.gbapal.lz graphics/pokemon/latios/back.4bpp.lz graphics/pokemon/latios/footprint.1bpp graphics/pokemon/latios/front.4bpp.lz graphics/pokemon/latios/icon.4bpp graphics/pokemon/latios/normal.gbapal.lz graphics/pokemon/latios/shiny.gbapal.lz graphics/pokemon/ledian/back.4bpp.lz graphics/pokemon/ledian/footprint.1bpp graphics/pokemon/ledian/front.4bpp.lz graphics/pokemon/ledian/icon.4bpp graphics/pokemon/ledian/normal.gbapal.lz graphics/pokemon/ledian/shiny.gbapal.lz graphics/pokemon/ledyba/back.4bpp.lz graphics/pokemon/ledyba/footprint.1bpp graphics/pokemon/ledyba/front.4bpp.lz graphics/pokemon/ledyba/icon.4bpp graphics/pokemon/ledyba/normal.gbapal.lz graphics/pokemon/ledyba/shiny.gbapal.lz graphics/pokemon/lickitung/back.4bpp.lz graphics/pokemon/lickitung/footprint.1bpp graphics/pokemon/lickitung/front.4bpp.lz graphics/pokemon/lickitung/icon.4bpp graphics/pokemon/lickitung/normal.gbapal.lz graphics/pokemon/lickitung/shiny.gbapal.lz graphics/pokemon/lileep/back.4bpp.lz graphics/pokemon/lileep/footprint.1bpp graphics/pokemon/lileep/front.4bpp.lz graphics/pokemon/lileep/icon.4bpp graphics/pokemon/lileep/normal.gbapal.lz graphics/pokemon/lileep/shiny.gbapal.lz graphics/pokemon/linoone/back.4bpp.lz graphics/pokemon/linoone/footprint.1bpp graphics/pokemon/linoone/front.4bpp.lz graphics/pokemon/linoone/icon.4bpp graphics/pokemon/linoone/normal.gbapal.lz graphics/pokemon/linoone/shiny.gbapal.lz graphics/pokemon/lombre/back.4bpp.lz graphics/pokemon/lombre/footprint.1bpp graphics/pokemon/lombre/front.4bpp.lz graphics/pokemon/lombre/icon.4bpp graphics/pokemon/lombre/normal.gbapal.lz graphics/pokemon/lombre/shiny.gbapal.lz graphics/pokemon/lotad/back.4bpp.lz graphics/pokemon/lotad/footprint.1bpp graphics/pokemon/lotad/front.4bpp.lz graphics/pokemon/lotad/icon.4bpp graphics/pokemon/lotad/normal.gbapal.lz graphics/pokemon/lotad/shiny.gbapal.lz graphics/pokemon/loudred/back.4bpp.lz graphics/pokemon/loudred/footprint.1bpp graphics/pokemon/loudred/front.4bpp.lz graphics/pokemon/loudred/icon.4bpp graphics/pokemon/loudred/normal.gbapal.lz graphics/pokemon/loudred/shiny.gbapal.lz graphics/pokemon/ludicolo/back.4bpp.lz graphics/pokemon/ludicolo/footprint.1bpp graphics/pokemon/ludicolo/front.4bpp.lz graphics/pokemon/ludicolo/icon.4bpp graphics/pokemon/ludicolo/normal.gbapal.lz graphics/pokemon/ludicolo/shiny.gbapal.lz graphics/pokemon/lugia/back.4bpp.lz graphics/pokemon/lugia/footprint.1bpp graphics/pokemon/lugia/front.4bpp.lz graphics/pokemon/lugia/icon.4bpp graphics/pokemon/lugia/normal.gbapal.lz graphics/pokemon/lugia/shiny.gbapal.lz graphics/pokemon/lunatone/back.4bpp.lz graphics/pokemon/lunatone/footprint.1bpp graphics/pokemon/lunatone/front.4bpp.lz graphics/pokemon/lunatone/icon.4bpp graphics/pokemon/lunatone/normal.gbapal.lz graphics/pokemon/lunatone/shiny.gbapal.lz graphics/pokemon/luvdisc/back.4bpp.lz graphics/pokemon/luvdisc/footprint.1bpp graphics/pokemon/luvdisc/front.4bpp.lz graphics/pokemon/luvdisc/icon.4bpp graphics/pokemon/luvdisc/normal.gbapal.lz graphics/pokemon/luvdisc/shiny.gbapal.lz graphics/pokemon/machamp/back.4bpp.lz graphics/pokemon/machamp/footprint.1bpp graphics/pokemon/machamp/front.4bpp.lz graphics/pokemon/machamp/icon.4bpp graphics/pokemon/machamp/normal.gbapal.lz graphics/pokemon/machamp/shiny.gbapal.lz graphics/pokemon/machoke/back.4bpp.lz graphics/pokemon/machoke/footprint.1bpp graphics/pokemon/machoke/front.4bpp.lz graphics/pokemon/machoke/icon.4bpp graphics/pokemon/machoke/normal.gbapal.lz graphics/pokemon/machoke/shiny.gbapal.lz graphics/pokemon/machop/back.4bpp.lz graphics/pokemon/machop/footprint.1bpp graphics/pokemon/machop/front.4bpp.lz graphics/pokemon/machop/icon.4bpp graphics/pokemon/machop/normal.gbapal.lz graphics/pokemon/machop/shiny.gbapal.lz graphics/pokemon/magby/back.4bpp.lz graphics/pokemon/magby/footprint.1bpp graphics/pokemon/magby/front.4bpp.lz graphics/pokemon/magby/icon.4bpp graphics/pokemon/magby/normal.gbapal.lz graphics/pokemon/magby/shiny.gbapal.lz graphics/pokemon/magcargo/back.4bpp.lz graphics/pokemon/magcargo/footprint.1bpp graphics/pokemon/magcargo/front.4bpp.lz graphics/pokemon/magcargo/icon.4bpp graphics/pokemon/magcargo/normal.gbapal.lz graphics/pokemon/magcargo/shiny.gbapal.lz graphics/pokemon/magikarp/back.4bpp.lz graphics/pokemon/magikarp/footprint.1bpp graphics/pokemon/magikarp/front.4bpp.lz graphics/pokemon/magikarp/icon.4bpp graphics/pokemon/magikarp/normal.gbapal.lz graphics/pokemon/magikarp/shiny.gbapal.lz graphics/pokemon/magmar/back.4bpp.lz graphics/pokemon/magmar/footprint.1bpp graphics/pokemon/magmar/front.4bpp.lz graphics/pokemon/magmar/icon.4bpp graphics/pokemon/magmar/normal.gbapal.lz graphics/pokemon/magmar/shiny.gbapal.lz graphics/pokemon/magnemite/back.4bpp.lz graphics/pokemon/magnemite/footprint.1bpp graphics/pokemon/magnemite/front.4bpp.lz graphics/pokemon/magnemite/icon.4bpp graphics/pokemon/magnemite/normal.gbapal.lz graphics/pokemon/magnemite/shiny.gbapal.lz graphics/pokemon/magneton/back.4bpp.lz graphics/pokemon/magneton/footprint.1bpp graphics/pokemon/magneton/front.4bpp.lz graphics/pokemon/magneton/icon.4bpp graphics/pokemon/magneton/normal.gbapal.lz graphics/pokemon/magneton/shiny.gbapal.lz graphics/pokemon/makuhita/back.4bpp.lz graphics/pokemon/makuhita/footprint.1bpp graphics/pokemon/makuhita/front.4bpp.lz graphics/pokemon/makuhita/icon.4bpp graphics/pokemon/makuhita/normal.gbapal.lz graphics/pokemon/makuhita/shiny.gbapal.lz graphics/pokemon/manectric/back.4bpp.lz graphics/pokemon/manectric/footprint.1bpp graphics/pokemon/manectric/front.4bpp.lz graphics/pokemon/manectric/icon.4bpp graphics/pokemon/manectric/normal.gbapal.lz graphics/pokemon/manectric/shiny.gbapal.lz graphics/pokemon/mankey/back.4bpp.lz graphics/pokemon/mankey/footprint.1bpp graphics/pokemon/mankey/front.4bpp.lz graphics/pokemon/mankey/icon.4bpp graphics/pokemon/mankey/normal.gbapal.lz graphics/pokemon/mankey/shiny.gbapal.lz graphics/pokemon/mantine/back.4bpp.lz graphics/pokemon/mantine/footprint.1bpp graphics/pokemon/mantine/front.4bpp.lz graphics/pokemon/mantine/icon.4bpp graphics/pokemon/mantine/normal.gbapal.lz graphics/pokemon/mantine/shiny.gbapal.lz graphics/pokemon/mareep/back.4bpp.lz graphics/pokemon/mareep/footprint.1bpp graphics/pokemon/mareep/front.4bpp.lz graphics/pokemon/mareep/icon.4bpp graphics/pokemon/mareep/normal.gbapal.lz graphics/pokemon/mareep/shiny.gbapal.lz graphics/pokemon/marill/back.4bpp.lz graphics/pokemon/marill/footprint.1bpp graphics/pokemon/marill/front.4bpp.lz graphics/pokemon/marill/icon.4bpp graphics/pokemon/marill/normal.gbapal.lz graphics/pokemon/marill/shiny.gbapal.lz graphics/pokemon/marowak/back.4bpp.lz graphics/pokemon/marowak/footprint.1bpp graphics/pokemon/marowak/front.4bpp.lz graphics/pokemon/marowak/icon.4bpp graphics/pokemon/marowak/normal.gbapal.lz graphics/pokemon/marowak/shiny.gbapal.lz graphics/pokemon/marshtomp/back.4bpp.lz graphics/pokemon/marshtomp/footprint.1bpp graphics/pokemon/marshtomp/front.4bpp.lz graphics/pokemon/marshtomp/icon.4bpp graphics/pokemon/marshtomp/normal.gbapal.lz graphics/pokemon/marshtomp/shiny.gbapal.lz graphics/pokemon/masquerain/back.4bpp.lz graphics/pokemon/masquerain/footprint.1bpp graphics/pokemon/masquerain/front.4bpp.lz graphics/pokemon/masquerain/icon.4bpp graphics/pokemon/masquerain/normal.gbapal.lz graphics/pokemon/masquerain/shiny.gbapal.lz graphics/pokemon/mawile/back.4bpp.lz graphics/pokemon/mawile/footprint.1bpp graphics/pokemon/mawile/front.4bpp.lz graphics/pokemon/mawile/icon.4bpp graphics/pokemon/mawile/normal.gbapal.lz graphics/pokemon/mawile/shiny.gbapal.lz graphics/pokemon/medicham/back.4bpp.lz graphics/pokemon/medicham/footprint.1bpp graphics/pokemon/medicham/front.4bpp.lz graphics/pokemon/medicham/icon.4bpp graphics/pokemon/medicham/normal.gbapal.lz graphics/pokemon/medicham/shiny.gbapal.lz graphics/pokemon/meditite/back.4bpp.lz graphics/pokemon/meditite/footprint.1bpp graphics/pokemon/meditite/front.4bpp.lz graphics/pokemon/meditite/icon.4bpp graphics/pokemon/meditite/normal.gbapal.lz graphics/pokemon/meditite/shiny.gbapal.lz graphics/pokemon/meganium/back.4bpp.lz graphics/pokemon/meganium/footprint.1bpp graphics/pokemon/meganium/front.4bpp.lz graphics/pokemon/meganium/icon.4bpp graphics/pokemon/meganium/normal.gbapal.lz graphics/pokemon/meganium/shiny.gbapal.lz graphics/pokemon/meowth/back.4bpp.lz graphics/pokemon/meowth/footprint.1bpp graphics/pokemon/meowth/front.4bpp.lz graphics/pokemon/meowth/icon.4bpp graphics/pokemon/meowth/normal.gbapal.lz graphics/pokemon/meowth/shiny.gbapal.lz graphics/pokemon/metagross/back.4bpp.lz graphics/pokemon/metagross/footprint.1bpp graphics/pokemon/metagross/front.4bpp.lz graphics/pokemon/metagross/icon.4bpp graphics/pokemon/metagross/normal.gbapal.lz graphics/pokemon/metagross/shiny.gbapal.lz graphics/pokemon/metang/back.4bpp.lz graphics/pokemon/metang/footprint.1bpp graphics/pokemon/metang/front.4bpp.lz graphics/pokemon/metang/icon.4bpp graphics/pokemon/metang/normal.gbapal.lz graphics/pokemon/metang/shiny.gbapal.lz graphics/pokemon/metapod/back.4bpp.lz graphics/pokemon/metapod/footprint.1bpp graphics/pokemon/metapod/front.4bpp.lz graphics/pokemon/metapod/icon.4bpp graphics/pokemon/metapod/normal.gbapal.lz graphics/pokemon/metapod/shiny.gbapal.lz graphics/pokemon/mew/back.4bpp.lz graphics/pokemon/mew/footprint.1bpp graphics/pokemon/mew/front.4bpp.lz graphics/pokemon/mew/icon.4bpp graphics/pokemon/mew/normal.gbapal.lz graphics/pokemon/mew/shiny.gbapal.lz graphics/pokemon/mewtwo/back.4bpp.lz graphics/pokemon/mewtwo/footprint.1bpp graphics/pokemon/mewtwo/front.4bpp.lz graphics/pokemon/mewtwo/icon.4bpp graphics/pokemon/mewtwo/normal.gbapal.lz graphics/pokemon/mewtwo/shiny.gbapal.lz graphics/pokemon/mightyena/back.4bpp.lz graphics/pokemon/mightyena/footprint.1bpp graphics/pokemon/mightyena/front.4bpp.lz graphics/pokemon/mightyena/icon.4bpp graphics/pokemon/mightyena/normal.gbapal.lz graphics/pokemon/mightyena/shiny.gbapal.lz graphics/pokemon/milotic/back.4bpp.lz graphics/pokemon/milotic/footprint.1bpp graphics/pokemon/milotic/front.4bpp.lz graphics/pokemon/milotic/icon.4bpp graphics/pokemon/milotic/normal.gbapal.lz graphics/pokemon/milotic/shiny.gbapal.lz graphics/pokemon/miltank/back.4bpp.lz graphics/pokemon/miltank/footprint.1bpp graphics/pokemon/miltank/front.4bpp.lz graphics/pokemon/miltank/icon.4bpp graphics/pokemon/miltank/normal.gbapal.lz graphics/pokemon/miltank/shiny.gbapal.lz graphics/pokemon/minun/back.4bpp.lz graphics/pokemon/minun/footprint.1bpp graphics/pokemon/minun/front.4bpp.lz graphics/pokemon/minun/icon.4bpp graphics/pokemon/minun/normal.gbapal.lz graphics/pokemon/minun/shiny.gbapal.lz graphics/pokemon/misdreavus/back.4bpp.lz graphics/pokemon/misdreavus/footprint.1bpp graphics/pokemon/misdreavus/front.4bpp.lz graphics/pokemon/misdreavus/icon.4bpp graphics/pokemon/misdreavus/normal.gbapal.lz graphics/pokemon/misdreavus/shiny.gbapal.lz graphics/pokemon/moltres/back.4bpp.lz graphics/pokemon/moltres/footprint.1bpp graphics/pokemon/moltres/front.4bpp.lz graphics/pokemon/moltres/icon.4bpp graphics/pokemon/moltres/normal.gbapal.lz graphics/pokemon/moltres/shiny.gbapal.lz graphics/pokemon/mr_mime/back.4bpp.lz graphics/pokemon/mr_mime/footprint.1bpp graphics/pokemon/mr_mime/front.4bpp.lz graphics/pokemon/mr_mime/icon.4bpp graphics/pokemon/mr_mime/normal.gbapal.lz graphics/pokemon/mr_mime/shiny.gbapal.lz graphics/pokemon/mudkip/back.4bpp.lz graphics/pokemon/mudkip/footprint.1bpp graphics/pokemon/mudkip/front.4bpp.lz graphics/pokemon/mudkip/icon.4bpp graphics/pokemon/mudkip/normal.gbapal.lz graphics/pokemon/mudkip/shiny.gbapal.lz graphics/pokemon/muk/back.4bpp.lz graphics/pokemon/muk/footprint.1bpp graphics/pokemon/muk/front.4bpp.lz graphics/pokemon/muk/icon.4bpp graphics/pokemon/muk/normal.gbapal.lz graphics/pokemon/muk/shiny.gbapal.lz graphics/pokemon/murkrow/back.4bpp.lz graphics/pokemon/murkrow/footprint.1bpp graphics/pokemon/murkrow/front.4bpp.lz graphics/pokemon/murkrow/icon.4bpp graphics/pokemon/murkrow/normal.gbapal.lz graphics/pokemon/murkrow/shiny.gbapal.lz graphics/pokemon/natu/back.4bpp.lz graphics/pokemon/natu/footprint.1bpp graphics/pokemon/natu/front.4bpp.lz graphics/pokemon/natu/icon.4bpp graphics/pokemon/natu/normal.gbapal.lz graphics/pokemon/natu/shiny.gbapal.lz graphics/pokemon/nidoking/back.4bpp.lz graphics/pokemon/nidoking/footprint.1bpp graphics/pokemon/nidoking/front.4bpp.lz graphics/pokemon/nidoking/icon.4bpp graphics/pokemon/nidoking/normal.gbapal.lz graphics/pokemon/nidoking/shiny.gbapal.lz graphics/pokemon/nidoqueen/back.4bpp.lz graphics/pokemon/nidoqueen/footprint.1bpp graphics/pokemon/nidoqueen/front.4bpp.lz graphics/pokemon/nidoqueen/icon.4bpp graphics/pokemon/nidoqueen/normal.gbapal.lz graphics/pokemon/nidoqueen/shiny.gbapal.lz graphics/pokemon/nidoran_f/back.4bpp.lz graphics/pokemon/nidoran_f/footprint.1bpp graphics/pokemon/nidoran_f/front.4bpp.lz graphics/pokemon/nidoran_f/icon.4bpp graphics/pokemon/nidoran_f/normal.gbapal.lz graphics/pokemon/nidoran_f/shiny.gbapal.lz graphics/pokemon/nidoran_m/back.4bpp.lz graphics/pokemon/nidoran_m/footprint.1bpp graphics/pokemon/nidoran_m/front.4bpp.lz graphics/pokemon/nidoran_m/icon.4bpp graphics/pokemon/nidoran_m/normal.gbapal.lz graphics/pokemon/nidoran_m/shiny.gbapal.lz graphics/pokemon/nidorina/back.4bpp.lz graphics/pokemon/nidorina/footprint.1bpp graphics/pokemon/nidorina/front.4bpp.lz graphics/pokemon/nidorina/icon.4bpp graphics/pokemon/nidorina/normal.gbapal.lz graphics/pokemon/nidorina/shiny.gbapal.lz graphics/pokemon/nidorino/back.4bpp.lz graphics/pokemon/nidorino/footprint.1bpp graphics/pokemon/nidorino/front.4bpp.lz graphics/pokemon/nidorino/icon.4bpp graphics/pokemon/nidorino/normal.gbapal.lz graphics/pokemon/nidorino/shiny.gbapal.lz graphics/pokemon/nincada/back.4bpp.lz graphics/pokemon/nincada/footprint.1bpp graphics/pokemon/nincada/front.4bpp.lz graphics/pokemon/nincada/icon.4bpp graphics/pokemon/nincada/normal.gbapal.lz graphics/pokemon/nincada/shiny.gbapal.lz graphics/pokemon/ninetales/back.4bpp.lz graphics/pokemon/ninetales/footprint.1bpp graphics/pokemon/ninetales/front.4bpp.lz graphics/pokemon/ninetales/icon.4bpp graphics/pokemon/ninetales/normal.gbapal.lz graphics/pokemon/ninetales/shiny.gbapal.lz graphics/pokemon/ninjask/back.4bpp.lz graphics/pokemon/ninjask/footprint.1bpp graphics/pokemon/ninjask/front.4bpp.lz graphics/pokemon/ninjask/icon.4bpp graphics/pokemon/ninjask/normal.gbapal.lz graphics/pokemon/ninjask/shiny.gbapal.lz graphics/pokemon/noctowl/back.4bpp.lz graphics/pokemon/noctowl/footprint.1bpp graphics/pokemon/noctowl/front.4bpp.lz graphics/pokemon/noctowl/icon.4bpp graphics/pokemon/noctowl/normal.gbapal.lz graphics/pokemon/noctowl/shiny.gbapal.lz graphics/pokemon/nosepass/back.4bpp.lz graphics/pokemon/nosepass/footprint.1bpp graphics/pokemon/nosepass/front.4bpp.lz graphics/pokemon/nosepass/icon.4bpp graphics/pokemon/nosepass/normal.gbapal.lz graphics/pokemon/nosepass/shiny.gbapal.lz graphics/pokemon/numel/back.4bpp.lz graphics/pokemon/numel/footprint.1bpp graphics/pokemon/numel/front.4bpp.lz graphics/pokemon/numel/icon.4bpp graphics/pokemon/numel/normal.gbapal.lz graphics/pokemon/numel/shiny.gbapal.lz graphics/pokemon/nuzleaf/back.4bpp.lz graphics/pokemon/nuzleaf/footprint.1bpp graphics/pokemon/nuzleaf/front.4bpp.lz graphics/pokemon/nuzleaf/icon.4bpp graphics/pokemon/nuzleaf/normal.gbapal.lz graphics/pokemon/nuzleaf/shiny.gbapal.lz graphics/pokemon/octillery/back.4bpp.lz graphics/pokemon/octillery/footprint.1bpp graphics/pokemon/octillery/front.4bpp.lz graphics/pokemon/octillery/icon.4bpp graphics/pokemon/octillery/normal.gbapal.lz graphics/pokemon/octillery/shiny.gbapal.lz graphics/pokemon/oddish/back.4bpp.lz graphics/pokemon/oddish/footprint.1bpp graphics/pokemon/oddish/front.4bpp.lz graphics/pokemon/oddish/icon.4bpp graphics/pokemon/oddish/normal.gbapal.lz graphics/pokemon/oddish/shiny.gbapal.lz graphics/pokemon/omanyte/back.4bpp.lz graphics/pokemon/omanyte/footprint.1bpp graphics/pokemon/omanyte/front.4bpp.lz graphics/pokemon/omanyte/icon.4bpp graphics/pokemon/omanyte/normal.gbapal.lz graphics/pokemon/omanyte/shiny.gbapal.lz graphics/pokemon/omastar/back.4bpp.lz graphics/pokemon/omastar/footprint.1bpp graphics/pokemon/omastar/front.4bpp.lz graphics/pokemon/omastar/icon.4bpp graphics/pokemon/omastar/normal.gbapal.lz graphics/pokemon/omastar/shiny.gbapal.lz graphics/pokemon/onix/back.4bpp.lz graphics/pokemon/onix/footprint.1bpp graphics/pokemon/onix/front.4bpp.lz graphics/pokemon/onix/icon.4bpp graphics/pokemon/onix/normal.gbapal.lz graphics/pokemon/onix/shiny.gbapal.lz graphics/pokemon/paras/back.4bpp.lz graphics/pokemon/paras/footprint.1bpp graphics/pokemon/paras/front.4bpp.lz graphics/pokemon/paras/icon.4bpp graphics/pokemon/paras/normal.gbapal.lz graphics/pokemon/paras/shiny.gbapal.lz graphics/pokemon/parasect/back.4bpp.lz graphics/pokemon/parasect/footprint.1bpp graphics/pokemon/parasect/front.4bpp.lz graphics/pokemon/parasect/icon.4bpp graphics/pokemon/parasect/normal.gbapal.lz graphics/pokemon/parasect/shiny.gbapal.lz graphics/pokemon/pelipper/back.4bpp.lz graphics/pokemon/pelipper/footprint.1bpp graphics/pokemon/pelipper/front.4bpp.lz graphics/pokemon/pelipper/icon.4bpp graphics/pokemon/pelipper/normal.gbapal.lz graphics/pokemon/pelipper/shiny.gbapal.lz graphics/pokemon/persian/back.4bpp.lz graphics/pokemon/persian/footprint.1bpp graphics/pokemon/persian/front.4bpp.lz graphics/pokemon/persian/icon.4bpp graphics/pokemon/persian/normal.gbapal.lz graphics/pokemon/persian/shiny.gbapal.lz graphics/pokemon/phanpy/back.4bpp.lz graphics/pokemon/phanpy/footprint.1bpp graphics/pokemon/phanpy/front.4bpp.lz graphics/pokemon/phanpy/icon.4bpp graphics/pokemon/phanpy/normal.gbapal.lz graphics/pokemon/phanpy/shiny.gbapal.lz graphics/pokemon/pichu/back.4bpp.lz graphics/pokemon/pichu/footprint.1bpp graphics/pokemon/pichu/front.4bpp.lz graphics/pokemon/pichu/icon.4bpp graphics/pokemon/pichu/normal.gbapal.lz graphics/pokemon/pichu/shiny.gbapal.lz graphics/pokemon/pidgeot/back.4bpp.lz graphics/pokemon/pidgeot/footprint.1bpp graphics/pokemon/pidgeot/front.4bpp.lz graphics/pokemon/pidgeot/icon.4bpp graphics/pokemon/pidgeot/normal.gbapal.lz graphics/pokemon/pidgeot/shiny.gbapal.lz graphics/pokemon/pidgeotto/back.4bpp.lz graphics/pokemon/pidgeotto/footprint.1bpp graphics/pokemon/pidgeotto/front.4bpp.lz graphics/pokemon/pidgeotto/icon.4bpp graphics/pokemon/pidgeotto/normal.gbapal.lz graphics/pokemon/pidgeotto/shiny.gbapal.lz graphics/pokemon/pidgey/back.4bpp.lz graphics/pokemon/pidgey/footprint.1bpp graphics/pokemon/pidgey/front.4bpp.lz graphics/pokemon/pidgey/icon.4bpp graphics/pokemon/pidgey/normal.gbapal.lz graphics/pokemon/pidgey/shiny.gbapal.lz graphics/pokemon/pikachu/back.4bpp.lz graphics/pokemon/pikachu/footprint.1bpp graphics/pokemon/pikachu/front.4bpp.lz graphics/pokemon/pikachu/icon.4bpp graphics/pokemon/pikachu/normal.gbapal.lz graphics/pokemon/pikachu/shiny.gbapal.lz graphics/pokemon/piloswine/back.4bpp.lz graphics/pokemon/piloswine/footprint.1bpp graphics/pokemon/piloswine/front.4bpp.lz graphics/pokemon/piloswine/icon.4bpp graphics/pokemon/piloswine/normal.gbapal.lz graphics/pokemon/piloswine/shiny.gbapal.lz graphics/pokemon/pineco/back.4bpp.lz graphics/pokemon/pineco/footprint.1bpp graphics/pokemon/pineco/front.4bpp.lz graphics/pokemon/pineco/icon.4bpp graphics/pokemon/pineco/normal.gbapal.lz graphics/pokemon/pineco/shiny.gbapal.lz graphics/pokemon/pinsir/back.4bpp.lz graphics/pokemon/pinsir/footprint.1bpp graphics/pokemon/pinsir/front.4bpp.lz graphics/pokemon/pinsir/icon.4bpp graphics/pokemon/pinsir/normal.gbapal.lz graphics/pokemon/pinsir/shiny.gbapal.lz graphics/pokemon/plusle/back.4bpp.lz graphics/pokemon/plusle/footprint.1bpp graphics/pokemon/plusle/front.4bpp.lz graphics/pokemon/plusle/icon.4bpp graphics/pokemon/plusle/normal.gbapal.lz graphics/pokemon/plusle/shiny.gbapal.lz graphics/pokemon/politoed/back.4bpp.lz graphics/pokemon/politoed/footprint.1bpp graphics/pokemon/politoed/front.4bpp.lz graphics/pokemon/politoed/icon.4bpp graphics/pokemon/politoed/normal.gbapal.lz graphics/pokemon/politoed/shiny.gbapal.lz graphics/pokemon/poliwag/back.4bpp.lz graphics/pokemon/poliwag/footprint.1bpp graphics/pokemon/poliwag/front.4bpp.lz graphics/pokemon/poliwag/icon.4bpp graphics/pokemon/poliwag/normal.gbapal.lz graphics/pokemon/poliwag/shiny.gbapal.lz graphics/pokemon/poliwhirl/back.4bpp.lz graphics/pokemon/poliwhirl/footprint.1bpp graphics/pokemon/poliwhirl/front.4bpp.lz graphics/pokemon/poliwhirl/icon.4bpp graphics/pokemon/poliwhirl/normal.gbapal.lz graphics/pokemon/poliwhirl/shiny.gbapal.lz graphics/pokemon/poliwrath/back.4bpp.lz graphics/pokemon/poliwrath/footprint.1bpp graphics/pokemon/poliwrath/front.4bpp.lz graphics/pokemon/poliwrath/icon.4bpp graphics/pokemon/poliwrath/normal.gbapal.lz graphics/pokemon/poliwrath/shiny.gbapal.lz graphics/pokemon/ponyta/back.4bpp.lz graphics/pokemon/ponyta/footprint.1bpp graphics/pokemon/ponyta/front.4bpp.lz graphics/pokemon/ponyta/icon.4bpp graphics/pokemon/ponyta/normal.gbapal.lz graphics/pokemon/ponyta/shiny.gbapal.lz graphics/pokemon/poochyena/back.4bpp.lz graphics/pokemon/poochyena/footprint.1bpp graphics/pokemon/poochyena/front.4bpp.lz graphics/pokemon/poochyena/icon.4bpp graphics/pokemon/poochyena/normal.gbapal.lz graphics/pokemon/poochyena/shiny.gbapal.lz graphics/pokemon/porygon/back.4bpp.lz graphics/pokemon/porygon/footprint.1bpp graphics/pokemon/porygon/front.4bpp.lz graphics/pokemon/porygon/icon.4bpp graphics/pokemon/porygon/normal.gbapal.lz graphics/pokemon/porygon/shiny.gbapal.lz graphics/pokemon/porygon2/back.4bpp.lz graphics/pokemon/porygon2/footprint.1bpp graphics/pokemon/porygon2/front.4bpp.lz graphics/pokemon/porygon2/icon.4bpp graphics/pokemon/porygon2/normal.gbapal.lz graphics/pokemon/porygon2/shiny.gbapal.lz graphics/pokemon/primeape/back.4bpp.lz graphics/pokemon/primeape/footprint.1bpp graphics/pokemon/primeape/front.4bpp.lz graphics/pokemon/primeape/icon.4bpp graphics/pokemon/primeape/normal.gbapal.lz graphics/pokemon/primeape/shiny.gbapal.lz graphics/pokemon/psyduck/back.4bpp.lz graphics/pokemon/psyduck/footprint.1bpp graphics/pokemon/psyduck/front.4bpp.lz graphics/pokemon/psyduck/icon.4bpp graphics/pokemon/psyduck/normal.gbapal.lz graphics/pokemon/psyduck/shiny.gbapal.lz graphics/pokemon/pupitar/back.4bpp.lz graphics/pokemon/pupitar/footprint.1bpp graphics/pokemon/pupitar/front.4bpp.lz graphics/pokemon/pupitar/icon.4bpp graphics/pokemon/pupitar/normal.gbapal.lz graphics/pokemon/pupitar/shiny.gbapal.lz graphics/pokemon/quagsire/back.4bpp.lz graphics/pokemon/quagsire/footprint.1bpp graphics/pokemon/quagsire/front.4bpp.lz graphics/pokemon/quagsire/icon.4bpp graphics/pokemon/quagsire/normal.gbapal.lz graphics/pokemon/quagsire/shiny.gbapal.lz graphics/pokemon/question_mark/circled/back.4bpp.lz graphics/pokemon/question_mark/circled/front.4bpp.lz graphics/pokemon/question_mark/circled/normal.gbapal.lz graphics/pokemon/question_mark/circled/shiny.gbapal.lz graphics/pokemon/question_mark/double/back.4bpp.lz graphics/pokemon/question_mark/double/front.4bpp.lz graphics/pokemon/question_mark/double/normal.gbapal.lz graphics/pokemon/question_mark/double/shiny.gbapal.lz graphics/pokemon/question_mark/footprint.1bpp graphics/pokemon/question_mark/icon.4bpp graphics/pokemon/quilava/back.4bpp.lz graphics/pokemon/quilava/footprint.1bpp graphics/pokemon/quilava/front.4bpp.lz graphics/pokemon/quilava/icon.4bpp graphics/pokemon/quilava/normal.gbapal.lz graphics/pokemon/quilava/shiny.gbapal.lz graphics/pokemon/qwilfish/back.4bpp.lz graphics/pokemon/qwilfish/footprint.1bpp graphics/pokemon/qwilfish/front.4bpp.lz graphics/pokemon/qwilfish/icon.4bpp graphics/pokemon/qwilfish/normal.gbapal.lz graphics/pokemon/qwilfish/shiny.gbapal.lz graphics/pokemon/raichu/back.4bpp.lz graphics/pokemon/raichu/footprint.1bpp graphics/pokemon/raichu/front.4bpp.lz graphics/pokemon/raichu/icon.4bpp graphics/pokemon/raichu/normal.gbapal.lz graphics/pokemon/raichu/shiny.gbapal.lz graphics/pokemon/raikou/back.4bpp.lz graphics/pokemon/raikou/footprint.1bpp graphics/pokemon/raikou/front.4bpp.lz graphics/pokemon/raikou/icon.4bpp graphics/pokemon/raikou/normal.gbapal.lz graphics/pokemon/raikou/shiny.gbapal.lz graphics/pokemon/ralts/back.4bpp.lz graphics/pokemon/ralts/footprint.1bpp graphics/pokemon/ralts/front.4bpp.lz graphics/pokemon/ralts/icon.4bpp graphics/pokemon/ralts/normal.gbapal.lz graphics/pokemon/ralts/shiny.gbapal.lz graphics/pokemon/rapidash/back.4bpp.lz graphics/pokemon/rapidash/footprint.1bpp graphics/pokemon/rapidash/front.4bpp.lz graphics/pokemon/rapidash/icon.4bpp graphics/pokemon/rapidash/normal.gbapal.lz graphics/pokemon/rapidash/shiny.gbapal.lz graphics/pokemon/raticate/back.4bpp.lz graphics/pokemon/raticate/footprint.1bpp graphics/pokemon/raticate/front.4bpp.lz graphics/pokemon/raticate/icon.4bpp graphics/pokemon/raticate/normal.gbapal.lz graphics/pokemon/raticate/shiny.gbapal.lz graphics/pokemon/rattata/back.4bpp.lz graphics/pokemon/rattata/footprint.1bpp graphics/pokemon/rattata/front.4bpp.lz graphics/pokemon/rattata/icon.4bpp graphics/pokemon/rattata/normal.gbapal.lz graphics/pokemon/rattata/shiny.gbapal.lz graphics/pokemon/rayquaza/back.4bpp.lz graphics/pokemon/rayquaza/footprint.1bpp graphics/pokemon/rayquaza/front.4bpp.lz graphics/pokemon/rayquaza/icon.4bpp graphics/pokemon/rayquaza/normal.gbapal.lz graphics/pokemon/rayquaza/shiny.gbapal.lz graphics/pokemon/regice/back.4bpp.lz graphics/pokemon/regice/footprint.1bpp graphics/pokemon/regice/front.4bpp.lz graphics/pokemon/regice/icon.4bpp graphics/pokemon/regice/normal.gbapal.lz graphics/pokemon/regice/shiny.gbapal.lz graphics/pokemon/regirock/back.4bpp.lz graphics/pokemon/regirock/footprint.1bpp graphics/pokemon/regirock/front.4bpp.lz graphics/pokemon/regirock/icon.4bpp graphics/pokemon/regirock/normal.gbapal.lz graphics/pokemon/regirock/shiny.gbapal.lz graphics/pokemon/registeel/back.4bpp.lz graphics/pokemon/registeel/footprint.1bpp graphics/pokemon/registeel/front.4bpp.lz graphics/pokemon/registeel/icon.4bpp graphics/pokemon/registeel/normal.gbapal.lz graphics/pokemon/registeel/shiny.gbapal.lz graphics/pokemon/relicanth/back.4bpp.lz graphics/pokemon/relicanth/footprint.1bpp graphics/pokemon/relicanth/front.4bpp.lz graphics/pokemon/relicanth/icon.4bpp graphics/pokemon/relicanth/normal.gbapal.lz graphics/pokemon/relicanth/shiny.gbapal.lz graphics/pokemon/remoraid/back.4bpp.lz graphics/pokemon/remoraid/footprint.1bpp graphics/pokemon/remoraid/front.4bpp.lz graphics/pokemon/remoraid/icon.4bpp graphics/pokemon/remoraid/normal.gbapal.lz graphics/pokemon/remoraid/shiny.gbapal.lz graphics/pokemon/rhydon/back.4bpp.lz graphics/pokemon/rhydon/footprint.1bpp graphics/pokemon/rhydon/front.4bpp.lz graphics/pokemon/rhydon/icon.4bpp graphics/pokemon/rhydon/normal.gbapal.lz graphics/pokemon/rhydon/shiny.gbapal.lz graphics/pokemon/rhyhorn/back.4bpp.lz graphics/pokemon/rhyhorn/footprint.1bpp graphics/pokemon/rhyhorn/front.4bpp.lz graphics/pokemon/rhyhorn/icon.4bpp graphics/pokemon/rhyhorn/normal.gbapal.lz graphics/pokemon/rhyhorn/shiny.gbapal.lz graphics/pokemon/roselia/back.4bpp.lz graphics/pokemon/roselia/footprint.1bpp graphics/pokemon/roselia/front.4bpp.lz graphics/pokemon/roselia/icon.4bpp graphics/pokemon/roselia/normal.gbapal.lz graphics/pokemon/roselia/shiny.gbapal.lz graphics/pokemon/sableye/back.4bpp.lz graphics/pokemon/sableye/footprint.1bpp graphics/pokemon/sableye/front.4bpp.lz graphics/pokemon/sableye/icon.4bpp graphics/pokemon/sableye/normal.gbapal.lz graphics/pokemon/sableye/shiny.gbapal.lz graphics/pokemon/salamence/back.4bpp.lz graphics/pokemon/salamence/footprint.1bpp graphics/pokemon/salamence/front.4bpp.lz graphics/pokemon/salamence/icon.4bpp graphics/pokemon/salamence/normal.gbapal.lz graphics/pokemon/salamence/shiny.gbapal.lz graphics/pokemon/sandshrew/back.4bpp.lz graphics/pokemon/sandshrew/footprint.1bpp graphics/pokemon/sandshrew/front.4bpp.lz graphics/pokemon/sandshrew/icon.4bpp graphics/pokemon/sandshrew/normal.gbapal.lz graphics/pokemon/sandshrew/shiny.gbapal.lz graphics/pokemon/sandslash/back.4bpp.lz graphics/pokemon/sandslash/footprint.1bpp graphics/pokemon/sandslash/front.4bpp.lz graphics/pokemon/sandslash/icon.4bpp graphics/pokemon/sandslash/normal.gbapal.lz graphics/pokemon/sandslash/shiny.gbapal.lz graphics/pokemon/sceptile/back.4bpp.lz graphics/pokemon/sceptile/footprint.1bpp graphics/pokemon/sceptile/front.4bpp.lz graphics/pokemon/sceptile/icon.4bpp graphics/pokemon/sceptile/normal.gbapal.lz graphics/pokemon/sceptile/shiny.gbapal.lz graphics/pokemon/scizor/back.4bpp.lz graphics/pokemon/scizor/footprint.1bpp graphics/pokemon/scizor/front.4bpp.lz graphics/pokemon/scizor/icon.4bpp graphics/pokemon/scizor/normal.gbapal.lz graphics/pokemon/scizor/shiny.gbapal.lz graphics/pokemon/scyther/back.4bpp.lz graphics/pokemon/scyther/footprint.1bpp graphics/pokemon/scyther/front.4bpp.lz graphics/pokemon/scyther/icon.4bpp graphics/pokemon/scyther/normal.gbapal.lz graphics/pokemon/scyther/shiny.gbapal.lz graphics/pokemon/seadra/back.4bpp.lz graphics/pokemon/seadra/footprint.1bpp graphics/pokemon/seadra/front.4bpp.lz graphics/pokemon/seadra/icon.4bpp graphics/pokemon/seadra/normal.gbapal.lz graphics/pokemon/seadra/shiny.gbapal.lz graphics/pokemon/seaking/back.4bpp.lz graphics/pokemon/seaking/footprint.1bpp graphics/pokemon/seaking/front.4bpp.lz graphics/pokemon/seaking/icon.4bpp graphics/pokemon/seaking/normal.gbapal.lz graphics/pokemon/seaking/shiny.gbapal.lz graphics/pokemon/sealeo/back.4bpp.lz graphics/pokemon/sealeo/footprint.1bpp graphics/pokemon/sealeo/front.4bpp.lz graphics/pokemon/sealeo/icon.4bpp graphics/pokemon/sealeo/normal.gbapal.lz graphics/pokemon/sealeo/shiny.gbapal.lz graphics/pokemon/seedot/back.4bpp.lz graphics/pokemon/seedot/footprint.1bpp graphics/pokemon/seedot/front.4bpp.lz graphics/pokemon/seedot/icon.4bpp graphics/pokemon/seedot/normal.gbapal.lz graphics/pokemon/seedot/shiny.gbapal.lz graphics/pokemon/seel/back.4bpp.lz graphics/pokemon/seel/footprint.1bpp graphics/pokemon/seel/front.4bpp.lz graphics/pokemon/seel/icon.4bpp graphics/pokemon/seel/normal.gbapal.lz graphics/pokemon/seel/shiny.gbapal.lz graphics/pokemon/sentret/back.4bpp.lz graphics/pokemon/sentret/footprint.1bpp graphics/pokemon/sentret/front.4bpp.lz graphics/pokemon/sentret/icon.4bpp graphics/pokemon/sentret/normal.gbapal.lz graphics/pokemon/sentret/shiny.gbapal.lz graphics/pokemon/seviper/back.4bpp.lz graphics/pokemon/seviper/footprint.1bpp graphics/pokemon/seviper/front.4bpp.lz graphics/pokemon/seviper/icon.4bpp graphics/pokemon/seviper/normal.gbapal.lz graphics/pokemon/seviper/shiny.gbapal.lz graphics/pokemon/sharpedo/back.4bpp.lz graphics/pokemon/sharpedo/footprint.1bpp graphics/pokemon/sharpedo/front.4bpp.lz graphics/pokemon/sharpedo/icon.4bpp graphics/pokemon/sharpedo/normal.gbapal.lz graphics/pokemon/sharpedo/shiny.gbapal.lz graphics/pokemon/shedinja/back.4bpp.lz graphics/pokemon/shedinja/footprint.1bpp graphics/pokemon/shedinja/front.4bpp.lz graphics/pokemon/shedinja/icon.4bpp graphics/pokemon/shedinja/normal.gbapal.lz graphics/pokemon/shedinja/shiny.gbapal.lz graphics/pokemon/shelgon/back.4bpp.lz graphics/pokemon/shelgon/footprint.1bpp graphics/pokemon/shelgon/front.4bpp.lz graphics/pokemon/shelgon/icon.4bpp graphics/pokemon/shelgon/normal.gbapal.lz graphics/pokemon/shelgon/shiny.gbapal.lz graphics/pokemon/shellder/back.4bpp.lz graphics/pokemon/shellder/footprint.1bpp graphics/pokemon/shellder/front.4bpp.lz graphics/pokemon/shellder/icon.4bpp graphics/pokemon/shellder/normal.gbapal.lz graphics/pokemon/shellder/shiny.gbapal.lz graphics/pokemon/shiftry/back.4bpp.lz graphics/pokemon/shiftry/footprint.1bpp graphics/pokemon/shiftry/front.4bpp.lz graphics/pokemon/shiftry/icon.4bpp graphics/pokemon/shiftry/normal.gbapal.lz graphics/pokemon/shiftry/shiny.gbapal.lz graphics/pokemon/shroomish/back.4bpp.lz graphics/pokemon/shroomish/footprint.1bpp graphics/pokemon/shroomish/front.4bpp.lz graphics/pokemon/shroomish/icon.4bpp graphics/pokemon/shroomish/normal.gbapal.lz graphics/pokemon/shroomish/shiny.gbapal.lz graphics/pokemon/shuckle/back.4bpp.lz graphics/pokemon/shuckle/footprint.1bpp graphics/pokemon/shuckle/front.4bpp.lz graphics/pokemon/shuckle/icon.4bpp graphics/pokemon/shuckle/normal.gbapal.lz graphics/pokemon/shuckle/shiny.gbapal.lz graphics/pokemon/shuppet/back.4bpp.lz graphics/pokemon/shuppet/footprint.1bpp graphics/pokemon/shuppet/front.4bpp.lz graphics/pokemon/shuppet/icon.4bpp graphics/pokemon/shuppet/normal.gbapal.lz graphics/pokemon/shuppet/shiny.gbapal.lz graphics/pokemon/silcoon/back.4bpp.lz graphics/pokemon/silcoon/footprint.1bpp graphics/pokemon/silcoon/front.4bpp.lz graphics/pokemon/silcoon/icon.4bpp graphics/pokemon/silcoon/normal.gbapal.lz graphics/pokemon/silcoon/shiny.gbapal.lz graphics/pokemon/skarmory/back.4bpp.lz graphics/pokemon/skarmory/footprint.1bpp graphics/pokemon/skarmory/front.4bpp.lz graphics/pokemon/skarmory/icon.4bpp graphics/pokemon/skarmory/normal.gbapal.lz graphics/pokemon/skarmory/shiny.gbapal.lz graphics/pokemon/skiploom/back.4bpp.lz graphics/pokemon/skiploom/footprint.1bpp graphics/pokemon/skiploom/front.4bpp.lz graphics/pokemon/skiploom/icon.4bpp graphics/pokemon/skiploom/normal.gbapal.lz graphics/pokemon/skiploom/shiny.gbapal.lz graphics/pokemon/skitty/back.4bpp.lz graphics/pokemon/skitty/footprint.1bpp graphics/pokemon/skitty/front.4bpp.lz graphics/pokemon/skitty/icon.4bpp graphics/pokemon/skitty/normal.gbapal.lz graphics/pokemon/skitty/shiny.gbapal.lz graphics/pokemon/slaking/back.4bpp.lz graphics/pokemon/slaking/footprint.1bpp graphics/pokemon/slaking/front.4bpp.lz graphics/pokemon/slaking/icon.4bpp graphics/pokemon/slaking/normal.gbapal.lz graphics/pokemon/slaking/shiny.gbapal.lz graphics/pokemon/slakoth/back.4bpp.lz graphics/pokemon/slakoth/footprint.1bpp graphics/pokemon/slakoth/front.4bpp.lz graphics/pokemon/slakoth/icon.4bpp graphics/pokemon/slakoth/normal.gbapal.lz graphics/pokemon/slakoth/shiny.gbapal.lz graphics/pokemon/slowbro/back.4bpp.lz graphics/pokemon/slowbro/footprint.1bpp graphics/pokemon/slowbro/front.4bpp.lz graphics/pokemon/slowbro/icon.4bpp graphics/pokemon/slowbro/normal.gbapal.lz graphics/pokemon/slowbro/shiny.gbapal.lz graphics/pokemon/slowking/back.4bpp.lz graphics/pokemon/slowking/footprint.1bpp graphics/pokemon/slowking/front.4bpp.lz graphics/pokemon/slowking/icon.4bpp graphics/pokemon/slowking/normal.gbapal.lz graphics/pokemon/slowking/shiny.gbapal.lz graphics/pokemon/slowpoke/back.4bpp.lz graphics/pokemon/slowpoke/footprint.1bpp graphics/pokemon/slowpoke/front.4bpp.lz graphics/pokemon/slowpoke/icon.4bpp graphics/pokemon/slowpoke/normal.gbapal.lz graphics/pokemon/slowpoke/shiny.gbapal.lz graphics/pokemon/slugma/back.4bpp.lz graphics/pokemon/slugma/footprint.1bpp graphics/pokemon/slugma/front.4bpp.lz graphics/pokemon/slugma/icon.4bpp graphics/pokemon/slugma/normal.gbapal.lz graphics/pokemon/slugma/shiny.gbapal.lz graphics/pokemon/smeargle/back.4bpp.lz graphics/pokemon/smeargle/footprint.1bpp graphics/pokemon/smeargle/front.4bpp.lz graphics/pokemon/smeargle/icon.4bpp graphics/pokemon/smeargle/normal.gbapal.lz graphics/pokemon/smeargle/shiny.gbapal.lz graphics/pokemon/smoochum/back.4bpp.lz graphics/pokemon/smoochum/footprint.1bpp graphics/pokemon/smoochum/front.4bpp.lz graphics/pokemon/smoochum/icon.4bpp graphics/pokemon/smoochum/normal.gbapal.lz graphics/pokemon/smoochum/shiny.gbapal.lz graphics/pokemon/sneasel/back.4bpp.lz graphics/pokemon/sneasel/footprint.1bpp graphics/pokemon/sneasel/front.4bpp.lz graphics/pokemon/sneasel/icon.4bpp graphics/pokemon/sneasel/normal.gbapal.lz graphics/pokemon/sneasel/shiny.gbapal.lz graphics/pokemon/snorlax/back.4bpp.lz graphics/pokemon/snorlax/footprint.1bpp graphics/pokemon/snorlax/front.4bpp.lz graphics/pokemon/snorlax/icon.4bpp graphics/pokemon/snorlax/normal.gbapal.lz graphics/pokemon/snorlax/shiny.gbapal.lz graphics/pokemon/snorunt/back.4bpp.lz graphics/pokemon/snorunt/footprint.1bpp graphics/pokemon/snorunt/front.4bpp.lz graphics/pokemon/snorunt/icon.4bpp graphics/pokemon/snorunt/normal.gbapal.lz graphics/pokemon/snorunt/shiny.gbapal.lz graphics/pokemon/snubbull/back.4bpp.lz graphics/pokemon/snubbull/footprint.1bpp graphics/pokemon/snubbull/front.4bpp.lz graphics/pokemon/snubbull/icon.4bpp graphics/pokemon/snubbull/normal.gbapal.lz graphics/pokemon/snubbull/shiny.gbapal.lz graphics/pokemon/solrock/back.4bpp.lz graphics/pokemon/solrock/footprint.1bpp graphics/pokemon/solrock/front.4bpp.lz graphics/pokemon/solrock/icon.4bpp graphics/pokemon/solrock/normal.gbapal.lz graphics/pokemon/solrock/shiny.gbapal.lz graphics/pokemon/spearow/back.4bpp.lz graphics/pokemon/spearow/footprint.1bpp graphics/pokemon/spearow/front.4bpp.lz graphics/pokemon/spearow/icon.4bpp graphics/pokemon/spearow/normal.gbapal.lz graphics/pokemon/spearow/shiny.gbapal.lz graphics/pokemon/spheal/back.4bpp.lz graphics/pokemon/spheal/footprint.1bpp graphics/pokemon/spheal/front.4bpp.lz graphics/pokemon/spheal/icon.4bpp graphics/pokemon/spheal/normal.gbapal.lz graphics/pokemon/spheal/shiny.gbapal.lz graphics/pokemon/spinarak/back.4bpp.lz graphics/pokemon/spinarak/footprint.1bpp graphics/pokemon/spinarak/front.4bpp.lz graphics/pokemon/spinarak/icon.4bpp graphics/pokemon/spinarak/normal.gbapal.lz graphics/pokemon/spinarak/shiny.gbapal.lz graphics/pokemon/spinda/back.4bpp.lz graphics/pokemon/spinda/footprint.1bpp graphics/pokemon/spinda/front.4bpp.lz graphics/pokemon/spinda/icon.4bpp graphics/pokemon/spinda/normal.gbapal.lz graphics/pokemon/spinda/shiny.gbapal.lz graphics/pokemon/spoink/back.4bpp.lz graphics/pokemon/spoink/footprint.1bpp graphics/pokemon/spoink/front.4bpp.lz graphics/pokemon/spoink/icon.4bpp graphics/pokemon/spoink/normal.gbapal.lz graphics/pokemon/spoink/shiny.gbapal.lz graphics/pokemon/squirtle/back.4bpp.lz graphics/pokemon/squirtle/footprint.1bpp graphics/pokemon/squirtle/front.4bpp.lz graphics/pokemon/squirtle/icon.4bpp graphics/pokemon/squirtle/normal.gbapal.lz graphics/pokemon/squirtle/shiny.gbapal.lz graphics/pokemon/stantler/back.4bpp.lz graphics/pokemon/stantler/footprint.1bpp graphics/pokemon/stantler/front.4bpp.lz graphics/pokemon/stantler/icon.4bpp graphics/pokemon/stantler/normal.gbapal.lz graphics/pokemon/stantler/shiny.gbapal.lz graphics/pokemon/starmie/back.4bpp.lz graphics/pokemon/starmie/footprint.1bpp graphics/pokemon/starmie/front.4bpp.lz graphics/pokemon/starmie/icon.4bpp graphics/pokemon/starmie/normal.gbapal.lz graphics/pokemon/starmie/shiny.gbapal.lz graphics/pokemon/staryu/back.4bpp.lz graphics/pokemon/staryu/footprint.1bpp graphics/pokemon/staryu/front.4bpp.lz graphics/pokemon/staryu/icon.4bpp graphics/pokemon/staryu/normal.gbapal.lz graphics/pokemon/staryu/shiny.gbapal.lz graphics/pokemon/steelix/back.4bpp.lz graphics/pokemon/steelix/footprint.1bpp graphics/pokemon/steelix/front.4bpp.lz graphics/pokemon/steelix/icon.4bpp graphics/pokemon/steelix/normal.gbapal.lz graphics/pokemon/steelix/shiny.gbapal.lz graphics/pokemon/sudowoodo/back.4bpp.lz graphics/pokemon/sudowoodo/footprint.1bpp graphics/pokemon/sudowoodo/front.4bpp.lz graphics/pokemon/sudowoodo/icon.4bpp graphics/pokemon/sudowoodo/normal.gbapal.lz graphics/pokemon/sudowoodo/shiny.gbapal.lz graphics/pokemon/suicune/back.4bpp.lz graphics/pokemon/suicune/footprint.1bpp graphics/pokemon/suicune/front.4bpp.lz graphics/pokemon/suicune/icon.4bpp graphics/pokemon/suicune/normal.gbapal.lz graphics/pokemon/suicune/shiny.gbapal.lz graphics/pokemon/sunflora/back.4bpp.lz graphics/pokemon/sunflora/footprint.1bpp graphics/pokemon/sunflora/front.4bpp.lz graphics/pokemon/sunflora/icon.4bpp graphics/pokemon/sunflora/normal.gbapal.lz graphics/pokemon/sunflora/shiny.gbapal.lz graphics/pokemon/sunkern/back.4bpp.lz graphics/pokemon/sunkern/footprint.1bpp graphics/pokemon/sunkern/front.4bpp.lz graphics/pokemon/sunkern/icon.4bpp graphics/pokemon/sunkern/normal.gbapal.lz graphics/pokemon/sunkern/shiny.gbapal.lz graphics/pokemon/surskit/back.4bpp.lz graphics/pokemon/surskit/footprint.1bpp graphics/pokemon/surskit/front.4bpp.lz graphics/pokemon/surskit/icon.4bpp graphics/pokemon/surskit/normal.gbapal.lz graphics/pokemon/surskit/shiny.gbapal.lz graphics/pokemon/swablu/back.4bpp.lz graphics/pokemon/swablu/footprint.1bpp graphics/pokemon/swablu/front.4bpp.lz graphics/pokemon/swablu/icon.4bpp graphics/pokemon/swablu/normal.gbapal.lz graphics/pokemon/swablu/shiny.gbapal.lz graphics/pokemon/swalot/back.4bpp.lz graphics/pokemon/swalot/footprint.1bpp graphics/pokemon/swalot/front.4bpp.lz graphics/pokemon/swalot/icon.4bpp graphics/pokemon/swalot/normal.gbapal.lz graphics/pokemon/swalot/shiny.gbapal.lz graphics/pokemon/swampert/back.4bpp.lz graphics/pokemon/swampert/footprint.1bpp graphics/pokemon/swampert/front.4bpp.lz graphics/pokemon/swampert/icon.4bpp graphics/pokemon/swampert/normal.gbapal.lz graphics/pokemon/swampert/shiny.gbapal.lz graphics/pokemon/swellow/back.4bpp.lz graphics/pokemon/swellow/footprint.1bpp graphics/pokemon/swellow/front.4bpp.lz graphics/pokemon/swellow/icon.4bpp graphics/pokemon/swellow/normal.gbapal.lz graphics/pokemon/swellow/shiny.gbapal.lz graphics/pokemon/swinub/back.4bpp.lz graphics/pokemon/swinub/footprint.1bpp graphics/pokemon/swinub/front.4bpp.lz graphics/pokemon/swinub/icon.4bpp graphics/pokemon/swinub/normal.gbapal.lz graphics/pokemon/swinub/shiny.gbapal.lz graphics/pokemon/taillow/back.4bpp.lz graphics/pokemon/taillow/footprint.1bpp graphics/pokemon/taillow/front.4bpp.lz graphics/pokemon/taillow/icon.4bpp graphics/pokemon/taillow/normal.gbapal.lz graphics/pokemon/taillow/shiny.gbapal.lz graphics/pokemon/tangela/back.4bpp.lz graphics/pokemon/tangela/footprint.1bpp graphics/pokemon/tangela/front.4bpp.lz graphics/pokemon/tangela/icon.4bpp graphics/pokemon/tangela/normal.gbapal.lz graphics/pokemon/tangela/shiny.gbapal.lz graphics/pokemon/tauros/back.4bpp.lz graphics/pokemon/tauros/footprint.1bpp graphics/pokemon/tauros/front.4bpp.lz graphics/pokemon/tauros/icon.4bpp graphics/pokemon/tauros/normal.gbapal.lz graphics/pokemon/tauros/shiny.gbapal.lz graphics/pokemon/teddiursa/back.4bpp.lz graphics/pokemon/teddiursa/footprint.1bpp graphics/pokemon/teddiursa/front.4bpp.lz graphics/pokemon/teddiursa/icon.4bpp graphics/pokemon/teddiursa/normal.gbapal.lz graphics/pokemon/teddiursa/shiny.gbapal.lz graphics/pokemon/tentacool/back.4bpp.lz graphics/pokemon/tentacool/footprint.1bpp graphics/pokemon/tentacool/front.4bpp.lz graphics/pokemon/tentacool/icon.4bpp graphics/pokemon/tentacool/normal.gbapal.lz graphics/pokemon/tentacool/shiny.gbapal.lz graphics/pokemon/tentacruel/back.4bpp.lz graphics/pokemon/tentacruel/footprint.1bpp graphics/pokemon/tentacruel/front.4bpp.lz graphics/pokemon/tentacruel/icon.4bpp graphics/pokemon/tentacruel/normal.gbapal.lz graphics/pokemon/tentacruel/shiny.gbapal.lz graphics/pokemon/togepi/back.4bpp.lz graphics/pokemon/togepi/footprint.1bpp graphics/pokemon/togepi/front.4bpp.lz graphics/pokemon/togepi/icon.4bpp graphics/pokemon/togepi/normal.gbapal.lz graphics/pokemon/togepi/shiny.gbapal.lz graphics/pokemon/togetic/back.4bpp.lz graphics/pokemon/togetic/footprint.1bpp graphics/pokemon/togetic/front.4bpp.lz graphics/pokemon/togetic/icon.4bpp graphics/pokemon/togetic/normal.gbapal.lz graphics/pokemon/togetic/shiny.gbapal.lz graphics/pokemon/torchic/back.4bpp.lz graphics/pokemon/torchic/footprint.1bpp graphics/pokemon/torchic/front.4bpp.lz graphics/pokemon/torchic/icon.4bpp graphics/pokemon/torchic/normal.gbapal.lz graphics/pokemon/torchic/shiny.gbapal.lz graphics/pokemon/torkoal/back.4bpp.lz graphics/pokemon/torkoal/footprint.1bpp graphics/pokemon/torkoal/front.4bpp.lz graphics/pokemon/torkoal/icon.4bpp graphics/pokemon/torkoal/normal.gbapal.lz graphics/pokemon/torkoal/shiny.gbapal.lz graphics/pokemon/totodile/back.4bpp.lz graphics/pokemon/totodile/footprint.1bpp graphics/pokemon/totodile/front.4bpp.lz graphics/pokemon/totodile/icon.4bpp graphics/pokemon/totodile/normal.gbapal.lz graphics/pokemon/totodile/shiny.gbapal.lz graphics/pokemon/trapinch/back.4bpp.lz graphics/pokemon/trapinch/footprint.1bpp graphics/pokemon/trapinch/front.4bpp.lz graphics/pokemon/trapinch/icon.4bpp graphics/pokemon/trapinch/normal.gbapal.lz graphics/pokemon/trapinch/shiny.gbapal.lz graphics/pokemon/treecko/back.4bpp.lz graphics/pokemon/treecko/footprint.1bpp graphics/pokemon/treecko/front.4bpp.lz graphics/pokemon/treecko/icon.4bpp graphics/pokemon/treecko/normal.gbapal.lz graphics/pokemon/treecko/shiny.gbapal.lz graphics/pokemon/tropius/back.4bpp.lz graphics/pokemon/tropius/footprint.1bpp graphics/pokemon/tropius/front.4bpp.lz graphics/pokemon/tropius/icon.4bpp graphics/pokemon/tropius/normal.gbapal.lz graphics/pokemon/tropius/shiny.gbapal.lz graphics/pokemon/typhlosion/back.4bpp.lz graphics/pokemon/typhlosion/footprint.1bpp graphics/pokemon/typhlosion/front.4bpp.lz graphics/pokemon/typhlosion/icon.4bpp graphics/pokemon/typhlosion/normal.gbapal.lz graphics/pokemon/typhlosion/shiny.gbapal.lz graphics/pokemon/tyranitar/back.4bpp.lz graphics/pokemon/tyranitar/footprint.1bpp graphics/pokemon/tyranitar/front.4bpp.lz graphics/pokemon/tyranitar/icon.4bpp graphics/pokemon/tyranitar/normal.gbapal.lz graphics/pokemon/tyranitar/shiny.gbapal.lz graphics/pokemon/tyrogue/back.4bpp.lz graphics/pokemon/tyrogue/footprint.1bpp graphics/pokemon/tyrogue/front.4bpp.lz graphics/pokemon/tyrogue/icon.4bpp graphics/pokemon/tyrogue/normal.gbapal.lz graphics/pokemon/tyrogue/shiny.gbapal.lz graphics/pokemon/umbreon/back.4bpp.lz graphics/pokemon/umbreon/footprint.1bpp graphics/pokemon/umbreon/front.4bpp.lz graphics/pokemon/umbreon/icon.4bpp graphics/pokemon/umbreon/normal.gbapal.lz graphics/pokemon/umbreon/shiny.gbapal.lz graphics/pokemon/unown/a/back.4bpp.lz graphics/pokemon/unown/a/front.4bpp.lz graphics/pokemon/unown/a/icon.4bpp graphics/pokemon/unown/b/back.4bpp.lz graphics/pokemon/unown/b/front.4bpp.lz graphics/pokemon/unown/b/icon.4bpp graphics/pokemon/unown/c/back.4bpp.lz graphics/pokemon/unown/c/front.4bpp.lz graphics/pokemon/unown/c/icon.4bpp graphics/pokemon/unown/d/back.4bpp.lz graphics/pokemon/unown/d/front.4bpp.lz graphics/pokemon/unown/d/icon.4bpp graphics/pokemon/unown/e/back.4bpp.lz graphics/pokemon/unown/e/front.4bpp.lz graphics/pokemon/unown/e/icon.4bpp graphics/pokemon/unown/exclamation_mark/back.4bpp.lz graphics/pokemon/unown/exclamation_mark/front.4bpp.lz graphics/pokemon/unown/exclamation_mark/icon.4bpp graphics/pokemon/unown/f/back.4bpp.lz graphics/pokemon/unown/f/front.4bpp.lz graphics/pokemon/unown/f/icon.4bpp graphics/pokemon/unown/footprint.1bpp graphics/pokemon/unown/g/back.4bpp.lz graphics/pokemon/unown/g/front.4bpp.lz graphics/pokemon/unown/g/icon.4bpp graphics/pokemon/unown/h/back.4bpp.lz graphics/pokemon/unown/h/front.4bpp.lz graphics/pokemon/unown/h/icon.4bpp graphics/pokemon/unown/i/back.4bpp.lz graphics/pokemon/unown/i/front.4bpp.lz graphics/pokemon/unown/i/icon.4bpp graphics/pokemon/unown/j/back.4bpp.lz graphics/pokemon/unown/j/front.4bpp.lz graphics/pokemon/unown/j/icon.4bpp graphics/pokemon/unown/k/back.4bpp.lz graphics/pokemon/unown/k/front.4bpp.lz graphics/pokemon/unown/k/icon.4bpp graphics/pokemon/unown/l/back.4bpp.lz graphics/pokemon/unown/l/front.4bpp.lz graphics/pokemon/unown/l/icon.4bpp graphics/pokemon/unown/m/back.4bpp.lz graphics/pokemon/unown/m/front.4bpp.lz graphics/pokemon/unown/m/icon.4bpp graphics/pokemon/unown/n/back.4bpp.lz graphics/pokemon/unown/n/front.4bpp.lz graphics/pokemon/unown/n/icon.4bpp graphics/pokemon/unown/normal.gbapal.lz graphics/pokemon/unown/o/back.4bpp.lz graphics/pokemon/unown/o/front.4bpp.lz graphics/pokemon/unown/o/icon.4bpp graphics/pokemon/unown/p/back.4bpp.lz graphics/pokemon/unown/p/front.4bpp.lz graphics/pokemon/unown/p/icon.4bpp graphics/pokemon/unown/q/back.4bpp.lz graphics/pokemon/unown/q/front.4bpp.lz graphics/pokemon/unown/q/icon.4bpp graphics/pokemon/unown/question_mark/back.4bpp.lz graphics/pokemon/unown/question_mark/front.4bpp.lz graphics/pokemon/unown/question_mark/icon.4bpp graphics/pokemon/unown/r/back.4bpp.lz graphics/pokemon/unown/r/front.4bpp.lz graphics/pokemon/unown/r/icon.4bpp graphics/pokemon/unown/s/back.4bpp.lz graphics/pokemon/unown/s/front.4bpp.lz graphics/pokemon/unown/s/icon.4bpp graphics/pokemon/unown/shiny.gbapal.lz graphics/pokemon/unown/t/back.4bpp.lz graphics/pokemon/unown/t/front.4bpp.lz graphics/pokemon/unown/t/icon.4bpp graphics/pokemon/unown/u/back.4bpp.lz graphics/pokemon/unown/u/front.4bpp.lz graphics/pokemon/unown/u/icon.4bpp graphics/pokemon/unown/v/back.4bpp.lz graphics/pokemon/unown/v/front.4bpp.lz graphics/pokemon/unown/v/icon.4bpp graphics/pokemon/unown/w/back.4bpp.lz graphics/pokemon/unown/w/front.4bpp.lz graphics/pokemon/unown/w/icon.4bpp graphics/pokemon/unown/x/back.4bpp.lz graphics/pokemon/unown/x/front.4bpp.lz graphics/pokemon/unown/x/icon.4bpp graphics/pokemon/unown/y/back.4bpp.lz graphics/pokemon/unown/y/front.4bpp.lz graphics/pokemon/unown/y/icon.4bpp graphics/pokemon/unown/z/back.4bpp.lz graphics/pokemon/unown/z/front.4bpp.lz graphics/pokemon/unown/z/icon.4bpp graphics/pokemon/ursaring/back.4bpp.lz graphics/pokemon/ursaring/footprint.1bpp graphics/pokemon/ursaring/front.4bpp.lz graphics/pokemon/ursaring/icon.4bpp graphics/pokemon/ursaring/normal.gbapal.lz graphics/pokemon/ursaring/shiny.gbapal.lz graphics/pokemon/vaporeon/back.4bpp.lz graphics/pokemon/vaporeon/footprint.1bpp graphics/pokemon/vaporeon/front.4bpp.lz graphics/pokemon/vaporeon/icon.4bpp graphics/pokemon/vaporeon/normal.gbapal.lz graphics/pokemon/vaporeon/shiny.gbapal.lz graphics/pokemon/venomoth/back.4bpp.lz graphics/pokemon/venomoth/footprint.1bpp graphics/pokemon/venomoth/front.4bpp.lz graphics/pokemon/venomoth/icon.4bpp graphics/pokemon/venomoth/normal.gbapal.lz graphics/pokemon/venomoth/shiny.gbapal.lz graphics/pokemon/venonat/back.4bpp.lz graphics/pokemon/venonat/footprint.1bpp graphics/pokemon/venonat/front.4bpp.lz graphics/pokemon/venonat/icon.4bpp graphics/pokemon/venonat/normal.gbapal.lz graphics/pokemon/venonat/shiny.gbapal.lz graphics/pokemon/venusaur/back.4bpp.lz graphics/pokemon/venusaur/footprint.1bpp graphics/pokemon/venusaur/front.4bpp.lz graphics/pokemon/venusaur/icon.4bpp graphics/pokemon/venusaur/normal.gbapal.lz graphics/pokemon/venusaur/shiny.gbapal.lz graphics/pokemon/vibrava/back.4bpp.lz graphics/pokemon/vibrava/footprint.1bpp graphics/pokemon/vibrava/front.4bpp.lz graphics/pokemon/vibrava/icon.4bpp graphics/pokemon/vibrava/normal.gbapal.lz graphics/pokemon/vibrava/shiny.gbapal.lz graphics/pokemon/victreebel/back.4bpp.lz graphics/pokemon/victreebel/footprint.1bpp graphics/pokemon/victreebel/front.4bpp.lz graphics/pokemon/victreebel/icon.4bpp graphics/pokemon/victreebel/normal.gbapal.lz graphics/pokemon/victreebel/shiny.gbapal.lz graphics/pokemon/vigoroth/back.4bpp.lz graphics/pokemon/vigoroth/footprint.1bpp graphics/pokemon/vigoroth/front.4bpp.lz graphics/pokemon/vigoroth/icon.4bpp graphics/pokemon/vigoroth/normal.gbapal.lz graphics/pokemon/vigoroth/shiny.gbapal.lz graphics/pokemon/vileplume/back.4bpp.lz graphics/pokemon/vileplume/footprint.1bpp graphics/pokemon/vileplume/front.4bpp.lz graphics/pokemon/vileplume/icon.4bpp graphics/pokemon/vileplume/normal.gbapal.lz graphics/pokemon/vileplume/shiny.gbapal.lz graphics/pokemon/volbeat/back.4bpp.lz graphics/pokemon/volbeat/footprint.1bpp graphics/pokemon/volbeat/front.4bpp.lz graphics/pokemon/volbeat/icon.4bpp graphics/pokemon/volbeat/normal.gbapal.lz graphics/pokemon/volbeat/shiny.gbapal.lz graphics/pokemon/voltorb/back.4bpp.lz graphics/pokemon/voltorb/footprint.1bpp graphics/pokemon/voltorb/front.4bpp.lz graphics/pokemon/voltorb/icon.4bpp graphics/pokemon/voltorb/normal.gbapal.lz graphics/pokemon/voltorb/shiny.gbapal.lz graphics/pokemon/vulpix/back.4bpp.lz graphics/pokemon/vulpix/footprint.1bpp graphics/pokemon/vulpix/front.4bpp.lz graphics/pokemon/vulpix/icon.4bpp graphics/pokemon/vulpix/normal.gbapal.lz graphics/pokemon/vulpix/shiny.gbapal.lz graphics/pokemon/wailmer/back.4bpp.lz graphics/pokemon/wailmer/footprint.1bpp graphics/pokemon/wailmer/front.4bpp.lz graphics/pokemon/wailmer/icon.4bpp graphics/pokemon/wailmer/normal.gbapal.lz graphics/pokemon/wailmer/shiny.gbapal.lz graphics/pokemon/wailord/back.4bpp.lz graphics/pokemon/wailord/footprint.1bpp graphics/pokemon/wailord/front.4bpp.lz graphics/pokemon/wailord/icon.4bpp graphics/pokemon/wailord/normal.gbapal.lz graphics/pokemon/wailord/shiny.gbapal.lz graphics/pokemon/walrein/back.4bpp.lz graphics/pokemon/walrein/footprint.1bpp graphics/pokemon/walrein/front.4bpp.lz graphics/pokemon/walrein/icon.4bpp graphics/pokemon/walrein/normal.gbapal.lz graphics/pokemon/walrein/shiny.gbapal.lz graphics/pokemon/wartortle/back.4bpp.lz graphics/pokemon/wartortle/footprint.1bpp graphics/pokemon/wartortle/front.4bpp.lz graphics/pokemon/wartortle/icon.4bpp graphics/pokemon/wartortle/normal.gbapal.lz graphics/pokemon/wartortle/shiny.gbapal.lz graphics/pokemon/weedle/back.4bpp.lz graphics/pokemon/weedle/footprint.1bpp graphics/pokemon/weedle/front.4bpp.lz graphics/pokemon/weedle/icon.4bpp graphics/pokemon/weedle/normal.gbapal.lz graphics/pokemon/weedle/shiny.gbapal.lz graphics/pokemon/weepinbell/back.4bpp.lz graphics/pokemon/weepinbell/footprint.1bpp graphics/pokemon/weepinbell/front.4bpp.lz graphics/pokemon/weepinbell/icon.4bpp graphics/pokemon/weepinbell/normal.gbapal.lz graphics/pokemon/weepinbell/shiny.gbapal.lz graphics/pokemon/weezing/back.4bpp.lz graphics/pokemon/weezing/footprint.1bpp graphics/pokemon/weezing/front.4bpp.lz graphics/pokemon/weezing/icon.4bpp graphics/pokemon/weezing/normal.gbapal.lz graphics/pokemon/weezing/shiny.gbapal.lz graphics/pokemon/whiscash/back.4bpp.lz graphics/pokemon/whiscash/footprint.1bpp graphics/pokemon/whiscash/front.4bpp.lz graphics/pokemon/whiscash/icon.4bpp graphics/pokemon/whiscash/normal.gbapal.lz graphics/pokemon/whiscash/shiny.gbapal.lz graphics/pokemon/whismur/back.4bpp.lz graphics/pokemon/whismur/footprint.1bpp graphics/pokemon/whismur/front.4bpp.lz graphics/pokemon/whismur/icon.4bpp graphics/pokemon/whismur/normal.gbapal.lz graphics/pokemon/whismur/shiny.gbapal.lz graphics/pokemon/wigglytuff/back.4bpp.lz graphics/pokemon/wigglytuff/footprint.1bpp graphics/pokemon/wigglytuff/front.4bpp.lz graphics/pokemon/wigglytuff/icon.4bpp graphics/pokemon/wigglytuff/normal.gbapal.lz graphics/pokemon/wigglytuff/shiny.gbapal.lz graphics/pokemon/wingull/back.4bpp.lz graphics/pokemon/wingull/footprint.1bpp graphics/pokemon/wingull/front.4bpp.lz graphics/pokemon/wingull/icon.4bpp graphics/pokemon/wingull/normal.gbapal.lz graphics/pokemon/wingull/shiny.gbapal.lz graphics/pokemon/wobbuffet/back.4bpp.lz graphics/pokemon/wobbuffet/footprint.1bpp graphics/pokemon/wobbuffet/front.4bpp.lz graphics/pokemon/wobbuffet/icon.4bpp graphics/pokemon/wobbuffet/normal.gbapal.lz graphics/pokemon/wobbuffet/shiny.gbapal.lz graphics/pokemon/wooper/back.4bpp.lz graphics/pokemon/wooper/footprint.1bpp graphics/pokemon/wooper/front.4bpp.lz graphics/pokemon/wooper/icon.4bpp graphics/pokemon/wooper/normal.gbapal.lz graphics/pokemon/wooper/shiny.gbapal.lz graphics/pokemon/wurmple/back.4bpp.lz graphics/pokemon/wurmple/footprint.1bpp graphics/pokemon/wurmple/front.4bpp.lz graphics/pokemon/wurmple/icon.4bpp graphics/pokemon/wurmple/normal.gbapal.lz graphics/pokemon/wurmple/shiny.gbapal.lz graphics/pokemon/wynaut/back.4bpp.lz graphics/pokemon/wynaut/footprint.1bpp graphics/pokemon/wynaut/front.4bpp.lz graphics/pokemon/wynaut/icon.4bpp graphics/pokemon/wynaut/normal.gbapal.lz graphics/pokemon/wynaut/shiny.gbapal.lz graphics/pokemon/xatu/back.4bpp.lz graphics/pokemon/xatu/footprint.1bpp graphics/pokemon/xatu/front.4bpp.lz graphics/pokemon/xatu/icon.4bpp graphics/pokemon/xatu/normal.gbapal.lz graphics/pokemon/xatu/shiny.gbapal.lz graphics/pokemon/yanma/back.4bpp.lz graphics/pokemon/yanma/footprint.1bpp graphics/pokemon/yanma/front.4bpp.lz graphics/pokemon/yanma/icon.4bpp graphics/pokemon/yanma/normal.gbapal.lz graphics/pokemon/yanma/shiny.gbapal.lz graphics/pokemon/zangoose/back.4bpp.lz graphics/pokemon/zangoose/footprint.1bpp graphics/pokemon/zangoose/front.4bpp.lz graphics/pokemon/zangoose/icon.4bpp graphics/pokemon/zangoose/normal.gbapal.lz graphics/pokemon/zangoose/shiny.gbapal.lz graphics/pokemon/zapdos/back.4bpp.lz graphics/pokemon/zapdos/footprint.1bpp graphics/pokemon/zapdos/front.4bpp.lz graphics/pokemon/zapdos/icon.4bpp graphics/pokemon/zapdos/normal.gbapal.lz graphics/pokemon/zapdos/shiny.gbapal.lz graphics/pokemon/zigzagoon/back.4bpp.lz graphics/pokemon/zigzagoon/footprint.1bpp graphics/pokemon/zigzagoon/front.4bpp.lz graphics/pokemon/zigzagoon/icon.4bpp graphics/pokemon/zigzagoon/normal.gbapal.lz graphics/pokemon/zigzagoon/shiny.gbapal.lz graphics/pokemon/zubat/back.4bpp.lz graphics/pokemon/zubat/footprint.1bpp graphics/pokemon/zubat/front.4bpp.lz graphics/pokemon/zubat/icon.4bpp graphics/pokemon/zubat/normal.gbapal.lz graphics/pokemon/zubat/shiny.gbapal.lz graphics/pokemon_jump/bg.4bpp.lz graphics/pokemon_jump/bg.bin.lz graphics/pokemon_jump/bg.gbapal graphics/pokemon_jump/bonuses.4bpp.lz graphics/pokemon_jump/bonuses.bin.lz graphics/pokemon_jump/bonuses.gbapal graphics/pokemon_jump/interface.gbapal graphics/pokemon_jump/pal1.gbapal graphics/pokemon_jump/pal2.gbapal graphics/pokemon_jump/star.4bpp.lz graphics/pokemon_jump/venusaur.4bpp.lz graphics/pokemon_jump/venusaur.bin.lz graphics/pokemon_jump/venusaur.gbapal graphics/pokemon_jump/vine1.4bpp.lz graphics/pokemon_jump/vine2.4bpp.lz graphics/pokemon_jump/vine3.4bpp.lz graphics/pokemon_jump/vine4.4bpp.lz graphics/pokemon_special_anim/bg.4bpp.lz graphics/pokemon_special_anim/bg.bin.lz graphics/pokemon_special_anim/bg.gbapal graphics/pokemon_special_anim/bg_tm_hm.gbapal graphics/pokemon_special_anim/level_up.4bpp.lz graphics/pokemon_special_anim/level_up.gbapal graphics/pokemon_special_anim/outward_spiral_dots.4bpp.lz graphics/pokemon_special_anim/outward_spiral_dots.gbapal graphics/pokemon_special_anim/star.4bpp.lz graphics/pokemon_special_anim/star.gbapal graphics/pokemon_storage/box_scroll_arrow.4bpp graphics/pokemon_storage/choose_box_menu_center.4bpp graphics/pokemon_storage/choose_box_menu_corners.4bpp graphics/pokemon_storage/cursor.4bpp graphics/pokemon_storage/cursor_shadow.4bpp graphics/pokemon_storage/interface.gbapal graphics/pokemon_storage/interface_no_display_mon.gbapal graphics/pokemon_storage/item_info_frame.4bpp graphics/pokemon_storage/item_info_frame.gbapal graphics/pokemon_storage/menu.4bpp.lz graphics/pokemon_storage/menu.bin.lz graphics/pokemon_storage/menu.gbapal graphics/pokemon_storage/misc1.gbapal graphics/pokemon_storage/misc2.gbapal graphics/pokemon_storage/party_menu.bin.lz graphics/pokemon_storage/party_menu.gbapal graphics/pokemon_storage/scrolling_bg.4bpp.lz graphics/pokemon_storage/scrolling_bg.bin.lz graphics/pokemon_storage/scrolling_bg.gbapal graphics/pokemon_storage/scrolling_bg_move_items.gbapal graphics/pokemon_storage/unused.gbapal graphics/pokemon_storage/unused_choose_box_menu.gbapal graphics/pokemon_storage/wallpapers/beach/tilemap.bin.lz graphics/pokemon_storage/wallpapers/beach/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/beach/tiles.gbapal graphics/pokemon_storage/wallpapers/cave/tilemap.bin.lz graphics/pokemon_storage/wallpapers/cave/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/cave/tiles.gbapal graphics/pokemon_storage/wallpapers/city/tilemap.bin.lz graphics/pokemon_storage/wallpapers/city/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/city/tiles.gbapal graphics/pokemon_storage/wallpapers/crag/tilemap.bin.lz graphics/pokemon_storage/wallpapers/crag/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/crag/tiles.gbapal graphics/pokemon_storage/wallpapers/desert/tilemap.bin.lz graphics/pokemon_storage/wallpapers/desert/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/desert/tiles.gbapal graphics/pokemon_storage/wallpapers/forest/tilemap.bin.lz graphics/pokemon_storage/wallpapers/forest/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/forest/tiles.gbapal graphics/pokemon_storage/wallpapers/pokecenter/tilemap.bin.lz graphics/pokemon_storage/wallpapers/pokecenter/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/pokecenter/tiles.gbapal graphics/pokemon_storage/wallpapers/river/tilemap.bin.lz graphics/pokemon_storage/wallpapers/river/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/river/tiles.gbapal graphics/pokemon_storage/wallpapers/savanna/tilemap.bin.lz graphics/pokemon_storage/wallpapers/savanna/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/savanna/tiles.gbapal graphics/pokemon_storage/wallpapers/seafloor/tilemap.bin.lz graphics/pokemon_storage/wallpapers/seafloor/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/seafloor/tiles.gbapal graphics/pokemon_storage/wallpapers/simple/tilemap.bin.lz graphics/pokemon_storage/wallpapers/simple/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/simple/tiles.gbapal graphics/pokemon_storage/wallpapers/sky/tilemap.bin.lz graphics/pokemon_storage/wallpapers/sky/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/sky/tiles.gbapal graphics/pokemon_storage/wallpapers/snow/tilemap.bin.lz graphics/pokemon_storage/wallpapers/snow/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/snow/tiles.gbapal graphics/pokemon_storage/wallpapers/stars/tilemap.bin.lz graphics/pokemon_storage/wallpapers/stars/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/stars/tiles.gbapal graphics/pokemon_storage/wallpapers/tiles/tilemap.bin.lz graphics/pokemon_storage/wallpapers/tiles/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/tiles/tiles.gbapal graphics/pokemon_storage/wallpapers/volcano/tilemap.bin.lz graphics/pokemon_storage/wallpapers/volcano/tiles.4bpp.lz graphics/pokemon_storage/wallpapers/volcano/tiles.gbapal graphics/pokemon_storage/waveform.4bpp graphics/quest_log/description_window.4bpp graphics/region_map/background.4bpp.lz graphics/region_map/background.bin.lz graphics/region_map/cursor.4bpp.lz graphics/region_map/cursor.gbapal graphics/region_map/dungeon_icon.4bpp.lz graphics/region_map/fly_icon.4bpp.lz graphics/region_map/kanto.bin.lz graphics/region_map/map_edge.4bpp.lz graphics/region_map/map_edge.bin.lz graphics/region_map/map_edge.gbapal graphics/region_map/map_edge_bottom_left.4bpp.lz graphics/region_map/map_edge_bottom_right.4bpp.lz graphics/region_map/map_edge_mid_left.4bpp.lz graphics/region_map/map_edge_mid_right.4bpp.lz graphics/region_map/map_edge_top_left.4bpp.lz graphics/region_map/map_edge_top_right.4bpp.lz graphics/region_map/misc_icon.gbapal graphics/region_map/player_icon_leaf.4bpp.lz graphics/region_map/player_icon_leaf.gbapal graphics/region_map/player_icon_red.4bpp.lz graphics/region_map/player_icon_red.gbapal graphics/region_map/region_map.4bpp.lz graphics/region_map/region_map.gbapal graphics/region_map/sevii_123.bin.lz graphics/region_map/sevii_45.bin.lz graphics/region_map/sevii_67.bin.lz graphics/region_map/switch_map_cursor.gbapal graphics/region_map/switch_map_cursor_left.4bpp.lz graphics/region_map/switch_map_cursor_right.4bpp.lz graphics/region_map/switch_map_kanto_sevii_123.bin.lz graphics/region_map/switch_map_kanto_sevii_all.bin.lz graphics/region_map/switch_map_kanto_sevii_all2.bin.lz graphics/region_map/switch_map_menu.4bpp.lz graphics/region_map/top_bar.gbapal graphics/script_menu/aerodactyl_fossil.4bpp graphics/script_menu/aerodactyl_fossil.gbapal graphics/script_menu/kabutops_fossil.4bpp graphics/script_menu/kabutops_fossil.gbapal graphics/seagallop/ferry_and_wake.gbapal graphics/seagallop/ferry_sprite.4bpp graphics/seagallop/wake.4bpp graphics/seagallop/water.4bpp graphics/seagallop/water.gbapal graphics/shop_menu/shop_menu.4bpp.lz graphics/shop_menu/shop_menu.gbapal.lz graphics/shop_menu/shop_tilemap.bin.lz graphics/shop_menu/shop_tm_hm_tilemap.bin.lz graphics/slot_machine/digits.4bpp.lz graphics/slot_machine/digits.gbapal graphics/slot_machine/firered/bg.4bpp.lz graphics/slot_machine/firered/bg.bin.lz graphics/slot_machine/firered/bg.gbapal graphics/slot_machine/firered/button_pressed.4bpp.lz graphics/slot_machine/firered/clefairy.4bpp.lz graphics/slot_machine/firered/clefairy.gbapal graphics/slot_machine/firered/combos_window.4bpp.lz graphics/slot_machine/firered/combos_window.bin.lz graphics/slot_machine/firered/combos_window.gbapal graphics/slot_machine/firered/match_lines.gbapal graphics/slot_machine/firered/payout_lights.gbapal graphics/slot_machine/firered/reel_icons.4bpp.lz graphics/slot_machine/firered/reel_icons.gbapal graphics/slot_machine/leafgreen/bg.4bpp.lz graphics/slot_machine/leafgreen/bg.bin.lz graphics/slot_machine/leafgreen/bg.gbapal graphics/slot_machine/leafgreen/button_pressed.4bpp.lz graphics/slot_machine/leafgreen/clefairy.4bpp.lz graphics/slot_machine/leafgreen/clefairy.gbapal graphics/slot_machine/leafgreen/combos_window.4bpp.lz graphics/slot_machine/leafgreen/combos_window.bin.lz graphics/slot_machine/leafgreen/combos_window.gbapal graphics/slot_machine/leafgreen/match_lines.gbapal graphics/slot_machine/leafgreen/payout_lights.gbapal graphics/slot_machine/leafgreen/reel_icons.4bpp.lz graphics/slot_machine/leafgreen/reel_icons.gbapal graphics/ss_anne/smoke.4bpp graphics/ss_anne/wake.4bpp graphics/summary_screen/bg.4bpp.lz graphics/summary_screen/bg.gbapal graphics/summary_screen/exp_bar.4bpp.lz graphics/summary_screen/exp_bar.gbapal graphics/summary_screen/hp_bar.4bpp.lz graphics/summary_screen/hp_bar_red.gbapal graphics/summary_screen/hp_bar_yellow.gbapal graphics/summary_screen/marking.gbapal graphics/summary_screen/move_selection_cursor.gbapal graphics/summary_screen/move_selection_cursor_left.4bpp.lz graphics/summary_screen/move_selection_cursor_right.4bpp.lz graphics/summary_screen/moves_info_page.bin.lz graphics/summary_screen/moves_page.bin.lz graphics/summary_screen/page_egg.bin.lz graphics/summary_screen/page_info.bin.lz graphics/summary_screen/page_moves.bin.lz graphics/summary_screen/page_moves_info.bin.lz graphics/summary_screen/page_skills.bin.lz graphics/summary_screen/pokerus_cured.4bpp.lz graphics/summary_screen/pokerus_cured.gbapal graphics/summary_screen/shiny_star.4bpp.lz graphics/summary_screen/shiny_star.gbapal graphics/summary_screen/status_ailment_icons.4bpp.lz graphics/summary_screen/status_ailment_icons.gbapal graphics/summary_screen/text_header.gbapal graphics/summary_screen/text_moves.gbapal graphics/teachy_tv/border.4bpp.lz graphics/teachy_tv/screen.bin.lz graphics/teachy_tv/tiles.4bpp.lz graphics/teachy_tv/tiles.gbapal.lz graphics/teachy_tv/title.bin.lz graphics/text_window/menu_message.4bpp graphics/text_window/quest_log.4bpp graphics/text_window/signpost.4bpp graphics/text_window/std.4bpp graphics/text_window/stdpal_0.gbapal graphics/text_window/stdpal_1.gbapal graphics/text_window/stdpal_2.gbapal graphics/text_window/stdpal_3.gbapal graphics/text_window/stdpal_4.gbapal graphics/text_window/type1.4bpp graphics/text_window/type1.gbapal graphics/text_window/type10.4bpp graphics/text_window/type10.gbapal graphics/text_window/type2.4bpp graphics/text_window/type2.gbapal graphics/text_window/type3.4bpp graphics/text_window/type3.gbapal graphics/text_window/type4.4bpp graphics/text_window/type4.gbapal graphics/text_window/type5.4bpp graphics/text_window/type5.gbapal graphics/text_window/type6.4bpp graphics/text_window/type6.gbapal graphics/text_window/type7.4bpp graphics/text_window/type7.gbapal graphics/text_window/type8.4bpp graphics/text_window/type8.gbapal graphics/text_window/type9.4bpp graphics/text_window/type9.gbapal graphics/text_window/unused.4bpp graphics/title_screen/blank_sprite.4bpp.lz graphics/title_screen/border_bg.4bpp.lz graphics/title_screen/copyright_press_start.4bpp.lz graphics/title_screen/copyright_press_start.bin.lz graphics/title_screen/firered/background.gbapal graphics/title_screen/firered/blank_flames.4bpp.lz graphics/title_screen/firered/border_bg.bin.lz graphics/title_screen/firered/box_art_mon.4bpp.lz graphics/title_screen/firered/box_art_mon.bin.lz graphics/title_screen/firered/box_art_mon.gbapal graphics/title_screen/firered/flames.4bpp.lz graphics/title_screen/firered/flames.gbapal graphics/title_screen/firered/game_title_logo.8bpp.lz graphics/title_screen/firered/game_title_logo.bin.lz graphics/title_screen/firered/game_title_logo.gbapal graphics/title_screen/firered/slash.gbapal graphics/title_screen/leafgreen/background.gbapal graphics/title_screen/leafgreen/border_bg.bin.lz graphics/title_screen/leafgreen/box_art_mon.4bpp.lz graphics/title_screen/leafgreen/box_art_mon.bin.lz graphics/title_screen/leafgreen/box_art_mon.gbapal graphics/title_screen/leafgreen/game_title_logo.8bpp.lz graphics/title_screen/leafgreen/game_title_logo.bin.lz graphics/title_screen/leafgreen/game_title_logo.gbapal graphics/title_screen/leafgreen/leaves.4bpp.lz graphics/title_screen/leafgreen/leaves.gbapal graphics/title_screen/leafgreen/slash.gbapal graphics/title_screen/leafgreen/streak.4bpp.lz graphics/title_screen/slash.4bpp.lz graphics/title_screen/unused1.bin.lz graphics/title_screen/unused2.bin.lz graphics/title_screen/unused3.bin.lz graphics/title_screen/unused4.bin.lz graphics/title_screen/unused5.bin.lz graphics/title_screen/unused6.bin.lz graphics/tm_case/disc.4bpp.lz graphics/tm_case/disc_types_1.gbapal.lz graphics/tm_case/disc_types_2.gbapal.lz graphics/tm_case/hm.4bpp graphics/tm_case/menu.bin.lz graphics/tm_case/menu_female.gbapal.lz graphics/tm_case/menu_male.gbapal.lz graphics/tm_case/tm_case.4bpp.lz graphics/tm_case/tm_case.bin.lz graphics/trade/black.gbapal graphics/trade/cable_end.4bpp graphics/trade/cursor.4bpp graphics/trade/cursor.gbapal graphics/trade/gba.4bpp graphics/trade/gba.gbapal graphics/trade/gba_affine.8bpp graphics/trade/gba_pal2.gbapal graphics/trade/gba_screen.4bpp graphics/trade/link_mon.gbapal graphics/trade/link_mon_glow.4bpp graphics/trade/link_mon_shadow.4bpp graphics/trade/menu.4bpp graphics/trade/menu.gbapal graphics/trade/pokeball.4bpp graphics/trade/pokeball.gbapal graphics/trade/pokeball_symbol.8bpp graphics/trade/shadow.gbapal graphics/trade/text.gbapal graphics/trade/unused1.gbapal graphics/trade/wireless_signal.4bpp.lz graphics/trade/wireless_signal.bin.lz graphics/trade/wireless_signal_closeup.bin.lz graphics/trade/wireless_signal_receive.gbapal graphics/trade/wireless_signal_send.gbapal graphics/trainer_card/back.bin.lz graphics/trainer_card/badges.4bpp.lz graphics/trainer_card/badges.gbapal graphics/trainer_card/bg.bin.lz graphics/trainer_card/blue.gbapal graphics/trainer_card/bronze.gbapal graphics/trainer_card/female_bg.gbapal graphics/trainer_card/front.bin.lz graphics/trainer_card/front_link.bin.lz graphics/trainer_card/gold.gbapal graphics/trainer_card/green.gbapal graphics/trainer_card/rse/back.bin.lz graphics/trainer_card/rse/badges.4bpp.lz graphics/trainer_card/rse/badges.gbapal graphics/trainer_card/rse/bg.bin.lz graphics/trainer_card/rse/bronze.gbapal graphics/trainer_card/rse/copper.gbapal graphics/trainer_card/rse/female_bg.gbapal graphics/trainer_card/rse/front.bin.lz graphics/trainer_card/rse/front_link.bin.lz graphics/trainer_card/rse/gold.gbapal graphics/trainer_card/rse/green.gbapal graphics/trainer_card/rse/silver.gbapal graphics/trainer_card/rse/tiles.4bpp.lz graphics/trainer_card/silver.gbapal graphics/trainer_card/star.gbapal graphics/trainer_card/stickers.4bpp.lz graphics/trainer_card/stickers1.gbapal graphics/trainer_card/stickers2.gbapal graphics/trainer_card/stickers3.gbapal graphics/trainer_card/stickers4.gbapal graphics/trainer_card/tiles.4bpp.lz graphics/trainer_card/unused.gbapal graphics/trainers/back_pics/leaf_back_pic.4bpp graphics/trainers/back_pics/old_man_back_pic.4bpp graphics/trainers/back_pics/pokedude_back_pic.4bpp graphics/trainers/back_pics/red_back_pic.4bpp graphics/trainers/back_pics/ruby_sapphire_brendan_back_pic.4bpp graphics/trainers/back_pics/ruby_sapphire_may_back_pic.4bpp graphics/trainers/front_pics/aqua_admin_f_front_pic.4bpp.lz graphics/trainers/front_pics/aqua_admin_m_front_pic.4bpp.lz graphics/trainers/front_pics/aqua_grunt_f_front_pic.4bpp.lz graphics/trainers/front_pics/aqua_grunt_m_front_pic.4bpp.lz graphics/trainers/front_pics/aqua_leader_archie_front_pic.4bpp.lz graphics/trainers/front_pics/aroma_lady_front_pic.4bpp.lz graphics/trainers/front_pics/battle_girl_front_pic.4bpp.lz graphics/trainers/front_pics/beauty_front_pic.4bpp.lz graphics/trainers/front_pics/biker_front_pic.4bpp.lz graphics/trainers/front_pics/bird_keeper_front_pic.4bpp.lz graphics/trainers/front_pics/black_belt_front_pic.4bpp.lz graphics/trainers/front_pics/bug_catcher_front_pic.4bpp.lz graphics/trainers/front_pics/bug_maniac_front_pic.4bpp.lz graphics/trainers/front_pics/burglar_front_pic.4bpp.lz graphics/trainers/front_pics/camper_front_pic.4bpp.lz graphics/trainers/front_pics/champion_rival_front_pic.4bpp.lz graphics/trainers/front_pics/champion_steven_front_pic.4bpp.lz graphics/trainers/front_pics/channeler_front_pic.4bpp.lz graphics/trainers/front_pics/collector_front_pic.4bpp.lz graphics/trainers/front_pics/cool_couple_front_pic.4bpp.lz graphics/trainers/front_pics/cool_trainer_f_front_pic.4bpp.lz graphics/trainers/front_pics/cool_trainer_m_front_pic.4bpp.lz graphics/trainers/front_pics/crush_girl_front_pic.4bpp.lz graphics/trainers/front_pics/crush_kin_front_pic.4bpp.lz graphics/trainers/front_pics/cue_ball_front_pic.4bpp.lz graphics/trainers/front_pics/cycling_triathlete_f_front_pic.4bpp.lz graphics/trainers/front_pics/cycling_triathlete_m_front_pic.4bpp.lz graphics/trainers/front_pics/dragon_tamer_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_agatha_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_bruno_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_drake_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_glacia_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_lance_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_lorelei_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_phoebe_front_pic.4bpp.lz graphics/trainers/front_pics/elite_four_sidney_front_pic.4bpp.lz graphics/trainers/front_pics/engineer_front_pic.4bpp.lz graphics/trainers/front_pics/expert_f_front_pic.4bpp.lz graphics/trainers/front_pics/expert_m_front_pic.4bpp.lz graphics/trainers/front_pics/fisherman_front_pic.4bpp.lz graphics/trainers/front_pics/gamer_front_pic.4bpp.lz graphics/trainers/front_pics/gentleman_front_pic.4bpp.lz graphics/trainers/front_pics/guitarist_front_pic.4bpp.lz graphics/trainers/front_pics/hex_maniac_front_pic.4bpp.lz graphics/trainers/front_pics/hiker_front_pic.4bpp.lz graphics/trainers/front_pics/interviewer_front_pic.4bpp.lz graphics/trainers/front_pics/juggler_front_pic.4bpp.lz graphics/trainers/front_pics/kindler_front_pic.4bpp.lz graphics/trainers/front_pics/lady_front_pic.4bpp.lz graphics/trainers/front_pics/lass_front_pic.4bpp.lz graphics/trainers/front_pics/leader_blaine_front_pic.4bpp.lz graphics/trainers/front_pics/leader_brawly_front_pic.4bpp.lz graphics/trainers/front_pics/leader_brock_front_pic.4bpp.lz graphics/trainers/front_pics/leader_erika_front_pic.4bpp.lz graphics/trainers/front_pics/leader_flannery_front_pic.4bpp.lz graphics/trainers/front_pics/leader_giovanni_front_pic.4bpp.lz graphics/trainers/front_pics/leader_koga_front_pic.4bpp.lz graphics/trainers/front_pics/leader_lt_surge_front_pic.4bpp.lz graphics/trainers/front_pics/leader_misty_front_pic.4bpp.lz graphics/trainers/front_pics/leader_norman_front_pic.4bpp.lz graphics/trainers/front_pics/leader_roxanne_front_pic.4bpp.lz graphics/trainers/front_pics/leader_sabrina_front_pic.4bpp.lz graphics/trainers/front_pics/leader_tate_and_liza_front_pic.4bpp.lz graphics/trainers/front_pics/leader_wallace_front_pic.4bpp.lz graphics/trainers/front_pics/leader_wattson_front_pic.4bpp.lz graphics/trainers/front_pics/leader_winona_front_pic.4bpp.lz graphics/trainers/front_pics/leaf_front_pic.4bpp.lz graphics/trainers/front_pics/magma_admin_f_front_pic.4bpp.lz graphics/trainers/front_pics/magma_admin_m_front_pic.4bpp.lz graphics/trainers/front_pics/magma_grunt_f_front_pic.4bpp.lz graphics/trainers/front_pics/magma_grunt_m_front_pic.4bpp.lz graphics/trainers/front_pics/magma_leader_maxie_front_pic.4bpp.lz graphics/trainers/front_pics/ninja_boy_front_pic.4bpp.lz graphics/trainers/front_pics/old_couple_front_pic.4bpp.lz graphics/trainers/front_pics/painter_front_pic.4bpp.lz graphics/trainers/front_pics/parasol_lady_front_pic.4bpp.lz graphics/trainers/front_pics/picnicker_front_pic.4bpp.lz graphics/trainers/front_pics/pokefan_f_front_pic.4bpp.lz graphics/trainers/front_pics/pokefan_m_front_pic.4bpp.lz graphics/trainers/front_pics/pokemaniac_front_pic.4bpp.lz graphics/trainers/front_pics/pokemon_breeder_front_pic.4bpp.lz graphics/trainers/front_pics/pokemon_ranger_f_front_pic.4bpp.lz graphics/trainers/front_pics/pokemon_ranger_m_front_pic.4bpp.lz graphics/trainers/front_pics/professor_oak_front_pic.4bpp.lz graphics/trainers/front_pics/psychic_f_front_pic.4bpp.lz graphics/trainers/front_pics/psychic_m_front_pic.4bpp.lz graphics/trainers/front_pics/red_front_pic.4bpp.lz graphics/trainers/front_pics/rich_boy_front_pic.4bpp.lz graphics/trainers/front_pics/rival_early_front_pic.4bpp.lz graphics/trainers/front_pics/rival_late_front_pic.4bpp.lz graphics/trainers/front_pics/rocker_front_pic.4bpp.lz graphics/trainers/front_pics/rocket_grunt_f_front_pic.4bpp.lz graphics/trainers/front_pics/rocket_grunt_m_front_pic.4bpp.lz graphics/trainers/front_pics/rs_aroma_lady_front_pic.4bpp.lz graphics/trainers/front_pics/rs_beauty_front_pic.4bpp.lz graphics/trainers/front_pics/rs_bird_keeper_front_pic.4bpp.lz graphics/trainers/front_pics/rs_black_belt_front_pic.4bpp.lz graphics/trainers/front_pics/rs_bug_catcher_front_pic.4bpp.lz graphics/trainers/front_pics/rs_camper_front_pic.4bpp.lz graphics/trainers/front_pics/rs_cool_trainer_f_front_pic.4bpp.lz graphics/trainers/front_pics/rs_cool_trainer_m_front_pic.4bpp.lz graphics/trainers/front_pics/rs_fisherman_front_pic.4bpp.lz graphics/trainers/front_pics/rs_gentleman_front_pic.4bpp.lz graphics/trainers/front_pics/rs_hiker_front_pic.4bpp.lz graphics/trainers/front_pics/rs_lady_front_pic.4bpp.lz graphics/trainers/front_pics/rs_lass_front_pic.4bpp.lz graphics/trainers/front_pics/rs_picnicker_front_pic.4bpp.lz graphics/trainers/front_pics/rs_pokemaniac_front_pic.4bpp.lz graphics/trainers/front_pics/rs_pokemon_breeder_f_front_pic.4bpp.lz graphics/trainers/front_pics/rs_pokemon_breeder_m_front_pic.4bpp.lz graphics/trainers/front_pics/rs_pokemon_ranger_f_front_pic.4bpp.lz graphics/trainers/front_pics/rs_pokemon_ranger_m_front_pic.4bpp.lz graphics/trainers/front_pics/rs_psychic_f_front_pic.4bpp.lz graphics/trainers/front_pics/rs_psychic_m_front_pic.4bpp.lz graphics/trainers/front_pics/rs_ruin_maniac_front_pic.4bpp.lz graphics/trainers/front_pics/rs_sailor_front_pic.4bpp.lz graphics/trainers/front_pics/rs_sis_and_bro_front_pic.4bpp.lz graphics/trainers/front_pics/rs_swimmer_f_front_pic.4bpp.lz graphics/trainers/front_pics/rs_swimmer_m_front_pic.4bpp.lz graphics/trainers/front_pics/rs_tuber_f_front_pic.4bpp.lz graphics/trainers/front_pics/rs_twins_front_pic.4bpp.lz graphics/trainers/front_pics/rs_young_couple_front_pic.4bpp.lz graphics/trainers/front_pics/rs_youngster_front_pic.4bpp.lz graphics/trainers/front_pics/ruby_sapphire_brendan_front_pic.4bpp.lz graphics/trainers/front_pics/ruby_sapphire_may_front_pic.4bpp.lz graphics/trainers/front_pics/ruin_maniac_front_pic.4bpp.lz graphics/trainers/front_pics/running_triathlete_f_front_pic.4bpp.lz graphics/trainers/front_pics/running_triathlete_m_front_pic.4bpp.lz graphics/trainers/front_pics/sailor_front_pic.4bpp.lz graphics/trainers/front_pics/school_kid_f_front_pic.4bpp.lz graphics/trainers/front_pics/school_kid_m_front_pic.4bpp.lz graphics/trainers/front_pics/scientist_front_pic.4bpp.lz graphics/trainers/front_pics/sis_and_bro_front_pic.4bpp.lz graphics/trainers/front_pics/sr_and_jr_front_pic.4bpp.lz graphics/trainers/front_pics/super_nerd_front_pic.4bpp.lz graphics/trainers/front_pics/swimmer_f_front_pic.4bpp.lz graphics/trainers/front_pics/swimmer_m_front_pic.4bpp.lz graphics/trainers/front_pics/swimming_triathlete_f_front_pic.4bpp.lz graphics/trainers/front_pics/swimming_triathlete_m_front_pic.4bpp.lz graphics/trainers/front_pics/tamer_front_pic.4bpp.lz graphics/trainers/front_pics/tuber_f_front_pic.4bpp.lz graphics/trainers/front_pics/tuber_m_front_pic.4bpp.lz graphics/trainers/front_pics/twins_front_pic.4bpp.lz graphics/trainers/front_pics/wally_front_pic.4bpp.lz graphics/trainers/front_pics/young_couple_front_pic.4bpp.lz graphics/trainers/front_pics/youngster_front_pic.4bpp.lz graphics/trainers/palettes/aqua_admin_f.gbapal.lz graphics/trainers/palettes/aqua_admin_m.gbapal.lz graphics/trainers/palettes/aqua_grunt_f.gbapal.lz graphics/trainers/palettes/aqua_grunt_m.gbapal.lz graphics/trainers/palettes/aqua_leader_archie.gbapal.lz graphics/trainers/palettes/aroma_lady.gbapal.lz graphics/trainers/palettes/battle_girl.gbapal.lz graphics/trainers/palettes/beauty.gbapal.lz graphics/trainers/palettes/biker.gbapal.lz graphics/trainers/palettes/bird_keeper.gbapal.lz graphics/trainers/palettes/black_belt.gbapal.lz graphics/trainers/palettes/bug_catcher.gbapal.lz graphics/trainers/palettes/bug_maniac.gbapal.lz graphics/trainers/palettes/burglar.gbapal.lz graphics/trainers/palettes/camper.gbapal.lz graphics/trainers/palettes/champion_rival.gbapal.lz graphics/trainers/palettes/champion_steven.gbapal.lz graphics/trainers/palettes/channeler.gbapal.lz graphics/trainers/palettes/collector.gbapal.lz graphics/trainers/palettes/cool_couple.gbapal.lz graphics/trainers/palettes/cool_trainer_f.gbapal.lz graphics/trainers/palettes/cool_trainer_m.gbapal.lz graphics/trainers/palettes/crush_girl.gbapal.lz graphics/trainers/palettes/crush_kin.gbapal.lz graphics/trainers/palettes/cue_ball.gbapal.lz graphics/trainers/palettes/cycling_triathlete_f.gbapal.lz graphics/trainers/palettes/cycling_triathlete_m.gbapal.lz graphics/trainers/palettes/dragon_tamer.gbapal.lz graphics/trainers/palettes/elite_four_agatha.gbapal.lz graphics/trainers/palettes/elite_four_bruno.gbapal.lz graphics/trainers/palettes/elite_four_drake.gbapal.lz graphics/trainers/palettes/elite_four_glacia.gbapal.lz graphics/trainers/palettes/elite_four_lance.gbapal.lz graphics/trainers/palettes/elite_four_lorelei.gbapal.lz graphics/trainers/palettes/elite_four_phoebe.gbapal.lz graphics/trainers/palettes/elite_four_sidney.gbapal.lz graphics/trainers/palettes/engineer.gbapal.lz graphics/trainers/palettes/expert_f.gbapal.lz graphics/trainers/palettes/expert_m.gbapal.lz graphics/trainers/palettes/fisherman.gbapal.lz graphics/trainers/palettes/gamer.gbapal.lz graphics/trainers/palettes/gentleman.gbapal.lz graphics/trainers/palettes/guitarist.gbapal.lz graphics/trainers/palettes/hex_maniac.gbapal.lz graphics/trainers/palettes/hiker.gbapal.lz graphics/trainers/palettes/interviewer.gbapal.lz graphics/trainers/palettes/juggler.gbapal.lz graphics/trainers/palettes/kindler.gbapal.lz graphics/trainers/palettes/lady.gbapal.lz graphics/trainers/palettes/lass.gbapal.lz graphics/trainers/palettes/leader_blaine.gbapal.lz graphics/trainers/palettes/leader_brawly.gbapal.lz graphics/trainers/palettes/leader_brock.gbapal.lz graphics/trainers/palettes/leader_erika.gbapal.lz graphics/trainers/palettes/leader_flannery.gbapal.lz graphics/trainers/palettes/leader_giovanni.gbapal.lz graphics/trainers/palettes/leader_koga.gbapal.lz graphics/trainers/palettes/leader_lt_surge.gbapal.lz graphics/trainers/palettes/leader_misty.gbapal.lz graphics/trainers/palettes/leader_norman.gbapal.lz graphics/trainers/palettes/leader_roxanne.gbapal.lz graphics/trainers/palettes/leader_sabrina.gbapal.lz graphics/trainers/palettes/leader_tate_and_liza.gbapal.lz graphics/trainers/palettes/leader_wallace.gbapal.lz graphics/trainers/palettes/leader_wattson.gbapal.lz graphics/trainers/palettes/leader_winona.gbapal.lz graphics/trainers/palettes/leaf.gbapal.lz graphics/trainers/palettes/leaf_back_pic.gbapal.lz graphics/trainers/palettes/magma_admin_f.gbapal.lz graphics/trainers/palettes/magma_admin_m.gbapal.lz graphics/trainers/palettes/magma_grunt_f.gbapal.lz graphics/trainers/palettes/magma_grunt_m.gbapal.lz graphics/trainers/palettes/magma_leader_maxie.gbapal.lz graphics/trainers/palettes/ninja_boy.gbapal.lz graphics/trainers/palettes/old_couple.gbapal.lz graphics/trainers/palettes/old_man_back_pic.gbapal.lz graphics/trainers/palettes/painter.gbapal.lz graphics/trainers/palettes/parasol_lady.gbapal.lz graphics/trainers/palettes/picnicker.gbapal.lz graphics/trainers/palettes/pokedude_back_pic.gbapal.lz graphics/trainers/palettes/pokefan_f.gbapal.lz graphics/trainers/palettes/pokefan_m.gbapal.lz graphics/trainers/palettes/pokemaniac.gbapal.lz graphics/trainers/palettes/pokemon_breeder.gbapal.lz graphics/trainers/palettes/pokemon_ranger_f.gbapal.lz graphics/trainers/palettes/pokemon_ranger_m.gbapal.lz graphics/trainers/palettes/professor_oak.gbapal.lz graphics/trainers/palettes/psychic_f.gbapal.lz graphics/trainers/palettes/psychic_m.gbapal.lz graphics/trainers/palettes/red.gbapal.lz graphics/trainers/palettes/red_back_pic.gbapal.lz graphics/trainers/palettes/rich_boy.gbapal.lz graphics/trainers/palettes/rival_early.gbapal.lz graphics/trainers/palettes/rival_late.gbapal.lz graphics/trainers/palettes/rocker.gbapal.lz graphics/trainers/palettes/rocket_grunt_f.gbapal.lz graphics/trainers/palettes/rocket_grunt_m.gbapal.lz graphics/trainers/palettes/rs_aroma_lady.gbapal.lz graphics/trainers/palettes/rs_beauty.gbapal.lz graphics/trainers/palettes/rs_bird_keeper.gbapal.lz graphics/trainers/palettes/rs_black_belt.gbapal.lz graphics/trainers/palettes/rs_bug_catcher.gbapal.lz graphics/trainers/palettes/rs_camper.gbapal.lz graphics/trainers/palettes/rs_cool_trainer_f.gbapal.lz graphics/trainers/palettes/rs_cool_trainer_m.gbapal.lz graphics/trainers/palettes/rs_fisherman.gbapal.lz graphics/trainers/palettes/rs_gentleman.gbapal.lz graphics/trainers/palettes/rs_hiker.gbapal.lz graphics/trainers/palettes/rs_lady.gbapal.lz graphics/trainers/palettes/rs_lass.gbapal.lz graphics/trainers/palettes/rs_picnicker.gbapal.lz graphics/trainers/palettes/rs_pokemaniac.gbapal.lz graphics/trainers/palettes/rs_pokemon_breeder_f.gbapal.lz graphics/trainers/palettes/rs_pokemon_breeder_m.gbapal.lz graphics/trainers/palettes/rs_pokemon_ranger_f.gbapal.lz graphics/trainers/palettes/rs_pokemon_ranger_m.gbapal.lz graphics/trainers/palettes/rs_psychic_f.gbapal.lz graphics/trainers/palettes/rs_psychic_m.gbapal.lz graphics/trainers/palettes/rs_ruin_maniac.gbapal.lz graphics/trainers/palettes/rs_sailor.gbapal.lz graphics/trainers/palettes/rs_sis_and_bro.gbapal.lz graphics/trainers/palettes/rs_swimmer_f.gbapal.lz graphics/trainers/palettes/rs_swimmer_m.gbapal.lz graphics/trainers/palettes/rs_tuber_f.gbapal.lz graphics/trainers/palettes/rs_twins.gbapal.lz graphics/trainers/palettes/rs_young_couple.gbapal.lz graphics/trainers/palettes/rs_youngster.gbapal.lz graphics/trainers/palettes/ruby_sapphire_brendan.gbapal.lz graphics/trainers/palettes/ruby_sapphire_may.gbapal.lz graphics/trainers/palettes/ruin_maniac.gbapal.lz graphics/trainers/palettes/running_triathlete_f.gbapal.lz graphics/trainers/palettes/running_triathlete_m.gbapal.lz graphics/trainers/palettes/sailor.gbapal.lz graphics/trainers/palettes/school_kid_f.gbapal.lz graphics/trainers/palettes/school_kid_m.gbapal.lz graphics/trainers/palettes/scientist.gbapal.lz graphics/trainers/palettes/sis_and_bro.gbapal.lz graphics/trainers/palettes/sr_and_jr.gbapal.lz graphics/trainers/palettes/super_nerd.gbapal.lz graphics/trainers/palettes/swimmer_f.gbapal.lz graphics/trainers/palettes/swimmer_m.gbapal.lz graphics/trainers/palettes/swimming_triathlete_f.gbapal.lz graphics/trainers/palettes/swimming_triathlete_m.gbapal.lz graphics/trainers/palettes/tamer.gbapal.lz graphics/trainers/palettes/tuber_f.gbapal.lz graphics/trainers/palettes/tuber_m.gbapal.lz graphics/trainers/palettes/twins.gbapal.lz graphics/trainers/palettes/wally.gbapal.lz graphics/trainers/palettes/young_couple.gbapal.lz graphics/trainers/palettes/youngster.gbapal.lz graphics/union_room_chat/bg.4bpp.lz graphics/union_room_chat/bg.bin.lz graphics/union_room_chat/bg.gbapal graphics/union_room_chat/character_select_cursor.4bpp.lz graphics/union_room_chat/icons.4bpp.lz graphics/union_room_chat/messages.gbapal graphics/union_room_chat/objects.gbapal graphics/union_room_chat/panel.4bpp.lz graphics/union_room_chat/panel.bin.lz graphics/union_room_chat/panel.gbapal graphics/union_room_chat/r_button.4bpp.lz graphics/union_room_chat/selector_cursor.4bpp.lz graphics/union_room_chat/text_entry.gbapal graphics/union_room_chat/text_entry_cursor.4bpp.lz graphics/union_room_chat/unused.gbapal graphics/unused/basic_frame.4bpp.lz graphics/unused/basic_frame.bin.lz graphics/unused/basic_frame.gbapal.lz graphics/unused/battle_anim_023.gbapal.lz graphics/unused/blue_frame.bin.lz graphics/unused/color_frames.4bpp.lz graphics/unused/color_frames.gbapal.lz graphics/unused/goosuto.4bpp.lz graphics/unused/goosuto.bin.lz graphics/unused/goosuto.gbapal.lz graphics/unused/gray_palette.gbapal.lz graphics/unused/line_sketch.4bpp.lz graphics/unused/line_sketch.gbapal.lz graphics/unused/metronome_hand_small.4bpp.lz graphics/unused/music_notes.4bpp.lz graphics/unused/obi1.4bpp.lz graphics/unused/obi2.4bpp.lz graphics/unused/obi_palpak1.gbapal.lz graphics/unused/obi_palpak3.gbapal.lz graphics/unused/old_battle_interface_tilemap.bin.lz graphics/unused/old_beatup.4bpp.lz graphics/unused/old_beatup.gbapal.lz graphics/unused/old_charmap.4bpp.lz graphics/unused/old_charmap.bin.lz graphics/unused/old_charmap.gbapal.lz graphics/unused/old_pal4.gbapal.lz graphics/unused/red_palette.gbapal graphics/unused/redyellowgreen_frame.bin.lz graphics/unused/shadow.4bpp.lz graphics/unused/shadow.gbapal.lz graphics/unused/water_splash.8bpp.lz graphics/unused/water_splash.bin.lz graphics/unused/water_splash.gbapal.lz graphics/weather/ash.4bpp graphics/weather/bubble.4bpp graphics/weather/cloud.4bpp graphics/weather/cloud.gbapal graphics/weather/default.gbapal graphics/weather/fog_diagonal.4bpp graphics/weather/fog_horizontal.4bpp graphics/weather/rain.4bpp graphics/weather/sandstorm.4bpp graphics/weather/sandstorm.gbapal graphics/weather/snow0.4bpp graphics/weather/snow1.4bpp graphics/wireless_status_screen/anim_00.gbapal graphics/wireless_status_screen/anim_01.gbapal graphics/wireless_status_screen/anim_02.gbapal graphics/wireless_status_screen/anim_03.gbapal graphics/wireless_status_screen/anim_04.gbapal graphics/wireless_status_screen/anim_05.gbapal graphics/wireless_status_screen/anim_06.gbapal graphics/wireless_status_screen/anim_07.gbapal graphics/wireless_status_screen/anim_08.gbapal graphics/wireless_status_screen/anim_09.gbapal graphics/wireless_status_screen/anim_10.gbapal graphics/wireless_status_screen/anim_11.gbapal graphics/wireless_status_screen/anim_12.gbapal graphics/wireless_status_screen/anim_13.gbapal graphics/wireless_status_screen/bg.4bpp.lz graphics/wireless_status_screen/default.gbapal graphics/wonder_card/bg0.4bpp.lz graphics/wonder_card/bg0.bin.lz graphics/wonder_card/bg0.gbapal graphics/wonder_card/bg1.4bpp.lz graphics/wonder_card/bg1.bin.lz graphics/wonder_card/bg1.gbapal graphics/wonder_card/bg2.4bpp.lz graphics/wonder_card/bg2.bin.lz graphics/wonder_card/bg2.gbapal graphics/wonder_card/bg3.gbapal graphics/wonder_card/bg4.gbapal graphics/wonder_card/bg5.gbapal graphics/wonder_card/bg6.4bpp.lz graphics/wonder_card/bg6.bin.lz graphics/wonder_card/bg6.gbapal graphics/wonder_card/bg7.4bpp.lz graphics/wonder_card/bg7.bin.lz graphics/wonder_card/bg7.gbapal graphics/wonder_card/stamp_shadow.4bpp.lz graphics/wonder_card/stamp_shadow_0.gbapal graphics/wonder_card/stamp_shadow_1.gbapal graphics/wonder_card/stamp_shadow_2.gbapal graphics/wonder_card/stamp_shadow_3.gbapal graphics/wonder_card/stamp_shadow_4.gbapal graphics/wonder_card/stamp_shadow_5.gbapal graphics/wonder_card/stamp_shadow_6.gbapal graphics/wonder_card/stamp_shadow_7.gbapal graphics/wonder_news/bg0.4bpp.lz graphics/wonder_news/bg0.bin.lz graphics/wonder_news/bg0.gbapal graphics/wonder_news/bg1.4bpp.lz graphics/wonder_news/bg1.bin.lz graphics/wonder_news/bg2.4bpp.lz graphics/wonder_news/bg2.bin.lz graphics/wonder_news/bg6.4bpp.lz graphics/wonder_news/bg6.bin.lz graphics/wonder_news/bg6.gbapal graphics/wonder_news/bg7.4bpp.lz graphics/wonder_news/bg7.bin.lz graphics/wonder_news/bg7.gbapal 
+GFX_OWN_TARGETS := $(CASTFORMGFXDIR)/front.4bpp $(CASTFORMGFXDIR)/back.4bpp $(CASTFORMGFXDIR)/normal.gbapal $(CASTFORMGFXDIR)/shiny.gbapal $(FONTGFXDIR)/latin_small.latfont $(FONTGFXDIR)/japanese_small.fwjpnfont $(FONTGFXDIR)/japanese_tall.fwjpnfont $(FONTGFXDIR)/latin_normal.latfont $(FONTGFXDIR)/japanese_normal.fwjpnfont $(FONTGFXDIR)/latin_male.latfont $(FONTGFXDIR)/japanese_male.fwjpnfont $(FONTGFXDIR)/latin_female.latfont $(FONTGFXDIR)/japanese_female.fwjpnfont $(FONTGFXDIR)/braille.fwjpnfont $(FONTGFXDIR)/japanese_bold.fwjpnfont graphics/pokemon_jump/bg.4bpp $(MISCGFXDIR)/markings2.4bpp $(BTLANMSPRGFXDIR)/ice_cube.4bpp $(UNUSEDGFXDIR)/obi_palpak1.gbapal $(UNUSEDGFXDIR)/obi_palpak3.gbapal $(UNUSEDGFXDIR)/obi1.4bpp $(UNUSEDGFXDIR)/obi2.4bpp $(INTERFACEGFXDIR)/hp_numbers.4bpp $(UNUSEDGFXDIR)/redyellowgreen_frame.bin $(UNUSEDGFXDIR)/color_frames.4bpp $(BATINTGFXDIR)/unused_window2bar.4bpp $(BATINTGFXDIR)/level_up_banner.4bpp $(BATINTGFXDIR)/textbox.gbapal $(JPCONTESTGFXDIR)/composite_1.4bpp $(JPCONTESTGFXDIR)/composite_2.4bpp $(JPCONTESTGFXDIR)/voltage.4bpp $(BTLANMSPRGFXDIR)/ice_crystals.4bpp $(BTLANMSPRGFXDIR)/mud_sand.4bpp $(BTLANMSPRGFXDIR)/flower.4bpp $(BTLANMSPRGFXDIR)/spark.4bpp $(MASKSGFXDIR)/unused_level_up.4bpp $(BATTRANSGFXDIR)/vs_frame.4bpp $(PARTYMENUGFXDIR)/bg.4bpp $(FIELDEFFECTSGFXDIR)/pics/underwater_bubbles.4bpp $(FIELDEFFECTSGFXDIR)/pics/bike_tire_tracks.4bpp $(FIELDEFFECTSGFXDIR)/pics/sand_disguise.4bpp $(FIELDEFFECTSGFXDIR)/pics/mountain_disguise.4bpp $(FIELDEFFECTSGFXDIR)/pics/tree_disguise.4bpp $(INTERFACEGFXDIR)/selector_outline.4bpp graphics/tm_case/tm_case.4bpp $(FAMECHECKERGFXDIR)/spinning_pokeball.4bpp $(FAMECHECKERGFXDIR)/bg.4bpp graphics/seagallop/water.4bpp graphics/link/321start.4bpp $(TEXTWINDOWGFXDIR)/signpost.4bpp $(SLOTMACHINEGFXDIR)/firered/combos_window.4bpp $(SLOTMACHINEGFXDIR)/firered/bg.4bpp $(SLOTMACHINEGFXDIR)/leafgreen/bg.4bpp $(TEACHYTVGFXDIR)/tiles.4bpp $(SSANNEGFXDIR)/smoke.4bpp $(ITEMPCGFXDIR)/bg.4bpp $(TITLESCREENGFXDIR)/firered/box_art_mon.4bpp $(TITLESCREENGFXDIR)/leafgreen/box_art_mon.4bpp $(POKEDEXAREAMARKERSDATADIR)/marker.4bpp graphics/pokemon/heracross/unk_icon.4bpp graphics/misc/emoticons.4bpp $(ITEMMENUGFXDIR)/bg.4bpp $(INTROGFXDIR)/scene_1/grass.4bpp $(INTROGFXDIR)/scene_2/plants.4bpp $(INTROGFXDIR)/scene_2/nidorino_close.4bpp $(INTROGFXDIR)/scene_2/gengar_close.4bpp $(INTROGFXDIR)/scene_3/gengar_anim.4bpp $(BATTLETERRAINGFXDIR)/building/terrain.4bpp $(BATTLETERRAINGFXDIR)/cave/anim.4bpp $(BATTLETERRAINGFXDIR)/cave/terrain.4bpp $(BATTLETERRAINGFXDIR)/grass/terrain.4bpp $(BATTLETERRAINGFXDIR)/indoor/terrain.4bpp $(BATTLETERRAINGFXDIR)/longgrass/anim.4bpp $(BATTLETERRAINGFXDIR)/longgrass/terrain.4bpp $(BATTLETERRAINGFXDIR)/mountain/anim.4bpp $(BATTLETERRAINGFXDIR)/pond/anim.4bpp $(BATTLETERRAINGFXDIR)/pond/terrain.4bpp $(BATTLETERRAINGFXDIR)/sand/terrain.4bpp $(BATTLETERRAINGFXDIR)/underwater/anim.4bpp $(BATTLETERRAINGFXDIR)/underwater/terrain.4bpp $(BATTLETERRAINGFXDIR)/water/terrain.4bpp $(BERRYPOUCHGFXDIR)/background.4bpp $(HALLOFFAMEGFXDIR)/hall_of_fame.4bpp $(TILESETGFXDIR)/primary/general/anim/water_current_landwatersedge/7.4bpp $(MAPPREVIEWGFXDIR)/altering_cave/tiles.4bpp $(MAPPREVIEWGFXDIR)/berry_forest/tiles.4bpp $(MAPPREVIEWGFXDIR)/digletts_cave/tiles.4bpp $(MAPPREVIEWGFXDIR)/dotted_hole/tiles.4bpp $(MAPPREVIEWGFXDIR)/icefall_cave/tiles.4bpp $(MAPPREVIEWGFXDIR)/lost_cave/tiles.4bpp $(MAPPREVIEWGFXDIR)/monean_chamber/tiles.4bpp $(MAPPREVIEWGFXDIR)/mt_ember/tiles.4bpp $(MAPPREVIEWGFXDIR)/mt_moon/tiles.4bpp $(MAPPREVIEWGFXDIR)/pokemon_mansion/tiles.4bpp $(MAPPREVIEWGFXDIR)/pokemon_tower/tiles.4bpp $(MAPPREVIEWGFXDIR)/power_plant/tiles.4bpp $(MAPPREVIEWGFXDIR)/rock_tunnel/tiles.4bpp $(MAPPREVIEWGFXDIR)/rocket_hideout/tiles.4bpp $(MAPPREVIEWGFXDIR)/rocket_warehouse/tiles.4bpp $(MAPPREVIEWGFXDIR)/safari_zone/tiles.4bpp $(MAPPREVIEWGFXDIR)/seafoam_islands/tiles.4bpp $(MAPPREVIEWGFXDIR)/silph_co/tiles.4bpp $(MAPPREVIEWGFXDIR)/victory_road/tiles.4bpp $(MAPPREVIEWGFXDIR)/viridian_forest/tiles.4bpp $(NAMINGGFXDIR)/cursor.4bpp $(NAMINGGFXDIR)/cursor_squished.4bpp $(NAMINGGFXDIR)/cursor_filled.4bpp $(WALLPAPERGFXDIR)/beach/tiles.4bpp $(WALLPAPERGFXDIR)/cave/tiles.4bpp $(WALLPAPERGFXDIR)/city/tiles.4bpp $(WALLPAPERGFXDIR)/crag/tiles.4bpp $(WALLPAPERGFXDIR)/desert/tiles.4bpp $(WALLPAPERGFXDIR)/forest/tiles.4bpp $(WALLPAPERGFXDIR)/pokecenter/tiles.4bpp $(WALLPAPERGFXDIR)/river/tiles.4bpp $(WALLPAPERGFXDIR)/savanna/tiles.4bpp $(WALLPAPERGFXDIR)/seafloor/tiles.4bpp $(WALLPAPERGFXDIR)/simple/tiles.4bpp $(WALLPAPERGFXDIR)/sky/tiles.4bpp $(WALLPAPERGFXDIR)/snow/tiles.4bpp $(WALLPAPERGFXDIR)/stars/tiles.4bpp $(WALLPAPERGFXDIR)/tiles/tiles.4bpp $(WALLPAPERGFXDIR)/volcano/tiles.4bpp $(TILESETGFXDIR)/primary/building/tiles.4bpp $(TILESETGFXDIR)/primary/general/tiles.4bpp $(TILESETGFXDIR)/secondary/pallet_town/tiles.4bpp $(TILESETGFXDIR)/secondary/lavender_town/tiles.4bpp $(TILESETGFXDIR)/secondary/cinnabar_island/tiles.4bpp $(TILESETGFXDIR)/secondary/pokemon_center/tiles.4bpp $(TILESETGFXDIR)/secondary/cable_club/tiles.4bpp $(TILESETGFXDIR)/secondary/fuchsia_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/pewter_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/saffron_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/viridian_forest/tiles.4bpp $(TILESETGFXDIR)/secondary/seafoam_islands/tiles.4bpp $(TILESETGFXDIR)/secondary/generic_building_2/tiles.4bpp $(TILESETGFXDIR)/secondary/underground_path/tiles.4bpp $(TILESETGFXDIR)/secondary/restaurant_hotel/tiles.4bpp $(TILESETGFXDIR)/secondary/burgled_house/tiles.4bpp $(TILESETGFXDIR)/secondary/berry_forest/tiles.4bpp $(TILESETGFXDIR)/secondary/sevii_islands_45/tiles.4bpp $(TILESETGFXDIR)/secondary/pokemon_league/tiles.4bpp $(TILESETGFXDIR)/secondary/viridian_city/tiles.4bpp $(TILESETGFXDIR)/secondary/vermilion_city/tiles.4bpp $(TILESETGFXDIR)/secondary/indigo_plateau/tiles.4bpp $(TILESETGFXDIR)/secondary/cave/tiles.4bpp $(TILESETGFXDIR)/secondary/bike_shop/tiles.4bpp $(TILESETGFXDIR)/secondary/viridian_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/cerulean_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/cinnabar_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/unused_gatehouse_1/tiles.4bpp $(TILESETGFXDIR)/secondary/unused_gatehouse_2/tiles.4bpp $(TILESETGFXDIR)/secondary/power_plant/tiles.4bpp $(TILESETGFXDIR)/secondary/pokemon_tower/tiles.4bpp $(TILESETGFXDIR)/secondary/school/tiles.4bpp $(TILESETGFXDIR)/secondary/dummy_3/tiles.4bpp $(TILESETGFXDIR)/secondary/navel_rock/tiles.4bpp $(TILESETGFXDIR)/secondary/sevii_islands_67/tiles.4bpp $(TILESETGFXDIR)/secondary/hall_of_fame/tiles.4bpp $(TILESETGFXDIR)/secondary/pewter_city/tiles.4bpp $(TILESETGFXDIR)/secondary/celadon_city/tiles.4bpp $(TILESETGFXDIR)/secondary/saffron_city/tiles.4bpp $(TILESETGFXDIR)/secondary/dummy_1/tiles.4bpp $(TILESETGFXDIR)/secondary/generic_building_1/tiles.4bpp $(TILESETGFXDIR)/secondary/hoenn_building/tiles.4bpp $(TILESETGFXDIR)/secondary/vermilion_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/ss_anne/tiles.4bpp $(TILESETGFXDIR)/secondary/rock_tunnel/tiles.4bpp $(TILESETGFXDIR)/secondary/cerulean_cave/tiles.4bpp $(TILESETGFXDIR)/secondary/sea_cottage/tiles.4bpp $(TILESETGFXDIR)/secondary/safari_zone_building/tiles.4bpp $(TILESETGFXDIR)/secondary/fan_club_daycare/tiles.4bpp $(TILESETGFXDIR)/secondary/dummy_4/tiles.4bpp $(TILESETGFXDIR)/secondary/tanoby_ruins/tiles.4bpp $(TILESETGFXDIR)/secondary/trainer_tower/tiles.4bpp $(TILESETGFXDIR)/secondary/cerulean_city/tiles.4bpp $(TILESETGFXDIR)/secondary/fuchsia_city/tiles.4bpp $(TILESETGFXDIR)/secondary/mart/tiles.4bpp $(TILESETGFXDIR)/secondary/museum/tiles.4bpp $(TILESETGFXDIR)/secondary/lab/tiles.4bpp $(TILESETGFXDIR)/secondary/game_corner/tiles.4bpp $(TILESETGFXDIR)/secondary/celadon_gym/tiles.4bpp $(TILESETGFXDIR)/secondary/dummy_2/tiles.4bpp $(TILESETGFXDIR)/secondary/digletts_cave/tiles.4bpp $(TILESETGFXDIR)/secondary/department_store/tiles.4bpp $(TILESETGFXDIR)/secondary/pokemon_mansion/tiles.4bpp $(TILESETGFXDIR)/secondary/condominiums/tiles.4bpp $(TILESETGFXDIR)/secondary/mt_ember/tiles.4bpp $(TILESETGFXDIR)/secondary/sevii_islands_123/tiles.4bpp $(TILESETGFXDIR)/secondary/island_harbor/tiles.4bpp $(OBJEVENTGFXDIR)/misc/cut_tree.4bpp $(OBJEVENTGFXDIR)/misc/rock_smash_rock.4bpp $(OBJEVENTGFXDIR)/misc/surf_blob.4bpp $(OBJEVENTGFXDIR)/misc/ss_anne.4bpp $(OBJEVENTGFXDIR)/misc/town_map.4bpp $(OBJEVENTGFXDIR)/people/agatha.4bpp $(OBJEVENTGFXDIR)/people/balding_man.4bpp $(OBJEVENTGFXDIR)/people/battle_girl.4bpp $(OBJEVENTGFXDIR)/people/beauty.4bpp $(OBJEVENTGFXDIR)/people/biker.4bpp $(OBJEVENTGFXDIR)/people/bill.4bpp $(OBJEVENTGFXDIR)/people/blackbelt.4bpp $(OBJEVENTGFXDIR)/people/blaine.4bpp $(OBJEVENTGFXDIR)/people/blue.4bpp $(OBJEVENTGFXDIR)/people/boy.4bpp $(OBJEVENTGFXDIR)/people/brock.4bpp $(OBJEVENTGFXDIR)/people/bruno.4bpp $(OBJEVENTGFXDIR)/people/bug_catcher.4bpp $(OBJEVENTGFXDIR)/people/cable_club_receptionist.4bpp $(OBJEVENTGFXDIR)/people/cameraman.4bpp $(OBJEVENTGFXDIR)/people/camper.4bpp $(OBJEVENTGFXDIR)/people/captain.4bpp $(OBJEVENTGFXDIR)/people/celio.4bpp $(OBJEVENTGFXDIR)/people/channeler.4bpp $(OBJEVENTGFXDIR)/people/chef.4bpp $(OBJEVENTGFXDIR)/people/clerk.4bpp $(OBJEVENTGFXDIR)/people/cooltrainer_f.4bpp $(OBJEVENTGFXDIR)/people/cooltrainer_m.4bpp $(OBJEVENTGFXDIR)/people/daisy.4bpp $(OBJEVENTGFXDIR)/people/erika.4bpp $(OBJEVENTGFXDIR)/people/fat_man.4bpp $(OBJEVENTGFXDIR)/people/fisher.4bpp $(OBJEVENTGFXDIR)/people/gba_kid.4bpp $(OBJEVENTGFXDIR)/people/gentleman.4bpp $(OBJEVENTGFXDIR)/people/giovanni.4bpp $(OBJEVENTGFXDIR)/people/green_bike.4bpp $(OBJEVENTGFXDIR)/people/green_fish.4bpp $(OBJEVENTGFXDIR)/people/green_item.4bpp $(OBJEVENTGFXDIR)/people/green_normal.4bpp $(OBJEVENTGFXDIR)/people/green_surf_run.4bpp $(OBJEVENTGFXDIR)/people/green_surf.4bpp $(OBJEVENTGFXDIR)/people/green_vs_seeker_bike.4bpp $(OBJEVENTGFXDIR)/people/gym_guy.4bpp $(OBJEVENTGFXDIR)/people/hiker.4bpp $(OBJEVENTGFXDIR)/people/koga.4bpp $(OBJEVENTGFXDIR)/people/lance.4bpp $(OBJEVENTGFXDIR)/people/lass.4bpp $(OBJEVENTGFXDIR)/people/little_boy.4bpp $(OBJEVENTGFXDIR)/people/little_girl.4bpp $(OBJEVENTGFXDIR)/people/lorelei.4bpp $(OBJEVENTGFXDIR)/people/lt_surge.4bpp $(OBJEVENTGFXDIR)/people/man.4bpp $(OBJEVENTGFXDIR)/people/mg_deliveryman.4bpp $(OBJEVENTGFXDIR)/people/misty.4bpp $(OBJEVENTGFXDIR)/people/mom.4bpp $(OBJEVENTGFXDIR)/people/mr_fuji.4bpp $(OBJEVENTGFXDIR)/people/nurse.4bpp $(OBJEVENTGFXDIR)/people/old_man_1.4bpp $(OBJEVENTGFXDIR)/people/old_man_2.4bpp $(OBJEVENTGFXDIR)/people/old_woman.4bpp $(OBJEVENTGFXDIR)/people/picnicker.4bpp $(OBJEVENTGFXDIR)/people/policeman.4bpp $(OBJEVENTGFXDIR)/people/prof_oak.4bpp $(OBJEVENTGFXDIR)/people/red_bike.4bpp $(OBJEVENTGFXDIR)/people/red_fish.4bpp $(OBJEVENTGFXDIR)/people/red_item.4bpp $(OBJEVENTGFXDIR)/people/red_normal.4bpp $(OBJEVENTGFXDIR)/people/red_surf_run.4bpp $(OBJEVENTGFXDIR)/people/red_surf.4bpp $(OBJEVENTGFXDIR)/people/red_vs_seeker_bike.4bpp $(OBJEVENTGFXDIR)/people/rich_boy.4bpp $(OBJEVENTGFXDIR)/people/rocker.4bpp $(OBJEVENTGFXDIR)/people/rocket_f.4bpp $(OBJEVENTGFXDIR)/people/rocket_m.4bpp $(OBJEVENTGFXDIR)/people/rs_brendan.4bpp $(OBJEVENTGFXDIR)/people/rs_may.4bpp $(OBJEVENTGFXDIR)/people/sabrina.4bpp $(OBJEVENTGFXDIR)/people/sailor.4bpp $(OBJEVENTGFXDIR)/people/scientist.4bpp $(OBJEVENTGFXDIR)/people/sitting_boy.4bpp $(OBJEVENTGFXDIR)/people/super_nerd.4bpp $(OBJEVENTGFXDIR)/people/swimmer_f_land.4bpp $(OBJEVENTGFXDIR)/people/swimmer_f_water.4bpp $(OBJEVENTGFXDIR)/people/swimmer_m_land.4bpp $(OBJEVENTGFXDIR)/people/swimmer_m_water.4bpp $(OBJEVENTGFXDIR)/people/teachy_tv_host.4bpp $(OBJEVENTGFXDIR)/people/trainer_tower_dude.4bpp $(OBJEVENTGFXDIR)/people/tuber_f.4bpp $(OBJEVENTGFXDIR)/people/tuber_m_land.4bpp $(OBJEVENTGFXDIR)/people/tuber_m_water.4bpp $(OBJEVENTGFXDIR)/people/union_room_receptionist.4bpp $(OBJEVENTGFXDIR)/people/unused_male_receptionist.4bpp $(OBJEVENTGFXDIR)/people/unused_man.4bpp $(OBJEVENTGFXDIR)/people/unused_woman.4bpp $(OBJEVENTGFXDIR)/people/woman_1.4bpp $(OBJEVENTGFXDIR)/people/woman_2.4bpp $(OBJEVENTGFXDIR)/people/woman_3.4bpp $(OBJEVENTGFXDIR)/people/worker_f.4bpp $(OBJEVENTGFXDIR)/people/worker_m.4bpp $(OBJEVENTGFXDIR)/people/youngster.4bpp $(OBJEVENTGFXDIR)/pokemon/chansey.4bpp $(OBJEVENTGFXDIR)/pokemon/clefairy.4bpp $(OBJEVENTGFXDIR)/pokemon/cubone.4bpp $(OBJEVENTGFXDIR)/pokemon/deoxys_a.4bpp $(OBJEVENTGFXDIR)/pokemon/deoxys_d.4bpp $(OBJEVENTGFXDIR)/pokemon/deoxys_n.4bpp $(OBJEVENTGFXDIR)/pokemon/doduo.4bpp $(OBJEVENTGFXDIR)/pokemon/fearow.4bpp $(OBJEVENTGFXDIR)/pokemon/ho_oh.4bpp $(OBJEVENTGFXDIR)/pokemon/jigglypuff.4bpp $(OBJEVENTGFXDIR)/pokemon/kabuto.4bpp $(OBJEVENTGFXDIR)/pokemon/kangaskhan.4bpp $(OBJEVENTGFXDIR)/pokemon/lapras.4bpp $(OBJEVENTGFXDIR)/pokemon/lugia.4bpp $(OBJEVENTGFXDIR)/pokemon/machoke.4bpp $(OBJEVENTGFXDIR)/pokemon/machop.4bpp $(OBJEVENTGFXDIR)/pokemon/meowth.4bpp $(OBJEVENTGFXDIR)/pokemon/nidoran_f.4bpp $(OBJEVENTGFXDIR)/pokemon/nidoran_m.4bpp $(OBJEVENTGFXDIR)/pokemon/nidorino.4bpp $(OBJEVENTGFXDIR)/pokemon/omanyte.4bpp $(OBJEVENTGFXDIR)/pokemon/pidgeot.4bpp $(OBJEVENTGFXDIR)/pokemon/pidgey.4bpp $(OBJEVENTGFXDIR)/pokemon/pikachu.4bpp $(OBJEVENTGFXDIR)/pokemon/poliwrath.4bpp $(OBJEVENTGFXDIR)/pokemon/psyduck.4bpp $(OBJEVENTGFXDIR)/pokemon/seel.4bpp $(OBJEVENTGFXDIR)/pokemon/slowbro.4bpp $(OBJEVENTGFXDIR)/pokemon/slowpoke.4bpp $(OBJEVENTGFXDIR)/pokemon/spearow.4bpp $(OBJEVENTGFXDIR)/pokemon/voltorb.4bpp $(OBJEVENTGFXDIR)/pokemon/wigglytuff.4bpp 
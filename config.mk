@@ -11,6 +11,60 @@ COMPARE       ?= 0
 
 KEEP_TEMPS    ?= 0
 
+# Compresses .lz assets with a minimum-size parse instead of the greedy one
+# the original ROM used. Saves ROM space but the result will not match.
+# Each .lz reports the bytes it saved over the greedy parse, and with
+# GFX_BATCH=1 the batch summary line reports the total.
+OPTIMAL_LZ    ?= 0
+
+# Runs the gbagfx conversions of the generic graphics rules in a single
+# multithreaded gbagfx process, instead of one process per file.
+# Needs the dependency scan, so NODEP=1 builds convert one file at a time.
+GFX_BATCH     ?= 0
+
+# Runs gbagfx, wav2agb and mid2agb through a content-addressed cache of their
+# outputs (in $ASSET_CACHE_DIR, default .assetcache), so assets that were
+# converted before, e.g. on another branch, are copied instead of rebuilt.
+# `tools/assetcache/assetcache --cache-stats` reports the hit rate.
+ASSET_CACHE   ?= 0
+
+# Writes every .d dependency file up front from a single scaninc process that
+# lexes each source and header only once, instead of one scaninc per source.
+# What each file includes is kept in $(OBJ_DIR)/scaninc.db between builds, so
+# only sources and headers that changed are lexed again.
+SCANINC_ALL   ?= 0
+
+# Converts all map.json files with a single multithreaded mapjson process that
+# reads layouts.json once, rewriting only the .inc files whose content changed.
+MAPJSON_ALL   ?= 0
+
+# Renders every jsonproc output with a single jsonproc process that parses each
+# JSON file and template once, rewriting only the headers whose content changed.
+JSONPROC_ALL  ?= 0
+
+# Has preproc turn top-level INCBIN arrays into .incbin directives assembled
+# alongside each C file, so cc1 never parses their bytes as C initializers.
+# The data moves to the end of each object's .rodata, so the ROM will not match.
+INCBIN_ASM    ?= 0
+
+# DPCM lookahead wav2agb compresses the Pokémon cries with, from 1 to 8.
+# Higher values search more deltas ahead for a slightly better SNR, but the
+# original ROM was built with 1, so anything else will not match.
+CRY_LOOKAHEAD ?= 1
+
+# Converts every .wav file with a single multithreaded wav2agb process,
+# rewriting only the .bin files whose content changed.
+WAV_BATCH     ?= 0
+
+# Has mid2agb factor any run of events that repeats within a track into a
+# PATT/PEND pattern, not just whole notes, whenever that makes the track
+# smaller. Saves about a tenth of the song data, so the ROM will not match.
+MID_PATTERNS  ?= 0
+
+# Converts every song in sound/songs/midi/midi.cfg with a single multithreaded
+# mid2agb process, rewriting only the .s files whose content changed.
+MID_BATCH     ?= 0
+
 ifeq (modern,$(MAKECMDGOALS))
   MODERN := 1
 endif
@@ -57,6 +57,45 @@
 #define UNITS_METRIC
 #endif // ENGLISH
 
+// Replaces the task scheduler's searches through gTasks with a head index,
+// a mask of free slots and the last task of each priority. Tasks get the same
+// ids and run in the same order, but the ROM no longer matches.
+// #define FAST_TASK_SCHEDULER
+
+// Adds CB2_TaskSchedulerBenchmark, a scene that times creating, running and
+// destroying a full set of tasks and logs the cycle counts with DebugPrintf.
+// #define TASK_SCHEDULER_BENCHMARK
+
+// Sorts sprites for OAM by packed keys with a radix sort instead of an
+// insertion sort that recomputes each sprite's Y on every swap. Sprites end up
+// in the same order, but the ROM no longer matches.
+// #define FAST_SPRITE_SORT
+
+// Makes BuildOamBuffer compare each sprite with how it was last frame and
+// only sort and rewrite the OAM buffer as far as the changes need, counting
+// the sprites it rewrote in gOamRebuiltSpriteCount. The ROM no longer matches.
+// #define OAM_DIRTY_TRACKING
+
+// Makes AllocSpriteTiles scan the sprite tile bitmap a word at a time,
+// skipping whole runs of used and free tiles, and logs how fragmented the
+// tiles are when an allocation fails. The ROM no longer matches.
+// #define FAST_SPRITE_TILE_ALLOC
+
+// With FAST_SPRITE_TILE_ALLOC, puts sprite tiles in the smallest free run
+// they fit in rather than the first one, to leave large runs for large
+// sheets. Tiles no longer end up where they do in the original game.
+// #define SPRITE_TILE_ALLOC_BEST_FIT
+
+// Replaces the heap's search through every block on each Alloc with free
+// lists by size class, and adds GetHeapStats. Blocks are placed differently
+// and the heap's first bytes hold the lists, so the ROM no longer matches.
+// #define FAST_MALLOC
+
+// Bit scans used by the options above.
+#if defined(FAST_TASK_SCHEDULER) || defined(FAST_SPRITE_TILE_ALLOC) || defined(FAST_MALLOC)
+#define FAST_BIT_SCAN
+#endif
+
 // Crashes may occur due to section reordering in the modern build,
 // so we force BUGFIX here.
 #if MODERN
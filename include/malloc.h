@@ -22,4 +22,25 @@ void *AllocZeroed(u32 size);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
 
+#ifdef FAST_MALLOC
+struct HeapStats
+{
+    // Bytes in allocated blocks, including their headers.
+    u32 usedSize;
+    // The most usedSize has been since the heap was set up.
+    u32 peakUsedSize;
+    // Bytes in free blocks, including their headers.
+    u32 freeSize;
+    // The largest size that can be allocated.
+    u32 largestFreeSize;
+    u16 usedBlockCount;
+    u16 freeBlockCount;
+    // The percentage of freeSize that's outside the largest free block:
+    // 0 if it's all in one block, approaching 100 as it's split up.
+    u8 fragmentation;
+};
+
+void GetHeapStats(struct HeapStats *stats);
+#endif
+
 #endif // GUARD_MALLOC_H
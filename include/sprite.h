@@ -259,6 +259,10 @@ extern struct Sprite gSprites[];
 extern struct OamMatrix gOamMatrices[];
 extern bool8 gAffineAnimsDisabled;
 extern u16 gReservedSpriteTileCount;
+#ifdef OAM_DIRTY_TRACKING
+// How many sprites BuildOamBuffer wrote to the OAM buffer last time.
+extern u8 gOamRebuiltSpriteCount;
+#endif
 
 void ResetSpriteData(void);
 void AnimateSprites(void);
@@ -315,6 +319,9 @@ bool8 AddSubspritesToOamBuffer(struct Sprite *sprite, struct OamData *destOam, u
 void CopyToSprites(u8 *src);
 void CopyFromSprites(u8 *dest);
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op);
+#ifdef FAST_SPRITE_TILE_ALLOC
+void DebugPrintSpriteTileUsage(void);
+#endif
 void ClearSpriteCopyRequests(void);
 void ResetAffineAnimData(void);
 void FreeSpriteTilesIfNotUsingSheet(struct Sprite *sprite);
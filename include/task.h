@@ -37,4 +37,8 @@ u8 GetTaskCount(void);
 void SetWordTaskArg(u8 taskId, u8 dataElem, unsigned long value);
 u32 GetWordTaskArg(u8 taskId, u8 dataElem);
 
+#ifdef TASK_SCHEDULER_BENCHMARK
+void CB2_TaskSchedulerBenchmark(void);
+#endif // TASK_SCHEDULER_BENCHMARK
+
 #endif // GUARD_TASK_H
@@ -12,6 +12,10 @@ u8 CreateInvisibleSpriteWithCallback(void (*)(struct Sprite *));
 void StoreWordInTwoHalfwords(u16 *, u32);
 void LoadWordFromTwoHalfwords(u16 *, u32 *);
 int CountTrailingZeroBits(u32 value);
+#ifdef FAST_BIT_SCAN
+u8 GetLowestSetBit(u32 mask);
+u8 GetHighestSetBit(u32 mask);
+#endif
 u16 CalcCRC16(const u8 *data, u32 length);
 u16 CalcCRC16WithTable(const u8 *data, u32 length);
 u32 CalcByteArraySum(const u8 *data, u32 length);
@@ -1,40 +1,53 @@
 # JSON files are run through jsonproc, which is a tool that converts JSON data to an output file
 # based on an Inja template. https://github.com/pantor/inja
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/wild_encounters.h
-$(DATA_SRC_SUBDIR)/wild_encounters.h: $(DATA_SRC_SUBDIR)/wild_encounters.json $(DATA_SRC_SUBDIR)/wild_encounters.json.txt
-	$(JSONPROC) $^ $@
+# $1: output, $2: JSON file, $3: Inja template
+define JSONPROC_RULE
+AUTO_GEN_TARGETS += $1
+JSONPROC_OUTPUTS += $1
+JSONPROC_JOBS += $2:$3:$1
+ifneq ($(JSONPROC_ALL),1)
+$1: $2 $3
+	$$(JSONPROC) $$^ $$@
+endif
+endef
+
+$(eval $(call JSONPROC_RULE,$(DATA_SRC_SUBDIR)/wild_encounters.h,$(DATA_SRC_SUBDIR)/wild_encounters.json,$(DATA_SRC_SUBDIR)/wild_encounters.json.txt))
 
 $(C_BUILDDIR)/wild_encounter.o: c_dep += $(DATA_SRC_SUBDIR)/wild_encounters.h
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/region_map/region_map_entries.h
-$(DATA_SRC_SUBDIR)/region_map/region_map_entries.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.entries.json.txt
-	$(JSONPROC) $^ $@
+$(eval $(call JSONPROC_RULE,$(DATA_SRC_SUBDIR)/region_map/region_map_entries.h,$(DATA_SRC_SUBDIR)/region_map/region_map_sections.json,$(DATA_SRC_SUBDIR)/region_map/region_map_sections.entries.json.txt))
 
 $(C_BUILDDIR)/region_map.o: c_dep += $(DATA_SRC_SUBDIR)/region_map/region_map_entries.h
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h
-$(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.strings.json.txt
-	$(JSONPROC) $^ $@
+$(eval $(call JSONPROC_RULE,$(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h,$(DATA_SRC_SUBDIR)/region_map/region_map_sections.json,$(DATA_SRC_SUBDIR)/region_map/region_map_sections.strings.json.txt))
 
 $(C_BUILDDIR)/region_map.o: c_dep += $(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h
 
-AUTO_GEN_TARGETS += include/constants/region_map_sections.h
-include/constants/region_map_sections.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.constants.json.txt
-	$(JSONPROC) $^ $@
+$(eval $(call JSONPROC_RULE,include/constants/region_map_sections.h,$(DATA_SRC_SUBDIR)/region_map/region_map_sections.json,$(DATA_SRC_SUBDIR)/region_map/region_map_sections.constants.json.txt))
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/items.h
-$(DATA_SRC_SUBDIR)/items.h: $(DATA_SRC_SUBDIR)/items.json $(DATA_SRC_SUBDIR)/items.json.txt
-	$(JSONPROC) $^ $@
+$(eval $(call JSONPROC_RULE,$(DATA_SRC_SUBDIR)/items.h,$(DATA_SRC_SUBDIR)/items.json,$(DATA_SRC_SUBDIR)/items.json.txt))
 
 $(C_BUILDDIR)/item.o: c_dep += $(DATA_SRC_SUBDIR)/items.h
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/heal_locations.h
-$(DATA_SRC_SUBDIR)/heal_locations.h: $(DATA_SRC_SUBDIR)/heal_locations.json $(DATA_SRC_SUBDIR)/heal_locations.json.txt
-	$(JSONPROC) $^ $@
+$(eval $(call JSONPROC_RULE,$(DATA_SRC_SUBDIR)/heal_locations.h,$(DATA_SRC_SUBDIR)/heal_locations.json,$(DATA_SRC_SUBDIR)/heal_locations.json.txt))
 
 $(C_BUILDDIR)/heal_location.o: c_dep += $(DATA_SRC_SUBDIR)/heal_locations.h
 
-AUTO_GEN_TARGETS += include/constants/heal_locations.h
-include/constants/heal_locations.h: $(DATA_SRC_SUBDIR)/heal_locations.json $(DATA_SRC_SUBDIR)/heal_locations.constants.json.txt
-	$(JSONPROC) $^ $@
+$(eval $(call JSONPROC_RULE,include/constants/heal_locations.h,$(DATA_SRC_SUBDIR)/heal_locations.json,$(DATA_SRC_SUBDIR)/heal_locations.constants.json.txt))
+
+ifeq ($(JSONPROC_ALL),1)
+# One jsonproc process renders every output above, parsing each JSON file and
+# template once, and only rewrites the outputs that changed, so the stamp
+# tracks when they were last brought up to date.
+JSONPROC_MANIFEST := $(OBJ_DIR)/jsonproc_manifest.txt
+
+$(JSONPROC_OUTPUTS): $(OBJ_DIR)/jsonproc_all.stamp ; @:
+
+$(OBJ_DIR)/jsonproc_all.stamp: $(sort $(foreach job,$(JSONPROC_JOBS),$(wordlist 1,2,$(subst :, ,$(job))))) $(call stamp_force,$(JSONPROC_OUTPUTS))
+	@mkdir -p $(@D)
+	$(file >$(JSONPROC_MANIFEST))
+	$(foreach job,$(JSONPROC_JOBS),$(file >>$(JSONPROC_MANIFEST),$(subst :, ,$(job))))
+	$(JSONPROC) --manifest $(JSONPROC_MANIFEST)
+	@touch $@
+endif
@@ -19,13 +19,24 @@ MAP_EVENTS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/events.inc,$(MAP_DIRS))
 MAP_HEADERS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/header.inc,$(MAP_DIRS))
 MAP_JSONS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/map.json,$(MAP_DIRS))
 
-$(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAP_CONNECTIONS) $(MAP_HEADERS)
-	$(PREPROC) $< charmap.txt | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
-$(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAP_EVENTS)
-	$(PREPROC) $< charmap.txt | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
-
+$(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAP_CONNECTIONS) $(MAP_HEADERS) | $(CHARMAP)
+	$(PREPROC) $< $(CHARMAP) | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -ie $< $(CHARMAP) | $(AS) $(ASFLAGS) -o $@
+$(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAP_EVENTS) | $(CHARMAP)
+	$(PREPROC) $< $(CHARMAP) | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -ie $< $(CHARMAP) | $(AS) $(ASFLAGS) -o $@
+
+ifeq ($(MAPJSON_ALL),1)
+# One mapjson process converts every map and only rewrites the files that changed,
+# so the stamp tracks when the .inc files were last brought up to date.
+$(MAP_CONNECTIONS) $(MAP_EVENTS) $(MAP_HEADERS): $(OBJ_DIR)/mapjson_all.stamp ; @:
+
+$(OBJ_DIR)/mapjson_all.stamp: $(MAP_JSONS) $(LAYOUTS_DIR)/layouts.json $(call stamp_force,$(MAP_CONNECTIONS) $(MAP_EVENTS) $(MAP_HEADERS))
+	@$(MAPJSON) all firered $(LAYOUTS_DIR)/layouts.json $(MAP_JSONS)
+	@echo "$(MAPJSON) all firered $(LAYOUTS_DIR)/layouts.json <MAP_JSONS>"
+	@mkdir -p $(@D) && touch $@
+else
 $(MAPS_OUTDIR)/%/header.inc $(MAPS_OUTDIR)/%/events.inc $(MAPS_OUTDIR)/%/connections.inc: $(MAPS_DIR)/%/map.json
 	$(MAPJSON) map firered $< $(LAYOUTS_DIR)/layouts.json $(@D)
+endif
 
 $(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc $(INCLUDECONSTS_OUTDIR)/map_groups.h: $(MAPS_DIR)/map_groups.json
 	$(MAPJSON) groups firered $< $(MAPS_OUTDIR) $(INCLUDECONSTS_OUTDIR)
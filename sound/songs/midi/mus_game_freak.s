@@ -0,0 +1,2962 @@
+	.include "MPlayDef.s"
+
+	.equ	mus_game_freak_grp, voicegroup181
+	.equ	mus_game_freak_pri, 0
+	.equ	mus_game_freak_rev, reverb_set+50
+	.equ	mus_game_freak_mvl, 75
+	.equ	mus_game_freak_key, 0
+	.equ	mus_game_freak_tbs, 1
+	.equ	mus_game_freak_exg, 1
+	.equ	mus_game_freak_cmp, 1
+
+	.section .rodata
+	.global	mus_game_freak
+	.align	2
+
+@**************** Track 1 (Midi-Chn.1) ****************@
+
+mus_game_freak_1:
+	.byte	KEYSH , mus_game_freak_key+0
+@ 000   ----------------------------------------
+	.byte	TEMPO , 150*mus_game_freak_tbs/2
+	.byte		VOICE , 46
+	.byte		BENDR , 2
+	.byte		VOL   , 127*mus_game_freak_mvl/mxv
+	.byte		PAN   , c_v+32
+	.byte		BEND  , c_v+0
+	.byte		N02   , En6 , v112
+	.byte	W02
+	.byte		        Dn6 
+	.byte	W01
+@ 001   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 002   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 003   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		N02   , Dn6 
+	.byte	W02
+@ 004   ----------------------------------------
+	.byte		        Cn6 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 005   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 006   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		PAN   , c_v+16
+	.byte		N02   , Cn6 
+	.byte	W01
+@ 007   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 008   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 009   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 010   ----------------------------------------
+	.byte		PAN   , c_v-48
+	.byte		N02   , An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 011   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 012   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 013   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 014   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 015   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 016   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		PAN   , c_v+32
+	.byte		N02   , En6 , v048
+	.byte	W01
+@ 017   ----------------------------------------
+	.byte	W01
+	.byte		        Dn6 
+	.byte	W02
+@ 018   ----------------------------------------
+	.byte		        Cn6 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 019   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 020   ----------------------------------------
+	.byte		PAN   , c_v-32
+	.byte		N02   , Dn6 
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 021   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 022   ----------------------------------------
+mus_game_freak_1_022:
+	.byte		N02   , Fn5 , v048
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+	.byte	PEND
+@ 023   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+16
+	.byte		N02   , Cn6 
+	.byte	W02
+@ 024   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 025   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 026   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		PAN   , c_v-48
+	.byte		N02   , An5 
+	.byte	W01
+@ 027   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 028   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 029   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 030   ----------------------------------------
+	.byte	PATT
+	 .word	mus_game_freak_1_022
+@ 031   ----------------------------------------
+	.byte	W01
+	.byte		N02   , Dn5 , v048
+	.byte	W02
+@ 032   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        An4 
+	.byte	W01
+@ 033   ----------------------------------------
+	.byte	W01
+	.byte		        En6 , v016
+	.byte	W02
+@ 034   ----------------------------------------
+	.byte		        Dn6 
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 035   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 036   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        Dn6 
+	.byte	W01
+@ 037   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 038   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 039   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 040   ----------------------------------------
+	.byte		        Cn6 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 041   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 042   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 043   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-48
+	.byte		N02   , An5 
+	.byte	W02
+@ 044   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 045   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 046   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 047   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 048   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 049   ----------------------------------------
+	.byte	W01
+	.byte		        An4 
+	.byte	W02
+@ 050   ----------------------------------------
+	.byte		PAN   , c_v-16
+	.byte		N02   , Gs3 
+	.byte	W02
+	.byte		        Cn4 
+	.byte	W01
+@ 051   ----------------------------------------
+	.byte	W01
+	.byte		        Dn4 
+	.byte	W02
+@ 052   ----------------------------------------
+	.byte		        Ds4 
+	.byte	W02
+	.byte		        Gn4 
+	.byte	W01
+@ 053   ----------------------------------------
+	.byte	W01
+	.byte		        Gs4 
+	.byte	W02
+@ 054   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 055   ----------------------------------------
+	.byte	W01
+	.byte		        Ds5 
+	.byte	W02
+@ 056   ----------------------------------------
+	.byte		PAN   , c_v+16
+	.byte		N02   , Dn4 
+	.byte	W02
+	.byte		        Ds4 
+	.byte	W01
+@ 057   ----------------------------------------
+	.byte	W01
+	.byte		        Gn4 , v024
+	.byte	W02
+@ 058   ----------------------------------------
+	.byte		        Gs4 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 059   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 060   ----------------------------------------
+	.byte		        Ds5 
+	.byte	W02
+	.byte		        Gn5 
+	.byte	W01
+@ 061   ----------------------------------------
+	.byte	W01
+	.byte		        Gs5 
+	.byte	W02
+@ 062   ----------------------------------------
+	.byte		PAN   , c_v-16
+	.byte		N02   , Ds4 
+	.byte	W02
+	.byte		        Gn4 , v032
+	.byte	W01
+@ 063   ----------------------------------------
+	.byte	W01
+	.byte		        Gs4 
+	.byte	W02
+@ 064   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 065   ----------------------------------------
+	.byte	W01
+	.byte		        Ds5 
+	.byte	W02
+@ 066   ----------------------------------------
+	.byte		        Gn5 
+	.byte	W02
+	.byte		        Gs5 
+	.byte	W01
+@ 067   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 068   ----------------------------------------
+	.byte		PAN   , c_v+16
+	.byte		N02   , Gn4 
+	.byte	W02
+	.byte		        Gs4 
+	.byte	W01
+@ 069   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 070   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Ds5 
+	.byte	W01
+@ 071   ----------------------------------------
+	.byte	W01
+	.byte		        Gn5 
+	.byte	W02
+@ 072   ----------------------------------------
+	.byte		        Gs5 
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 073   ----------------------------------------
+	.byte	W01
+	.byte		        Dn6 
+	.byte	W02
+@ 074   ----------------------------------------
+	.byte		        Ds6 , v044
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 075   ----------------------------------------
+	.byte	W01
+	.byte		        Gs5 
+	.byte	W02
+@ 076   ----------------------------------------
+	.byte		        Ds5 
+	.byte	W02
+	.byte		PAN   , c_v+32
+	.byte		N02   , Dn6 , v080
+	.byte	W01
+@ 077   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 078   ----------------------------------------
+	.byte		        As5 
+	.byte	W02
+	.byte		        Gn5 
+	.byte	W01
+@ 079   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-16
+	.byte		N02   , Ds5 
+	.byte	W02
+@ 080   ----------------------------------------
+	.byte		PAN   , c_v-32
+	.byte		N02   , Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 081   ----------------------------------------
+	.byte	W01
+	.byte		        As4 
+	.byte	W02
+@ 082   ----------------------------------------
+	.byte		        Gn4 
+	.byte	W02
+	.byte		        Ds4 
+	.byte	W01
+@ 083   ----------------------------------------
+	.byte	W01
+	.byte		        Dn4 
+	.byte	W02
+@ 084   ----------------------------------------
+	.byte		PAN   , c_v+16
+	.byte		N02   , As3 
+	.byte	W02
+	.byte		        Dn6 , v048
+	.byte	W01
+@ 085   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 086   ----------------------------------------
+	.byte		        As5 
+	.byte	W02
+	.byte		PAN   , c_v-32
+	.byte		N02   , Gn5 
+	.byte	W01
+@ 087   ----------------------------------------
+	.byte	W01
+	.byte		        Ds5 
+	.byte	W02
+@ 088   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 089   ----------------------------------------
+	.byte	W01
+	.byte		        As4 
+	.byte	W02
+@ 090   ----------------------------------------
+	.byte		PAN   , c_v+32
+	.byte		N02   , Cn6 , v080
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 091   ----------------------------------------
+	.byte	W01
+	.byte		        Gn5 
+	.byte	W02
+@ 092   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		PAN   , c_v-16
+	.byte		N02   , Dn5 
+	.byte	W01
+@ 093   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		N02   , Cn5 
+	.byte	W02
+@ 094   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		        Gn4 
+	.byte	W01
+@ 095   ----------------------------------------
+	.byte	W01
+	.byte		        Fn4 
+	.byte	W02
+@ 096   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W02
+	.byte		        Cn4 
+	.byte	W01
+@ 097   ----------------------------------------
+	.byte	W01
+	.byte		        An3 
+	.byte	W02
+@ 098   ----------------------------------------
+	.byte		PAN   , c_v+16
+	.byte		N02   , Cn6 , v048
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 099   ----------------------------------------
+	.byte	W01
+	.byte		        Gn5 
+	.byte	W02
+@ 100   ----------------------------------------
+	.byte		PAN   , c_v-16
+	.byte		N02   , Fn5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 101   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 102   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		        Gn4 
+	.byte	W01
+@ 103   ----------------------------------------
+	.byte	W01
+	.byte		        Fn4 
+	.byte	W02
+@ 104   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W02
+	.byte		PAN   , c_v+16
+	.byte		N02   , Cn6 , v020
+	.byte	W01
+@ 105   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 106   ----------------------------------------
+	.byte		PAN   , c_v-16
+	.byte		N02   , Gn5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 107   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 108   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        As4 
+	.byte	W01
+@ 109   ----------------------------------------
+	.byte	W01
+	.byte		        Gs4 
+	.byte	W02
+@ 110   ----------------------------------------
+	.byte		PAN   , c_v+0
+	.byte		VOL   , 105*mus_game_freak_mvl/mxv
+	.byte		N04   , Cn4 , v064
+	.byte	W03
+@ 111   ----------------------------------------
+	.byte	W03
+@ 112   ----------------------------------------
+	.byte		        En4 
+	.byte	W03
+@ 113   ----------------------------------------
+	.byte	W03
+@ 114   ----------------------------------------
+	.byte		        Gn4 
+	.byte	W03
+@ 115   ----------------------------------------
+	.byte	W01
+	.byte		        Bn4 
+	.byte	W02
+@ 116   ----------------------------------------
+	.byte	W03
+@ 117   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 118   ----------------------------------------
+	.byte	W03
+@ 119   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 120   ----------------------------------------
+	.byte	W03
+@ 121   ----------------------------------------
+	.byte	W01
+	.byte		        Gn5 
+	.byte	W02
+@ 122   ----------------------------------------
+	.byte	W03
+@ 123   ----------------------------------------
+	.byte	W01
+	.byte		        Bn5 
+	.byte	W02
+@ 124   ----------------------------------------
+	.byte	W03
+@ 125   ----------------------------------------
+	.byte	W01
+	.byte		        Dn6 
+	.byte	W02
+@ 126   ----------------------------------------
+	.byte	W03
+@ 127   ----------------------------------------
+	.byte	W01
+	.byte		        En6 , v056
+	.byte	W02
+@ 128   ----------------------------------------
+	.byte	W03
+@ 129   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 90*mus_game_freak_mvl/mxv
+	.byte		N04   , En6 , v036
+	.byte	W02
+@ 130   ----------------------------------------
+	.byte	W03
+@ 131   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 75*mus_game_freak_mvl/mxv
+	.byte		N04   , En6 , v032
+	.byte	W02
+@ 132   ----------------------------------------
+	.byte	W03
+@ 133   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 63*mus_game_freak_mvl/mxv
+	.byte		N04   , En6 , v020
+	.byte	W02
+@ 134   ----------------------------------------
+	.byte	W03
+@ 135   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 46*mus_game_freak_mvl/mxv
+	.byte		N04   , En6 , v012
+	.byte	W02
+@ 136   ----------------------------------------
+	.byte	W03
+@ 137   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 38*mus_game_freak_mvl/mxv
+	.byte		N04   , En6 , v008
+	.byte	W02
+@ 138   ----------------------------------------
+	.byte	W03
+@ 139   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 24*mus_game_freak_mvl/mxv
+	.byte		N04   
+	.byte	W02
+@ 140   ----------------------------------------
+	.byte	W03
+@ 141   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 19*mus_game_freak_mvl/mxv
+	.byte		N04   , En6 , v004
+	.byte	W02
+@ 142   ----------------------------------------
+	.byte	W03
+@ 143   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 12*mus_game_freak_mvl/mxv
+	.byte		N04   
+	.byte	W02
+@ 144   ----------------------------------------
+	.byte	W03
+@ 145   ----------------------------------------
+	.byte	W01
+	.byte		VOL   , 11*mus_game_freak_mvl/mxv
+	.byte		PAN   , c_v-17
+	.byte		N72   
+	.byte	W02
+@ 146   ----------------------------------------
+	.byte		VOL   , 11*mus_game_freak_mvl/mxv
+	.byte	W03
+@ 147   ----------------------------------------
+	.byte	W03
+@ 148   ----------------------------------------
+	.byte	W03
+@ 149   ----------------------------------------
+	.byte		        9*mus_game_freak_mvl/mxv
+	.byte	W03
+@ 150   ----------------------------------------
+	.byte	W03
+@ 151   ----------------------------------------
+	.byte	W03
+@ 152   ----------------------------------------
+	.byte		        7*mus_game_freak_mvl/mxv
+	.byte	W03
+@ 153   ----------------------------------------
+	.byte	W03
+@ 154   ----------------------------------------
+	.byte	W03
+@ 155   ----------------------------------------
+	.byte		        6*mus_game_freak_mvl/mxv
+	.byte	W03
+@ 156   ----------------------------------------
+	.byte	W03
+@ 157   ----------------------------------------
+	.byte	W03
+@ 158   ----------------------------------------
+	.byte	W01
+	.byte		        6*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 159   ----------------------------------------
+	.byte	W03
+@ 160   ----------------------------------------
+	.byte	W03
+@ 161   ----------------------------------------
+	.byte	W01
+	.byte		        4*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 162   ----------------------------------------
+	.byte	W03
+@ 163   ----------------------------------------
+	.byte	W03
+@ 164   ----------------------------------------
+	.byte	W01
+	.byte		        2*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 165   ----------------------------------------
+	.byte	W03
+@ 166   ----------------------------------------
+	.byte	W03
+@ 167   ----------------------------------------
+	.byte	W01
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 168   ----------------------------------------
+	.byte	W03
+@ 169   ----------------------------------------
+	.byte	W03
+@ 170   ----------------------------------------
+	.byte	W02
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 171   ----------------------------------------
+	.byte	W03
+@ 172   ----------------------------------------
+	.byte	W03
+@ 173   ----------------------------------------
+	.byte	W03
+@ 174   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 2 (Midi-Chn.2) ****************@
+
+mus_game_freak_2:
+	.byte	KEYSH , mus_game_freak_key+0
+@ 000   ----------------------------------------
+	.byte		VOICE , 46
+	.byte		BENDR , 2
+	.byte		VOL   , 85*mus_game_freak_mvl/mxv
+	.byte		PAN   , c_v+0
+	.byte		BEND  , c_v+0
+	.byte		N02   , Cn6 , v112
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 001   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 002   ----------------------------------------
+mus_game_freak_2_002:
+	.byte		N02   , En5 , v112
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+	.byte	PEND
+@ 003   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 004   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 005   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 006   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 007   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 008   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 009   ----------------------------------------
+	.byte	W01
+	.byte		        An4 
+	.byte	W02
+@ 010   ----------------------------------------
+	.byte	PATT
+	 .word	mus_game_freak_2_002
+@ 011   ----------------------------------------
+	.byte	W01
+	.byte		N02   , Cn5 , v112
+	.byte	W02
+@ 012   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		        Fn4 
+	.byte	W01
+@ 013   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 014   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        An4 
+	.byte	W01
+@ 015   ----------------------------------------
+	.byte	W01
+	.byte		        Fn4 
+	.byte	W02
+@ 016   ----------------------------------------
+	.byte		        En4 
+	.byte	W02
+	.byte		        Cn6 , v064
+	.byte	W01
+@ 017   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 018   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 019   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 020   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 021   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 022   ----------------------------------------
+mus_game_freak_2_022:
+	.byte		N02   , Dn5 , v064
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+	.byte	PEND
+@ 023   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 024   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 025   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 026   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 027   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 028   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        An4 
+	.byte	W01
+@ 029   ----------------------------------------
+	.byte	W01
+	.byte		        Fn4 
+	.byte	W02
+@ 030   ----------------------------------------
+	.byte	PATT
+	 .word	mus_game_freak_2_022
+@ 031   ----------------------------------------
+	.byte	W01
+	.byte		N02   , An4 , v064
+	.byte	W02
+@ 032   ----------------------------------------
+	.byte		        Fn4 
+	.byte	W02
+	.byte		        En4 
+	.byte	W01
+@ 033   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 , v032
+	.byte	W02
+@ 034   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 035   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 036   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 037   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 038   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 039   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 040   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 041   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 042   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        An4 
+	.byte	W01
+@ 043   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 044   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 045   ----------------------------------------
+	.byte	W01
+	.byte		        An4 
+	.byte	W02
+@ 046   ----------------------------------------
+	.byte		        Fn4 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 047   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 048   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		        Fn4 
+	.byte	W01
+@ 049   ----------------------------------------
+	.byte	W01
+	.byte		        En4 
+	.byte	W02
+@ 050   ----------------------------------------
+	.byte	W03
+@ 051   ----------------------------------------
+	.byte	W03
+@ 052   ----------------------------------------
+	.byte	W03
+@ 053   ----------------------------------------
+	.byte	W03
+@ 054   ----------------------------------------
+	.byte	W03
+@ 055   ----------------------------------------
+	.byte	W03
+@ 056   ----------------------------------------
+	.byte	W03
+@ 057   ----------------------------------------
+	.byte	W03
+@ 058   ----------------------------------------
+	.byte	W03
+@ 059   ----------------------------------------
+	.byte	W03
+@ 060   ----------------------------------------
+	.byte	W03
+@ 061   ----------------------------------------
+	.byte	W03
+@ 062   ----------------------------------------
+	.byte	W03
+@ 063   ----------------------------------------
+	.byte	W03
+@ 064   ----------------------------------------
+	.byte	W03
+@ 065   ----------------------------------------
+	.byte	W03
+@ 066   ----------------------------------------
+	.byte	W03
+@ 067   ----------------------------------------
+	.byte	W03
+@ 068   ----------------------------------------
+	.byte	W03
+@ 069   ----------------------------------------
+	.byte	W03
+@ 070   ----------------------------------------
+	.byte	W03
+@ 071   ----------------------------------------
+	.byte	W03
+@ 072   ----------------------------------------
+	.byte	W03
+@ 073   ----------------------------------------
+	.byte	W03
+@ 074   ----------------------------------------
+	.byte	W03
+@ 075   ----------------------------------------
+	.byte	W03
+@ 076   ----------------------------------------
+	.byte	W03
+@ 077   ----------------------------------------
+	.byte	W03
+@ 078   ----------------------------------------
+	.byte	W03
+@ 079   ----------------------------------------
+	.byte	W03
+@ 080   ----------------------------------------
+	.byte	W03
+@ 081   ----------------------------------------
+	.byte	W03
+@ 082   ----------------------------------------
+	.byte	W03
+@ 083   ----------------------------------------
+	.byte	W03
+@ 084   ----------------------------------------
+	.byte	W03
+@ 085   ----------------------------------------
+	.byte	W03
+@ 086   ----------------------------------------
+	.byte	W03
+@ 087   ----------------------------------------
+	.byte	W03
+@ 088   ----------------------------------------
+	.byte	W03
+@ 089   ----------------------------------------
+	.byte	W03
+@ 090   ----------------------------------------
+	.byte	W03
+@ 091   ----------------------------------------
+	.byte	W03
+@ 092   ----------------------------------------
+	.byte	W03
+@ 093   ----------------------------------------
+	.byte	W03
+@ 094   ----------------------------------------
+	.byte	W03
+@ 095   ----------------------------------------
+	.byte	W03
+@ 096   ----------------------------------------
+	.byte	W03
+@ 097   ----------------------------------------
+	.byte	W03
+@ 098   ----------------------------------------
+	.byte	W03
+@ 099   ----------------------------------------
+	.byte	W03
+@ 100   ----------------------------------------
+	.byte	W03
+@ 101   ----------------------------------------
+	.byte	W03
+@ 102   ----------------------------------------
+	.byte	W03
+@ 103   ----------------------------------------
+	.byte	W03
+@ 104   ----------------------------------------
+	.byte	W03
+@ 105   ----------------------------------------
+	.byte	W03
+@ 106   ----------------------------------------
+	.byte	W03
+@ 107   ----------------------------------------
+	.byte	W03
+@ 108   ----------------------------------------
+	.byte	W03
+@ 109   ----------------------------------------
+	.byte	W03
+@ 110   ----------------------------------------
+	.byte		VOL   , 68*mus_game_freak_mvl/mxv
+	.byte		N04   , Cn3 , v064
+	.byte	W03
+@ 111   ----------------------------------------
+	.byte	W03
+@ 112   ----------------------------------------
+	.byte		        En3 
+	.byte	W03
+@ 113   ----------------------------------------
+	.byte	W03
+@ 114   ----------------------------------------
+	.byte		        Gn3 
+	.byte	W03
+@ 115   ----------------------------------------
+	.byte	W01
+	.byte		        Bn3 
+	.byte	W02
+@ 116   ----------------------------------------
+	.byte	W03
+@ 117   ----------------------------------------
+	.byte	W01
+	.byte		        Cn4 
+	.byte	W02
+@ 118   ----------------------------------------
+	.byte	W03
+@ 119   ----------------------------------------
+	.byte	W01
+	.byte		        En4 
+	.byte	W02
+@ 120   ----------------------------------------
+	.byte	W03
+@ 121   ----------------------------------------
+	.byte	W01
+	.byte		        Gn4 
+	.byte	W02
+@ 122   ----------------------------------------
+	.byte	W03
+@ 123   ----------------------------------------
+	.byte	W01
+	.byte		        Bn4 , v056
+	.byte	W02
+@ 124   ----------------------------------------
+	.byte	W03
+@ 125   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 , v052
+	.byte	W02
+@ 126   ----------------------------------------
+	.byte	W03
+@ 127   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 128   ----------------------------------------
+	.byte	W03
+@ 129   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 70*mus_game_freak_mvl/mxv
+	.byte		N04   , En5 , v040
+	.byte	W02
+@ 130   ----------------------------------------
+	.byte	W03
+@ 131   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 63*mus_game_freak_mvl/mxv
+	.byte		N04   , En5 , v032
+	.byte	W02
+@ 132   ----------------------------------------
+	.byte	W03
+@ 133   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 50*mus_game_freak_mvl/mxv
+	.byte		N04   , En5 , v024
+	.byte	W02
+@ 134   ----------------------------------------
+	.byte	W03
+@ 135   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 38*mus_game_freak_mvl/mxv
+	.byte		N04   , En5 , v016
+	.byte	W02
+@ 136   ----------------------------------------
+	.byte	W03
+@ 137   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 29*mus_game_freak_mvl/mxv
+	.byte		N04   , En5 , v008
+	.byte	W02
+@ 138   ----------------------------------------
+	.byte	W03
+@ 139   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 16*mus_game_freak_mvl/mxv
+	.byte		N04   , En5 , v004
+	.byte	W02
+@ 140   ----------------------------------------
+	.byte	W03
+@ 141   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 7*mus_game_freak_mvl/mxv
+	.byte		N04   
+	.byte	W02
+@ 142   ----------------------------------------
+	.byte	W03
+@ 143   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v-32
+	.byte		VOL   , 4*mus_game_freak_mvl/mxv
+	.byte		N04   
+	.byte	W02
+@ 144   ----------------------------------------
+	.byte	W03
+@ 145   ----------------------------------------
+	.byte	W01
+	.byte		PAN   , c_v+32
+	.byte		VOL   , 2*mus_game_freak_mvl/mxv
+	.byte		N76   
+	.byte	W02
+@ 146   ----------------------------------------
+	.byte	W03
+@ 147   ----------------------------------------
+	.byte	W03
+@ 148   ----------------------------------------
+	.byte	W03
+@ 149   ----------------------------------------
+	.byte	W03
+@ 150   ----------------------------------------
+	.byte	W03
+@ 151   ----------------------------------------
+	.byte	W03
+@ 152   ----------------------------------------
+	.byte	W03
+@ 153   ----------------------------------------
+	.byte	W03
+@ 154   ----------------------------------------
+	.byte	W03
+@ 155   ----------------------------------------
+	.byte	W03
+@ 156   ----------------------------------------
+	.byte	W03
+@ 157   ----------------------------------------
+	.byte	W03
+@ 158   ----------------------------------------
+	.byte	W03
+@ 159   ----------------------------------------
+	.byte	W01
+	.byte		VOL   , 0*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 160   ----------------------------------------
+	.byte	W03
+@ 161   ----------------------------------------
+	.byte	W03
+@ 162   ----------------------------------------
+	.byte	W03
+@ 163   ----------------------------------------
+	.byte	W03
+@ 164   ----------------------------------------
+	.byte	W03
+@ 165   ----------------------------------------
+	.byte	W03
+@ 166   ----------------------------------------
+	.byte	W03
+@ 167   ----------------------------------------
+	.byte	W03
+@ 168   ----------------------------------------
+	.byte	W03
+@ 169   ----------------------------------------
+	.byte	W03
+@ 170   ----------------------------------------
+	.byte	W03
+@ 171   ----------------------------------------
+	.byte	W03
+@ 172   ----------------------------------------
+	.byte	W03
+@ 173   ----------------------------------------
+	.byte	W01
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 174   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 3 (Midi-Chn.3) ****************@
+
+mus_game_freak_3:
+	.byte	KEYSH , mus_game_freak_key+0
+@ 000   ----------------------------------------
+	.byte		VOICE , 80
+	.byte		PAN   , c_v+0
+	.byte		BENDR , 12
+	.byte		LFOS  , 44
+	.byte		VOL   , 53*mus_game_freak_mvl/mxv
+	.byte		BEND  , c_v+1
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte	W03
+@ 003   ----------------------------------------
+	.byte	W03
+@ 004   ----------------------------------------
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	W03
+@ 007   ----------------------------------------
+	.byte	W03
+@ 008   ----------------------------------------
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte	W03
+@ 010   ----------------------------------------
+	.byte	W03
+@ 011   ----------------------------------------
+	.byte	W03
+@ 012   ----------------------------------------
+	.byte	W03
+@ 013   ----------------------------------------
+	.byte	W03
+@ 014   ----------------------------------------
+	.byte	W03
+@ 015   ----------------------------------------
+	.byte	W03
+@ 016   ----------------------------------------
+	.byte	W03
+@ 017   ----------------------------------------
+	.byte	W03
+@ 018   ----------------------------------------
+	.byte	W03
+@ 019   ----------------------------------------
+	.byte	W03
+@ 020   ----------------------------------------
+	.byte	W03
+@ 021   ----------------------------------------
+	.byte	W03
+@ 022   ----------------------------------------
+	.byte	W03
+@ 023   ----------------------------------------
+	.byte	W03
+@ 024   ----------------------------------------
+	.byte	W03
+@ 025   ----------------------------------------
+	.byte	W03
+@ 026   ----------------------------------------
+	.byte	W03
+@ 027   ----------------------------------------
+	.byte	W03
+@ 028   ----------------------------------------
+	.byte	W03
+@ 029   ----------------------------------------
+	.byte	W03
+@ 030   ----------------------------------------
+	.byte	W03
+@ 031   ----------------------------------------
+	.byte	W03
+@ 032   ----------------------------------------
+	.byte	W03
+@ 033   ----------------------------------------
+	.byte	W03
+@ 034   ----------------------------------------
+	.byte	W03
+@ 035   ----------------------------------------
+	.byte	W03
+@ 036   ----------------------------------------
+	.byte	W03
+@ 037   ----------------------------------------
+	.byte	W03
+@ 038   ----------------------------------------
+	.byte	W03
+@ 039   ----------------------------------------
+	.byte	W03
+@ 040   ----------------------------------------
+	.byte	W03
+@ 041   ----------------------------------------
+	.byte	W03
+@ 042   ----------------------------------------
+	.byte	W03
+@ 043   ----------------------------------------
+	.byte	W03
+@ 044   ----------------------------------------
+	.byte	W03
+@ 045   ----------------------------------------
+	.byte	W03
+@ 046   ----------------------------------------
+	.byte	W03
+@ 047   ----------------------------------------
+	.byte	W03
+@ 048   ----------------------------------------
+	.byte	W03
+@ 049   ----------------------------------------
+	.byte	W03
+@ 050   ----------------------------------------
+	.byte	W03
+@ 051   ----------------------------------------
+	.byte	W03
+@ 052   ----------------------------------------
+	.byte	W03
+@ 053   ----------------------------------------
+	.byte	W03
+@ 054   ----------------------------------------
+	.byte	W03
+@ 055   ----------------------------------------
+	.byte	W03
+@ 056   ----------------------------------------
+	.byte	W03
+@ 057   ----------------------------------------
+	.byte	W03
+@ 058   ----------------------------------------
+	.byte	W03
+@ 059   ----------------------------------------
+	.byte	W03
+@ 060   ----------------------------------------
+	.byte	W03
+@ 061   ----------------------------------------
+	.byte	W03
+@ 062   ----------------------------------------
+	.byte	W03
+@ 063   ----------------------------------------
+	.byte	W03
+@ 064   ----------------------------------------
+	.byte	W03
+@ 065   ----------------------------------------
+	.byte	W03
+@ 066   ----------------------------------------
+	.byte	W03
+@ 067   ----------------------------------------
+	.byte	W03
+@ 068   ----------------------------------------
+	.byte	W03
+@ 069   ----------------------------------------
+	.byte	W03
+@ 070   ----------------------------------------
+	.byte	W03
+@ 071   ----------------------------------------
+	.byte	W03
+@ 072   ----------------------------------------
+	.byte	W03
+@ 073   ----------------------------------------
+	.byte	W03
+@ 074   ----------------------------------------
+	.byte	W03
+@ 075   ----------------------------------------
+	.byte	W03
+@ 076   ----------------------------------------
+	.byte	W03
+@ 077   ----------------------------------------
+	.byte	W03
+@ 078   ----------------------------------------
+	.byte	W03
+@ 079   ----------------------------------------
+	.byte	W03
+@ 080   ----------------------------------------
+	.byte	W03
+@ 081   ----------------------------------------
+	.byte	W03
+@ 082   ----------------------------------------
+	.byte	W03
+@ 083   ----------------------------------------
+	.byte	W03
+@ 084   ----------------------------------------
+	.byte	W03
+@ 085   ----------------------------------------
+	.byte	W03
+@ 086   ----------------------------------------
+	.byte	W03
+@ 087   ----------------------------------------
+	.byte	W03
+@ 088   ----------------------------------------
+	.byte	W03
+@ 089   ----------------------------------------
+	.byte	W03
+@ 090   ----------------------------------------
+	.byte	W03
+@ 091   ----------------------------------------
+	.byte	W03
+@ 092   ----------------------------------------
+	.byte	W03
+@ 093   ----------------------------------------
+	.byte	W03
+@ 094   ----------------------------------------
+	.byte	W03
+@ 095   ----------------------------------------
+	.byte	W03
+@ 096   ----------------------------------------
+	.byte	W03
+@ 097   ----------------------------------------
+	.byte	W03
+@ 098   ----------------------------------------
+	.byte	W03
+@ 099   ----------------------------------------
+	.byte	W03
+@ 100   ----------------------------------------
+	.byte	W03
+@ 101   ----------------------------------------
+	.byte	W03
+@ 102   ----------------------------------------
+	.byte	W03
+@ 103   ----------------------------------------
+	.byte	W03
+@ 104   ----------------------------------------
+	.byte	W03
+@ 105   ----------------------------------------
+	.byte	W03
+@ 106   ----------------------------------------
+	.byte	W03
+@ 107   ----------------------------------------
+	.byte	W03
+@ 108   ----------------------------------------
+	.byte	W03
+@ 109   ----------------------------------------
+	.byte	W03
+@ 110   ----------------------------------------
+	.byte		N72   , CnM2, v048
+	.byte	W03
+@ 111   ----------------------------------------
+	.byte	W03
+@ 112   ----------------------------------------
+	.byte	W03
+@ 113   ----------------------------------------
+	.byte	W03
+@ 114   ----------------------------------------
+	.byte	W03
+@ 115   ----------------------------------------
+	.byte	W03
+@ 116   ----------------------------------------
+	.byte	W03
+@ 117   ----------------------------------------
+	.byte	W03
+@ 118   ----------------------------------------
+	.byte	W03
+@ 119   ----------------------------------------
+	.byte	W03
+@ 120   ----------------------------------------
+	.byte	W03
+@ 121   ----------------------------------------
+	.byte	W03
+@ 122   ----------------------------------------
+	.byte	W03
+@ 123   ----------------------------------------
+	.byte	W03
+@ 124   ----------------------------------------
+	.byte	W03
+@ 125   ----------------------------------------
+	.byte	W03
+@ 126   ----------------------------------------
+	.byte	W03
+@ 127   ----------------------------------------
+	.byte	W03
+@ 128   ----------------------------------------
+	.byte	W03
+@ 129   ----------------------------------------
+	.byte	W03
+@ 130   ----------------------------------------
+	.byte	W03
+@ 131   ----------------------------------------
+	.byte	W03
+@ 132   ----------------------------------------
+	.byte	W03
+@ 133   ----------------------------------------
+	.byte	W03
+@ 134   ----------------------------------------
+	.byte	W03
+@ 135   ----------------------------------------
+	.byte	W03
+@ 136   ----------------------------------------
+	.byte	W03
+@ 137   ----------------------------------------
+	.byte	W03
+@ 138   ----------------------------------------
+	.byte	W03
+@ 139   ----------------------------------------
+	.byte	W03
+@ 140   ----------------------------------------
+	.byte	W03
+@ 141   ----------------------------------------
+	.byte	W03
+@ 142   ----------------------------------------
+	.byte	W03
+@ 143   ----------------------------------------
+	.byte	W03
+@ 144   ----------------------------------------
+	.byte	W03
+@ 145   ----------------------------------------
+	.byte	W03
+@ 146   ----------------------------------------
+	.byte	W03
+@ 147   ----------------------------------------
+	.byte	W03
+@ 148   ----------------------------------------
+	.byte	W03
+@ 149   ----------------------------------------
+	.byte	W03
+@ 150   ----------------------------------------
+	.byte	W03
+@ 151   ----------------------------------------
+	.byte	W03
+@ 152   ----------------------------------------
+	.byte	W03
+@ 153   ----------------------------------------
+	.byte	W03
+@ 154   ----------------------------------------
+	.byte	W03
+@ 155   ----------------------------------------
+	.byte	W03
+@ 156   ----------------------------------------
+	.byte	W03
+@ 157   ----------------------------------------
+	.byte	W03
+@ 158   ----------------------------------------
+	.byte	W03
+@ 159   ----------------------------------------
+	.byte	W03
+@ 160   ----------------------------------------
+	.byte	W03
+@ 161   ----------------------------------------
+	.byte	W03
+@ 162   ----------------------------------------
+	.byte	W03
+@ 163   ----------------------------------------
+	.byte	W03
+@ 164   ----------------------------------------
+	.byte	W03
+@ 165   ----------------------------------------
+	.byte	W03
+@ 166   ----------------------------------------
+	.byte	W03
+@ 167   ----------------------------------------
+	.byte	W03
+@ 168   ----------------------------------------
+	.byte	W03
+@ 169   ----------------------------------------
+	.byte	W03
+@ 170   ----------------------------------------
+	.byte	W03
+@ 171   ----------------------------------------
+	.byte	W03
+@ 172   ----------------------------------------
+	.byte	W03
+@ 173   ----------------------------------------
+	.byte	W03
+@ 174   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 4 (Midi-Chn.4) ****************@
+
+mus_game_freak_4:
+	.byte	KEYSH , mus_game_freak_key+0
+@ 000   ----------------------------------------
+	.byte		VOICE , 46
+	.byte		BENDR , 12
+	.byte		LFOS  , 44
+	.byte		PAN   , c_v+33
+	.byte		VOL   , 43*mus_game_freak_mvl/mxv
+	.byte		BEND  , c_v+0
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte	W01
+	.byte		N02   , En6 , v112
+	.byte	W02
+@ 002   ----------------------------------------
+	.byte		        Dn6 
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 003   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 004   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        Dn6 
+	.byte	W01
+@ 005   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 006   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 007   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 008   ----------------------------------------
+	.byte		        Cn6 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 009   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 010   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 011   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 012   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 013   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 014   ----------------------------------------
+	.byte		        Cn5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 015   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 016   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 017   ----------------------------------------
+	.byte	W01
+	.byte		        An4 
+	.byte	W02
+@ 018   ----------------------------------------
+	.byte		        En6 , v048
+	.byte	W02
+	.byte		        Dn6 
+	.byte	W01
+@ 019   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 020   ----------------------------------------
+mus_game_freak_4_020:
+	.byte		N02   , An5 , v048
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+	.byte	PEND
+@ 021   ----------------------------------------
+	.byte	W01
+	.byte		        Dn6 
+	.byte	W02
+@ 022   ----------------------------------------
+	.byte		        Cn6 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 023   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 024   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 025   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 026   ----------------------------------------
+	.byte		        Fn5 
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+@ 027   ----------------------------------------
+	.byte	W01
+	.byte		        Dn5 
+	.byte	W02
+@ 028   ----------------------------------------
+	.byte	PATT
+	 .word	mus_game_freak_4_020
+@ 029   ----------------------------------------
+	.byte	W01
+	.byte		N02   , En5 , v048
+	.byte	W02
+@ 030   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        Cn5 
+	.byte	W01
+@ 031   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 032   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 033   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 034   ----------------------------------------
+	.byte		        An4 
+	.byte	W02
+	.byte		        En6 , v016
+	.byte	W01
+@ 035   ----------------------------------------
+	.byte	W01
+	.byte		        Dn6 
+	.byte	W02
+@ 036   ----------------------------------------
+	.byte		        Cn6 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 037   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 038   ----------------------------------------
+	.byte		        Dn6 
+	.byte	W02
+	.byte		        Cn6 
+	.byte	W01
+@ 039   ----------------------------------------
+	.byte	W01
+	.byte		        An5 
+	.byte	W02
+@ 040   ----------------------------------------
+mus_game_freak_4_040:
+	.byte		N02   , Fn5 , v016
+	.byte	W02
+	.byte		        En5 
+	.byte	W01
+	.byte	PEND
+@ 041   ----------------------------------------
+	.byte	W01
+	.byte		        Cn6 
+	.byte	W02
+@ 042   ----------------------------------------
+	.byte		        An5 
+	.byte	W02
+	.byte		        Fn5 
+	.byte	W01
+@ 043   ----------------------------------------
+	.byte	W01
+	.byte		        En5 
+	.byte	W02
+@ 044   ----------------------------------------
+	.byte		        Dn5 
+	.byte	W02
+	.byte		        An5 
+	.byte	W01
+@ 045   ----------------------------------------
+	.byte	W01
+	.byte		        Fn5 
+	.byte	W02
+@ 046   ----------------------------------------
+	.byte		        En5 
+	.byte	W02
+	.byte		        Dn5 
+	.byte	W01
+@ 047   ----------------------------------------
+	.byte	W01
+	.byte		        Cn5 
+	.byte	W02
+@ 048   ----------------------------------------
+	.byte	PATT
+	 .word	mus_game_freak_4_040
+@ 049   ----------------------------------------
+	.byte	W01
+	.byte		N02   , Dn5 , v016
+	.byte	W02
+@ 050   ----------------------------------------
+	.byte		VOICE , 1
+	.byte		VOL   , 6*mus_game_freak_mvl/mxv
+	.byte		PAN   , c_v+16
+	.byte		BEND  , c_v+0
+	.byte		N80   , Cn4 , v124
+	.byte	W01
+	.byte		VOL   , 6*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        7*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 051   ----------------------------------------
+	.byte		        9*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        11*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 052   ----------------------------------------
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        14*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 053   ----------------------------------------
+	.byte		        16*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        17*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 054   ----------------------------------------
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        21*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 055   ----------------------------------------
+	.byte	W01
+	.byte		        23*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 056   ----------------------------------------
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        26*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 057   ----------------------------------------
+	.byte		        28*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        29*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 058   ----------------------------------------
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        33*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 059   ----------------------------------------
+	.byte		        34*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        36*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 060   ----------------------------------------
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        39*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 061   ----------------------------------------
+	.byte		        41*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 062   ----------------------------------------
+	.byte	W01
+	.byte		        45*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        46*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 063   ----------------------------------------
+	.byte		        48*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 064   ----------------------------------------
+	.byte	W01
+	.byte		        51*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        53*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 065   ----------------------------------------
+	.byte		        55*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 066   ----------------------------------------
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        58*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        60*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 067   ----------------------------------------
+	.byte		        61*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 068   ----------------------------------------
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        65*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        67*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 069   ----------------------------------------
+	.byte	W01
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 070   ----------------------------------------
+	.byte		        70*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        72*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        73*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 071   ----------------------------------------
+	.byte	W01
+	.byte		        75*mus_game_freak_mvl/mxv
+	.byte		BEND  , c_v-6
+	.byte	W01
+	.byte		VOL   , 75*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 072   ----------------------------------------
+	.byte		        77*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        78*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		BEND  , c_v-11
+	.byte	W01
+@ 073   ----------------------------------------
+	.byte		VOL   , 80*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 074   ----------------------------------------
+	.byte		        83*mus_game_freak_mvl/mxv
+	.byte		BEND  , c_v-16
+	.byte	W02
+	.byte		VOL   , 85*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 075   ----------------------------------------
+	.byte	W01
+	.byte		BEND  , c_v-22
+	.byte	W02
+@ 076   ----------------------------------------
+	.byte	W02
+	.byte		        c_v+0
+	.byte		N24   , Gn3 
+	.byte	W01
+@ 077   ----------------------------------------
+	.byte	W03
+@ 078   ----------------------------------------
+	.byte	W03
+@ 079   ----------------------------------------
+	.byte	W03
+@ 080   ----------------------------------------
+	.byte	W03
+@ 081   ----------------------------------------
+	.byte	W03
+@ 082   ----------------------------------------
+	.byte	W03
+@ 083   ----------------------------------------
+	.byte	W03
+@ 084   ----------------------------------------
+	.byte	W03
+@ 085   ----------------------------------------
+	.byte	W01
+	.byte		N14   , An3 
+	.byte	W02
+@ 086   ----------------------------------------
+	.byte	W03
+@ 087   ----------------------------------------
+	.byte	W03
+@ 088   ----------------------------------------
+	.byte	W03
+@ 089   ----------------------------------------
+	.byte	W03
+@ 090   ----------------------------------------
+	.byte		N40   , Fn3 
+	.byte	W03
+@ 091   ----------------------------------------
+	.byte	W03
+@ 092   ----------------------------------------
+	.byte	W03
+@ 093   ----------------------------------------
+	.byte	W03
+@ 094   ----------------------------------------
+	.byte	W03
+@ 095   ----------------------------------------
+	.byte	W03
+@ 096   ----------------------------------------
+	.byte	W03
+@ 097   ----------------------------------------
+	.byte	W03
+@ 098   ----------------------------------------
+	.byte	W03
+@ 099   ----------------------------------------
+	.byte	W03
+@ 100   ----------------------------------------
+	.byte	W03
+@ 101   ----------------------------------------
+	.byte	W03
+@ 102   ----------------------------------------
+	.byte	W03
+@ 103   ----------------------------------------
+	.byte	W01
+	.byte		N20   , Dn3 
+	.byte	W02
+@ 104   ----------------------------------------
+	.byte	W03
+@ 105   ----------------------------------------
+	.byte	W03
+@ 106   ----------------------------------------
+	.byte	W03
+@ 107   ----------------------------------------
+	.byte	W03
+@ 108   ----------------------------------------
+	.byte	W03
+@ 109   ----------------------------------------
+	.byte	W03
+@ 110   ----------------------------------------
+	.byte		TIE   , En3 
+	.byte	W03
+@ 111   ----------------------------------------
+	.byte	W03
+@ 112   ----------------------------------------
+	.byte	W03
+@ 113   ----------------------------------------
+	.byte	W03
+@ 114   ----------------------------------------
+	.byte	W03
+@ 115   ----------------------------------------
+	.byte	W03
+@ 116   ----------------------------------------
+	.byte	W03
+@ 117   ----------------------------------------
+	.byte	W03
+@ 118   ----------------------------------------
+	.byte	W03
+@ 119   ----------------------------------------
+	.byte	W03
+@ 120   ----------------------------------------
+	.byte	W03
+@ 121   ----------------------------------------
+	.byte	W03
+@ 122   ----------------------------------------
+	.byte	W03
+@ 123   ----------------------------------------
+	.byte	W03
+@ 124   ----------------------------------------
+	.byte	W03
+@ 125   ----------------------------------------
+	.byte	W03
+@ 126   ----------------------------------------
+	.byte	W03
+@ 127   ----------------------------------------
+	.byte	W03
+@ 128   ----------------------------------------
+	.byte		VOL   , 83*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 129   ----------------------------------------
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        80*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 130   ----------------------------------------
+	.byte		        78*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        77*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 131   ----------------------------------------
+	.byte		        75*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        75*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 132   ----------------------------------------
+	.byte		        73*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        72*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 133   ----------------------------------------
+	.byte		        70*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 134   ----------------------------------------
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        67*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 135   ----------------------------------------
+	.byte		        65*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 136   ----------------------------------------
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        61*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 137   ----------------------------------------
+	.byte	W01
+	.byte		        60*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        58*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 138   ----------------------------------------
+	.byte	W01
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 139   ----------------------------------------
+	.byte	W01
+	.byte		        55*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        53*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 140   ----------------------------------------
+	.byte	W01
+	.byte		        51*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 141   ----------------------------------------
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 142   ----------------------------------------
+	.byte		        48*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        46*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 143   ----------------------------------------
+	.byte		        45*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 144   ----------------------------------------
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        41*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 145   ----------------------------------------
+	.byte		        39*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 146   ----------------------------------------
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        36*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 147   ----------------------------------------
+	.byte		        34*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        33*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 148   ----------------------------------------
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 149   ----------------------------------------
+	.byte		        29*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        28*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 150   ----------------------------------------
+	.byte		        26*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 151   ----------------------------------------
+	.byte	W01
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        23*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 152   ----------------------------------------
+	.byte	W01
+	.byte		        21*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 153   ----------------------------------------
+	.byte	W01
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        17*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 154   ----------------------------------------
+	.byte	W01
+	.byte		        16*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        14*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 155   ----------------------------------------
+	.byte	W01
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 156   ----------------------------------------
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        11*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 157   ----------------------------------------
+	.byte		        9*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        7*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 158   ----------------------------------------
+	.byte		        6*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        6*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 159   ----------------------------------------
+	.byte		        4*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        2*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 160   ----------------------------------------
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 161   ----------------------------------------
+	.byte	W03
+@ 162   ----------------------------------------
+	.byte	W03
+@ 163   ----------------------------------------
+	.byte	W03
+@ 164   ----------------------------------------
+	.byte	W03
+@ 165   ----------------------------------------
+	.byte	W03
+@ 166   ----------------------------------------
+	.byte	W03
+@ 167   ----------------------------------------
+	.byte	W03
+@ 168   ----------------------------------------
+	.byte	W03
+@ 169   ----------------------------------------
+	.byte	W03
+	.byte		EOT   
+@ 170   ----------------------------------------
+	.byte	W03
+@ 171   ----------------------------------------
+	.byte	W03
+@ 172   ----------------------------------------
+	.byte	W03
+@ 173   ----------------------------------------
+	.byte	W03
+@ 174   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 5 (Midi-Chn.5) ****************@
+
+mus_game_freak_5:
+	.byte	KEYSH , mus_game_freak_key+0
+@ 000   ----------------------------------------
+	.byte		VOICE , 1
+	.byte		PAN   , c_v-17
+	.byte		VOL   , 61*mus_game_freak_mvl/mxv
+	.byte		BENDR , 12
+	.byte		LFOS  , 44
+	.byte		BEND  , c_v+0
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte	W03
+@ 003   ----------------------------------------
+	.byte	W03
+@ 004   ----------------------------------------
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	W03
+@ 007   ----------------------------------------
+	.byte	W03
+@ 008   ----------------------------------------
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte	W03
+@ 010   ----------------------------------------
+	.byte	W03
+@ 011   ----------------------------------------
+	.byte	W03
+@ 012   ----------------------------------------
+	.byte	W03
+@ 013   ----------------------------------------
+	.byte	W03
+@ 014   ----------------------------------------
+	.byte	W03
+@ 015   ----------------------------------------
+	.byte	W03
+@ 016   ----------------------------------------
+	.byte	W03
+@ 017   ----------------------------------------
+	.byte	W03
+@ 018   ----------------------------------------
+	.byte	W03
+@ 019   ----------------------------------------
+	.byte	W03
+@ 020   ----------------------------------------
+	.byte	W03
+@ 021   ----------------------------------------
+	.byte	W03
+@ 022   ----------------------------------------
+	.byte	W03
+@ 023   ----------------------------------------
+	.byte	W03
+@ 024   ----------------------------------------
+	.byte	W03
+@ 025   ----------------------------------------
+	.byte	W03
+@ 026   ----------------------------------------
+	.byte	W03
+@ 027   ----------------------------------------
+	.byte	W03
+@ 028   ----------------------------------------
+	.byte	W03
+@ 029   ----------------------------------------
+	.byte	W03
+@ 030   ----------------------------------------
+	.byte	W03
+@ 031   ----------------------------------------
+	.byte	W03
+@ 032   ----------------------------------------
+	.byte	W03
+@ 033   ----------------------------------------
+	.byte	W03
+@ 034   ----------------------------------------
+	.byte	W03
+@ 035   ----------------------------------------
+	.byte	W03
+@ 036   ----------------------------------------
+	.byte	W03
+@ 037   ----------------------------------------
+	.byte	W03
+@ 038   ----------------------------------------
+	.byte	W03
+@ 039   ----------------------------------------
+	.byte	W03
+@ 040   ----------------------------------------
+	.byte	W03
+@ 041   ----------------------------------------
+	.byte	W03
+@ 042   ----------------------------------------
+	.byte	W03
+@ 043   ----------------------------------------
+	.byte	W03
+@ 044   ----------------------------------------
+	.byte	W03
+@ 045   ----------------------------------------
+	.byte	W03
+@ 046   ----------------------------------------
+	.byte	W03
+@ 047   ----------------------------------------
+	.byte	W03
+@ 048   ----------------------------------------
+	.byte	W03
+@ 049   ----------------------------------------
+	.byte	W03
+@ 050   ----------------------------------------
+	.byte		VOL   , 6*mus_game_freak_mvl/mxv
+	.byte		N80   , Cn2 , v124
+	.byte	W01
+	.byte		VOL   , 6*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        7*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 051   ----------------------------------------
+	.byte		        9*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        11*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 052   ----------------------------------------
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        14*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 053   ----------------------------------------
+	.byte		        16*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        17*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 054   ----------------------------------------
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        21*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 055   ----------------------------------------
+	.byte	W01
+	.byte		        23*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 056   ----------------------------------------
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        26*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 057   ----------------------------------------
+	.byte		        28*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        29*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 058   ----------------------------------------
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        33*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 059   ----------------------------------------
+	.byte		        34*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        36*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 060   ----------------------------------------
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        39*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 061   ----------------------------------------
+	.byte		        41*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 062   ----------------------------------------
+	.byte	W01
+	.byte		        45*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        46*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 063   ----------------------------------------
+	.byte		        48*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 064   ----------------------------------------
+	.byte	W01
+	.byte		        51*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        53*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 065   ----------------------------------------
+	.byte		        55*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 066   ----------------------------------------
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        58*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        60*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 067   ----------------------------------------
+	.byte		        61*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 068   ----------------------------------------
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        65*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        67*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 069   ----------------------------------------
+	.byte	W01
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 070   ----------------------------------------
+	.byte		        70*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        72*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        73*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 071   ----------------------------------------
+	.byte	W01
+	.byte		        75*mus_game_freak_mvl/mxv
+	.byte		BEND  , c_v-6
+	.byte	W01
+	.byte		VOL   , 75*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 072   ----------------------------------------
+	.byte		        77*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        78*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		BEND  , c_v-11
+	.byte	W01
+@ 073   ----------------------------------------
+	.byte		VOL   , 80*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 074   ----------------------------------------
+	.byte		        83*mus_game_freak_mvl/mxv
+	.byte		BEND  , c_v-16
+	.byte	W02
+	.byte		VOL   , 85*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 075   ----------------------------------------
+	.byte	W01
+	.byte		BEND  , c_v-22
+	.byte	W02
+@ 076   ----------------------------------------
+	.byte	W02
+	.byte		        c_v+0
+	.byte		N24   , Gn1 
+	.byte	W01
+@ 077   ----------------------------------------
+	.byte	W03
+@ 078   ----------------------------------------
+	.byte	W03
+@ 079   ----------------------------------------
+	.byte	W03
+@ 080   ----------------------------------------
+	.byte	W03
+@ 081   ----------------------------------------
+	.byte	W03
+@ 082   ----------------------------------------
+	.byte	W03
+@ 083   ----------------------------------------
+	.byte	W03
+@ 084   ----------------------------------------
+	.byte	W03
+@ 085   ----------------------------------------
+	.byte	W01
+	.byte		N14   , An1 
+	.byte	W02
+@ 086   ----------------------------------------
+	.byte	W03
+@ 087   ----------------------------------------
+	.byte	W03
+@ 088   ----------------------------------------
+	.byte	W03
+@ 089   ----------------------------------------
+	.byte	W03
+@ 090   ----------------------------------------
+	.byte		N40   , Fn1 
+	.byte	W03
+@ 091   ----------------------------------------
+	.byte	W03
+@ 092   ----------------------------------------
+	.byte	W03
+@ 093   ----------------------------------------
+	.byte	W03
+@ 094   ----------------------------------------
+	.byte	W03
+@ 095   ----------------------------------------
+	.byte	W03
+@ 096   ----------------------------------------
+	.byte	W03
+@ 097   ----------------------------------------
+	.byte	W03
+@ 098   ----------------------------------------
+	.byte	W03
+@ 099   ----------------------------------------
+	.byte	W03
+@ 100   ----------------------------------------
+	.byte	W03
+@ 101   ----------------------------------------
+	.byte	W03
+@ 102   ----------------------------------------
+	.byte	W03
+@ 103   ----------------------------------------
+	.byte	W01
+	.byte		N20   , Dn1 
+	.byte	W02
+@ 104   ----------------------------------------
+	.byte	W03
+@ 105   ----------------------------------------
+	.byte	W03
+@ 106   ----------------------------------------
+	.byte	W03
+@ 107   ----------------------------------------
+	.byte	W03
+@ 108   ----------------------------------------
+	.byte	W03
+@ 109   ----------------------------------------
+	.byte	W03
+@ 110   ----------------------------------------
+	.byte		TIE   , En1 
+	.byte	W03
+@ 111   ----------------------------------------
+	.byte	W03
+@ 112   ----------------------------------------
+	.byte	W03
+@ 113   ----------------------------------------
+	.byte	W03
+@ 114   ----------------------------------------
+	.byte	W03
+@ 115   ----------------------------------------
+	.byte	W03
+@ 116   ----------------------------------------
+	.byte	W03
+@ 117   ----------------------------------------
+	.byte	W03
+@ 118   ----------------------------------------
+	.byte	W03
+@ 119   ----------------------------------------
+	.byte	W03
+@ 120   ----------------------------------------
+	.byte	W03
+@ 121   ----------------------------------------
+	.byte	W03
+@ 122   ----------------------------------------
+	.byte	W03
+@ 123   ----------------------------------------
+	.byte	W03
+@ 124   ----------------------------------------
+	.byte	W03
+@ 125   ----------------------------------------
+	.byte	W03
+@ 126   ----------------------------------------
+	.byte	W03
+@ 127   ----------------------------------------
+	.byte	W03
+@ 128   ----------------------------------------
+	.byte		VOL   , 83*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 129   ----------------------------------------
+	.byte		        82*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        80*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 130   ----------------------------------------
+	.byte		        78*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        77*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 131   ----------------------------------------
+	.byte		        75*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        75*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 132   ----------------------------------------
+	.byte		        73*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        72*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 133   ----------------------------------------
+	.byte		        70*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 134   ----------------------------------------
+	.byte		        68*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        67*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 135   ----------------------------------------
+	.byte		        65*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 136   ----------------------------------------
+	.byte		        63*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        61*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 137   ----------------------------------------
+	.byte	W01
+	.byte		        60*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        58*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 138   ----------------------------------------
+	.byte	W01
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        56*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 139   ----------------------------------------
+	.byte	W01
+	.byte		        55*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        53*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 140   ----------------------------------------
+	.byte	W01
+	.byte		        51*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 141   ----------------------------------------
+	.byte	W01
+	.byte		        50*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 142   ----------------------------------------
+	.byte		        48*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        46*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 143   ----------------------------------------
+	.byte		        45*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 144   ----------------------------------------
+	.byte		        43*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        41*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 145   ----------------------------------------
+	.byte		        39*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 146   ----------------------------------------
+	.byte		        38*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        36*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 147   ----------------------------------------
+	.byte		        34*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        33*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 148   ----------------------------------------
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        31*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 149   ----------------------------------------
+	.byte		        29*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        28*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 150   ----------------------------------------
+	.byte		        26*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 151   ----------------------------------------
+	.byte	W01
+	.byte		        24*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        23*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 152   ----------------------------------------
+	.byte	W01
+	.byte		        21*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 153   ----------------------------------------
+	.byte	W01
+	.byte		        19*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        17*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 154   ----------------------------------------
+	.byte	W01
+	.byte		        16*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        14*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 155   ----------------------------------------
+	.byte	W01
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 156   ----------------------------------------
+	.byte		        12*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        11*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 157   ----------------------------------------
+	.byte		        9*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        7*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 158   ----------------------------------------
+	.byte		        6*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        6*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 159   ----------------------------------------
+	.byte		        4*mus_game_freak_mvl/mxv
+	.byte	W01
+	.byte		        2*mus_game_freak_mvl/mxv
+	.byte	W02
+@ 160   ----------------------------------------
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W02
+	.byte		        0*mus_game_freak_mvl/mxv
+	.byte	W01
+@ 161   ----------------------------------------
+	.byte	W03
+@ 162   ----------------------------------------
+	.byte	W03
+@ 163   ----------------------------------------
+	.byte	W03
+@ 164   ----------------------------------------
+	.byte	W03
+@ 165   ----------------------------------------
+	.byte	W03
+@ 166   ----------------------------------------
+	.byte	W03
+@ 167   ----------------------------------------
+	.byte	W03
+@ 168   ----------------------------------------
+	.byte	W03
+@ 169   ----------------------------------------
+	.byte	W03
+	.byte		EOT   
+@ 170   ----------------------------------------
+	.byte	W03
+@ 171   ----------------------------------------
+	.byte	W03
+@ 172   ----------------------------------------
+	.byte	W03
+@ 173   ----------------------------------------
+	.byte	W03
+@ 174   ----------------------------------------
+	.byte	FINE
+
+@******************************************************@
+	.align	2
+
+mus_game_freak:
+	.byte	5	@ NumTrks
+	.byte	0	@ NumBlks
+	.byte	mus_game_freak_pri	@ Priority
+	.byte	mus_game_freak_rev	@ Reverb.
+
+	.word	mus_game_freak_grp
+
+	.word	mus_game_freak_1
+	.word	mus_game_freak_2
+	.word	mus_game_freak_3
+	.word	mus_game_freak_4
+	.word	mus_game_freak_5
+
+	.end
@@ -0,0 +1,142 @@
+	.include "MPlayDef.s"
+
+	.equ	se_ding_dong_grp, voicegroup127
+	.equ	se_ding_dong_pri, 5
+	.equ	se_ding_dong_rev, reverb_set+50
+	.equ	se_ding_dong_mvl, 90
+	.equ	se_ding_dong_key, 0
+	.equ	se_ding_dong_tbs, 1
+	.equ	se_ding_dong_exg, 1
+	.equ	se_ding_dong_cmp, 1
+
+	.section .rodata
+	.global	se_ding_dong
+	.align	2
+
+@**************** Track 1 (Midi-Chn.1) ****************@
+
+se_ding_dong_1:
+	.byte	KEYSH , se_ding_dong_key+0
+@ 000   ----------------------------------------
+	.byte	TEMPO , 150*se_ding_dong_tbs/2
+	.byte		VOICE , 15
+	.byte		BENDR , 2
+	.byte		VOL   , 127*se_ding_dong_mvl/mxv
+	.byte		BEND  , c_v+1
+	.byte		N24   , Ds4 , v092
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte	W03
+@ 003   ----------------------------------------
+	.byte	W03
+@ 004   ----------------------------------------
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	W03
+@ 007   ----------------------------------------
+	.byte	W03
+@ 008   ----------------------------------------
+	.byte		BEND  , c_v+15
+	.byte		N36   , Bn3 
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte	W03
+@ 010   ----------------------------------------
+	.byte	W03
+@ 011   ----------------------------------------
+	.byte	W03
+@ 012   ----------------------------------------
+	.byte	W03
+@ 013   ----------------------------------------
+	.byte	W03
+@ 014   ----------------------------------------
+	.byte	W03
+@ 015   ----------------------------------------
+	.byte	W03
+@ 016   ----------------------------------------
+	.byte	W03
+@ 017   ----------------------------------------
+	.byte	W03
+@ 018   ----------------------------------------
+	.byte	W03
+@ 019   ----------------------------------------
+	.byte	W03
+@ 020   ----------------------------------------
+	.byte	W03
+@ 021   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 2 (Midi-Chn.2) ****************@
+
+se_ding_dong_2:
+	.byte	KEYSH , se_ding_dong_key+0
+@ 000   ----------------------------------------
+	.byte		VOICE , 14
+	.byte		VOL   , 127*se_ding_dong_mvl/mxv
+	.byte		BEND  , c_v+1
+	.byte		N24   , Ds4 , v072
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte	W03
+@ 003   ----------------------------------------
+	.byte	W03
+@ 004   ----------------------------------------
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	W03
+@ 007   ----------------------------------------
+	.byte	W03
+@ 008   ----------------------------------------
+	.byte		BEND  , c_v+15
+	.byte		N36   , Bn3 
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte	W03
+@ 010   ----------------------------------------
+	.byte	W03
+@ 011   ----------------------------------------
+	.byte	W03
+@ 012   ----------------------------------------
+	.byte	W03
+@ 013   ----------------------------------------
+	.byte	W03
+@ 014   ----------------------------------------
+	.byte	W03
+@ 015   ----------------------------------------
+	.byte	W03
+@ 016   ----------------------------------------
+	.byte	W03
+@ 017   ----------------------------------------
+	.byte	W03
+@ 018   ----------------------------------------
+	.byte	W03
+@ 019   ----------------------------------------
+	.byte	W03
+@ 020   ----------------------------------------
+	.byte	W03
+@ 021   ----------------------------------------
+	.byte	FINE
+
+@******************************************************@
+	.align	2
+
+se_ding_dong:
+	.byte	2	@ NumTrks
+	.byte	0	@ NumBlks
+	.byte	se_ding_dong_pri	@ Priority
+	.byte	se_ding_dong_rev	@ Reverb.
+
+	.word	se_ding_dong_grp
+
+	.word	se_ding_dong_1
+	.word	se_ding_dong_2
+
+	.end
@@ -0,0 +1,112 @@
+	.include "MPlayDef.s"
+
+	.equ	se_effective_grp, voicegroup127
+	.equ	se_effective_pri, 5
+	.equ	se_effective_rev, reverb_set+50
+	.equ	se_effective_mvl, 110
+	.equ	se_effective_key, 0
+	.equ	se_effective_tbs, 1
+	.equ	se_effective_exg, 1
+	.equ	se_effective_cmp, 1
+
+	.section .rodata
+	.global	se_effective
+	.align	2
+
+@**************** Track 1 (Midi-Chn.1) ****************@
+
+se_effective_1:
+	.byte	KEYSH , se_effective_key+0
+@ 000   ----------------------------------------
+	.byte	TEMPO , 90*se_effective_tbs/2
+	.byte		VOICE , 125
+	.byte		VOL   , 127*se_effective_mvl/mxv
+	.byte		BEND  , c_v+0
+	.byte		N03   , As2 , v100
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte		BEND  , c_v-33
+	.byte		N36   , Ds3 
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte		BEND  , c_v+0
+	.byte	W03
+@ 003   ----------------------------------------
+	.byte	W03
+@ 004   ----------------------------------------
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	W03
+@ 007   ----------------------------------------
+	.byte	W03
+@ 008   ----------------------------------------
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte	W03
+@ 010   ----------------------------------------
+	.byte	W03
+@ 011   ----------------------------------------
+	.byte	W03
+@ 012   ----------------------------------------
+	.byte	W03
+@ 013   ----------------------------------------
+	.byte	W03
+@ 014   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 2 (Midi-Chn.2) ****************@
+
+se_effective_2:
+	.byte	KEYSH , se_effective_key+0
+@ 000   ----------------------------------------
+	.byte		VOICE , 0
+	.byte		VOL   , 127*se_effective_mvl/mxv
+	.byte		N03   , Cn3 , v127
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte		N18   
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte	W03
+@ 003   ----------------------------------------
+	.byte	W03
+@ 004   ----------------------------------------
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	W03
+@ 007   ----------------------------------------
+	.byte	W03
+@ 008   ----------------------------------------
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte	W03
+@ 010   ----------------------------------------
+	.byte	W03
+@ 011   ----------------------------------------
+	.byte	W03
+@ 012   ----------------------------------------
+	.byte	W03
+@ 013   ----------------------------------------
+	.byte	W03
+@ 014   ----------------------------------------
+	.byte	FINE
+
+@******************************************************@
+	.align	2
+
+se_effective:
+	.byte	2	@ NumTrks
+	.byte	0	@ NumBlks
+	.byte	se_effective_pri	@ Priority
+	.byte	se_effective_rev	@ Reverb.
+
+	.word	se_effective_grp
+
+	.word	se_effective_1
+	.word	se_effective_2
+
+	.end
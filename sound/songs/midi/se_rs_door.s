@@ -0,0 +1,44 @@
+	.include "MPlayDef.s"
+
+	.equ	se_rs_door_grp, voicegroup127
+	.equ	se_rs_door_pri, 5
+	.equ	se_rs_door_rev, reverb_set+50
+	.equ	se_rs_door_mvl, 80
+	.equ	se_rs_door_key, 0
+	.equ	se_rs_door_tbs, 1
+	.equ	se_rs_door_exg, 1
+	.equ	se_rs_door_cmp, 1
+
+	.section .rodata
+	.global	se_rs_door
+	.align	2
+
+@**************** Track 1 (Midi-Chn.1) ****************@
+
+se_rs_door_1:
+	.byte	KEYSH , se_rs_door_key+0
+@ 000   ----------------------------------------
+	.byte	TEMPO , 110*se_rs_door_tbs/2
+	.byte		VOICE , 127
+	.byte		VOL   , 127*se_rs_door_mvl/mxv
+	.byte		N03   , Dn3 , v127
+	.byte	W06
+	.byte		N12   , Fs3 
+	.byte	W18
+@ 001   ----------------------------------------
+	.byte	FINE
+
+@******************************************************@
+	.align	2
+
+se_rs_door:
+	.byte	1	@ NumTrks
+	.byte	0	@ NumBlks
+	.byte	se_rs_door_pri	@ Priority
+	.byte	se_rs_door_rev	@ Reverb.
+
+	.word	se_rs_door_grp
+
+	.word	se_rs_door_1
+
+	.end
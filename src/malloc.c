@@ -1,5 +1,339 @@
 #include "global.h"
 
+#ifdef FAST_MALLOC
+#include "malloc.h"
+#include "util.h"
+
+#define MALLOC_SYSTEM_ID 0xA3A3
+
+// Free blocks are kept in a list for each size class, class n holding the
+// blocks of 2^n to 2^(n+1) - 1 bytes.
+#define NUM_SIZE_CLASSES 32
+
+struct MemBlock {
+    // Whether this block is currently allocated.
+    bool16 flag;
+
+    // Magic number used for error checking. Should equal MALLOC_SYSTEM_ID.
+    u16 magic_number;
+
+    // Size of the block (not including this header struct).
+    u32 size;
+
+    // The block just before this one in memory, or NULL if this is the first
+    // block. The one just after is at the end of the data, so a block that's
+    // freed can merge with either without searching for it.
+    struct MemBlock *prev;
+
+    // Data in the memory block. (Arrays of length 0 are a GNU extension.)
+    u8 data[0];
+};
+
+// A free block links to the others in its size class from the start of its
+// data, which is why no block is smaller than the links.
+struct FreeMemBlock {
+    struct MemBlock header;
+    struct FreeMemBlock *nextFree;
+    struct FreeMemBlock *prevFree;
+};
+
+#define MIN_BLOCK_SIZE (sizeof(struct FreeMemBlock) - sizeof(struct MemBlock))
+
+// Kept at the start of the heap, followed by the blocks.
+struct Heap {
+    // Bit n is set if freeLists[n] isn't empty.
+    u32 nonEmptySizeClasses;
+    struct FreeMemBlock *freeLists[NUM_SIZE_CLASSES];
+
+    // Just past the last block.
+    u8 *end;
+
+    // Bytes in allocated blocks, including their headers, now and at most
+    // since InitHeap.
+    u32 usedSize;
+    u32 peakUsedSize;
+};
+
+#define FIRST_BLOCK(heap) ((struct MemBlock *)((struct Heap *)(heap) + 1))
+#define NEXT_BLOCK(block) ((struct MemBlock *)((block)->data + (block)->size))
+
+static void *sHeapStart;
+static u32 sHeapSize;
+
+void PutMemBlockHeader(void *block, struct MemBlock *prev, u32 size)
+{
+    struct MemBlock *header = (struct MemBlock *)block;
+
+    header->flag = FALSE;
+    header->magic_number = MALLOC_SYSTEM_ID;
+    header->size = size;
+    header->prev = prev;
+}
+
+static void AddFreeBlock(struct Heap *heap, struct MemBlock *block)
+{
+    struct FreeMemBlock *freeBlock = (struct FreeMemBlock *)block;
+    u32 sizeClass = GetHighestSetBit(block->size);
+
+    block->flag = FALSE;
+    freeBlock->prevFree = NULL;
+    freeBlock->nextFree = heap->freeLists[sizeClass];
+
+    if (freeBlock->nextFree != NULL)
+        freeBlock->nextFree->prevFree = freeBlock;
+
+    heap->freeLists[sizeClass] = freeBlock;
+    heap->nonEmptySizeClasses |= 1 << sizeClass;
+}
+
+static void RemoveFreeBlock(struct Heap *heap, struct MemBlock *block)
+{
+    struct FreeMemBlock *freeBlock = (struct FreeMemBlock *)block;
+    u32 sizeClass = GetHighestSetBit(block->size);
+
+    if (freeBlock->prevFree != NULL) {
+        freeBlock->prevFree->nextFree = freeBlock->nextFree;
+    } else {
+        heap->freeLists[sizeClass] = freeBlock->nextFree;
+        if (freeBlock->nextFree == NULL)
+            heap->nonEmptySizeClasses &= ~(1 << sizeClass);
+    }
+
+    if (freeBlock->nextFree != NULL)
+        freeBlock->nextFree->prevFree = freeBlock->prevFree;
+}
+
+// Returns a free block of at least the given size, or NULL if there's none.
+static struct MemBlock *FindFreeBlock(struct Heap *heap, u32 size)
+{
+    u32 sizeClass = GetHighestSetBit(size);
+    u32 largerSizeClasses;
+    struct FreeMemBlock *block;
+
+    // Blocks in the size's own class may or may not be big enough, but
+    // using one of them leaves the larger blocks whole.
+    for (block = heap->freeLists[sizeClass]; block != NULL; block = block->nextFree) {
+        if (block->header.size >= size)
+            return &block->header;
+    }
+
+    // Any block in a larger class is big enough.
+    largerSizeClasses = heap->nonEmptySizeClasses & ~((2u << sizeClass) - 1);
+
+    if (largerSizeClasses == 0)
+        return NULL;
+
+    return &heap->freeLists[GetLowestSetBit(largerSizeClasses)]->header;
+}
+
+void *AllocInternal(void *heapStart, u32 size)
+{
+    struct Heap *heap = (struct Heap *)heapStart;
+    struct MemBlock *block;
+
+    // Alignment
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+
+    if (size < MIN_BLOCK_SIZE)
+        size = MIN_BLOCK_SIZE;
+
+    block = FindFreeBlock(heap, size);
+
+    if (block == NULL) {
+        AGB_ASSERT(block != NULL);
+        return NULL;
+    }
+
+    RemoveFreeBlock(heap, block);
+
+    if (block->size - size >= 2 * sizeof(struct MemBlock)) {
+        // The block is significantly bigger than the requested size, so
+        // split the rest into a separate block.
+        struct MemBlock *splitBlock = (struct MemBlock *)(block->data + size);
+
+        PutMemBlockHeader(splitBlock, block, block->size - size - sizeof(struct MemBlock));
+        block->size = size;
+
+        if ((u8 *)NEXT_BLOCK(splitBlock) != heap->end)
+            NEXT_BLOCK(splitBlock)->prev = splitBlock;
+
+        AddFreeBlock(heap, splitBlock);
+    }
+
+    block->flag = TRUE;
+
+    heap->usedSize += sizeof(struct MemBlock) + block->size;
+    if (heap->usedSize > heap->peakUsedSize)
+        heap->peakUsedSize = heap->usedSize;
+
+    return block->data;
+}
+
+void FreeInternal(void *heapStart, void *p)
+{
+    AGB_ASSERT(p != NULL);
+
+    if (p) {
+        struct Heap *heap = (struct Heap *)heapStart;
+        struct MemBlock *block = (struct MemBlock *)((u8 *)p - sizeof(struct MemBlock));
+        struct MemBlock *next;
+
+        AGB_ASSERT(block->magic_number == MALLOC_SYSTEM_ID);
+        AGB_ASSERT(block->flag == TRUE);
+
+        // Freeing a block twice would put it in a free list twice.
+        if (!block->flag)
+            return;
+
+        heap->usedSize -= sizeof(struct MemBlock) + block->size;
+
+        // Merge with the next block if it's not in use.
+        next = NEXT_BLOCK(block);
+        if ((u8 *)next != heap->end && !next->flag) {
+            AGB_ASSERT(next->magic_number == MALLOC_SYSTEM_ID);
+            RemoveFreeBlock(heap, next);
+            block->size += sizeof(struct MemBlock) + next->size;
+            next->magic_number = 0;
+        }
+
+        // Merge with the previous block if it's not in use.
+        if (block->prev != NULL && !block->prev->flag) {
+            struct MemBlock *prev = block->prev;
+
+            AGB_ASSERT(prev->magic_number == MALLOC_SYSTEM_ID);
+            RemoveFreeBlock(heap, prev);
+            prev->size += sizeof(struct MemBlock) + block->size;
+            block->magic_number = 0;
+            block = prev;
+        }
+
+        next = NEXT_BLOCK(block);
+        if ((u8 *)next != heap->end)
+            next->prev = block;
+
+        AddFreeBlock(heap, block);
+    }
+}
+
+void *AllocZeroedInternal(void *heapStart, u32 size)
+{
+    void *mem = AllocInternal(heapStart, size);
+
+    if (mem != NULL) {
+        if (size & 3)
+            size = 4 * ((size / 4) + 1);
+
+        CpuFill32(0, mem, size);
+    }
+
+    return mem;
+}
+
+bool32 CheckMemBlockInternal(void *heapStart, void *pointer)
+{
+    struct Heap *heap = (struct Heap *)heapStart;
+    struct MemBlock *block = (struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
+    struct MemBlock *next;
+
+    if (block->magic_number != MALLOC_SYSTEM_ID)
+        return FALSE;
+
+    next = NEXT_BLOCK(block);
+
+    if ((u8 *)next > heap->end)
+        return FALSE;
+
+    if ((u8 *)next != heap->end && (next->magic_number != MALLOC_SYSTEM_ID || next->prev != block))
+        return FALSE;
+
+    if (block->prev != NULL && (block->prev->magic_number != MALLOC_SYSTEM_ID || NEXT_BLOCK(block->prev) != block))
+        return FALSE;
+
+    return TRUE;
+}
+
+void InitHeap(void *heapStart, u32 heapSize)
+{
+    struct Heap *heap = (struct Heap *)heapStart;
+    struct MemBlock *block = FIRST_BLOCK(heap);
+
+    sHeapStart = heapStart;
+    sHeapSize = heapSize;
+
+    CpuFill32(0, heap, sizeof(*heap));
+    heap->end = (u8 *)heapStart + heapSize;
+
+    PutMemBlockHeader(block, NULL, heap->end - block->data);
+    AddFreeBlock(heap, block);
+}
+
+void *Alloc(u32 size)
+{
+    return AllocInternal(sHeapStart, size);
+}
+
+void *AllocZeroed(u32 size)
+{
+    return AllocZeroedInternal(sHeapStart, size);
+}
+
+void Free(void *pointer)
+{
+    FreeInternal(sHeapStart, pointer);
+}
+
+bool32 CheckMemBlock(void *pointer)
+{
+    return CheckMemBlockInternal(sHeapStart, pointer);
+}
+
+bool32 CheckHeap()
+{
+    struct Heap *heap = (struct Heap *)sHeapStart;
+    struct MemBlock *pos;
+
+    for (pos = FIRST_BLOCK(heap); (u8 *)pos != heap->end; pos = NEXT_BLOCK(pos)) {
+        if (!CheckMemBlockInternal(sHeapStart, pos->data))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+void GetHeapStats(struct HeapStats *stats)
+{
+    struct Heap *heap = (struct Heap *)sHeapStart;
+    struct MemBlock *pos;
+    u32 largestFreeBlockSize = 0;
+
+    stats->usedSize = heap->usedSize;
+    stats->peakUsedSize = heap->peakUsedSize;
+    stats->freeSize = 0;
+    stats->largestFreeSize = 0;
+    stats->usedBlockCount = 0;
+    stats->freeBlockCount = 0;
+
+    for (pos = FIRST_BLOCK(heap); (u8 *)pos != heap->end; pos = NEXT_BLOCK(pos)) {
+        if (pos->flag) {
+            stats->usedBlockCount++;
+        } else {
+            stats->freeBlockCount++;
+            stats->freeSize += sizeof(struct MemBlock) + pos->size;
+            if (pos->size > stats->largestFreeSize)
+                stats->largestFreeSize = pos->size;
+        }
+    }
+
+    if (stats->freeBlockCount != 0)
+        largestFreeBlockSize = sizeof(struct MemBlock) + stats->largestFreeSize;
+
+    if (stats->freeSize != 0)
+        stats->fragmentation = 100 - largestFreeBlockSize * 100 / stats->freeSize;
+    else
+        stats->fragmentation = 0;
+}
+#else
 static void *sHeapStart;
 static u32 sHeapSize;
 
@@ -222,3 +556,4 @@ bool32 CheckHeap()
 
     return TRUE;
 }
+#endif // FAST_MALLOC
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "gflib.h"
+#include "util.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
@@ -281,7 +282,12 @@ EWRAM_DATA u8 gSpriteCopyRequestCount = 0;
 EWRAM_DATA struct SpriteCopyRequest gSpriteCopyRequests[MAX_SPRITES] = {0};
 EWRAM_DATA u8 gOamLimit = 0;
 EWRAM_DATA u16 gReservedSpriteTileCount = 0;
+#ifdef FAST_SPRITE_TILE_ALLOC
+// Aligned so that it can be read a word at a time.
+EWRAM_DATA u8 gSpriteTileAllocBitmap[128] ALIGNED(4) = {0};
+#else
 EWRAM_DATA u8 gSpriteTileAllocBitmap[128] = {0};
+#endif
 EWRAM_DATA s16 gSpriteCoordOffsetX = 0;
 EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
@@ -318,6 +324,179 @@ void AnimateSprites(void)
     }
 }
 
+#ifdef OAM_DIRTY_TRACKING
+// Ways the sprites can have changed since the OAM buffer was last built.
+#define OAM_CHANGE_SPRITES (1 << 0) // some sprites' entries need rewriting
+#define OAM_CHANGE_ORDER   (1 << 1) // sprites may need sorting again
+#define OAM_CHANGE_LAYOUT  (1 << 2) // sprites may have moved to other entries
+
+#define OAM_INDEX_NONE 0xFF
+
+#define IS_RAM_POINTER(ptr) ((u32)(ptr) - EWRAM_START < IWRAM_END - EWRAM_START)
+
+// Everything about a sprite that BuildOamBuffer reads, as of the last time
+// it ran.
+struct SpriteOamState
+{
+    struct OamData oam;
+    const struct SubspriteTable *subspriteTables;
+    s8 centerToCornerVecX;
+    s8 centerToCornerVecY;
+    u8 subpriority;
+    u8 subspriteTableNum:6;
+    u8 subspriteMode:2;
+    bool8 shown;
+};
+
+static EWRAM_DATA struct SpriteOamState sSpriteOamStates[MAX_SPRITES] = {0};
+// The first OAM buffer entry of each sprite, or OAM_INDEX_NONE for sprites
+// that aren't in it.
+static EWRAM_DATA u8 sSpriteOamIndices[MAX_SPRITES] = {0};
+static EWRAM_DATA u8 sLastOamLimit = 0;
+// Cleared whenever the OAM buffer or gSpriteOrder are changed elsewhere.
+static EWRAM_DATA bool8 sOamBufferIsValid = FALSE;
+EWRAM_DATA u8 gOamRebuiltSpriteCount = 0;
+
+// Whether the entries a sprite adds can change without the sprite itself
+// changing, because its subsprites can be rewritten.
+static bool8 HasSubspritesInRam(struct Sprite *sprite)
+{
+    const struct SubspriteTable *subspriteTable;
+
+    if (!sprite->subspriteTables || sprite->subspriteMode == SUBSPRITES_OFF)
+        return FALSE;
+
+    subspriteTable = &sprite->subspriteTables[sprite->subspriteTableNum];
+    return IS_RAM_POINTER(subspriteTable) || IS_RAM_POINTER(subspriteTable->subsprites);
+}
+
+// Compares each sprite with how it was last time, marking the shown ones
+// whose entries need rewriting in isChanged, and returns the OAM_CHANGE
+// flags for what needs doing. Sprites that aren't shown still count for
+// the order, since they're sorted too.
+static u8 FindChangedSprites(bool8 *isChanged)
+{
+    u8 i;
+    u8 changes = 0;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        struct Sprite *sprite = &gSprites[i];
+        struct SpriteOamState *state = &sSpriteOamStates[i];
+        bool8 shown = sprite->inUse && !sprite->invisible;
+        bool8 hasSubspritesInRam = shown && HasSubspritesInRam(sprite);
+
+        isChanged[i] = FALSE;
+
+        if (sprite->oam.y != state->oam.y
+         || sprite->oam.affineMode != state->oam.affineMode
+         || sprite->oam.shape != state->oam.shape
+         || sprite->oam.size != state->oam.size
+         || sprite->oam.priority != state->oam.priority
+         || sprite->subpriority != state->subpriority)
+            changes |= OAM_CHANGE_ORDER;
+
+        if (shown != state->shown
+         || (shown && (sprite->subspriteTables != state->subspriteTables
+                    || sprite->subspriteTableNum != state->subspriteTableNum
+                    || sprite->subspriteMode != state->subspriteMode
+                    || hasSubspritesInRam)))
+            changes |= OAM_CHANGE_LAYOUT;
+
+        if (shown
+         && (((u32 *)&sprite->oam)[0] != ((u32 *)&state->oam)[0]
+          || ((u32 *)&sprite->oam)[1] != ((u32 *)&state->oam)[1]
+          || sprite->centerToCornerVecX != state->centerToCornerVecX
+          || sprite->centerToCornerVecY != state->centerToCornerVecY
+          || hasSubspritesInRam))
+        {
+            isChanged[i] = TRUE;
+            changes |= OAM_CHANGE_SPRITES;
+        }
+
+        state->oam = sprite->oam;
+        state->subspriteTables = sprite->subspriteTables;
+        state->centerToCornerVecX = sprite->centerToCornerVecX;
+        state->centerToCornerVecY = sprite->centerToCornerVecY;
+        state->subpriority = sprite->subpriority;
+        state->subspriteTableNum = sprite->subspriteTableNum;
+        state->subspriteMode = sprite->subspriteMode;
+        state->shown = shown;
+    }
+
+    if (gOamLimit != sLastOamLimit)
+        changes |= OAM_CHANGE_LAYOUT;
+    sLastOamLimit = gOamLimit;
+
+    return changes;
+}
+
+// Rewrites the entries of the sprites that changed in place. Only valid
+// when every sprite still has the same entries as last time.
+static void UpdateChangedSpritesInOamBuffer(const bool8 *isChanged)
+{
+    u8 i;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        if (isChanged[i] && sSpriteOamIndices[i] != OAM_INDEX_NONE)
+        {
+            u8 oamIndex = sSpriteOamIndices[i];
+            AddSpriteToOamBuffer(&gSprites[i], &oamIndex);
+            gOamRebuiltSpriteCount++;
+        }
+    }
+}
+
+// Only sorts the sprites and rewrites their entries as far as the changes
+// since last frame need. If nothing changed, the OAM buffer is left as it is.
+void BuildOamBuffer(void)
+{
+    u8 temp;
+    u8 changes;
+    bool8 isChanged[MAX_SPRITES];
+
+    UpdateOamCoords();
+    BuildSpritePriorities();
+    changes = FindChangedSprites(isChanged);
+    gOamRebuiltSpriteCount = 0;
+
+    if (!sOamBufferIsValid)
+        changes |= OAM_CHANGE_ORDER | OAM_CHANGE_LAYOUT;
+
+    // If no sort key changed, the order from last frame is still sorted.
+    if (changes & OAM_CHANGE_ORDER)
+    {
+        u8 lastOrder[MAX_SPRITES];
+        u8 i;
+
+        for (i = 0; i < MAX_SPRITES; i++)
+            lastOrder[i] = gSpriteOrder[i];
+
+        SortSprites();
+
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            if (gSpriteOrder[i] != lastOrder[i])
+            {
+                changes |= OAM_CHANGE_LAYOUT;
+                break;
+            }
+        }
+    }
+
+    temp = gMain.oamLoadDisabled;
+    gMain.oamLoadDisabled = TRUE;
+    if (changes & OAM_CHANGE_LAYOUT)
+        AddSpritesToOamBuffer();
+    else if (changes & OAM_CHANGE_SPRITES)
+        UpdateChangedSpritesInOamBuffer(isChanged);
+    CopyMatricesToOamBuffer();
+    gMain.oamLoadDisabled = temp;
+    gShouldProcessSpriteCopyRequests = TRUE;
+    sOamBufferIsValid = TRUE;
+}
+#else
 void BuildOamBuffer(void)
 {
     u8 temp;
@@ -331,6 +510,7 @@ void BuildOamBuffer(void)
     gMain.oamLoadDisabled = temp;
     gShouldProcessSpriteCopyRequests = TRUE;
 }
+#endif // OAM_DIRTY_TRACKING
 
 void UpdateOamCoords(void)
 {
@@ -365,6 +545,96 @@ void BuildSpritePriorities(void)
     }
 }
 
+#ifdef FAST_SPRITE_SORT
+// A sprite's sort key has its entry in gSpritePriorities in bits 9-18 and
+// its adjusted Y, flipped, in bits 0-8, so sorting the keys in ascending
+// order puts sprites in priority order and then from the bottom of the
+// screen up.
+#define SPRITE_SORT_KEY_BITS 19
+#define SPRITE_SORT_RADIX_BITS 7
+#define SPRITE_SORT_RADIX (1 << SPRITE_SORT_RADIX_BITS)
+
+static u32 GetSpriteSortKey(u8 spriteId)
+{
+    struct Sprite *sprite = &gSprites[spriteId];
+    s16 y = sprite->oam.y;
+
+    if (y >= DISPLAY_HEIGHT)
+        y = y - 256;
+
+    if (sprite->oam.affineMode == ST_OAM_AFFINE_DOUBLE
+     && sprite->oam.size == 3)
+    {
+        u32 shape = sprite->oam.shape;
+        if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
+        {
+            if (y > 128)
+                y = y - 256;
+        }
+    }
+
+    // y is now between -127 and DISPLAY_HEIGHT - 1.
+    return (gSpritePriorities[spriteId] << 9) | (DISPLAY_HEIGHT - 1 - y);
+}
+
+void SortSprites(void)
+{
+    u32 keys[MAX_SPRITES];
+    u32 sortedKeys[MAX_SPRITES];
+    u8 sortedOrder[MAX_SPRITES];
+    u8 offsets[SPRITE_SORT_RADIX];
+    u8 i;
+    u8 shift;
+    bool8 isSorted = TRUE;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        keys[i] = GetSpriteSortKey(gSpriteOrder[i]);
+        if (i > 0 && keys[i] < keys[i - 1])
+            isSorted = FALSE;
+    }
+
+    // gSpriteOrder is kept from one frame to the next, so it's often
+    // still in order.
+    if (isSorted)
+        return;
+
+    // Sprites with equal keys have to stay in the order they were in last
+    // frame, which the radix sort does because each pass is stable. All
+    // sprites are sorted, even unused ones, so that they're in the same
+    // place for that when they're shown again.
+    for (shift = 0; shift < SPRITE_SORT_KEY_BITS; shift += SPRITE_SORT_RADIX_BITS)
+    {
+        u8 total = 0;
+
+        for (i = 0; i < SPRITE_SORT_RADIX; i++)
+            offsets[i] = 0;
+
+        for (i = 0; i < MAX_SPRITES; i++)
+            offsets[(keys[i] >> shift) & (SPRITE_SORT_RADIX - 1)]++;
+
+        for (i = 0; i < SPRITE_SORT_RADIX; i++)
+        {
+            u8 count = offsets[i];
+            offsets[i] = total;
+            total += count;
+        }
+
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            u8 dest = offsets[(keys[i] >> shift) & (SPRITE_SORT_RADIX - 1)]++;
+            sortedKeys[dest] = keys[i];
+            sortedOrder[dest] = gSpriteOrder[i];
+        }
+
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            keys[i] = sortedKeys[i];
+            gSpriteOrder[i] = sortedOrder[i];
+        }
+    }
+}
+#else
 void SortSprites(void)
 {
     u8 i;
@@ -457,6 +727,7 @@ void SortSprites(void)
         }
     }
 }
+#endif // FAST_SPRITE_SORT
 
 void CopyMatricesToOamBuffer(void)
 {
@@ -471,6 +742,39 @@ void CopyMatricesToOamBuffer(void)
     }
 }
 
+#ifdef OAM_DIRTY_TRACKING
+// Also notes where each sprite's entries start, for
+// UpdateChangedSpritesInOamBuffer.
+void AddSpritesToOamBuffer(void)
+{
+    u8 i;
+    u8 oamIndex = 0;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+        sSpriteOamIndices[i] = OAM_INDEX_NONE;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        u8 spriteId = gSpriteOrder[i];
+        struct Sprite *sprite = &gSprites[spriteId];
+        if (sprite->inUse && !sprite->invisible)
+        {
+            if (oamIndex >= gOamLimit)
+                return;
+            sSpriteOamIndices[spriteId] = oamIndex;
+            gOamRebuiltSpriteCount++;
+            if (AddSpriteToOamBuffer(sprite, &oamIndex))
+                return;
+        }
+    }
+
+    while (oamIndex < gOamLimit)
+    {
+        gMain.oamBuffer[oamIndex] = gDummyOamData;
+        oamIndex++;
+    }
+}
+#else
 void AddSpritesToOamBuffer(void)
 {
     int i = 0;
@@ -490,6 +794,7 @@ void AddSpritesToOamBuffer(void)
         oamIndex++;
     }
 }
+#endif // OAM_DIRTY_TRACKING
 
 u8 CreateSprite(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority)
 {
@@ -631,6 +936,10 @@ void ResetOamRange(u8 a, u8 b)
         struct OamData *oamBuffer = gMain.oamBuffer;
         oamBuffer[i] = *(struct OamData *)&gDummyOamData;
     }
+
+#ifdef OAM_DIRTY_TRACKING
+    sOamBufferIsValid = FALSE;
+#endif
 }
 
 void LoadOam(void)
@@ -695,6 +1004,159 @@ void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMo
     sprite->centerToCornerVecY = y;
 }
 
+#ifdef FAST_SPRITE_TILE_ALLOC
+
+#define SPRITE_TILE_WORD_COUNT (TOTAL_OBJ_TILE_COUNT / 32)
+
+// Bit n of word n / 32 is tile n, the same bits as the byte macros above
+// since the GBA is little-endian.
+#define SPRITE_TILE_ALLOC_WORDS ((u32 *)gSpriteTileAllocBitmap)
+
+// Returns the first tile from the given one on that is allocated, if
+// allocated is TRUE, or free otherwise, or TOTAL_OBJ_TILE_COUNT if there are
+// none. Whole words of the other kind are skipped at once.
+static u16 FindNextSpriteTile(u16 tile, bool32 allocated)
+{
+    u32 flip = allocated ? 0 : 0xFFFFFFFF;
+    u32 wordIndex = tile / 32;
+    u32 word;
+
+    if (tile >= TOTAL_OBJ_TILE_COUNT)
+        return TOTAL_OBJ_TILE_COUNT;
+
+    word = (SPRITE_TILE_ALLOC_WORDS[wordIndex] ^ flip) & (0xFFFFFFFF << (tile % 32));
+
+    while (word == 0)
+    {
+        if (++wordIndex == SPRITE_TILE_WORD_COUNT)
+            return TOTAL_OBJ_TILE_COUNT;
+        word = SPRITE_TILE_ALLOC_WORDS[wordIndex] ^ flip;
+    }
+
+    return wordIndex * 32 + GetLowestSetBit(word);
+}
+
+static void SetSpriteTilesAllocated(u16 start, u16 count, bool32 allocated)
+{
+    u32 wordIndex = start / 32;
+    u32 bit = start % 32;
+
+    while (count != 0)
+    {
+        u32 bitCount = 32 - bit;
+        u32 mask;
+
+        if (bitCount > count)
+            bitCount = count;
+
+        mask = (0xFFFFFFFF >> (32 - bitCount)) << bit;
+
+        if (allocated)
+            SPRITE_TILE_ALLOC_WORDS[wordIndex] |= mask;
+        else
+            SPRITE_TILE_ALLOC_WORDS[wordIndex] &= ~mask;
+
+        count -= bitCount;
+        wordIndex++;
+        bit = 0;
+    }
+}
+
+s16 AllocSpriteTiles(u16 tileCount)
+{
+    u16 start;
+    s16 bestStart = -1;
+    u16 bestCount = TOTAL_OBJ_TILE_COUNT + 1;
+
+    if (tileCount == 0)
+    {
+        // Free all unreserved tiles if the tile count is 0.
+        if (gReservedSpriteTileCount < TOTAL_OBJ_TILE_COUNT)
+            SetSpriteTilesAllocated(gReservedSpriteTileCount, TOTAL_OBJ_TILE_COUNT - gReservedSpriteTileCount, FALSE);
+
+        return 0;
+    }
+
+    start = FindNextSpriteTile(gReservedSpriteTileCount, FALSE);
+
+    while (start < TOTAL_OBJ_TILE_COUNT)
+    {
+        u16 end = FindNextSpriteTile(start, TRUE);
+        u16 count = end - start;
+
+        if (count >= tileCount && count < bestCount)
+        {
+            bestStart = start;
+            bestCount = count;
+#ifndef SPRITE_TILE_ALLOC_BEST_FIT
+            break;
+#else
+            if (count == tileCount)
+                break;
+#endif
+        }
+
+        start = FindNextSpriteTile(end, FALSE);
+    }
+
+    if (bestStart < 0)
+    {
+#ifndef NDEBUG
+        DebugPrintf("Couldn't allocate %u sprite tiles", tileCount);
+        DebugPrintSpriteTileUsage();
+#endif
+        return -1;
+    }
+
+    SetSpriteTilesAllocated(bestStart, tileCount, TRUE);
+
+    return bestStart;
+}
+
+// Logs a map of the sprite tiles, with '#' for used and '.' for free tiles,
+// and how the free tiles are split up. If the largest free run is much
+// smaller than the free total, large sheets can fail to fit even though
+// there's room for them overall. Does nothing in NDEBUG builds, which have
+// nowhere to print to.
+void DebugPrintSpriteTileUsage(void)
+{
+#ifndef NDEBUG
+    u8 row[65];
+    u16 i;
+    u16 freeCount = 0;
+    u16 runCount = 0;
+    u16 largestRun = 0;
+    u16 start;
+
+    for (i = 0; i < TOTAL_OBJ_TILE_COUNT; i++)
+    {
+        row[i % 64] = SPRITE_TILE_IS_ALLOCATED(i) ? '#' : '.';
+        if (i % 64 == 63)
+        {
+            row[64] = '\0';
+            DebugPrintf("%3u %s", i - 63, row);
+        }
+    }
+
+    start = FindNextSpriteTile(gReservedSpriteTileCount, FALSE);
+
+    while (start < TOTAL_OBJ_TILE_COUNT)
+    {
+        u16 end = FindNextSpriteTile(start, TRUE);
+
+        freeCount += end - start;
+        runCount++;
+        if (end - start > largestRun)
+            largestRun = end - start;
+
+        start = FindNextSpriteTile(end, FALSE);
+    }
+
+    DebugPrintf("Sprite tiles: %u reserved, %u free in %u runs, largest run %u",
+                gReservedSpriteTileCount, freeCount, runCount, largestRun);
+#endif
+}
+#else
 s16 AllocSpriteTiles(u16 tileCount)
 {
     u16 i;
@@ -747,6 +1209,7 @@ s16 AllocSpriteTiles(u16 tileCount)
 
     return start;
 }
+#endif // FAST_SPRITE_TILE_ALLOC
 
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
 {
@@ -864,6 +1327,10 @@ void ResetAllSprites(void)
     }
 
     ResetSprite(&gSprites[i]);
+
+#ifdef OAM_DIRTY_TRACKING
+    sOamBufferIsValid = FALSE;
+#endif
 }
 
 void FreeSpriteTiles(struct Sprite *sprite)
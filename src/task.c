@@ -1,13 +1,37 @@
 #include "global.h"
 #include "task.h"
+#include "util.h"
 
 #define HEAD_SENTINEL 0xFE
 #define TAIL_SENTINEL 0xFF
 
 COMMON_DATA struct Task gTasks[NUM_TASKS] = {0};
 
+#ifdef FAST_TASK_SCHEDULER
+
+#define NUM_TASK_PRIORITIES 256
+
+STATIC_ASSERT(NUM_TASKS <= 32, TooManyTasksForActiveMask);
+
+#define ALL_TASKS_MASK ((1u << (NUM_TASKS - 1) << 1) - 1)
+
+// The list of active tasks, kept up to date as tasks are created and
+// destroyed so that nothing has to search gTasks: the slots in use (bit n
+// set if gTasks[n] is active), the task that runs first if any are, the
+// priorities that have any tasks and the task of each priority that runs
+// last. All zeroes is an empty list, as it is for gTasks.
+static u32 sActiveTasks;
+static u8 sHeadTaskId;
+static u32 sActivePriorities[NUM_TASK_PRIORITIES / 32];
+static EWRAM_DATA u8 sPriorityTails[NUM_TASK_PRIORITIES] = {0};
+
+static u8 FindLastTaskUpToPriority(u8 priority);
+#endif // FAST_TASK_SCHEDULER
+
 static void InsertTask(u8 newTaskId);
+#ifndef FAST_TASK_SCHEDULER
 static u8 FindFirstActiveTask();
+#endif // FAST_TASK_SCHEDULER
 
 void ResetTasks(void)
 {
@@ -25,8 +49,68 @@ void ResetTasks(void)
 
     gTasks[0].prev = HEAD_SENTINEL;
     gTasks[NUM_TASKS - 1].next = TAIL_SENTINEL;
+
+#ifdef FAST_TASK_SCHEDULER
+    sActiveTasks = 0;
+    for (i = 0; i < ARRAY_COUNT(sActivePriorities); i++)
+        sActivePriorities[i] = 0;
+#endif // FAST_TASK_SCHEDULER
 }
 
+#ifdef FAST_TASK_SCHEDULER
+// Takes the lowest free slot, as the search through gTasks did.
+u8 CreateTask(TaskFunc func, u8 priority)
+{
+    u8 i;
+
+    if (sActiveTasks == ALL_TASKS_MASK)
+        return 0;
+
+    i = GetLowestSetBit(~sActiveTasks & ALL_TASKS_MASK);
+    gTasks[i].func = func;
+    gTasks[i].priority = priority;
+    InsertTask(i);
+    memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    gTasks[i].isActive = TRUE;
+    sActiveTasks |= 1u << i;
+    return i;
+}
+
+// Links the task in after the last task with the same or a lower priority
+// value, which is before the first task with a higher one.
+static void InsertTask(u8 newTaskId)
+{
+    u8 priority = gTasks[newTaskId].priority;
+    u8 taskId = FindLastTaskUpToPriority(priority);
+
+    if (taskId == NUM_TASKS)
+    {
+        // The new task runs first.
+        gTasks[newTaskId].prev = HEAD_SENTINEL;
+        if (sActiveTasks == 0)
+        {
+            gTasks[newTaskId].next = TAIL_SENTINEL;
+        }
+        else
+        {
+            gTasks[newTaskId].next = sHeadTaskId;
+            gTasks[sHeadTaskId].prev = newTaskId;
+        }
+        sHeadTaskId = newTaskId;
+    }
+    else
+    {
+        gTasks[newTaskId].prev = taskId;
+        gTasks[newTaskId].next = gTasks[taskId].next;
+        if (gTasks[taskId].next != TAIL_SENTINEL)
+            gTasks[gTasks[taskId].next].prev = newTaskId;
+        gTasks[taskId].next = newTaskId;
+    }
+
+    sPriorityTails[priority] = newTaskId;
+    sActivePriorities[priority / 32] |= 1u << (priority % 32);
+}
+#else
 u8 CreateTask(TaskFunc func, u8 priority)
 {
     u8 i;
@@ -84,6 +168,8 @@ static void InsertTask(u8 newTaskId)
     }
 }
 
+#endif // FAST_TASK_SCHEDULER
+
 void DestroyTask(u8 taskId)
 {
     if (gTasks[taskId].isActive)
@@ -107,12 +193,34 @@ void DestroyTask(u8 taskId)
                 gTasks[gTasks[taskId].next].prev = gTasks[taskId].prev;
             }
         }
+
+#ifdef FAST_TASK_SCHEDULER
+        if (sHeadTaskId == taskId)
+            sHeadTaskId = gTasks[taskId].next;
+
+        if (sPriorityTails[gTasks[taskId].priority] == taskId)
+        {
+            u8 priority = gTasks[taskId].priority;
+            u8 prev = gTasks[taskId].prev;
+
+            if (prev != HEAD_SENTINEL && gTasks[prev].priority == priority)
+                sPriorityTails[priority] = prev;
+            else
+                sActivePriorities[priority / 32] &= ~(1u << (priority % 32));
+        }
+
+        sActiveTasks &= ~(1u << taskId);
+#endif // FAST_TASK_SCHEDULER
     }
 }
 
 void RunTasks(void)
 {
+#ifdef FAST_TASK_SCHEDULER
+    u8 taskId = sActiveTasks != 0 ? sHeadTaskId : NUM_TASKS;
+#else
     u8 taskId = FindFirstActiveTask();
+#endif // FAST_TASK_SCHEDULER
 
     if (taskId != NUM_TASKS)
     {
@@ -124,6 +232,24 @@ void RunTasks(void)
     }
 }
 
+#ifdef FAST_TASK_SCHEDULER
+// Returns the task that runs last among those with a priority value no
+// higher than the given one, or NUM_TASKS if there are none.
+static u8 FindLastTaskUpToPriority(u8 priority)
+{
+    s32 word = priority / 32;
+    u32 mask = sActivePriorities[word] & (0xFFFFFFFFu >> (31 - priority % 32));
+
+    while (mask == 0)
+    {
+        if (--word < 0)
+            return NUM_TASKS;
+        mask = sActivePriorities[word];
+    }
+
+    return sPriorityTails[word * 32 + GetHighestSetBit(mask)];
+}
+#else
 static u8 FindFirstActiveTask()
 {
     u8 taskId;
@@ -135,6 +261,8 @@ static u8 FindFirstActiveTask()
     return taskId;
 }
 
+#endif // FAST_TASK_SCHEDULER
+
 void TaskDummy(u8 taskId)
 {
 }
@@ -205,3 +333,89 @@ u32 GetWordTaskArg(u8 taskId, u8 dataElem)
     else
         return 0;
 }
+
+#ifdef TASK_SCHEDULER_BENCHMARK
+#include "main.h"
+
+#define BENCHMARK_FRAMES 60
+
+enum {
+    BENCHMARK_CREATE,
+    BENCHMARK_RUN,
+    BENCHMARK_DESTROY,
+    BENCHMARK_STEP_COUNT
+};
+
+STATIC_ASSERT(NUM_TASKS % 5 != 0, BenchmarkDestroyOrderMustVisitEveryTask);
+
+static u32 sBenchmarkCycles[BENCHMARK_STEP_COUNT];
+static u16 sBenchmarkFrames;
+
+static void Task_BenchmarkDummy(u8 taskId)
+{
+    gTasks[taskId].data[0]++;
+}
+
+// Timer 2 counts CPU cycles and overflows into timer 3, together making a
+// 32-bit cycle counter.
+static void StartCycleCounter(void)
+{
+    REG_TM2CNT_H = 0;
+    REG_TM3CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM3CNT_L = 0;
+    REG_TM3CNT_H = TIMER_ENABLE | TIMER_COUNTUP;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_1CLK;
+}
+
+static u32 StopCycleCounter(void)
+{
+    REG_TM2CNT_H = 0;
+    REG_TM3CNT_H = 0;
+    return REG_TM2CNT_L | (REG_TM3CNT_L << 16);
+}
+
+// Each frame, fills gTasks with tasks of a handful of priorities, runs them
+// once and destroys them in a scattered order, timing each step. The average
+// cycles per frame are logged every BENCHMARK_FRAMES frames. The scene owns
+// gTasks, so nothing else can have tasks while it runs.
+void CB2_TaskSchedulerBenchmark(void)
+{
+    u8 taskIds[NUM_TASKS];
+    u8 i;
+
+    if (gMain.state == 0)
+    {
+        ResetTasks();
+        for (i = 0; i < BENCHMARK_STEP_COUNT; i++)
+            sBenchmarkCycles[i] = 0;
+        sBenchmarkFrames = 0;
+        gMain.state++;
+    }
+
+    StartCycleCounter();
+    for (i = 0; i < NUM_TASKS; i++)
+        taskIds[i] = CreateTask(Task_BenchmarkDummy, (i * 7) % 5);
+    sBenchmarkCycles[BENCHMARK_CREATE] += StopCycleCounter();
+
+    StartCycleCounter();
+    RunTasks();
+    sBenchmarkCycles[BENCHMARK_RUN] += StopCycleCounter();
+
+    StartCycleCounter();
+    for (i = 0; i < NUM_TASKS; i++)
+        DestroyTask(taskIds[(i * 5) % NUM_TASKS]);
+    sBenchmarkCycles[BENCHMARK_DESTROY] += StopCycleCounter();
+
+    if (++sBenchmarkFrames == BENCHMARK_FRAMES)
+    {
+        DebugPrintf("Tasks: create %u, run %u, destroy %u cycles/frame",
+                    sBenchmarkCycles[BENCHMARK_CREATE] / BENCHMARK_FRAMES,
+                    sBenchmarkCycles[BENCHMARK_RUN] / BENCHMARK_FRAMES,
+                    sBenchmarkCycles[BENCHMARK_DESTROY] / BENCHMARK_FRAMES);
+        for (i = 0; i < BENCHMARK_STEP_COUNT; i++)
+            sBenchmarkCycles[i] = 0;
+        sBenchmarkFrames = 0;
+    }
+}
+#endif // TASK_SCHEDULER_BENCHMARK
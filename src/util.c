@@ -228,6 +228,33 @@ int CountTrailingZeroBits(u32 value)
     return 0;
 }
 
+#ifdef FAST_BIT_SCAN
+// Indexed by the top 5 bits of a De Bruijn sequence shifted by the bit's index.
+static const u8 sDeBruijnBitIndices[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
+
+// The ARM7TDMI has no count leading zeros instruction, so these take a
+// multiply and a table lookup instead of looping over the bits like
+// CountTrailingZeroBits. The mask must not be 0.
+u8 GetLowestSetBit(u32 mask)
+{
+    return sDeBruijnBitIndices[((mask & -mask) * 0x077CB531u) >> 27];
+}
+
+u8 GetHighestSetBit(u32 mask)
+{
+    mask |= mask >> 1;
+    mask |= mask >> 2;
+    mask |= mask >> 4;
+    mask |= mask >> 8;
+    mask |= mask >> 16;
+    return sDeBruijnBitIndices[((mask ^ (mask >> 1)) * 0x077CB531u) >> 27];
+}
+#endif // FAST_BIT_SCAN
+
 u16 CalcCRC16(const u8 *data, u32 length)
 {
     u16 i, j;
@@ -0,0 +1,281 @@
+// assetcache runs an asset conversion tool (gbagfx, wav2agb, mid2agb, ...)
+// through a content-addressed cache, in the style of ccache:
+//
+//     assetcache -o 2 tools/gbagfx/gbagfx graphics/foo.png graphics/foo.4bpp
+//
+// The key is a hash of the tool executable, every argument, and the contents
+// of every argument that names an existing file, except for the output (the
+// N-th argument after the tool, or counted from the end if N is negative).
+// On a hit the output is copied out of the cache instead of running the tool.
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "assetcache.h"
+#include "sha1.h"
+
+static const char *const USAGE =
+    "Usage: assetcache -o OUTPUT_ARG TOOL [ARGS...]\n"
+    "       assetcache --cache-stats\n"
+    "       assetcache --zero-stats\n"
+    "\n"
+    "OUTPUT_ARG is the position of the output path among ARGS, starting at 1.\n"
+    "Negative positions count from the end (-1 is the last argument).\n"
+    "The cache lives in $ASSET_CACHE_DIR, or .assetcache if that isn't set.\n";
+
+static std::string CacheDir()
+{
+    const char *dir = std::getenv("ASSET_CACHE_DIR");
+    return (dir != nullptr && *dir != 0) ? dir : ".assetcache";
+}
+
+static bool IsRegularFile(const std::string& path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+static bool ReadWholeFile(const std::string& path, std::string& contents)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == nullptr)
+        return false;
+
+    std::fseek(fp, 0, SEEK_END);
+    long size = std::ftell(fp);
+    std::rewind(fp);
+
+    contents.resize(size);
+
+    bool ok = size == 0 || std::fread(&contents[0], size, 1, fp) == 1;
+    std::fclose(fp);
+    return ok;
+}
+
+static void WriteWholeFile(const std::string& path, const char *data, std::size_t size)
+{
+    FILE *fp = std::fopen(path.c_str(), "wb");
+
+    if (fp == nullptr)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path.c_str());
+
+    if (size > 0 && std::fwrite(data, size, 1, fp) != 1)
+        FATAL_ERROR("Failed to write to \"%s\".\n", path.c_str());
+
+    std::fclose(fp);
+}
+
+static void MakeDirectory(const std::string& path)
+{
+    if (mkdir(path.c_str(), 0777) != 0 && errno != EEXIST)
+        FATAL_ERROR("Failed to create directory \"%s\".\n", path.c_str());
+}
+
+static void AppendStat(const char *kind, long long nanoseconds)
+{
+    MakeDirectory(CacheDir());
+
+    // Lines are short enough for O_APPEND writes from parallel jobs not to interleave.
+    FILE *fp = std::fopen((CacheDir() + "/stats").c_str(), "a");
+
+    if (fp == nullptr)
+        return;
+
+    std::fprintf(fp, "%s %lld\n", kind, nanoseconds);
+    std::fclose(fp);
+}
+
+static std::string ComputeKey(const std::string& tool, const std::vector<std::string>& args, std::size_t outputIndex)
+{
+    Sha1 sha1;
+    std::string contents;
+
+    sha1.Update("assetcache " + std::to_string(kCacheFormatVersion) + '\0');
+
+    if (!ReadWholeFile(tool, contents))
+        FATAL_ERROR("Failed to read tool \"%s\".\n", tool.c_str());
+
+    sha1.Update(contents);
+
+    for (std::size_t i = 0; i < args.size(); i++)
+    {
+        sha1.Update(args[i] + '\0');
+
+        if (i != outputIndex && IsRegularFile(args[i]))
+        {
+            if (!ReadWholeFile(args[i], contents))
+                FATAL_ERROR("Failed to read \"%s\".\n", args[i].c_str());
+
+            sha1.Update(std::to_string(contents.size()) + '\0');
+            sha1.Update(contents);
+        }
+    }
+
+    return sha1.HexDigest();
+}
+
+static int RunTool(const std::string& tool, const std::vector<std::string>& args)
+{
+    std::vector<char *> argv;
+
+    argv.push_back(const_cast<char *>(tool.c_str()));
+
+    for (const std::string& arg : args)
+        argv.push_back(const_cast<char *>(arg.c_str()));
+
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+
+    if (pid < 0)
+        FATAL_ERROR("Failed to start \"%s\".\n", tool.c_str());
+
+    if (pid == 0)
+    {
+        execvp(argv[0], argv.data());
+        std::fprintf(stderr, "Failed to run \"%s\": %s\n", tool.c_str(), std::strerror(errno));
+        _exit(127);
+    }
+
+    int status;
+
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+            FATAL_ERROR("Failed to wait for \"%s\".\n", tool.c_str());
+    }
+
+    if (WIFEXITED(status))
+        return WEXITSTATUS(status);
+
+    return 1;
+}
+
+static int RunCached(const std::string& tool, const std::vector<std::string>& args, std::size_t outputIndex)
+{
+    const std::string& outputPath = args[outputIndex];
+    std::string key = ComputeKey(tool, args, outputIndex);
+    std::string entryDir = CacheDir() + "/" + key.substr(0, 2);
+    std::string entryPath = entryDir + "/" + key.substr(2);
+    std::string entry;
+
+    // An entry is the time the conversion originally took on its own line,
+    // followed by the output file's contents.
+    if (ReadWholeFile(entryPath, entry))
+    {
+        std::size_t newline = entry.find('\n');
+
+        if (newline != std::string::npos)
+        {
+            WriteWholeFile(outputPath, entry.data() + newline + 1, entry.size() - newline - 1);
+            AppendStat("hit", std::atoll(entry.c_str()));
+            return 0;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    int status = RunTool(tool, args);
+    auto end = std::chrono::steady_clock::now();
+
+    if (status != 0)
+        return status;
+
+    long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::string output;
+
+    if (!ReadWholeFile(outputPath, output))
+        FATAL_ERROR("\"%s\" did not produce \"%s\".\n", tool.c_str(), outputPath.c_str());
+
+    entry = std::to_string(nanoseconds) + '\n' + output;
+
+    // Write under a temporary name first so parallel jobs never see a partial entry.
+    MakeDirectory(CacheDir());
+    MakeDirectory(entryDir);
+    std::string tempPath = entryPath + ".tmp" + std::to_string(getpid());
+    WriteWholeFile(tempPath, entry.data(), entry.size());
+
+    if (std::rename(tempPath.c_str(), entryPath.c_str()) != 0)
+        std::remove(tempPath.c_str());
+
+    AppendStat("miss", nanoseconds);
+    return 0;
+}
+
+static void PrintStats()
+{
+    FILE *fp = std::fopen((CacheDir() + "/stats").c_str(), "r");
+    long long hits = 0;
+    long long misses = 0;
+    long long savedNanoseconds = 0;
+    long long spentNanoseconds = 0;
+
+    if (fp != nullptr)
+    {
+        char kind[16];
+        long long nanoseconds;
+
+        while (std::fscanf(fp, "%15s %lld", kind, &nanoseconds) == 2)
+        {
+            if (std::strcmp(kind, "hit") == 0)
+            {
+                hits++;
+                savedNanoseconds += nanoseconds;
+            }
+            else
+            {
+                misses++;
+                spentNanoseconds += nanoseconds;
+            }
+        }
+
+        std::fclose(fp);
+    }
+
+    long long lookups = hits + misses;
+
+    std::printf("cache directory:  %s\n", CacheDir().c_str());
+    std::printf("lookups:          %lld\n", lookups);
+    std::printf("hits:             %lld\n", hits);
+    std::printf("misses:           %lld\n", misses);
+    std::printf("hit rate:         %.1f%%\n", lookups > 0 ? 100.0 * hits / lookups : 0.0);
+    std::printf("time converting:  %.2fs\n", spentNanoseconds / 1e9);
+    std::printf("time saved:       %.2fs\n", savedNanoseconds / 1e9);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 2 && std::strcmp(argv[1], "--cache-stats") == 0)
+    {
+        PrintStats();
+        return 0;
+    }
+
+    if (argc == 2 && std::strcmp(argv[1], "--zero-stats") == 0)
+    {
+        std::remove((CacheDir() + "/stats").c_str());
+        return 0;
+    }
+
+    if (argc < 4 || std::strcmp(argv[1], "-o") != 0)
+        FATAL_ERROR("%s", USAGE);
+
+    char *end;
+    long outputArg = std::strtol(argv[2], &end, 10);
+    std::string tool = argv[3];
+    std::vector<std::string> args(argv + 4, argv + argc);
+
+    if (*end != 0 || outputArg == 0 || outputArg > (long)args.size() || -outputArg > (long)args.size())
+        FATAL_ERROR("Output argument position \"%s\" is out of range.\n", argv[2]);
+
+    std::size_t outputIndex = outputArg > 0 ? outputArg - 1 : args.size() + outputArg;
+
+    return RunCached(tool, args, outputIndex);
+}
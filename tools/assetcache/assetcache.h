@@ -0,0 +1,30 @@
+#ifndef ASSETCACHE_H
+#define ASSETCACHE_H
+
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef _MSC_VER
+
+#define FATAL_ERROR(format, ...)               \
+do                                             \
+{                                              \
+    std::fprintf(stderr, format, __VA_ARGS__); \
+    std::exit(1);                              \
+} while (0)
+
+#else
+
+#define FATAL_ERROR(format, ...)                 \
+do                                               \
+{                                                \
+    std::fprintf(stderr, format, ##__VA_ARGS__); \
+    std::exit(1);                                \
+} while (0)
+
+#endif // _MSC_VER
+
+// Bump this to invalidate every existing cache entry.
+const int kCacheFormatVersion = 1;
+
+#endif // ASSETCACHE_H
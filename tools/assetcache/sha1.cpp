@@ -0,0 +1,118 @@
+#include <cstdio>
+#include <cstring>
+#include "sha1.h"
+
+static inline std::uint32_t Rotl(std::uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+Sha1::Sha1() : m_blockSize(0), m_totalSize(0)
+{
+    m_state[0] = 0x67452301;
+    m_state[1] = 0xEFCDAB89;
+    m_state[2] = 0x98BADCFE;
+    m_state[3] = 0x10325476;
+    m_state[4] = 0xC3D2E1F0;
+}
+
+void Sha1::ProcessBlock(const unsigned char *block)
+{
+    std::uint32_t w[80];
+
+    for (int i = 0; i < 16; i++)
+        w[i] = (block[i * 4] << 24) | (block[i * 4 + 1] << 16) | (block[i * 4 + 2] << 8) | block[i * 4 + 3];
+
+    for (int i = 16; i < 80; i++)
+        w[i] = Rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+    std::uint32_t a = m_state[0];
+    std::uint32_t b = m_state[1];
+    std::uint32_t c = m_state[2];
+    std::uint32_t d = m_state[3];
+    std::uint32_t e = m_state[4];
+
+    for (int i = 0; i < 80; i++)
+    {
+        std::uint32_t f, k;
+
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+
+        std::uint32_t temp = Rotl(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = Rotl(b, 30);
+        b = a;
+        a = temp;
+    }
+
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+}
+
+void Sha1::Update(const void *data, std::size_t size)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+
+    m_totalSize += size;
+
+    while (size > 0)
+    {
+        std::size_t n = 64 - m_blockSize;
+
+        if (n > size)
+            n = size;
+
+        std::memcpy(&m_block[m_blockSize], bytes, n);
+        m_blockSize += n;
+        bytes += n;
+        size -= n;
+
+        if (m_blockSize == 64)
+        {
+            ProcessBlock(m_block);
+            m_blockSize = 0;
+        }
+    }
+}
+
+std::string Sha1::HexDigest()
+{
+    std::uint64_t totalBits = m_totalSize * 8;
+    unsigned char padding[72] = { 0x80 };
+    std::size_t paddingSize = (m_blockSize < 56 ? 56 : 120) - m_blockSize;
+
+    for (int i = 0; i < 8; i++)
+        padding[paddingSize + i] = static_cast<unsigned char>(totalBits >> (56 - i * 8));
+
+    Update(padding, paddingSize + 8);
+
+    char hex[41];
+
+    for (int i = 0; i < 5; i++)
+        std::snprintf(&hex[i * 8], 9, "%08x", m_state[i]);
+
+    return std::string(hex, 40);
+}
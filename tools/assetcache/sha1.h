@@ -0,0 +1,25 @@
+#ifndef SHA1_H
+#define SHA1_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+class Sha1
+{
+public:
+    Sha1();
+    void Update(const void *data, std::size_t size);
+    void Update(const std::string& s) { Update(s.data(), s.size()); }
+    std::string HexDigest();
+
+private:
+    void ProcessBlock(const unsigned char *block);
+
+    std::uint32_t m_state[5];
+    unsigned char m_block[64];
+    std::size_t m_blockSize;
+    std::uint64_t m_totalSize;
+};
+
+#endif // SHA1_H
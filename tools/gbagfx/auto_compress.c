@@ -0,0 +1,196 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "global.h"
+#include "lz.h"
+#include "rl.h"
+#include "huff.h"
+#include "auto_compress.h"
+
+static const char *const sCodecNames[NUM_CODECS] = {
+	[CODEC_LZ] = "lz",
+	[CODEC_RL] = "rl",
+	[CODEC_HUFF4] = "huff4",
+	[CODEC_HUFF8] = "huff8",
+	[CODEC_LZ_HUFF4] = "lz+huff4",
+	[CODEC_LZ_HUFF8] = "lz+huff8",
+};
+
+// Rough cycle costs of the BIOS decompressors for each byte they write and
+// each byte they read, with both buffers in WRAM. They only need to rank the
+// codecs sensibly: RL is little more than a copy loop, LZ adds a flag bit per
+// token and its block copies, and Huff walks the tree one bit at a time.
+struct DecodeCost {
+	int perOutputByte;
+	int perInputByte;
+};
+
+static const struct DecodeCost sLZCost = { 12, 8 };
+static const struct DecodeCost sRLCost = { 6, 6 };
+static const struct DecodeCost sHuffCost = { 8, 140 };
+
+static long EstimateCycles(struct DecodeCost cost, int outputSize, int inputSize)
+{
+	return (long)cost.perOutputByte * outputSize + (long)cost.perInputByte * inputSize;
+}
+
+struct AutoCompressJob {
+	unsigned char *src;
+	int srcSize;
+	struct AutoCompressResult *result;
+	const enum Codec *codecs;
+	int numCodecs;
+	atomic_int nextCodec;
+};
+
+const char *GetCodecName(enum Codec codec)
+{
+	return sCodecNames[codec];
+}
+
+// Decompresses a candidate and fails if it doesn't give back the original.
+static void VerifyCandidate(enum Codec codec, unsigned char *data, int size, unsigned char *expected, int expectedSize)
+{
+	int decodedSize;
+	unsigned char *decoded;
+
+	if (codec == CODEC_LZ)
+		decoded = LZDecompress(data, size, &decodedSize);
+	else if (codec == CODEC_RL)
+		decoded = RLDecompress(data, size, &decodedSize);
+	else
+		decoded = HuffDecompress(data, size, &decodedSize);
+
+	if (decodedSize != expectedSize || memcmp(decoded, expected, expectedSize) != 0)
+		FATAL_ERROR("Compressing with %s doesn't round-trip.\n", GetCodecName(codec));
+
+	free(decoded);
+}
+
+static void CompressCandidate(struct AutoCompressJob *job, enum Codec codec)
+{
+	struct CodecCandidate *candidate = &job->result->candidates[codec];
+	struct CodecCandidate *lz = &job->result->candidates[CODEC_LZ];
+	unsigned char *src = job->src;
+	int srcSize = job->srcSize;
+
+	switch (codec) {
+	case CODEC_LZ:
+		// A minimum distance of 2 keeps the data safe for LZ77UnCompVram.
+		candidate->data = LZCompressOptimal(src, srcSize, &candidate->size, 2);
+		candidate->decodeCycles = EstimateCycles(sLZCost, srcSize, candidate->size);
+		break;
+	case CODEC_RL:
+		candidate->data = RLCompress(src, srcSize, &candidate->size);
+		candidate->decodeCycles = EstimateCycles(sRLCost, srcSize, candidate->size);
+		break;
+	case CODEC_HUFF4:
+	case CODEC_HUFF8:
+		candidate->data = HuffTryCompress(src, srcSize, &candidate->size, codec == CODEC_HUFF4 ? 4 : 8);
+		candidate->decodeCycles = EstimateCycles(sHuffCost, srcSize, candidate->size);
+		break;
+	case CODEC_LZ_HUFF4:
+	case CODEC_LZ_HUFF8:
+		// The LZ stream is coded again, so it's what has to round-trip.
+		src = lz->data;
+		srcSize = lz->size;
+		candidate->data = HuffTryCompress(src, srcSize, &candidate->size, codec == CODEC_LZ_HUFF4 ? 4 : 8);
+		candidate->decodeCycles = EstimateCycles(sHuffCost, srcSize, candidate->size) + lz->decodeCycles;
+		break;
+	default:
+		FATAL_ERROR("Unknown codec %d.\n", codec);
+	}
+
+	candidate->available = candidate->data != NULL;
+
+	if (candidate->available)
+		VerifyCandidate(codec, candidate->data, candidate->size, src, srcSize);
+}
+
+static void *AutoCompressWorker(void *arg)
+{
+	struct AutoCompressJob *job = arg;
+	int i;
+
+	while ((i = job->nextCodec++) < job->numCodecs)
+		CompressCandidate(job, job->codecs[i]);
+
+	return NULL;
+}
+
+static void RunCodecs(struct AutoCompressJob *job, const enum Codec *codecs, int numCodecs, int numThreads)
+{
+	job->codecs = codecs;
+	job->numCodecs = numCodecs;
+	job->nextCodec = 0;
+
+	if (numThreads > numCodecs)
+		numThreads = numCodecs;
+
+	pthread_t threads[NUM_CODECS];
+
+	for (int i = 1; i < numThreads; i++) {
+		if (pthread_create(&threads[i], NULL, AutoCompressWorker, job) != 0)
+			FATAL_ERROR("Failed to create compression thread.\n");
+	}
+
+	AutoCompressWorker(job);
+
+	for (int i = 1; i < numThreads; i++)
+		pthread_join(threads[i], NULL);
+}
+
+// Whether a is a better choice than b under the policy. Ties on the policy's
+// own measure are broken by the other one.
+static bool IsBetter(const struct CodecCandidate *a, const struct CodecCandidate *b, enum CodecPolicy policy)
+{
+	if (policy == CODEC_POLICY_SPEED && a->decodeCycles != b->decodeCycles)
+		return a->decodeCycles < b->decodeCycles;
+	if (a->size != b->size)
+		return a->size < b->size;
+	return a->decodeCycles < b->decodeCycles;
+}
+
+void AutoCompress(unsigned char *src, int srcSize, enum CodecPolicy policy, int numThreads, struct AutoCompressResult *result)
+{
+	// The combined codecs need the LZ stream, so they run once it's done.
+	static const enum Codec firstPass[] = { CODEC_LZ, CODEC_RL, CODEC_HUFF4, CODEC_HUFF8 };
+	static const enum Codec secondPass[] = { CODEC_LZ_HUFF4, CODEC_LZ_HUFF8 };
+
+	if (srcSize <= 0)
+		FATAL_ERROR("Cannot compress empty data.\n");
+
+	if (numThreads < 1) {
+		long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+		numThreads = numCpus > 0 ? (int)numCpus : 1;
+	}
+
+	memset(result, 0, sizeof(*result));
+
+	struct AutoCompressJob job;
+	job.src = src;
+	job.srcSize = srcSize;
+	job.result = result;
+
+	RunCodecs(&job, firstPass, sizeof(firstPass) / sizeof(firstPass[0]), numThreads);
+	RunCodecs(&job, secondPass, sizeof(secondPass) / sizeof(secondPass[0]), numThreads);
+
+	// LZ and RL can encode anything, so there's always a choice.
+	result->chosen = CODEC_LZ;
+
+	for (int i = 0; i < NUM_CODECS; i++) {
+		if (result->candidates[i].available && IsBetter(&result->candidates[i], &result->candidates[result->chosen], policy))
+			result->chosen = i;
+	}
+
+	for (int i = 0; i < NUM_CODECS; i++) {
+		if (i != (int)result->chosen) {
+			free(result->candidates[i].data);
+			result->candidates[i].data = NULL;
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#ifndef AUTO_COMPRESS_H
+#define AUTO_COMPRESS_H
+
+#include <stdbool.h>
+
+enum Codec {
+	CODEC_LZ,
+	CODEC_RL,
+	CODEC_HUFF4,
+	CODEC_HUFF8,
+	CODEC_LZ_HUFF4,
+	CODEC_LZ_HUFF8,
+	NUM_CODECS,
+};
+
+enum CodecPolicy {
+	CODEC_POLICY_SIZE,  // smallest output
+	CODEC_POLICY_SPEED, // least estimated time to decompress
+};
+
+struct CodecCandidate {
+	bool available;
+	unsigned char *data;
+	int size;
+	long decodeCycles;
+};
+
+struct AutoCompressResult {
+	enum Codec chosen;
+	struct CodecCandidate candidates[NUM_CODECS];
+};
+
+const char *GetCodecName(enum Codec codec);
+
+// Compresses the data with every codec the GBA's BIOS can decompress, on up
+// to numThreads threads (0 for one per CPU), checks that each one
+// decompresses back to the input and chooses one according to the policy.
+// The LZ+Huff codecs are an LZ stream that's then Huffman-coded, which is
+// decompressed by running the BIOS's HuffUnComp and then LZ77UnComp.
+// Only the chosen candidate's data is kept.
+void AutoCompress(unsigned char *src, int srcSize, enum CodecPolicy policy, int numThreads, struct AutoCompressResult *result);
+
+#endif // AUTO_COMPRESS_H
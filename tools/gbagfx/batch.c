@@ -0,0 +1,254 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "global.h"
+#include "util.h"
+#include "batch.h"
+
+// A batch manifest has one conversion per line, written exactly like the
+// arguments of a normal gbagfx invocation:
+//
+//     graphics/foo/bar.png graphics/foo/bar.4bpp -mwidth 2 -mheight 2
+//     graphics/foo/bar.4bpp graphics/foo/bar.4bpp.lz
+//
+// Blank lines and lines starting with '#' are ignored. A job whose input is
+// the output of another job in the manifest runs after that job; everything
+// else runs in parallel. Jobs whose input doesn't exist are skipped and counted,
+// so a manifest can list every graphic the sources refer to without failing on
+// ones that aren't built this way.
+
+atomic_int gNumOptimalLzFiles;
+atomic_int gOptimalLzBytesSaved;
+
+struct BatchJob {
+	int argc;
+	char **argv;
+	int level;
+};
+
+struct Batch {
+	struct BatchJob *jobs;
+	int numJobs;
+	int level;
+	ConvertFunc convert;
+	atomic_int nextJob;
+	atomic_int numSkipped;
+};
+
+static bool FileExists(char *path)
+{
+	FILE *fp = fopen(path, "rb");
+
+	if (fp == NULL)
+		return false;
+
+	fclose(fp);
+	return true;
+}
+
+static char *NextToken(char **cursor)
+{
+	char *s = *cursor;
+
+	while (*s == ' ' || *s == '\t')
+		s++;
+
+	if (*s == 0)
+		return NULL;
+
+	char *token = s;
+
+	while (*s != 0 && *s != ' ' && *s != '\t')
+		s++;
+
+	if (*s != 0)
+		*s++ = 0;
+
+	*cursor = s;
+	return token;
+}
+
+static void ParseManifest(char *text, struct Batch *batch)
+{
+	int capacity = 256;
+	batch->jobs = malloc(capacity * sizeof(struct BatchJob));
+	batch->numJobs = 0;
+
+	if (batch->jobs == NULL)
+		FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+	char *line = text;
+
+	while (line != NULL && *line != 0) {
+		char *next = strpbrk(line, "\r\n");
+
+		if (next != NULL) {
+			while (*next == '\r' || *next == '\n')
+				*next++ = 0;
+		}
+
+		char *cursor = line;
+		char *token = NextToken(&cursor);
+
+		if (token != NULL && token[0] != '#') {
+			struct BatchJob job;
+			int argvCapacity = 8;
+
+			job.argv = malloc(argvCapacity * sizeof(char *));
+
+			if (job.argv == NULL)
+				FATAL_ERROR("Failed to allocate memory for batch job arguments.\n");
+
+			job.argv[0] = "gbagfx";
+			job.argc = 1;
+			job.level = 0;
+
+			for (; token != NULL; token = NextToken(&cursor)) {
+				if (job.argc + 1 >= argvCapacity) {
+					argvCapacity *= 2;
+					job.argv = realloc(job.argv, argvCapacity * sizeof(char *));
+
+					if (job.argv == NULL)
+						FATAL_ERROR("Failed to allocate memory for batch job arguments.\n");
+				}
+
+				job.argv[job.argc++] = token;
+			}
+
+			job.argv[job.argc] = NULL;
+
+			if (job.argc < 3)
+				FATAL_ERROR("Batch job \"%s\" has no output path.\n", job.argv[1]);
+
+			if (batch->numJobs == capacity) {
+				capacity *= 2;
+				batch->jobs = realloc(batch->jobs, capacity * sizeof(struct BatchJob));
+
+				if (batch->jobs == NULL)
+					FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+			}
+
+			batch->jobs[batch->numJobs++] = job;
+		}
+
+		line = next;
+	}
+}
+
+// Puts each job one level after the last earlier job that produces its input.
+static int AssignLevels(struct Batch *batch)
+{
+	int maxLevel = 0;
+
+	for (int i = 0; i < batch->numJobs; i++) {
+		struct BatchJob *job = &batch->jobs[i];
+
+		for (int j = 0; j < i; j++) {
+			struct BatchJob *producer = &batch->jobs[j];
+
+			if (producer->level >= job->level && strcmp(producer->argv[2], job->argv[1]) == 0)
+				job->level = producer->level + 1;
+		}
+
+		if (job->level > maxLevel)
+			maxLevel = job->level;
+	}
+
+	return maxLevel;
+}
+
+static void *BatchWorker(void *arg)
+{
+	struct Batch *batch = arg;
+
+	for (;;) {
+		int i = batch->nextJob++;
+
+		if (i >= batch->numJobs)
+			break;
+
+		struct BatchJob *job = &batch->jobs[i];
+
+		if (job->level != batch->level)
+			continue;
+
+		if (!FileExists(job->argv[1])) {
+			batch->numSkipped++;
+			continue;
+		}
+
+		batch->convert(job->argc, job->argv);
+	}
+
+	return NULL;
+}
+
+void RunBatch(char *manifestPath, int numThreads, ConvertFunc convert)
+{
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	int fileSize;
+	unsigned char *data = ReadWholeFileZeroPadded(manifestPath, &fileSize, 1);
+
+	struct Batch batch;
+	batch.convert = convert;
+	batch.numSkipped = 0;
+	ParseManifest((char *)data, &batch);
+
+	int maxLevel = AssignLevels(&batch);
+
+	if (numThreads < 1) {
+		long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+		numThreads = numCpus > 0 ? (int)numCpus : 1;
+	}
+
+	pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+
+	if (threads == NULL)
+		FATAL_ERROR("Failed to allocate memory for batch threads.\n");
+
+	gWriteOnlyIfChanged = true;
+
+	for (batch.level = 0; batch.level <= maxLevel; batch.level++) {
+		batch.nextJob = 0;
+
+		for (int i = 0; i < numThreads; i++) {
+			if (pthread_create(&threads[i], NULL, BatchWorker, &batch) != 0)
+				FATAL_ERROR("Failed to create batch worker thread.\n");
+		}
+
+		for (int i = 0; i < numThreads; i++)
+			pthread_join(threads[i], NULL);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	int numSkipped = batch.numSkipped;
+	int numUnchanged = gNumUnchangedWrites;
+
+	printf("%s: %d jobs in %.2fs on %d threads, %d unchanged, %d skipped",
+	       manifestPath, batch.numJobs, seconds, numThreads, numUnchanged, numSkipped);
+
+	int numOptimalLzFiles = gNumOptimalLzFiles;
+
+	if (numOptimalLzFiles > 0)
+		printf(", %d bytes saved over greedy LZ in %d files", (int)gOptimalLzBytesSaved, numOptimalLzFiles);
+
+	putchar('\n');
+
+	for (int i = 0; i < batch.numJobs; i++)
+		free(batch.jobs[i].argv);
+
+	free(batch.jobs);
+	free(threads);
+	free(data);
+}
@@ -0,0 +1,19 @@
+// Copyright (c) 2015 YamaArashi
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdatomic.h>
+
+// Runs a single conversion. argv has the same layout as gbagfx's own
+// command line: argv[1] is the input path and argv[2] the output path.
+typedef void (*ConvertFunc)(int argc, char **argv);
+
+// Files compressed with -optimal and the bytes they saved over the greedy
+// parse, which the batch summary line totals.
+extern atomic_int gNumOptimalLzFiles;
+extern atomic_int gOptimalLzBytesSaved;
+
+void RunBatch(char *manifestPath, int numThreads, ConvertFunc convert);
+
+#endif // BATCH_H
@@ -0,0 +1,69 @@
+#!/bin/sh
+# Compresses every .4bpp/.gbapal under the given directory (default: the
+# repository's graphics/) with the brute force reference search and with the
+# hash chain search, checks that both produce identical .lz files and reports
+# the throughput of each. Then compresses them again with -optimal, checks
+# that the results decompress back to the input and reports the bytes saved.
+#
+# Run `make` in the repository root first so the .4bpp/.gbapal files exist.
+
+GBAGFX="$(dirname "$0")/gbagfx"
+GRAPHICS="${1:-$(dirname "$0")/../../graphics}"
+TMP="$(mktemp -d)"
+trap 'rm -rf "$TMP"' EXIT
+
+find "$GRAPHICS" \( -name '*.4bpp' -o -name '*.gbapal' \) > "$TMP/inputs"
+
+if [ ! -s "$TMP/inputs" ]; then
+    echo "No .4bpp/.gbapal files found under $GRAPHICS; build the graphics first." >&2
+    exit 1
+fi
+
+total_bytes=$(xargs cat < "$TMP/inputs" | wc -c)
+num_files=$(wc -l < "$TMP/inputs")
+
+now_ns() {
+    date +%s%N
+}
+
+run() {
+    name="$1"
+    shift
+    mkdir -p "$TMP/$name"
+    start=$(now_ns)
+    n=0
+    while read -r input; do
+        n=$((n + 1))
+        "$GBAGFX" "$input" "$TMP/$name/$n.lz" "$@" > /dev/null || exit 1
+    done < "$TMP/inputs"
+    end=$(now_ns)
+    elapsed_ns=$((end - start))
+    echo "$name: $num_files files, $total_bytes bytes in $((elapsed_ns / 1000000)) ms" \
+        "($(awk "BEGIN { printf \"%.2f\", $total_bytes / 1048576 / ($elapsed_ns / 1e9) }") MB/s)"
+}
+
+run bruteforce -bruteforce
+run hashchain
+
+if ! diff -r "$TMP/bruteforce" "$TMP/hashchain" > /dev/null; then
+    echo "Output differs between bruteforce and hashchain searches!" >&2
+    exit 1
+fi
+
+echo "Outputs are identical."
+
+run optimal -optimal
+
+n=0
+while read -r input; do
+    n=$((n + 1))
+    "$GBAGFX" "$TMP/optimal/$n.lz" "$TMP/optimal/$n.bin" || exit 1
+    if ! cmp -s "$input" "$TMP/optimal/$n.bin"; then
+        echo "Optimal output for $input does not decompress correctly!" >&2
+        exit 1
+    fi
+done < "$TMP/inputs"
+
+greedy_bytes=$(cat "$TMP"/hashchain/*.lz | wc -c)
+optimal_bytes=$(cat "$TMP"/optimal/*.lz | wc -c)
+echo "greedy: $greedy_bytes bytes, optimal: $optimal_bytes bytes (saved $((greedy_bytes - optimal_bytes)) bytes)"
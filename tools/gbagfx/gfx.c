@@ -569,10 +569,7 @@ void ReadGbaPalette(char *path, struct Palette *palette)
 
 void WriteGbaPalette(char *path, struct Palette *palette)
 {
-	FILE *fp = fopen(path, "wb");
-
-	if (fp == NULL)
-		FATAL_ERROR("Failed to open \"%s\" for writing.\n", path);
+	unsigned char buffer[256 * 2];
 
 	for (int i = 0; i < palette->numColors; i++) {
 		unsigned char red = DOWNCONVERT_BIT_DEPTH(palette->colors[i].red);
@@ -581,9 +578,9 @@ void WriteGbaPalette(char *path, struct Palette *palette)
 
 		uint16_t paletteEntry = SET_GBA_PAL(red, green, blue);
 
-		fputc(paletteEntry & 0xFF, fp);
-		fputc(paletteEntry >> 8, fp);
+		buffer[i * 2] = paletteEntry & 0xFF;
+		buffer[i * 2 + 1] = paletteEntry >> 8;
 	}
 
-	fclose(fp);
+	WriteWholeFile(path, buffer, palette->numColors * 2);
 }
@@ -1,4 +1,5 @@
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 #include <stdio.h>
@@ -6,156 +7,74 @@
 #include "global.h"
 #include "huff.h"
 
-static int cmp_tree(const void *a0, const void *b0) {
-    return ((struct HuffData *)a0)->value - ((struct HuffData *)b0)->value;
-}
-
-typedef int (*cmpfun)(const void *, const void *);
-
-int msort_r(void *data, size_t count, size_t size, cmpfun cmp, void *buffer) {
-    /*
-     * Out-of-place mergesort (stable sort)
-     * Returns 1 on success, 0 on failure
-     */
-    void *leftPtr;
-    void *rightPtr;
-    void *leftEnd;
-    void *rightEnd;
-    int i;
-
-    switch (count) {
-    case 0:
-        // Should never be here
-        return 0;
-
-    case 1:
-        // Nothing to do here
-        break;
-
-    case 2:
-        // Swap the two entries if the right one compares higher.
-        if (cmp(data, data + size) > 0) {
-            memcpy(buffer, data, size);
-            memcpy(data, data + size, size);
-            memcpy(data + size, buffer, size);
-        }
-        break;
-    default:
-        // Merge sort out-of-place.
-        leftPtr = data;
-        leftEnd = rightPtr = data + count / 2 * size;
-        rightEnd = data + count * size;
-
-        // Sort the left half
-        if (!msort_r(leftPtr, count / 2, size, cmp, buffer))
-            return 0;
-
-        // Sort the right half
-        if (!msort_r(rightPtr, count / 2 + (count & 1), size, cmp, buffer))
-            return 0;
-
-        // Merge the sorted halves out of place
-        i = 0;
-        do {
-            if (cmp(leftPtr, rightPtr) <= 0) {
-                memcpy(buffer + i * size, leftPtr, size);
-                leftPtr += size;
-            } else {
-                memcpy(buffer + i * size, rightPtr, size);
-                rightPtr += size;
-            }
-
-        } while (++i < count && leftPtr < leftEnd && rightPtr < rightEnd);
-
-        // Copy the remainder
-        if (i < count) {
-            if (leftPtr < leftEnd) {
-                memcpy(buffer + i * size, leftPtr, leftEnd - leftPtr);
-            }
-            else {
-                memcpy(buffer + i * size, rightPtr, rightEnd - rightPtr);
-            }
-        }
+// Orders leaves by frequency. Ties keep the order of the symbols themselves,
+// which is the order the table starts out in.
+static int cmp_leaves(const void *a0, const void *b0) {
+    const HuffNode_t *a = a0;
+    const HuffNode_t *b = b0;
 
-        // Copy the merged data back
-        memcpy(data, buffer, count * size);
-        break;
-    }
-
-    return 1;
-}
-
-int msort(void *data, size_t count, size_t size, cmpfun cmp) {
-    void *buffer = malloc(count * size);
-    if (buffer == NULL) return 0;
-    int result = msort_r(data, count, size, cmp, buffer);
-    free(buffer);
-    return result;
+    if (a->header.value != b->header.value)
+        return a->header.value < b->header.value ? -1 : 1;
+    return (int)a->leaf.key - (int)b->leaf.key;
 }
 
-static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
+static bool write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
     /*
      * The example used to guide this function encodes the tree in a
-     * breadth-first manner.  We attempt to emulate that here.
+     * breadth-first manner, visiting each level from left to right.
+     * A queue of nodes with their paths gives that same order directly.
      */
 
-    int i, j, k;
+    int i, head;
 
     // There are (2 * nitems - 1) nodes in the binary tree.  Allocate that.
     HuffNode_t * traversal = calloc(2 * nitems - 1, sizeof(HuffNode_t));
-    if (traversal == NULL)
+    int * depths = calloc(2 * nitems - 1, sizeof(int));
+    unsigned long long * paths = calloc(2 * nitems - 1, sizeof(unsigned long long));
+    if (traversal == NULL || depths == NULL || paths == NULL)
         FATAL_ERROR("Fatal error while compressing Huff file.\n");
 
     // The first node is the root of the tree.
     traversal[0] = *tree;
     i = 1;
 
-    // Copy the tree into a breadth-first ordering using brute force.
-    for (int depth = 1; i < 2 * nitems - 1; depth++) {
-        // Consider every possible path up to the current depth.
-        for (j = 0; i < 2 * nitems - 1 && j < 1 << depth; j++) {
-            // The index of the path is used to encode the path itself.
-            // Start from the most significant relevant bit and work our way down.
-            // Keep track of the current and previous nodes.
-            HuffNode_t * currNode = traversal;
-            HuffNode_t * parent = NULL;
-            for (k = 0; k < depth; k++) {
-                if (currNode->header.isLeaf)
-                    break;
-                parent = currNode;
-                if ((j >> (depth - k - 1)) & 1)
-                    currNode = currNode->branch.right;
-                else
-                    currNode = currNode->branch.left;
-            }
-            // Check that the length of the current path equals the current depth.
-            if (k == depth) {
-                // Make sure we can encode the current branch.
-                // Bail here if we cannot.
-                // This is only applicable for 8-bit encodings.
-                if (traversal + i - parent > 128)
-                    FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
-                // Copy the current node, and update its parent.
-                traversal[i] = *currNode;
-                if (parent != NULL) {
-                    if ((j & 1) == 1)
-                        parent->branch.right = traversal + i;
-                    else
-                        parent->branch.left = traversal + i;
-                }
-                // Encode the path through the tree in the lookup table
-                if (traversal[i].header.isLeaf) {
-                    encoding[traversal[i].leaf.key].nbits = depth;
-                    encoding[traversal[i].leaf.key].bitstring = j;
-                }
-                i++;
-            }
+    for (head = 0; head < i; head++) {
+        HuffNode_t * currNode = traversal + head;
+
+        if (currNode->header.isLeaf) {
+            // Encode the path through the tree in the lookup table
+            encoding[currNode->leaf.key].nbits = depths[head];
+            encoding[currNode->leaf.key].bitstring = paths[head];
+            continue;
+        }
+
+        // Make sure we can encode the current branch.
+        // Bail here if we cannot.
+        // This is only applicable for 8-bit encodings.
+        if (i + 1 - head > 128) {
+            free(traversal);
+            free(depths);
+            free(paths);
+            return false;
         }
+
+        // Queue the children, and update their parent.
+        traversal[i] = *currNode->branch.left;
+        traversal[i + 1] = *currNode->branch.right;
+        depths[i] = depths[i + 1] = depths[head] + 1;
+        paths[i] = paths[head] << 1;
+        paths[i + 1] = (paths[head] << 1) | 1;
+        currNode->branch.left = traversal + i;
+        currNode->branch.right = traversal + i + 1;
+        i += 2;
     }
 
     // Encode the size of the tree.
-    // This is used by the decompressor to skip the tree.
-    dest[4] = nitems - 1;
+    // This is used by the decompressor to skip the tree, and the data after
+    // it is read a word at a time, so the table is padded to a whole word.
+    int tableSize = (2 * nitems + 3) & ~3;
+    dest[4] = tableSize / 2 - 1;
+    memset(dest + 4 + 2 * nitems, 0, tableSize - 2 * nitems);
 
     // Encode each node in the tree.
     for (i = 0; i < 2 * nitems - 1; i++) {
@@ -172,6 +91,9 @@ static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, stru
     }
 
     free(traversal);
+    free(depths);
+    free(paths);
+    return true;
 }
 
 static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t * buff, int * buffPos) {
@@ -201,7 +123,7 @@ static void write_bits(unsigned char * dest, int * destPos, struct BitEncoding *
         int diff = *buffBits + nbits - 32;
         *buff <<= nbits - diff;
         *buff |= bitstring >> diff;
-        bitstring &= ~(1 << diff);
+        bitstring &= (1u << diff) - 1;
         nbits = diff;
         write_32_le(dest, destPos, buff, buffBits);
     }
@@ -218,7 +140,9 @@ MAIN COMPRESSION/DECOMPRESSION ROUTINES
 =======================================
  */
 
-unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+// Returns NULL, without reporting an error, if the tree is too lopsided for
+// the GBA's format, which can happen with 8-bit symbols.
+static unsigned char * HuffEncode(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
     if (srcSize <= 0)
         goto fail;
 
@@ -262,8 +186,7 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
 #endif // DEBUG
 
     // Sort the frequency table.
-    if (!msort(freqs, nitems, sizeof(HuffNode_t), cmp_tree))
-        goto fail;
+    qsort(freqs, nitems, sizeof(HuffNode_t), cmp_leaves);
 
     // Prune zero-frequency values.
     for (int i = 0; i < nitems; i++) {
@@ -285,33 +208,40 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     if (tree == NULL)
         goto fail;
 
-    // Iteratively collapse the two least frequent nodes.
-    HuffNode_t * endptr = freqs + nitems - 2;
-
+    // Iteratively collapse the two least frequent nodes. The table stays
+    // sorted by inserting each new branch after every node that's no more
+    // frequent than it.
     for (int i = 0; i < nitems - 1; i++) {
-        HuffNode_t * left = freqs;
-        HuffNode_t * right = freqs + 1;
-        tree[i * 2] = *right;
-        tree[i * 2 + 1] = *left;
-        for (int j = 0; j < nitems - i - 2; j++)
-            freqs[j] = freqs[j + 2];
-        endptr->header.isLeaf = 0;
-        endptr->header.value = tree[i * 2].header.value + tree[i * 2 + 1].header.value;
-        endptr->branch.left = tree + i * 2;
-        endptr->branch.right = tree + i * 2 + 1;
-        endptr--;
-        if (i < nitems - 2 && !msort(freqs, nitems - i - 1, sizeof(HuffNode_t), cmp_tree))
-            goto fail;
+        int remaining = nitems - i - 2;
+        HuffNode_t branch;
+        tree[i * 2] = freqs[1];
+        tree[i * 2 + 1] = freqs[0];
+        branch.header.isLeaf = 0;
+        branch.header.value = tree[i * 2].header.value + tree[i * 2 + 1].header.value;
+        branch.branch.left = tree + i * 2;
+        branch.branch.right = tree + i * 2 + 1;
+        memmove(freqs, freqs + 2, remaining * sizeof(HuffNode_t));
+        int pos = 0;
+        while (pos < remaining && freqs[pos].header.value <= branch.header.value)
+            pos++;
+        memmove(freqs + pos + 1, freqs + pos, (remaining - pos) * sizeof(HuffNode_t));
+        freqs[pos] = branch;
     }
 
     // Write the tree breadth-first, and create the path lookup table.
-    write_tree(dest, freqs, nitems, encoding);
+    bool encodable = write_tree(dest, freqs, nitems, encoding);
 
     free(tree);
     free(freqs);
 
+    if (!encodable) {
+        free(encoding);
+        free(dest);
+        return NULL;
+    }
+
     // Encode the data itself.
-    int destPos = 4 + nitems * 2;
+    int destPos = 4 + ((nitems * 2 + 3) & ~3);
     uint32_t destBuf = 0;
     uint32_t srcBuf = 0;
     int destBitPos = 0;
@@ -324,7 +254,9 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
         }
     }
 
+    // The decompressor reads each word from its top bit down.
     if (destBitPos != 0) {
+        destBuf <<= 32 - destBitPos;
         write_32_le(dest, &destPos, &destBuf, &destBitPos);
     }
 
@@ -342,6 +274,42 @@ fail:
     FATAL_ERROR("Fatal error while compressing Huff file.\n");
 }
 
+unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+    unsigned char * dest = HuffEncode(src, srcSize, compressedSize_p, bitDepth);
+
+    if (dest == NULL)
+        FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
+
+    return dest;
+}
+
+unsigned char * HuffTryCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+    // The decompressor works a word at a time and needs a real tree, so
+    // anything else can't be encoded either.
+    if (srcSize % 4 != 0)
+        return NULL;
+
+    bool seen[256] = { false };
+    int numSymbols = 0;
+
+    for (int i = 0; i < srcSize; i++) {
+        int symbols[2] = { src[i] >> 4, src[i] & 0xF };
+        if (bitDepth == 8)
+            symbols[0] = symbols[1] = src[i];
+        for (int j = 0; j < 2; j++) {
+            if (!seen[symbols[j]]) {
+                seen[symbols[j]] = true;
+                numSymbols++;
+            }
+        }
+    }
+
+    if (numSymbols >= 2)
+        return HuffEncode(src, srcSize, compressedSize_p, bitDepth);
+
+    return NULL;
+}
+
 unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompressedSize_p) {
     if (srcSize < 4)
         goto fail;
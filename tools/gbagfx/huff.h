@@ -33,6 +33,10 @@ struct BitEncoding {
 };
 
 unsigned char * HuffCompress(unsigned char * buffer, int srcSize, int * compressedSize_p, int bitDepth);
+// Like HuffCompress, but returns NULL instead of failing if the data can't
+// be Huffman-coded for the GBA: its size isn't a multiple of 4, it has fewer
+// than two distinct symbols, or its tree is too lopsided to encode.
+unsigned char * HuffTryCompress(unsigned char * buffer, int srcSize, int * compressedSize_p, int bitDepth);
 unsigned char * HuffDecompress(unsigned char * buffer, int srcSize, int * uncompressedSize_p);
 
 #endif //HUFF_H
@@ -69,85 +69,312 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+// Match finder. Every position is hashed on its first three bytes and
+// linked to the previous position with the same hash, so a search only visits
+// earlier positions that can start a match of at least LZ_MIN_MATCH bytes.
+// Chains are walked from the nearest position outwards and only a strictly
+// longer match replaces the current best, which gives the same (length,
+// distance) choice as scanning every distance from minDistance upwards.
+
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 15
+#define LZ_HASH_SIZE (1 << LZ_HASH_BITS)
+
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	enum LZSearch search;
+	int *head;
+	int *prev;
+	int nextInsertPos;
+};
+
+static unsigned int LZHash(unsigned char *p)
 {
-	if (srcSize <= 0)
-		goto fail;
+	unsigned int key = (p[0] << 16) | (p[1] << 8) | p[2];
+
+	return (key * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void LZInitMatchFinder(struct LZMatchFinder *mf, unsigned char *src, int srcSize, int minDistance, enum LZSearch search)
+{
+	mf->src = src;
+	mf->srcSize = srcSize;
+	mf->minDistance = minDistance;
+	mf->search = search;
+	mf->head = NULL;
+	mf->prev = NULL;
+	mf->nextInsertPos = 0;
+
+	if (search == LZ_SEARCH_BRUTE_FORCE)
+		return;
+
+	mf->head = malloc(LZ_HASH_SIZE * sizeof(int));
+	mf->prev = malloc(srcSize * sizeof(int));
+
+	if (mf->head == NULL || mf->prev == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ match finder.\n");
+
+	for (int i = 0; i < LZ_HASH_SIZE; i++)
+		mf->head[i] = -1;
+}
+
+static void LZFreeMatchFinder(struct LZMatchFinder *mf)
+{
+	free(mf->head);
+	free(mf->prev);
+}
+
+static int LZMatchLength(unsigned char *src, int blockStart, int srcPos, int maxSize)
+{
+	int blockSize = 0;
+
+	while (blockSize < maxSize && src[blockStart + blockSize] == src[srcPos + blockSize])
+		blockSize++;
+
+	return blockSize;
+}
+
+static int LZFindLongestMatchBruteForce(struct LZMatchFinder *mf, int srcPos, int *distance)
+{
+	int maxSize = mf->srcSize - srcPos;
+	int bestBlockDistance = 0;
+	int bestBlockSize = 0;
+
+	if (maxSize > LZ_MAX_MATCH)
+		maxSize = LZ_MAX_MATCH;
+
+	for (int blockDistance = mf->minDistance; blockDistance <= srcPos && blockDistance <= LZ_MAX_DISTANCE; blockDistance++) {
+		int blockSize = LZMatchLength(mf->src, srcPos - blockDistance, srcPos, maxSize);
+
+		if (blockSize > bestBlockSize) {
+			bestBlockDistance = blockDistance;
+			bestBlockSize = blockSize;
+
+			if (blockSize == maxSize)
+				break;
+		}
+	}
+
+	*distance = bestBlockDistance;
+	return bestBlockSize;
+}
+
+// Returns the length of the longest match for the data at srcPos (0 if it is
+// shorter than LZ_MIN_MATCH) and stores its distance. srcPos must not go
+// backwards between calls.
+static int LZFindLongestMatch(struct LZMatchFinder *mf, int srcPos, int *distance)
+{
+	if (mf->search == LZ_SEARCH_BRUTE_FORCE) {
+		int blockSize = LZFindLongestMatchBruteForce(mf, srcPos, distance);
+		return blockSize >= LZ_MIN_MATCH ? blockSize : 0;
+	}
+
+	while (mf->nextInsertPos < srcPos && mf->nextInsertPos + LZ_MIN_MATCH <= mf->srcSize) {
+		unsigned int hash = LZHash(&mf->src[mf->nextInsertPos]);
+		mf->prev[mf->nextInsertPos] = mf->head[hash];
+		mf->head[hash] = mf->nextInsertPos;
+		mf->nextInsertPos++;
+	}
+
+	int maxSize = mf->srcSize - srcPos;
+	int bestBlockDistance = 0;
+	int bestBlockSize = 0;
+
+	if (maxSize < LZ_MIN_MATCH)
+		return 0;
+
+	if (maxSize > LZ_MAX_MATCH)
+		maxSize = LZ_MAX_MATCH;
+
+	int blockStart = mf->head[LZHash(&mf->src[srcPos])];
+
+	while (blockStart >= 0) {
+		int blockDistance = srcPos - blockStart;
+
+		if (blockDistance > LZ_MAX_DISTANCE)
+			break;
+
+		if (blockDistance >= mf->minDistance) {
+			int blockSize = LZMatchLength(mf->src, blockStart, srcPos, maxSize);
+
+			if (blockSize > bestBlockSize) {
+				bestBlockDistance = blockDistance;
+				bestBlockSize = blockSize;
+
+				if (blockSize == maxSize)
+					break;
+			}
+		}
+
+		blockStart = mf->prev[blockStart];
+	}
+
+	if (bestBlockSize < LZ_MIN_MATCH)
+		return 0;
 
+	*distance = bestBlockDistance;
+	return bestBlockSize;
+}
+
+// Writes the LZ77 token stream: a flags byte ahead of every group of eight
+// tokens, with one bit per token set for back-references.
+struct LZWriter {
+	unsigned char *dest;
+	int destPos;
+	int flagsPos;
+	int numTokens;
+};
+
+static void LZInitWriter(struct LZWriter *writer, int srcSize)
+{
 	int worstCaseDestSize = 4 + srcSize + ((srcSize + 7) / 8);
 
 	// Round up to the next multiple of four.
 	worstCaseDestSize = (worstCaseDestSize + 3) & ~3;
 
-	unsigned char *dest = malloc(worstCaseDestSize);
+	writer->dest = malloc(worstCaseDestSize);
 
-	if (dest == NULL)
-		goto fail;
+	if (writer->dest == NULL)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
 
 	// header
-	dest[0] = 0x10; // LZ compression type
-	dest[1] = (unsigned char)srcSize;
-	dest[2] = (unsigned char)(srcSize >> 8);
-	dest[3] = (unsigned char)(srcSize >> 16);
+	writer->dest[0] = 0x10; // LZ compression type
+	writer->dest[1] = (unsigned char)srcSize;
+	writer->dest[2] = (unsigned char)(srcSize >> 8);
+	writer->dest[3] = (unsigned char)(srcSize >> 16);
+
+	writer->destPos = 4;
+	writer->flagsPos = 0;
+	writer->numTokens = 0;
+}
+
+static void LZBeginToken(struct LZWriter *writer)
+{
+	if (writer->numTokens % 8 == 0) {
+		writer->flagsPos = writer->destPos++;
+		writer->dest[writer->flagsPos] = 0;
+	}
+}
+
+static void LZWriteLiteral(struct LZWriter *writer, unsigned char value)
+{
+	LZBeginToken(writer);
+	writer->dest[writer->destPos++] = value;
+	writer->numTokens++;
+}
+
+static void LZWriteBlock(struct LZWriter *writer, int blockSize, int blockDistance)
+{
+	LZBeginToken(writer);
+	writer->dest[writer->flagsPos] |= (0x80 >> (writer->numTokens % 8));
+	blockSize -= 3;
+	blockDistance--;
+	writer->dest[writer->destPos++] = (blockSize << 4) | ((unsigned int)blockDistance >> 8);
+	writer->dest[writer->destPos++] = (unsigned char)blockDistance;
+	writer->numTokens++;
+}
+
+static unsigned char *LZFinishWriter(struct LZWriter *writer, int *compressedSize)
+{
+	// Pad to multiple of 4 bytes.
+	while (writer->destPos % 4 != 0)
+		writer->dest[writer->destPos++] = 0;
+
+	*compressedSize = writer->destPos;
+	return writer->dest;
+}
+
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, enum LZSearch search)
+{
+	if (srcSize <= 0)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
+
+	struct LZWriter writer;
+	LZInitWriter(&writer, srcSize);
+
+	struct LZMatchFinder mf;
+	LZInitMatchFinder(&mf, src, srcSize, minDistance, search);
 
 	int srcPos = 0;
-	int destPos = 4;
 
-	for (;;) {
-		unsigned char *flags = &dest[destPos++];
-		*flags = 0;
+	while (srcPos < srcSize) {
+		int bestBlockDistance = 0;
+		int bestBlockSize = LZFindLongestMatch(&mf, srcPos, &bestBlockDistance);
 
-		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
+		if (bestBlockSize >= LZ_MIN_MATCH) {
+			LZWriteBlock(&writer, bestBlockSize, bestBlockDistance);
+			srcPos += bestBlockSize;
+		} else {
+			LZWriteLiteral(&writer, src[srcPos++]);
+		}
+	}
 
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
+	LZFreeMatchFinder(&mf);
 
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
+	return LZFinishWriter(&writer, compressedSize);
+}
 
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
+// Minimum-size parse. A literal costs 9 bits (flag + byte) and a block costs
+// 17 bits (flag + 2 bytes) regardless of its length or distance, so the
+// longest match at each position is all the parser needs: any shorter length
+// can reuse the same distance. The cheapest encoding of the remaining data is
+// then computed backwards from the end of the input.
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
 
-					if (blockSize == 18)
-						break;
-				}
+	int *matchSize = malloc(srcSize * sizeof(int));
+	int *matchDistance = malloc(srcSize * sizeof(int));
+	int *cost = malloc((srcSize + 1) * sizeof(int));
+	int *step = malloc(srcSize * sizeof(int));
 
-				blockDistance++;
-			}
+	if (matchSize == NULL || matchDistance == NULL || cost == NULL || step == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ optimal parse.\n");
 
-			if (bestBlockSize >= 3) {
-				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
-			} else {
-				dest[destPos++] = src[srcPos++];
-			}
+	struct LZMatchFinder mf;
+	LZInitMatchFinder(&mf, src, srcSize, minDistance, LZ_SEARCH_HASH_CHAIN);
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos++) {
+		matchDistance[srcPos] = 0;
+		matchSize[srcPos] = LZFindLongestMatch(&mf, srcPos, &matchDistance[srcPos]);
+	}
 
-			if (srcPos == srcSize) {
-				// Pad to multiple of 4 bytes.
-				int remainder = destPos % 4;
+	LZFreeMatchFinder(&mf);
 
-				if (remainder != 0) {
-					for (int i = 0; i < 4 - remainder; i++)
-						dest[destPos++] = 0;
-				}
+	cost[srcSize] = 0;
 
-				*compressedSize = destPos;
-				return dest;
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		cost[srcPos] = cost[srcPos + 1] + 9;
+		step[srcPos] = 1;
+
+		// Prefer longer blocks on ties, which keeps the token count down.
+		for (int blockSize = matchSize[srcPos]; blockSize >= LZ_MIN_MATCH; blockSize--) {
+			if (cost[srcPos + blockSize] + 17 < cost[srcPos]) {
+				cost[srcPos] = cost[srcPos + blockSize] + 17;
+				step[srcPos] = blockSize;
 			}
 		}
 	}
 
-fail:
-	FATAL_ERROR("Fatal error while compressing LZ file.\n");
+	struct LZWriter writer;
+	LZInitWriter(&writer, srcSize);
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos += step[srcPos]) {
+		if (step[srcPos] >= LZ_MIN_MATCH)
+			LZWriteBlock(&writer, step[srcPos], matchDistance[srcPos]);
+		else
+			LZWriteLiteral(&writer, src[srcPos]);
+	}
+
+	free(matchSize);
+	free(matchDistance);
+	free(cost);
+	free(step);
+
+	return LZFinishWriter(&writer, compressedSize);
 }
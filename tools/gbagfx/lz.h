@@ -3,7 +3,13 @@
 #ifndef LZ_H
 #define LZ_H
 
+enum LZSearch {
+	LZ_SEARCH_HASH_CHAIN,
+	LZ_SEARCH_BRUTE_FORCE,
+};
+
 unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSize);
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance);
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, enum LZSearch search);
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance);
 
 #endif // LZ_H
@@ -13,6 +13,8 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "auto_compress.h"
+#include "batch.h"
 
 struct CommandHandler
 {
@@ -426,6 +428,8 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
 {
     int overflowSize = 0;
     int minDistance = 2; // default, for compatibility with LZ77UnCompVram()
+    enum LZSearch search = LZ_SEARCH_HASH_CHAIN;
+    bool optimal = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -457,6 +461,16 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
             if (minDistance < 1)
                 FATAL_ERROR("LZ min search distance must be positive.\n");
         }
+        else if (strcmp(option, "-bruteforce") == 0)
+        {
+            // Reference search over every distance; produces the same output
+            // as the default hash chain search, only slower.
+            search = LZ_SEARCH_BRUTE_FORCE;
+        }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            optimal = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option \"%s\".\n", option);
@@ -473,7 +487,22 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     unsigned char *buffer = ReadWholeFileZeroPadded(inputPath, &fileSize, overflowSize);
 
     int compressedSize;
-    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    unsigned char *compressedData;
+
+    if (optimal)
+    {
+        // Also run the greedy parse, to report how much the optimal one saves.
+        int greedySize;
+        free(LZCompress(buffer, fileSize + overflowSize, &greedySize, minDistance, LZ_SEARCH_HASH_CHAIN));
+        compressedData = LZCompressOptimal(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+        printf("%s: %d bytes, saved %d bytes over greedy\n", outputPath, compressedSize, greedySize - compressedSize);
+        gNumOptimalLzFiles++;
+        gOptimalLzBytesSaved += greedySize - compressedSize;
+    }
+    else
+    {
+        compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance, search);
+    }
 
     compressedData[1] = (unsigned char)fileSize;
     compressedData[2] = (unsigned char)(fileSize >> 8);
@@ -586,39 +615,119 @@ void HandleHuffDecompressCommand(char *inputPath, char *outputPath, int argc UNU
     free(uncompressedData);
 }
 
-int main(int argc, char **argv)
+// Compresses with whichever codec suits the data best, whatever the output's
+// extension, and logs the choice.
+void HandleAutoCompressCommand(char *inputPath, char *outputPath, int argc, char **argv)
 {
-    char converted = 0;
+    enum CodecPolicy policy = CODEC_POLICY_SIZE;
+    int numThreads = 0; // default, one per CPU
 
-    if (argc < 3)
-        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
+    for (int i = 4; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-policy") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No policy following \"-policy\".\n");
+
+            i++;
+
+            if (strcmp(argv[i], "size") == 0)
+                policy = CODEC_POLICY_SIZE;
+            else if (strcmp(argv[i], "speed") == 0)
+                policy = CODEC_POLICY_SPEED;
+            else
+                FATAL_ERROR("Policy must be \"size\" or \"speed\".\n");
+        }
+        else if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No number of threads following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numThreads))
+                FATAL_ERROR("Failed to parse number of threads.\n");
+
+            if (numThreads < 1)
+                FATAL_ERROR("Number of threads must be positive.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    int fileSize;
+    unsigned char *buffer = ReadWholeFile(inputPath, &fileSize);
+
+    struct AutoCompressResult result;
+    AutoCompress(buffer, fileSize, policy, numThreads, &result);
+
+    free(buffer);
+
+    struct CodecCandidate *chosen = &result.candidates[result.chosen];
+    char others[256] = "";
+    int othersLength = 0;
+
+    for (int i = 0; i < NUM_CODECS; i++)
+    {
+        struct CodecCandidate *candidate = &result.candidates[i];
 
-    struct CommandHandler handlers[] =
+        if (i == (int)result.chosen)
+            continue;
+
+        if (candidate->available)
+            othersLength += snprintf(others + othersLength, sizeof(others) - othersLength, ", %s %d", GetCodecName(i), candidate->size);
+        else
+            othersLength += snprintf(others + othersLength, sizeof(others) - othersLength, ", %s -", GetCodecName(i));
+    }
+
+    printf("%s: %s, %d bytes, ~%ld cycles to decompress (%d uncompressed%s)\n",
+           outputPath, GetCodecName(result.chosen), chosen->size, chosen->decodeCycles, fileSize, others);
+
+    WriteWholeFile(outputPath, chosen->data, chosen->size);
+
+    free(chosen->data);
+}
+
+static const struct CommandHandler handlers[] =
+{
+    { "1bpp", "png", HandleGbaToPngCommand },
+    { "4bpp", "png", HandleGbaToPngCommand },
+    { "8bpp", "png", HandleGbaToPngCommand },
+    { "png", "1bpp", HandlePngToGbaCommand },
+    { "png", "4bpp", HandlePngToGbaCommand },
+    { "png", "8bpp", HandlePngToGbaCommand },
+    { "png", "gbapal", HandlePngToGbaPaletteCommand },
+    { "png", "pal", HandlePngToJascPaletteCommand },
+    { "gbapal", "pal", HandleGbaToJascPaletteCommand },
+    { "pal", "gbapal", HandleJascToGbaPaletteCommand },
+    { "latfont", "png", HandleLatinFontToPngCommand },
+    { "png", "latfont", HandlePngToLatinFontCommand },
+    { "hwjpnfont", "png", HandleHalfwidthJapaneseFontToPngCommand },
+    { "png", "hwjpnfont", HandlePngToHalfwidthJapaneseFontCommand },
+    { "fwjpnfont", "png", HandleFullwidthJapaneseFontToPngCommand },
+    { "png", "fwjpnfont", HandlePngToFullwidthJapaneseFontCommand },
+    { NULL, "huff", HandleHuffCompressCommand },
+    { NULL, "lz", HandleLZCompressCommand },
+    { "huff", NULL, HandleHuffDecompressCommand },
+    { "lz", NULL, HandleLZDecompressCommand },
+    { NULL, "rl", HandleRLCompressCommand },
+    { "rl", NULL, HandleRLDecompressCommand },
+    { NULL, NULL, NULL }
+};
+
+void ConvertFile(int argc, char **argv)
+{
+    char converted = 0;
+
+    if (argc > 3 && strcmp(argv[3], "-auto") == 0)
     {
-        { "1bpp", "png", HandleGbaToPngCommand },
-        { "4bpp", "png", HandleGbaToPngCommand },
-        { "8bpp", "png", HandleGbaToPngCommand },
-        { "png", "1bpp", HandlePngToGbaCommand },
-        { "png", "4bpp", HandlePngToGbaCommand },
-        { "png", "8bpp", HandlePngToGbaCommand },
-        { "png", "gbapal", HandlePngToGbaPaletteCommand },
-        { "png", "pal", HandlePngToJascPaletteCommand },
-        { "gbapal", "pal", HandleGbaToJascPaletteCommand },
-        { "pal", "gbapal", HandleJascToGbaPaletteCommand },
-        { "latfont", "png", HandleLatinFontToPngCommand },
-        { "png", "latfont", HandlePngToLatinFontCommand },
-        { "hwjpnfont", "png", HandleHalfwidthJapaneseFontToPngCommand },
-        { "png", "hwjpnfont", HandlePngToHalfwidthJapaneseFontCommand },
-        { "fwjpnfont", "png", HandleFullwidthJapaneseFontToPngCommand },
-        { "png", "fwjpnfont", HandlePngToFullwidthJapaneseFontCommand },
-        { NULL, "huff", HandleHuffCompressCommand },
-        { NULL, "lz", HandleLZCompressCommand },
-        { "huff", NULL, HandleHuffDecompressCommand },
-        { "lz", NULL, HandleLZDecompressCommand },
-        { NULL, "rl", HandleRLCompressCommand },
-        { "rl", NULL, HandleRLDecompressCommand },
-        { NULL, NULL, NULL }
-    };
+        HandleAutoCompressCommand(argv[1], argv[2], argc, argv);
+        return;
+    }
 
     char *inputPath = argv[1];
     char *outputPath = argv[2];
@@ -672,6 +781,49 @@ int main(int argc, char **argv)
 
     if (!converted)
         FATAL_ERROR("Don't know how to convert \"%s\" to \"%s\".\n", argv[1], argv[2]);
+}
+
+void HandleBatchCommand(int argc, char **argv)
+{
+    int numThreads = 0; // default, one per CPU
+
+    for (int i = 3; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No number of threads following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numThreads))
+                FATAL_ERROR("Failed to parse number of threads.\n");
+
+            if (numThreads < 1)
+                FATAL_ERROR("Number of threads must be positive.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    RunBatch(argv[2], numThreads, ConvertFile);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n"
+                    "       gbagfx INPUT_PATH OUTPUT_PATH -auto [-policy size|speed] [-j THREADS]\n"
+                    "       gbagfx batch MANIFEST_PATH [-j THREADS]\n");
+
+    if (strcmp(argv[1], "batch") == 0)
+        HandleBatchCommand(argc, argv);
+    else
+        ConvertFile(argc, argv);
 
     return 0;
 }
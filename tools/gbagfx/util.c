@@ -9,6 +9,36 @@
 #include "global.h"
 #include "util.h"
 
+bool gWriteOnlyIfChanged;
+atomic_int gNumUnchangedWrites;
+
+static bool FileHasContents(char *path, void *buffer, int bufferSize)
+{
+	FILE *fp = fopen(path, "rb");
+
+	if (fp == NULL)
+		return false;
+
+	fseek(fp, 0, SEEK_END);
+
+	bool same = false;
+
+	if (ftell(fp) == bufferSize) {
+		unsigned char *existing = malloc(bufferSize);
+
+		if (existing == NULL)
+			FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", path);
+
+		rewind(fp);
+		same = fread(existing, bufferSize, 1, fp) == 1 && memcmp(existing, buffer, bufferSize) == 0;
+		free(existing);
+	}
+
+	fclose(fp);
+
+	return same;
+}
+
 bool ParseNumber(char *s, char **end, int radix, int *intValue)
 {
 	char *localEnd;
@@ -119,12 +149,17 @@ unsigned char *ReadWholeFileZeroPadded(char *path, int *size, int padAmount)
 
 void WriteWholeFile(char *path, void *buffer, int bufferSize)
 {
+	if (gWriteOnlyIfChanged && FileHasContents(path, buffer, bufferSize)) {
+		gNumUnchangedWrites++;
+		return;
+	}
+
 	FILE *fp = fopen(path, "wb");
 
 	if (fp == NULL)
 		FATAL_ERROR("Failed to open \"%s\" for writing.\n", path);
 
-	if (fwrite(buffer, bufferSize, 1, fp) != 1)
+	if (bufferSize > 0 && fwrite(buffer, bufferSize, 1, fp) != 1)
 		FATAL_ERROR("Failed to write to \"%s\".\n", path);
 
 	fclose(fp);
@@ -4,6 +4,12 @@
 #define UTIL_H
 
 #include <stdbool.h>
+#include <stdatomic.h>
+
+// When set, WriteWholeFile leaves files that already have the new contents
+// untouched (keeping their timestamps) and counts them in gNumUnchangedWrites.
+extern bool gWriteOnlyIfChanged;
+extern atomic_int gNumUnchangedWrites;
 
 bool ParseNumber(char *s, char **end, int radix, int *intValue);
 char *GetFileExtension(char *path);
@@ -12,12 +12,22 @@ using std::string; using std::to_string;
 #include <algorithm>
 using std::replace_if;
 
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
 #include <inja.hpp>
 using namespace inja;
 using json = nlohmann::json;
 
 std::map<string, string> customVars;
 
+// The files the output being rendered is generated from, for doNotModifyHeader.
+string currentJsonFilepath;
+string currentTemplateFilepath;
+
 void set_custom_var(string key, string value)
 {
     customVars[key] = value;
@@ -28,21 +38,38 @@ string get_custom_var(string key)
     return customVars[key];
 }
 
-int main(int argc, char *argv[])
+// Leaves the file (and its mtime) alone if it already has this content, so
+// the C files including a regenerated header aren't all recompiled. Only
+// --manifest uses this, as its stamp records when the outputs were last
+// brought up to date; a single output must be newer than its inputs.
+// Returns whether it was written.
+bool write_if_changed(string filepath, string text)
 {
-    if (argc != 4)
-        FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n");
+    std::ifstream in_file(filepath, std::ios::binary);
 
-    string jsonfilepath = argv[1];
-    string templateFilepath = argv[2];
-    string outputFilepath = argv[3];
+    if (in_file.is_open()) {
+        string old_text((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+        if (old_text == text)
+            return false;
+        in_file.close();
+    }
 
-    Environment env;
+    std::ofstream out_file(filepath, std::ios::binary);
+
+    if (!out_file.is_open())
+        FATAL_ERROR("Cannot open file %s for writing.\n", filepath.c_str());
+
+    out_file << text;
+    return true;
+}
+
+void setup_environment(Environment& env)
+{
     env.set_trim_blocks(true);
 
     // Add custom command callbacks.
-    env.add_callback("doNotModifyHeader", 0, [jsonfilepath, templateFilepath](Arguments& args) {
-        return "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from " + jsonfilepath +" and Inja template " + templateFilepath + "\n//\n";
+    env.add_callback("doNotModifyHeader", 0, [](Arguments& args) {
+        return "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from " + currentJsonFilepath +" and Inja template " + currentTemplateFilepath + "\n//\n";
     });
 
     env.add_callback("contains", 2, [](Arguments& args) {
@@ -126,15 +153,126 @@ int main(int argc, char *argv[])
         }
         return str;
     });
+}
+
+double milliseconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Renders each (json, template, output) triple listed in a manifest, parsing
+// every JSON file and template only once however many outputs use it.
+void render_manifest(string manifestFilepath)
+{
+    std::ifstream manifest(manifestFilepath);
+
+    if (!manifest.is_open())
+        FATAL_ERROR("Cannot open file %s for reading.\n", manifestFilepath.c_str());
+
+    Environment env;
+    setup_environment(env);
+
+    std::map<string, json> jsons;
+    std::map<string, Template> templates;
+    string line;
+    int numRendered = 0;
+    int numUnchanged = 0;
+    auto totalStart = std::chrono::steady_clock::now();
+
+    while (std::getline(manifest, line)) {
+        std::istringstream fields(line);
+        string jsonFilepath, templateFilepath, outputFilepath;
+
+        if (!(fields >> jsonFilepath) || jsonFilepath[0] == '#')
+            continue;
+        if (!(fields >> templateFilepath >> outputFilepath))
+            FATAL_ERROR("%s: expected <json-filepath> <template-filepath> <output-filepath>, got \"%s\"\n", manifestFilepath.c_str(), line.c_str());
+
+        double jsonTime = 0, templateTime = 0, renderTime = 0;
+        string output;
+
+        try
+        {
+            auto start = std::chrono::steady_clock::now();
+            auto jsonIt = jsons.find(jsonFilepath);
+
+            if (jsonIt == jsons.end()) {
+                jsonIt = jsons.emplace(jsonFilepath, env.load_json(jsonFilepath)).first;
+                jsonTime = milliseconds_since(start);
+            }
+
+            start = std::chrono::steady_clock::now();
+            auto templateIt = templates.find(templateFilepath);
+
+            if (templateIt == templates.end()) {
+                templateIt = templates.emplace(templateFilepath, env.parse_template(templateFilepath)).first;
+                templateTime = milliseconds_since(start);
+            }
+
+            start = std::chrono::steady_clock::now();
+            currentJsonFilepath = jsonFilepath;
+            currentTemplateFilepath = templateFilepath;
+            customVars.clear();
+            output = env.render(templateIt->second, jsonIt->second);
+            renderTime = milliseconds_since(start);
+        }
+        catch (const std::exception& e)
+        {
+            FATAL_ERROR("JSONPROC_ERROR: %s: %s\n", outputFilepath.c_str(), e.what());
+        }
+
+        bool written = write_if_changed(outputFilepath, output);
+
+        numRendered++;
+        if (!written)
+            numUnchanged++;
+
+        printf("jsonproc: %s: json %.1f ms, template %.1f ms, render %.1f ms\n", outputFilepath.c_str(),
+               jsonTime, templateTime, renderTime);
+    }
+
+    printf("jsonproc: rendered %d outputs from %d JSON files and %d templates in %.1f ms, %d unchanged and not rewritten\n",
+           numRendered, (int)jsons.size(), (int)templates.size(), milliseconds_since(totalStart), numUnchanged);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc == 3 && string(argv[1]) == "--manifest") {
+        render_manifest(argv[2]);
+        return 0;
+    }
+
+    if (argc != 4)
+        FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n"
+                    "       jsonproc --manifest <manifest-filepath>\n");
+
+    string jsonfilepath = argv[1];
+    string templateFilepath = argv[2];
+    string outputFilepath = argv[3];
+
+    Environment env;
+    setup_environment(env);
+
+    currentJsonFilepath = jsonfilepath;
+    currentTemplateFilepath = templateFilepath;
+
+    string output;
 
     try
     {
-        env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
+        output = env.render_file_with_json_file(templateFilepath, jsonfilepath);
     }
     catch (const std::exception& e)
     {
         FATAL_ERROR("JSONPROC_ERROR: %s\n", e.what());
     }
 
+    std::ofstream out_file(outputFilepath, std::ios::binary);
+
+    if (!out_file.is_open())
+        FATAL_ERROR("Cannot open file %s for writing.\n", outputFilepath.c_str());
+
+    out_file << output;
+
     return 0;
 }
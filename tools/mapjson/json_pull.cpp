@@ -0,0 +1,306 @@
+// json_pull.cpp
+
+#include <cstring>
+
+#include "json_pull.h"
+
+JsonPullParser::JsonPullParser(const char *begin, const char *end)
+    : m_begin(begin), m_pos(begin), m_end(end), m_expect_key(false), m_after_value(false) {
+}
+
+JsonPullParser::Token JsonPullParser::fail(const char *message) {
+    if (m_error.empty())
+        m_error = "JSON syntax error at offset " + std::to_string(offset()) + ": " + message;
+    return Token::Error;
+}
+
+void JsonPullParser::skip_whitespace() {
+    while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\n' || *m_pos == '\r'))
+        m_pos++;
+}
+
+static void append_utf8(std::string &out, unsigned long codepoint) {
+    if (codepoint < 0x80) {
+        out += (char)codepoint;
+    } else if (codepoint < 0x800) {
+        out += (char)(0xC0 | (codepoint >> 6));
+        out += (char)(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+        out += (char)(0xE0 | (codepoint >> 12));
+        out += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        out += (char)(0x80 | (codepoint & 0x3F));
+    } else {
+        out += (char)(0xF0 | (codepoint >> 18));
+        out += (char)(0x80 | ((codepoint >> 12) & 0x3F));
+        out += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        out += (char)(0x80 | (codepoint & 0x3F));
+    }
+}
+
+static bool read_hex4(const char *p, const char *end, unsigned long &value) {
+    if (end - p < 4)
+        return false;
+
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9')
+            value |= c - '0';
+        else if (c >= 'a' && c <= 'f')
+            value |= c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            value |= c - 'A' + 10;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Reads the string starting at the opening quote into m_text, or just steps
+// over it if it doesn't need to be decoded.
+bool JsonPullParser::read_string(bool decode) {
+    m_pos++;
+
+    if (decode)
+        m_text.clear();
+
+    for (;;) {
+        const char *run = m_pos;
+
+        while (m_pos < m_end && *m_pos != '"' && *m_pos != '\\')
+            m_pos++;
+
+        if (decode)
+            m_text.append(run, m_pos);
+
+        if (m_pos >= m_end) {
+            fail("unterminated string");
+            return false;
+        }
+
+        if (*m_pos++ == '"')
+            return true;
+
+        if (m_pos >= m_end) {
+            fail("unterminated string");
+            return false;
+        }
+
+        char escape = *m_pos++;
+
+        if (!decode) {
+            continue;
+        }
+
+        switch (escape) {
+        case '"':  m_text += '"';  break;
+        case '\\': m_text += '\\'; break;
+        case '/':  m_text += '/';  break;
+        case 'b':  m_text += '\b'; break;
+        case 'f':  m_text += '\f'; break;
+        case 'n':  m_text += '\n'; break;
+        case 'r':  m_text += '\r'; break;
+        case 't':  m_text += '\t'; break;
+        case 'u': {
+            unsigned long codepoint;
+            if (!read_hex4(m_pos, m_end, codepoint)) {
+                fail("bad \\u escape");
+                return false;
+            }
+            m_pos += 4;
+
+            // A high surrogate followed by a low one encodes a single codepoint.
+            unsigned long low;
+            if (codepoint >= 0xD800 && codepoint <= 0xDBFF && m_end - m_pos >= 6
+             && m_pos[0] == '\\' && m_pos[1] == 'u' && read_hex4(m_pos + 2, m_end, low)
+             && low >= 0xDC00 && low <= 0xDFFF) {
+                codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                m_pos += 6;
+            }
+
+            append_utf8(m_text, codepoint);
+            break;
+        }
+        default:
+            fail("bad escape in string");
+            return false;
+        }
+    }
+}
+
+bool JsonPullParser::read_literal(const char *literal) {
+    size_t length = std::strlen(literal);
+
+    if ((size_t)(m_end - m_pos) < length || std::strncmp(m_pos, literal, length) != 0) {
+        fail("unexpected character");
+        return false;
+    }
+
+    m_pos += length;
+    return true;
+}
+
+bool JsonPullParser::read_number() {
+    const char *start = m_pos;
+
+    while (m_pos < m_end && (std::strchr("+-.eE", *m_pos) != nullptr || (*m_pos >= '0' && *m_pos <= '9')))
+        m_pos++;
+
+    m_text.assign(start, m_pos);
+    return true;
+}
+
+const char *JsonPullParser::describe(Token token) {
+    switch (token) {
+    case Token::BeginObject: return "the start of an object";
+    case Token::EndObject:   return "the end of an object";
+    case Token::BeginArray:  return "the start of an array";
+    case Token::EndArray:    return "the end of an array";
+    case Token::Key:         return "a key";
+    case Token::String:      return "a string";
+    case Token::Number:      return "a number";
+    case Token::True:
+    case Token::False:       return "a bool";
+    case Token::Null:        return "null";
+    case Token::End:         return "the end of the input";
+    default:                 return "a syntax error";
+    }
+}
+
+JsonPullParser::Token JsonPullParser::next() {
+    return read_token(true);
+}
+
+JsonPullParser::Token JsonPullParser::read_token(bool decode) {
+    if (!m_error.empty())
+        return Token::Error;
+
+    skip_whitespace();
+
+    if (m_pos < m_end && *m_pos == ',') {
+        if (m_stack.empty() || !m_after_value)
+            return fail("unexpected ','");
+        m_pos++;
+        m_expect_key = m_stack.back() == '{';
+        m_after_value = false;
+        skip_whitespace();
+        if (m_pos < m_end && (*m_pos == '}' || *m_pos == ']'))
+            return fail("unexpected ',' before closing bracket");
+    } else if (m_after_value && !m_stack.empty() && m_pos < m_end && *m_pos != '}' && *m_pos != ']') {
+        return fail("expected ',' or closing bracket");
+    }
+
+    if (m_pos >= m_end) {
+        if (!m_stack.empty())
+            return fail("unexpected end of input");
+        return Token::End;
+    }
+
+    switch (*m_pos) {
+    case '{':
+        if (m_expect_key)
+            return fail("expected a key");
+        m_pos++;
+        m_stack += '{';
+        m_expect_key = true;
+        m_after_value = false;
+        return Token::BeginObject;
+    case '[':
+        if (m_expect_key)
+            return fail("expected a key");
+        m_pos++;
+        m_stack += '[';
+        m_expect_key = false;
+        m_after_value = false;
+        return Token::BeginArray;
+    case '}':
+    case ']': {
+        char open = (*m_pos == '}') ? '{' : '[';
+        if (m_stack.empty() || m_stack.back() != open)
+            return fail("mismatched bracket");
+        // Only a key with no value can be left open at this point.
+        if (open == '{' && !m_expect_key && !m_after_value)
+            return fail("expected a value");
+        m_pos++;
+        m_stack.pop_back();
+        m_expect_key = false;
+        m_after_value = true;
+        return open == '{' ? Token::EndObject : Token::EndArray;
+    }
+    case '"':
+        if (!read_string(decode))
+            return Token::Error;
+        if (!m_expect_key) {
+            m_after_value = true;
+            return Token::String;
+        }
+        skip_whitespace();
+        if (m_pos >= m_end || *m_pos != ':')
+            return fail("expected ':' after key");
+        m_pos++;
+        m_expect_key = false;
+        return Token::Key;
+    }
+
+    if (m_expect_key)
+        return fail("expected a key");
+
+    m_after_value = true;
+
+    switch (*m_pos) {
+    case 't':
+        return read_literal("true") ? Token::True : Token::Error;
+    case 'f':
+        return read_literal("false") ? Token::False : Token::Error;
+    case 'n':
+        return read_literal("null") ? Token::Null : Token::Error;
+    default:
+        if (*m_pos == '-' || (*m_pos >= '0' && *m_pos <= '9')) {
+            read_number();
+            return Token::Number;
+        }
+        return fail("unexpected character");
+    }
+}
+
+bool JsonPullParser::skip_value() {
+    switch (read_token(false)) {
+    case Token::BeginObject:
+    case Token::BeginArray:
+        return skip_rest();
+    case Token::String:
+    case Token::Number:
+    case Token::True:
+    case Token::False:
+    case Token::Null:
+        return true;
+    default:
+        fail("expected a value");
+        return false;
+    }
+}
+
+bool JsonPullParser::skip_rest() {
+    if (m_stack.empty()) {
+        fail("not in an object or array");
+        return false;
+    }
+
+    size_t depth = m_stack.size();
+
+    for (;;) {
+        switch (read_token(false)) {
+        case Token::Error:
+            return false;
+        case Token::EndObject:
+        case Token::EndArray:
+            if (m_stack.size() < depth)
+                return true;
+            break;
+        default:
+            break;
+        }
+    }
+}
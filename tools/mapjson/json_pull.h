@@ -0,0 +1,72 @@
+// json_pull.h
+
+#ifndef JSON_PULL_H
+#define JSON_PULL_H
+
+#include <cstddef>
+#include <string>
+
+// A pull parser over JSON text that hands out one token at a time, so a
+// caller that only needs a few fields can skip everything else without
+// building a tree. Only keys and the string values the caller reads are
+// decoded; the text must outlive the parser.
+class JsonPullParser {
+public:
+    enum class Token {
+        BeginObject,
+        EndObject,
+        BeginArray,
+        EndArray,
+        Key,
+        String,
+        Number,
+        True,
+        False,
+        Null,
+        End,
+        Error,
+    };
+
+    JsonPullParser(const char *begin, const char *end);
+
+    // Reads the next token. Keys and strings are in text(), numbers as written.
+    Token next();
+
+    // Describes a token for error messages, e.g. "the end of an object".
+    static const char *describe(Token token);
+
+    // Skips the value that follows, including everything nested in it.
+    // Returns false on a syntax error.
+    bool skip_value();
+
+    // Skips the rest of the object or array that was just begun or is being
+    // read, through its closing bracket. It is checked like everything else,
+    // only without decoding its strings. Returns false on a syntax error.
+    bool skip_rest();
+
+    const std::string &text() const { return m_text; }
+    const std::string &error() const { return m_error; }
+    size_t offset() const { return m_pos - m_begin; }
+
+private:
+    Token read_token(bool decode);
+    Token fail(const char *message);
+    void skip_whitespace();
+    bool read_string(bool decode);
+    bool read_literal(const char *literal);
+    bool read_number();
+
+    const char *m_begin;
+    const char *m_pos;
+    const char *m_end;
+    std::string m_text;
+    std::string m_error;
+    // Whether the parser is in an object and the next string is a key.
+    bool m_expect_key;
+    // Whether a value was just read, so a ',' or a closing bracket must follow.
+    bool m_after_value;
+    // The open objects ('{') and arrays ('[') around the current position.
+    std::string m_stack;
+};
+
+#endif // JSON_PULL_H
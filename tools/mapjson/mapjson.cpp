@@ -15,9 +15,22 @@ using std::sort; using std::find;
 #include <map>
 using std::map;
 
+#include <unordered_map>
+using std::unordered_map;
+
+#include <atomic>
+using std::atomic;
+
+#include <thread>
+using std::thread;
+
 #include <fstream>
 using std::ofstream; using std::ifstream;
 
+#include <iterator>
+
+#include <cstdlib>
+
 #include <sstream>
 using std::ostringstream;
 
@@ -27,6 +40,8 @@ using std::numeric_limits;
 #include "json11.h"
 using json11::Json;
 
+#include "json_pull.h"
+
 #include "mapjson.h"
 
 string version;
@@ -63,6 +78,23 @@ void write_text_file(string filepath, string text) {
     out_file.close();
 }
 
+// Leaves the file (and its mtime) alone if it already has this content.
+// Only `all` uses this: its stamp records when the outputs were last brought
+// up to date, while the other modes' outputs must be newer than their inputs.
+// Returns whether it was written.
+bool write_text_file_if_changed(string filepath, string text) {
+    ifstream in_file(filepath, std::ifstream::binary);
+
+    if (in_file.is_open()) {
+        string old_text((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+        if (old_text == text)
+            return false;
+    }
+
+    write_text_file(filepath, text);
+    return true;
+}
+
 
 string json_to_string(const Json &data, const string &field = "", bool silent = false) {
     const Json value = !field.empty() ? data[field] : data;
@@ -119,20 +151,32 @@ string get_include_guard_end(const string &name) {
     return guard.str();
 }
 
-string generate_map_header_text(Json map_data, Json layouts_data) {
-    string map_layout_id = json_to_string(map_data, "layout");
+// What a map header needs from its layout. Holds the layout's name as
+// json_to_string would convert it, unless it isn't a string, number, bool or
+// null, and is marked invalid when its id is used by more than one layout, so
+// that looking it up fails just like looking up an unknown one.
+struct LayoutRef {
+    string name;
+    bool name_is_scalar = true;
+    bool valid = true;
+};
 
-    vector<Json> matched;
+typedef unordered_map<string, LayoutRef> LayoutIndex;
 
-    for (auto &layout : layouts_data["layouts"].array_items()) {
-        if (map_layout_id == json_to_string(layout, "id", true))
-            matched.push_back(layout);
-    }
+string generate_map_header_text(Json map_data, const LayoutIndex &layouts) {
+    string map_layout_id = json_to_string(map_data, "layout");
 
-    if (matched.size() != 1)
+    auto match = layouts.find(map_layout_id);
+
+    if (match == layouts.end() || !match->second.valid)
         FATAL_ERROR("Failed to find matching layout for %s.\n", map_layout_id.c_str());
 
-    Json layout = matched[0];
+    const LayoutRef &layout = match->second;
+
+    if (!layout.name_is_scalar)
+        FATAL_ERROR("Value for 'name' is unexpected type; expected string, number, or bool.\n");
+    if (layout.name.empty())
+        FATAL_ERROR("Value for 'name' cannot be empty.\n");
 
     ostringstream text;
 
@@ -140,7 +184,7 @@ string generate_map_header_text(Json map_data, Json layouts_data) {
     text << get_generated_warning("data/maps/" + mapName + "/map.json", true);
 
     text << mapName << ":\n"
-         << "\t.4byte " << json_to_string(layout, "name") << "\n";
+         << "\t.4byte " << layout.name << "\n";
 
     if (map_data.object_items().find("shared_events_map") != map_data.object_items().end())
         text << "\t.4byte " << json_to_string(map_data, "shared_events_map") << "_MapEvents\n";
@@ -159,7 +203,7 @@ string generate_map_header_text(Json map_data, Json layouts_data) {
         text << "\t.4byte NULL\n";
 
     text << "\t.2byte " << json_to_string(map_data, "music") << "\n"
-         << "\t.2byte " << json_to_string(layout, "id") << "\n"
+         << "\t.2byte " << map_layout_id << "\n"
          << "\t.byte "  << json_to_string(map_data, "region_map_section") << "\n"
          << "\t.byte "  << json_to_string(map_data, "requires_flash") << "\n"
          << "\t.byte "  << json_to_string(map_data, "weather") << "\n"
@@ -367,28 +411,177 @@ string file_parent(string filename){
     return filename.substr(0, dir_pos + 1);
 }
 
-void process_map(string map_filepath, string layouts_filepath, string output_dir) {
-    string mapdata_err, layouts_err;
+void fail_syntax(const JsonPullParser &parser, string filepath) {
+    FATAL_ERROR("%s: %s\n", filepath.c_str(), parser.error().c_str());
+}
 
-    string mapdata_json_text = read_text_file(map_filepath);
+// Exits with what was expected where the unexpected token was found, or with
+// the parser's error if the token is one.
+void fail_unexpected(const JsonPullParser &parser, JsonPullParser::Token token, string filepath, string expected) {
+    if (token == JsonPullParser::Token::Error)
+        fail_syntax(parser, filepath);
+    FATAL_ERROR("%s: expected %s at offset %zu, got %s.\n", filepath.c_str(), expected.c_str(),
+                parser.offset(), JsonPullParser::describe(token));
+}
+
+// Converts the value of key that follows the way json_to_string converts a
+// parsed one, skipping it and returning false if it's an object or array.
+bool read_scalar(JsonPullParser &parser, string filepath, string key, string &value) {
+    JsonPullParser::Token token = parser.next();
+
+    switch (token) {
+        case JsonPullParser::Token::String:
+            value = parser.text();
+            return true;
+        case JsonPullParser::Token::Number:
+            value = std::to_string(static_cast<int>(strtod(parser.text().c_str(), nullptr)));
+            return true;
+        case JsonPullParser::Token::True:
+            value = "TRUE";
+            return true;
+        case JsonPullParser::Token::False:
+            value = "FALSE";
+            return true;
+        case JsonPullParser::Token::Null:
+            value = "";
+            return true;
+        case JsonPullParser::Token::BeginObject:
+        case JsonPullParser::Token::BeginArray:
+            value = "";
+            if (!parser.skip_rest())
+                fail_syntax(parser, filepath);
+            return false;
+        default:
+            fail_unexpected(parser, token, filepath, "a value for '" + key + "'");
+            return false;
+    }
+}
+
+// Reads the layouts' ids and names from layouts.json without building the
+// rest of it, which only matters to the layouts mode. Every other field is
+// skipped over rather than parsed.
+LayoutIndex read_layouts(string layouts_filepath) {
     string layouts_json_text = read_text_file(layouts_filepath);
+    const char *text = layouts_json_text.data();
+    JsonPullParser parser(text, text + layouts_json_text.size());
+    LayoutIndex layouts;
+    JsonPullParser::Token token;
+
+    if ((token = parser.next()) != JsonPullParser::Token::BeginObject)
+        fail_unexpected(parser, token, layouts_filepath, "an object");
+
+    while ((token = parser.next()) != JsonPullParser::Token::EndObject) {
+        if (token != JsonPullParser::Token::Key)
+            fail_unexpected(parser, token, layouts_filepath, "a key");
+
+        if (parser.text() != "layouts") {
+            if (!parser.skip_value())
+                fail_syntax(parser, layouts_filepath);
+            continue;
+        }
+
+        // A repeated key replaces the earlier value, as it does when parsed.
+        layouts.clear();
+
+        token = parser.next();
+        if (token == JsonPullParser::Token::Error)
+            fail_syntax(parser, layouts_filepath);
+        if (token != JsonPullParser::Token::BeginArray) {
+            if (token == JsonPullParser::Token::BeginObject && !parser.skip_rest())
+                fail_syntax(parser, layouts_filepath);
+            continue;
+        }
+
+        while ((token = parser.next()) != JsonPullParser::Token::EndArray) {
+            string id;
+            LayoutRef layout;
+
+            if (token == JsonPullParser::Token::BeginObject) {
+                while ((token = parser.next()) != JsonPullParser::Token::EndObject) {
+                    if (token != JsonPullParser::Token::Key)
+                        fail_unexpected(parser, token, layouts_filepath, "a key");
+
+                    if (parser.text() == "id") {
+                        read_scalar(parser, layouts_filepath, "id", id);
+                    } else if (parser.text() == "name") {
+                        layout.name_is_scalar = read_scalar(parser, layouts_filepath, "name", layout.name);
+                    } else if (!parser.skip_value()) {
+                        fail_syntax(parser, layouts_filepath);
+                    }
+                }
+            } else if (token == JsonPullParser::Token::BeginArray) {
+                if (!parser.skip_rest())
+                    fail_syntax(parser, layouts_filepath);
+            } else if (token == JsonPullParser::Token::Error) {
+                fail_syntax(parser, layouts_filepath);
+            }
+
+            auto inserted = layouts.emplace(id, layout);
+            if (!inserted.second)
+                inserted.first->second.valid = false;
+        }
+    }
+
+    if (parser.next() != JsonPullParser::Token::End)
+        FATAL_ERROR("%s: unexpected data after the top-level object.\n", layouts_filepath.c_str());
+
+    return layouts;
+}
+
+// Returns the number of files written.
+int write_map_files(string map_filepath, const LayoutIndex &layouts, string output_dir, bool only_if_changed) {
+    string mapdata_err;
+
+    string mapdata_json_text = read_text_file(map_filepath);
 
     Json map_data = Json::parse(mapdata_json_text, mapdata_err);
     if (map_data == Json())
         FATAL_ERROR("%s\n", mapdata_err.c_str());
 
-    Json layouts_data = Json::parse(layouts_json_text, layouts_err);
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", layouts_err.c_str());
-
-    string header_text = generate_map_header_text(map_data, layouts_data);
+    string header_text = generate_map_header_text(map_data, layouts);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
 
     string out_dir = strip_trailing_separator(output_dir).append(sep);
-    write_text_file(out_dir + "header.inc", header_text);
-    write_text_file(out_dir + "events.inc", events_text);
-    write_text_file(out_dir + "connections.inc", connections_text);
+    if (!only_if_changed) {
+        write_text_file(out_dir + "header.inc", header_text);
+        write_text_file(out_dir + "events.inc", events_text);
+        write_text_file(out_dir + "connections.inc", connections_text);
+        return 3;
+    }
+
+    return write_text_file_if_changed(out_dir + "header.inc", header_text)
+         + write_text_file_if_changed(out_dir + "events.inc", events_text)
+         + write_text_file_if_changed(out_dir + "connections.inc", connections_text);
+}
+
+void process_map(string map_filepath, string layouts_filepath, string output_dir) {
+    write_map_files(map_filepath, read_layouts(layouts_filepath), output_dir, false);
+}
+
+// Writes the .inc files of every map next to its map.json, reading the
+// layouts once and converting maps on all hardware threads.
+void process_all_maps(string layouts_filepath, const vector<string> &map_filepaths) {
+    LayoutIndex layouts = read_layouts(layouts_filepath);
+    atomic<size_t> next_map(0);
+    atomic<int> num_written(0);
+
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next_map++) < map_filepaths.size())
+            num_written += write_map_files(map_filepaths[i], layouts, file_parent(map_filepaths[i]), true);
+    };
+
+    unsigned num_threads = std::max(1u, std::min(thread::hardware_concurrency(), (unsigned)map_filepaths.size()));
+    vector<thread> threads;
+
+    for (unsigned i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &t : threads)
+        t.join();
+
+    cout << "mapjson: converted " << map_filepaths.size() << " maps, " << num_written << " files changed" << endl;
 }
 
 void process_event_constants(const vector<string> &map_filepaths, string output_ids_file) {
@@ -716,6 +909,17 @@ int main(int argc, char *argv[]) {
 
         process_layouts(filepath, output_asm, output_c);
     }
+    else if (mode == "all") {
+        if (argc < 5)
+            FATAL_ERROR("USAGE: mapjson all <game-version> <layouts_file> <map_file> [additional_map_files]\n");
+
+        infer_separator(argv[4]);
+        string layouts_filepath(argv[3]);
+
+        vector<string> filepaths(argv + 4, argv + argc);
+
+        process_all_maps(layouts_filepath, filepaths);
+    }
     else if (mode == "event_constants") {
         if (argc < 5)
             FATAL_ERROR("USAGE: mapjson event_constants <game-version> <map_file> [additional_map_files] <output_ids_file>");
@@ -733,7 +937,7 @@ int main(int argc, char *argv[]) {
         process_event_constants(filepaths, output_ids_file);
     }
     else {
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'event_constants', or 'groups'.\n");
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'all', 'event_constants', or 'groups'.\n");
     }
 
     return 0;
@@ -24,126 +24,159 @@
 #include <cstring>
 #include <vector>
 #include "agb.h"
-#include "main.h"
+#include "song.h"
 #include "midi.h"
 #include "tables.h"
 
-int g_agbTrack;
-
-static std::string s_lastOpName;
-static int s_blockNum;
-static bool s_keepLastOpName;
-static int s_lastNote;
-static int s_lastVelocity;
-static bool s_noteChanged;
-static bool s_velocityChanged;
-static bool s_inPattern;
-static int s_extendedCommand;
-static int s_memaccOp;
-static int s_memaccParam1;
-static int s_memaccParam2;
-
-void PrintAgbHeader()
+// Appends to the output, unless a track is only being measured.
+static void Write(Song& song, const char *format, ...)
 {
-    std::fprintf(g_outputFile, "\t.include \"MPlayDef.s\"\n\n");
-    std::fprintf(g_outputFile, "\t.equ\t%s_grp, voicegroup%03u\n", g_asmLabel.c_str(), g_voiceGroup);
-    std::fprintf(g_outputFile, "\t.equ\t%s_pri, %u\n", g_asmLabel.c_str(), g_priority);
+    if (song.measuring)
+        return;
 
-    if (g_reverb >= 0)
-        std::fprintf(g_outputFile, "\t.equ\t%s_rev, reverb_set+%u\n", g_asmLabel.c_str(), g_reverb);
+    char buffer[256];
+    std::va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (length < (int)sizeof(buffer))
+    {
+        song.output.append(buffer, length);
+    }
+    else
+    {
+        std::vector<char> longBuffer(length + 1);
+        va_start(args, format);
+        std::vsnprintf(longBuffer.data(), longBuffer.size(), format, args);
+        va_end(args);
+        song.output.append(longBuffer.data(), length);
+    }
+}
+
+// Counts the values in a comma-separated list of .byte operands.
+static int CountBytes(const char *operands)
+{
+    int count = 1;
+
+    for (const char *p = operands; *p != 0; p++)
+    {
+        if (*p == ',')
+            count++;
+    }
+
+    return count;
+}
+
+void PrintAgbHeader(Song& song)
+{
+    Write(song, "\t.include \"MPlayDef.s\"\n\n");
+    Write(song, "\t.equ\t%s_grp, voicegroup%03u\n", song.asmLabel.c_str(), song.voiceGroup);
+    Write(song, "\t.equ\t%s_pri, %u\n", song.asmLabel.c_str(), song.priority);
+
+    if (song.reverb >= 0)
+        Write(song, "\t.equ\t%s_rev, reverb_set+%u\n", song.asmLabel.c_str(), song.reverb);
     else
-        std::fprintf(g_outputFile, "\t.equ\t%s_rev, 0\n", g_asmLabel.c_str());
+        Write(song, "\t.equ\t%s_rev, 0\n", song.asmLabel.c_str());
 
-    std::fprintf(g_outputFile, "\t.equ\t%s_mvl, %u\n", g_asmLabel.c_str(), g_masterVolume);
-    std::fprintf(g_outputFile, "\t.equ\t%s_key, %u\n", g_asmLabel.c_str(), 0);
-    std::fprintf(g_outputFile, "\t.equ\t%s_tbs, %u\n", g_asmLabel.c_str(), g_clocksPerBeat);
-    std::fprintf(g_outputFile, "\t.equ\t%s_exg, %u\n", g_asmLabel.c_str(), g_exactGateTime);
-    std::fprintf(g_outputFile, "\t.equ\t%s_cmp, %u\n", g_asmLabel.c_str(), g_compressionEnabled);
+    Write(song, "\t.equ\t%s_mvl, %u\n", song.asmLabel.c_str(), song.masterVolume);
+    Write(song, "\t.equ\t%s_key, %u\n", song.asmLabel.c_str(), 0);
+    Write(song, "\t.equ\t%s_tbs, %u\n", song.asmLabel.c_str(), song.clocksPerBeat);
+    Write(song, "\t.equ\t%s_exg, %u\n", song.asmLabel.c_str(), song.exactGateTime);
+    Write(song, "\t.equ\t%s_cmp, %u\n", song.asmLabel.c_str(), song.compressionEnabled);
 
-    std::fprintf(g_outputFile, "\n\t.section .rodata\n");
-    std::fprintf(g_outputFile, "\t.global\t%s\n", g_asmLabel.c_str());
+    Write(song, "\n\t.section .rodata\n");
+    Write(song, "\t.global\t%s\n", song.asmLabel.c_str());
 
-    std::fprintf(g_outputFile, "\t.align\t2\n");
+    Write(song, "\t.align\t2\n");
 }
 
-void ResetTrackVars()
+void ResetTrackVars(Song& song)
 {
-    s_lastVelocity = -1;
-    s_lastNote = -1;
-    s_velocityChanged = false;
-    s_noteChanged = false;
-    s_keepLastOpName = false;
-    s_lastOpName = "";
-    s_inPattern = false;
+    song.lastVelocity = -1;
+    song.lastNote = -1;
+    song.velocityChanged = false;
+    song.noteChanged = false;
+    song.keepLastOpName = false;
+    song.lastOpName = "";
+    song.inPattern = false;
 }
 
-void PrintWait(int wait)
+void PrintWait(Song& song, int wait)
 {
     if (wait > 0)
     {
-        std::fprintf(g_outputFile, "\t.byte\tW%02d\n", wait);
-        s_velocityChanged = true;
-        s_noteChanged = true;
-        s_keepLastOpName = true;
+        Write(song, "\t.byte\tW%02d\n", wait);
+        song.byteCount++;
+        song.velocityChanged = true;
+        song.noteChanged = true;
+        song.keepLastOpName = true;
     }
 }
 
-void PrintOp(int wait, std::string name, const char *format, ...)
+void PrintOp(Song& song, int wait, std::string name, const char *format, ...)
 {
-    std::va_list args;
-    va_start(args, format);
-    std::fprintf(g_outputFile, "\t.byte\t\t");
+    Write(song, "\t.byte\t\t");
 
     if (format != nullptr)
     {
-        if (!g_compressionEnabled || s_lastOpName != name)
+        char operands[256];
+        std::va_list args;
+        va_start(args, format);
+        std::vsnprintf(operands, sizeof(operands), format, args);
+        va_end(args);
+
+        if (!song.compressionEnabled || song.lastOpName != name)
         {
-            std::fprintf(g_outputFile, "%s, ", name.c_str());
-            s_lastOpName = name;
+            Write(song, "%s, ", name.c_str());
+            song.lastOpName = name;
+            song.byteCount++;
         }
         else
         {
-            std::fprintf(g_outputFile, "        ");
+            Write(song, "        ");
         }
-        std::vfprintf(g_outputFile, format, args);
+        Write(song, "%s", operands);
+        song.byteCount += CountBytes(operands);
     }
     else
     {
-        std::fputs(name.c_str(), g_outputFile);
-        s_lastOpName = name;
+        Write(song, "%s", name.c_str());
+        song.lastOpName = name;
+        song.byteCount++;
     }
 
-    std::fprintf(g_outputFile, "\n");
-
-    va_end(args);
+    Write(song, "\n");
 
-    PrintWait(wait);
+    PrintWait(song, wait);
 }
 
-void PrintByte(const char *format, ...)
+void PrintByte(Song& song, const char *format, ...)
 {
+    char operands[256];
     std::va_list args;
     va_start(args, format);
-    std::fprintf(g_outputFile, "\t.byte\t");
-    std::vfprintf(g_outputFile, format, args);
-    std::fprintf(g_outputFile, "\n");
-    s_velocityChanged = true;
-    s_noteChanged = true;
-    s_keepLastOpName = true;
+    std::vsnprintf(operands, sizeof(operands), format, args);
     va_end(args);
+    Write(song, "\t.byte\t%s\n", operands);
+    song.byteCount += CountBytes(operands);
+    song.velocityChanged = true;
+    song.noteChanged = true;
+    song.keepLastOpName = true;
 }
 
-void PrintWord(const char *format, ...)
+void PrintWord(Song& song, const char *format, ...)
 {
+    char operand[256];
     std::va_list args;
     va_start(args, format);
-    std::fprintf(g_outputFile, "\t .word\t");
-    std::vfprintf(g_outputFile, format, args);
-    std::fprintf(g_outputFile, "\n");
+    std::vsnprintf(operand, sizeof(operand), format, args);
     va_end(args);
+    Write(song, "\t .word\t%s\n", operand);
+    song.byteCount += 4;
 }
 
-void PrintNote(const Event& event)
+void PrintNote(Song& song, const Event& event)
 {
     int note = event.note;
     int velocity = g_noteVelocityLUT[event.param1];
@@ -154,7 +187,7 @@ void PrintNote(const Event& event)
 
     int gateTimeParam = 0;
 
-    if (g_exactGateTime && duration != -1)
+    if (song.exactGateTime && duration != -1)
         gateTimeParam = event.param2 - duration;
 
     char gtpBuf[16];
@@ -174,20 +207,20 @@ void PrintNote(const Event& event)
     bool noteChanged = true;
     bool velocityChanged = true;
 
-    if (g_compressionEnabled)
+    if (song.compressionEnabled)
     {
-        noteChanged = (note != s_lastNote);
-        velocityChanged = (velocity != s_lastVelocity);
+        noteChanged = (note != song.lastNote);
+        velocityChanged = (velocity != song.lastVelocity);
     }
 
-    if (s_keepLastOpName)
-        s_keepLastOpName = false;
+    if (song.keepLastOpName)
+        song.keepLastOpName = false;
     else
-        s_lastOpName = "";
+        song.lastOpName = "";
 
     if (noteChanged || velocityChanged || (gateTimeParam > 0))
     {
-        s_lastNote = note;
+        song.lastNote = note;
 
         char noteBuf[16];
 
@@ -200,7 +233,7 @@ void PrintNote(const Event& event)
 
         if (velocityChanged || (gateTimeParam > 0))
         {
-            s_lastVelocity = velocity;
+            song.lastVelocity = velocity;
             std::snprintf(velocityBuf, sizeof(velocityBuf), ", v%03u", velocity);
         }
         else
@@ -208,70 +241,70 @@ void PrintNote(const Event& event)
             velocityBuf[0] = 0;
         }
 
-        PrintOp(event.time, opName, "%s%s%s", noteBuf, velocityBuf, gtpBuf);
+        PrintOp(song, event.time, opName, "%s%s%s", noteBuf, velocityBuf, gtpBuf);
     }
     else
     {
-        PrintOp(event.time, opName, 0);
+        PrintOp(song, event.time, opName, 0);
     }
 
-    s_noteChanged = noteChanged;
-    s_velocityChanged = velocityChanged;
+    song.noteChanged = noteChanged;
+    song.velocityChanged = velocityChanged;
 }
 
-void PrintEndOfTieOp(const Event& event)
+void PrintEndOfTieOp(Song& song, const Event& event)
 {
     int note = event.note;
-    bool noteChanged = (note != s_lastNote);
+    bool noteChanged = (note != song.lastNote);
 
-    if (!noteChanged || !s_noteChanged)
-        s_lastOpName = "";
+    if (!noteChanged || !song.noteChanged)
+        song.lastOpName = "";
 
-    if (!noteChanged && g_compressionEnabled)
+    if (!noteChanged && song.compressionEnabled)
     {
-        PrintOp(event.time, "EOT   ", nullptr);
+        PrintOp(song, event.time, "EOT   ", nullptr);
     }
     else
     {
-        s_lastNote = note;
+        song.lastNote = note;
         if (note >= 24)
-            PrintOp(event.time, "EOT   ", g_noteTable[note % 12], note / 12 - 2);
+            PrintOp(song, event.time, "EOT   ", g_noteTable[note % 12], note / 12 - 2);
         else
-            PrintOp(event.time, "EOT   ", g_minusNoteTable[note % 12], note / -12 + 2);
+            PrintOp(song, event.time, "EOT   ", g_minusNoteTable[note % 12], note / -12 + 2);
     }
 
-    s_noteChanged = noteChanged;
+    song.noteChanged = noteChanged;
 }
 
-void PrintSeqLoopLabel(const Event& event)
+void PrintSeqLoopLabel(Song& song, const Event& event)
 {
-    s_blockNum = event.param1 + 1;
-    std::fprintf(g_outputFile, "%s_%u_B%u:\n", g_asmLabel.c_str(), g_agbTrack, s_blockNum);
-    PrintWait(event.time);
-    ResetTrackVars();
+    song.blockNum = event.param1 + 1;
+    Write(song, "%s_%u_B%u:\n", song.asmLabel.c_str(), song.agbTrack, song.blockNum);
+    PrintWait(song, event.time);
+    ResetTrackVars(song);
 }
 
-void PrintMemAcc(const Event& event)
+void PrintMemAcc(Song& song, const Event& event)
 {
-    switch (s_memaccOp)
+    switch (song.memaccOp)
     {
     case 0x00:
-        PrintByte("MEMACC, mem_set, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_set, 0x%02X, %u", song.memaccParam1, event.param2);
         break;
     case 0x01:
-        PrintByte("MEMACC, mem_add, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_add, 0x%02X, %u", song.memaccParam1, event.param2);
         break;
     case 0x02:
-        PrintByte("MEMACC, mem_sub, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_sub, 0x%02X, %u", song.memaccParam1, event.param2);
         break;
     case 0x03:
-        PrintByte("MEMACC, mem_mem_set, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_mem_set, 0x%02X, 0x%02X", song.memaccParam1, event.param2);
         break;
     case 0x04:
-        PrintByte("MEMACC, mem_mem_add, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_mem_add, 0x%02X, 0x%02X", song.memaccParam1, event.param2);
         break;
     case 0x05:
-        PrintByte("MEMACC, mem_mem_sub, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_mem_sub, 0x%02X, 0x%02X", song.memaccParam1, event.param2);
         break;
     // TODO: everything else
     case 0x06:
@@ -326,104 +359,106 @@ void PrintMemAcc(const Event& event)
         break;
     }
 
-    PrintWait(event.time);
+    PrintWait(song, event.time);
 }
 
-void PrintExtendedOp(const Event& event)
+void PrintExtendedOp(Song& song, const Event& event)
 {
     // TODO: support for other extended commands
 
-    switch (s_extendedCommand)
+    switch (song.extendedCommand)
     {
     case 0x08:
-        PrintOp(event.time, "XCMD  ", "xIECV , %u", event.param2);
+        PrintOp(song, event.time, "XCMD  ", "xIECV , %u", event.param2);
         break;
     case 0x09:
-        PrintOp(event.time, "XCMD  ", "xIECL , %u", event.param2);
+        PrintOp(song, event.time, "XCMD  ", "xIECL , %u", event.param2);
         break;
     default:
-        PrintWait(event.time);
+        PrintWait(song, event.time);
         break;
     }
 }
 
-void PrintControllerOp(const Event& event)
+void PrintControllerOp(Song& song, const Event& event)
 {
     switch (event.param1)
     {
     case 0x01:
-        PrintOp(event.time, "MOD   ", "%u", event.param2);
+        PrintOp(song, event.time, "MOD   ", "%u", event.param2);
         break;
     case 0x07:
-        PrintOp(event.time, "VOL   ", "%u*%s_mvl/mxv", event.param2, g_asmLabel.c_str());
+        PrintOp(song, event.time, "VOL   ", "%u*%s_mvl/mxv", event.param2, song.asmLabel.c_str());
         break;
     case 0x0A:
-        PrintOp(event.time, "PAN   ", "c_v%+d", event.param2 - 64);
+        PrintOp(song, event.time, "PAN   ", "c_v%+d", event.param2 - 64);
         break;
     case 0x0C:
     case 0x10:
-        PrintMemAcc(event);
+        PrintMemAcc(song, event);
         break;
     case 0x0D:
-        s_memaccOp = event.param2;
-        PrintWait(event.time);
+        song.memaccOp = event.param2;
+        PrintWait(song, event.time);
         break;
     case 0x0E:
-        s_memaccParam1 = event.param2;
-        PrintWait(event.time);
+        song.memaccParam1 = event.param2;
+        PrintWait(song, event.time);
         break;
     case 0x0F:
-        s_memaccParam2 = event.param2;
-        PrintWait(event.time);
+        song.memaccParam2 = event.param2;
+        PrintWait(song, event.time);
         break;
     case 0x11:
-        std::fprintf(g_outputFile, "%s_%u_L%u:\n", g_asmLabel.c_str(), g_agbTrack, event.param2);
-        PrintWait(event.time);
-        ResetTrackVars();
+        Write(song, "%s_%u_L%u:\n", song.asmLabel.c_str(), song.agbTrack, event.param2);
+        PrintWait(song, event.time);
+        ResetTrackVars(song);
         break;
     case 0x14:
-        PrintOp(event.time, "BENDR ", "%u", event.param2);
+        PrintOp(song, event.time, "BENDR ", "%u", event.param2);
         break;
     case 0x15:
-        PrintOp(event.time, "LFOS  ", "%u", event.param2);
+        PrintOp(song, event.time, "LFOS  ", "%u", event.param2);
         break;
     case 0x16:
-        PrintOp(event.time, "MODT  ", "%u", event.param2);
+        PrintOp(song, event.time, "MODT  ", "%u", event.param2);
         break;
     case 0x18:
-        PrintOp(event.time, "TUNE  ", "c_v%+d", event.param2 - 64);
+        PrintOp(song, event.time, "TUNE  ", "c_v%+d", event.param2 - 64);
         break;
     case 0x1A:
-        PrintOp(event.time, "LFODL ", "%u", event.param2);
+        PrintOp(song, event.time, "LFODL ", "%u", event.param2);
         break;
     case 0x1D:
     case 0x1F:
-        PrintExtendedOp(event);
+        PrintExtendedOp(song, event);
         break;
     case 0x1E:
-        s_extendedCommand = event.param2;
+        song.extendedCommand = event.param2;
         // TODO: loop op
         break;
     case 0x21:
     case 0x27:
-        PrintByte("PRIO  , %u", event.param2);
-        PrintWait(event.time);
+        PrintByte(song, "PRIO  , %u", event.param2);
+        PrintWait(song, event.time);
         break;
     default:
-        PrintWait(event.time);
+        PrintWait(song, event.time);
         break;
     }
 }
 
-void PrintAgbTrack(std::vector<Event>& events)
+// Prints a track, storing the number of bytes each event took in eventBytes
+// if it isn't null.
+static void PrintTrack(Song& song, std::vector<Event>& events, std::vector<int> *eventBytes)
 {
-    std::fprintf(g_outputFile, "\n@**************** Track %u (Midi-Chn.%u) ****************@\n\n", g_agbTrack, g_midiChan + 1);
-    std::fprintf(g_outputFile, "%s_%u:\n", g_asmLabel.c_str(), g_agbTrack);
+    Write(song, "\n@**************** Track %u (Midi-Chn.%u) ****************@\n\n", song.agbTrack, song.midiChan + 1);
+    Write(song, "%s_%u:\n", song.asmLabel.c_str(), song.agbTrack);
 
     int wholeNoteCount = 0;
     int loopEndBlockNum = 0;
 
-    ResetTrackVars();
+    ResetTrackVars(song);
 
     bool foundVolBeforeNote = false;
 
@@ -440,109 +475,163 @@ void PrintAgbTrack(std::vector<Event>& events)
     }
 
     if (!foundVolBeforeNote)
-        PrintByte("\tVOL   , 127*%s_mvl/mxv", g_asmLabel.c_str());
+        PrintByte(song, "\tVOL   , 127*%s_mvl/mxv", song.asmLabel.c_str());
 
-    PrintWait(g_initialWait);
-    PrintByte("KEYSH , %s_key%+d", g_asmLabel.c_str(), 0);
+    PrintWait(song, song.initialWait);
+    PrintByte(song, "KEYSH , %s_key%+d", song.asmLabel.c_str(), 0);
+
+    if (eventBytes != nullptr)
+        eventBytes->assign(events.size(), 0);
 
     for (unsigned i = 0; events[i].type != EventType::EndOfTrack; i++)
     {
         const Event& event = events[i];
+        unsigned start = i;
+        int startByteCount = song.byteCount;
 
         if (IsPatternBoundary(event.type))
         {
-            if (s_inPattern)
-                PrintByte("PEND");
-            s_inPattern = false;
+            if (song.inPattern)
+                PrintByte(song, "PEND");
+            song.inPattern = false;
         }
 
         if (event.type == EventType::WholeNoteMark || event.type == EventType::Pattern)
-            std::fprintf(g_outputFile, "@ %03d   ----------------------------------------\n", wholeNoteCount++);
+            Write(song, "@ %03d   ----------------------------------------\n", wholeNoteCount++);
 
         switch (event.type)
         {
         case EventType::Note:
-            PrintNote(event);
+            PrintNote(song, event);
             break;
         case EventType::EndOfTie:
-            PrintEndOfTieOp(event);
+            PrintEndOfTieOp(song, event);
             break;
         case EventType::Label:
-            PrintSeqLoopLabel(event);
+            PrintSeqLoopLabel(song, event);
             break;
         case EventType::LoopEnd:
-            PrintByte("GOTO");
-            PrintWord("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum);
-            PrintSeqLoopLabel(event);
+            PrintByte(song, "GOTO");
+            PrintWord(song, "%s_%u_B%u", song.asmLabel.c_str(), song.agbTrack, loopEndBlockNum);
+            PrintSeqLoopLabel(song, event);
             break;
         case EventType::LoopEndBegin:
-            PrintByte("GOTO");
-            PrintWord("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum);
-            PrintSeqLoopLabel(event);
-            loopEndBlockNum = s_blockNum;
+            PrintByte(song, "GOTO");
+            PrintWord(song, "%s_%u_B%u", song.asmLabel.c_str(), song.agbTrack, loopEndBlockNum);
+            PrintSeqLoopLabel(song, event);
+            loopEndBlockNum = song.blockNum;
             break;
         case EventType::LoopBegin:
-            PrintSeqLoopLabel(event);
-            loopEndBlockNum = s_blockNum;
+            PrintSeqLoopLabel(song, event);
+            loopEndBlockNum = song.blockNum;
             break;
         case EventType::WholeNoteMark:
             if (event.param2 & 0x80000000)
             {
-                std::fprintf(g_outputFile, "%s_%u_%03lu:\n", g_asmLabel.c_str(), g_agbTrack, (unsigned long)(event.param2 & 0x7FFFFFFF));
-                ResetTrackVars();
-                s_inPattern = true;
+                Write(song, "%s_%u_%03lu:\n", song.asmLabel.c_str(), song.agbTrack, (unsigned long)(event.param2 & 0x7FFFFFFF));
+                ResetTrackVars(song);
+                song.inPattern = true;
             }
-            PrintWait(event.time);
+            PrintWait(song, event.time);
             break;
         case EventType::Pattern:
-            PrintByte("PATT");
-            PrintWord("%s_%u_%03lu", g_asmLabel.c_str(), g_agbTrack, event.param2);
+            PrintByte(song, "PATT");
+            PrintWord(song, "%s_%u_%03lu", song.asmLabel.c_str(), song.agbTrack, event.param2);
 
             while (!IsPatternBoundary(events[i + 1].type))
                 i++;
 
-            ResetTrackVars();
+            ResetTrackVars(song);
+            break;
+        case EventType::PatternStart:
+            Write(song, "%s_%u_P%03d:\n", song.asmLabel.c_str(), song.agbTrack, event.param2);
+            ResetTrackVars(song);
+            break;
+        case EventType::PatternEnd:
+            PrintByte(song, "PEND");
+            break;
+        case EventType::PatternCall:
+            PrintByte(song, "PATT");
+            PrintWord(song, "%s_%u_P%03d", song.asmLabel.c_str(), song.agbTrack, event.param2);
+
+            // Skip the copy of the pattern, but keep counting whole notes.
+            while (events[++i].type != EventType::PatternEnd)
+            {
+                if (events[i].type == EventType::WholeNoteMark)
+                    wholeNoteCount++;
+            }
+
+            ResetTrackVars(song);
             break;
         case EventType::Tempo:
-            PrintByte("TEMPO , %u*%s_tbs/2", static_cast<int>(round(60000000.0f / static_cast<float>(event.param2))), g_asmLabel.c_str());
-            PrintWait(event.time);
+            PrintByte(song, "TEMPO , %u*%s_tbs/2", static_cast<int>(round(60000000.0f / static_cast<float>(event.param2))), song.asmLabel.c_str());
+            PrintWait(song, event.time);
             break;
         case EventType::InstrumentChange:
-            PrintOp(event.time, "VOICE ", "%u", event.param1);
+            PrintOp(song, event.time, "VOICE ", "%u", event.param1);
             break;
         case EventType::PitchBend:
-            PrintOp(event.time, "BEND  ", "c_v%+d", event.param2 - 64);
+            PrintOp(song, event.time, "BEND  ", "c_v%+d", event.param2 - 64);
             break;
         case EventType::Controller:
-            PrintControllerOp(event);
+            PrintControllerOp(song, event);
             break;
         default:
-            PrintWait(event.time);
+            PrintWait(song, event.time);
             break;
         }
+
+        if (eventBytes != nullptr)
+            (*eventBytes)[start] = song.byteCount - startByteCount;
     }
 
-    PrintByte("FINE");
+    PrintByte(song, "FINE");
+}
+
+void PrintAgbTrack(Song& song, std::vector<Event>& events)
+{
+    PrintTrack(song, events, nullptr);
+}
+
+int MeasureAgbTrack(Song& song, std::vector<Event>& events, std::vector<int> *eventBytes)
+{
+    // Printing changes state that carries over to the next track.
+    int extendedCommand = song.extendedCommand;
+    int memaccOp = song.memaccOp;
+    int memaccParam1 = song.memaccParam1;
+    int memaccParam2 = song.memaccParam2;
+
+    song.measuring = true;
+    song.byteCount = 0;
+    PrintTrack(song, events, eventBytes);
+    song.measuring = false;
+
+    song.extendedCommand = extendedCommand;
+    song.memaccOp = memaccOp;
+    song.memaccParam1 = memaccParam1;
+    song.memaccParam2 = memaccParam2;
+
+    return song.byteCount;
 }
 
-void PrintAgbFooter()
+void PrintAgbFooter(Song& song)
 {
-    int trackCount = g_agbTrack - 1;
-
-    std::fprintf(g_outputFile, "\n@******************************************************@\n");
-    std::fprintf(g_outputFile, "\t.align\t2\n");
-    std::fprintf(g_outputFile, "\n%s:\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\t.byte\t%u\t@ NumTrks\n", trackCount);
-    std::fprintf(g_outputFile, "\t.byte\t%u\t@ NumBlks\n", 0);
-    std::fprintf(g_outputFile, "\t.byte\t%s_pri\t@ Priority\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\t.byte\t%s_rev\t@ Reverb.\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\n");
-    std::fprintf(g_outputFile, "\t.word\t%s_grp\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\n");
+    int trackCount = song.agbTrack - 1;
+
+    Write(song, "\n@******************************************************@\n");
+    Write(song, "\t.align\t2\n");
+    Write(song, "\n%s:\n", song.asmLabel.c_str());
+    Write(song, "\t.byte\t%u\t@ NumTrks\n", trackCount);
+    Write(song, "\t.byte\t%u\t@ NumBlks\n", 0);
+    Write(song, "\t.byte\t%s_pri\t@ Priority\n", song.asmLabel.c_str());
+    Write(song, "\t.byte\t%s_rev\t@ Reverb.\n", song.asmLabel.c_str());
+    Write(song, "\n");
+    Write(song, "\t.word\t%s_grp\n", song.asmLabel.c_str());
+    Write(song, "\n");
 
     // track pointers
     for (int i = 1; i <= trackCount; i++)
-        std::fprintf(g_outputFile, "\t.word\t%s_%u\n", g_asmLabel.c_str(), i);
+        Write(song, "\t.word\t%s_%u\n", song.asmLabel.c_str(), i);
 
-    std::fprintf(g_outputFile, "\n\t.end\n");
+    Write(song, "\n\t.end\n");
 }
@@ -24,10 +24,13 @@
 #include <vector>
 #include "midi.h"
 
-void PrintAgbHeader();
-void PrintAgbTrack(std::vector<Event>& events);
-void PrintAgbFooter();
+struct Song;
 
-extern int g_agbTrack;
+void PrintAgbHeader(Song& song);
+void PrintAgbTrack(Song& song, std::vector<Event>& events);
+void PrintAgbFooter(Song& song);
+
+// Returns the number of bytes a track would take without printing it.
+int MeasureAgbTrack(Song& song, std::vector<Event>& events, std::vector<int> *eventBytes = nullptr);
 
 #endif // AGB_H
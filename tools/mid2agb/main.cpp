@@ -18,34 +18,29 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
-#include <cassert>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 #include <string>
-#include <set>
-#include "main.h"
+#include <thread>
+#include <vector>
 #include "error.h"
 #include "midi.h"
 #include "agb.h"
-
-FILE* g_inputFile = nullptr;
-FILE* g_outputFile = nullptr;
-
-std::string g_asmLabel;
-int g_masterVolume = 127;
-int g_voiceGroup = 0;
-int g_priority = 0;
-int g_reverb = -1;
-int g_clocksPerBeat = 1;
-bool g_exactGateTime = false;
-bool g_compressionEnabled = true;
+#include "song.h"
 
 [[noreturn]] static void PrintUsage()
 {
     std::printf(
         "Usage: MID2AGB name [options]\n"
+        "       MID2AGB --cfg midi.cfg [-j threads] [options]\n"
         "\n"
         "    input_file  filename(.mid) of MIDI file\n"
         "   output_file  filename(.s) for AGB file (default:input_file)\n"
@@ -58,6 +53,11 @@ bool g_compressionEnabled = true;
         "            -X  48 clocks/beat (default:24 clocks/beat)\n"
         "            -E  exact gate-time\n"
         "            -N  no compression\n"
+        "            -O  factor any repeated run of events into a pattern\n"
+        "\n"
+        "--cfg converts each \"name.mid: options\" line of midi.cfg to name.s in\n"
+        "the same directory, on up to `threads` threads (default: one per CPU),\n"
+        "adding the options given after it. Only .s files that changed are written.\n"
     );
     std::exit(1);
 }
@@ -102,24 +102,19 @@ static std::string BaseName(std::string s)
     return s;
 }
 
-static const char *GetArgument(int argc, char **argv, int& index)
+static const char *GetArgument(const std::vector<std::string>& args, std::size_t& index)
 {
-    assert(index >= 0 && index < argc);
-
-    const char *option = argv[index];
-
-    assert(option != nullptr);
-    assert(option[0] == '-');
+    const std::string& option = args[index];
 
     // If there is text following the letter, return that.
-    if (std::strlen(option) >= 3)
-        return option + 2;
+    if (option.size() >= 3)
+        return option.c_str() + 2;
 
     // Otherwise, try to get the next arg.
-    if (index + 1 < argc)
+    if (index + 1 < args.size())
     {
         index++;
-        return argv[index];
+        return args[index].c_str();
     }
     else
     {
@@ -127,14 +122,12 @@ static const char *GetArgument(int argc, char **argv, int& index)
     }
 }
 
-int main(int argc, char** argv)
+// Reads a song's options and file names. Returns false if they're invalid.
+static bool ParseArguments(const std::vector<std::string>& args, Song& song, std::string& inputFilename, std::string& outputFilename)
 {
-    std::string inputFilename;
-    std::string outputFilename;
-
-    for (int i = 1; i < argc; i++)
+    for (std::size_t i = 0; i < args.size(); i++)
     {
-        const char *option = argv[i];
+        const char *option = args[i].c_str();
 
         if (option[0] == '-' && option[1] != '\0')
         {
@@ -143,62 +136,68 @@ int main(int argc, char** argv)
             switch (std::toupper(option[1]))
             {
             case 'E':
-                g_exactGateTime = true;
+                song.exactGateTime = true;
                 break;
             case 'G':
-                arg = GetArgument(argc, argv, i);
+                arg = GetArgument(args, i);
                 if (arg == nullptr)
-                    PrintUsage();
-                g_voiceGroup = std::stoi(arg);
+                    return false;
+                song.voiceGroup = std::stoi(arg);
                 break;
             case 'L':
-                arg = GetArgument(argc, argv, i);
+                arg = GetArgument(args, i);
                 if (arg == nullptr)
-                    PrintUsage();
-                g_asmLabel = arg;
+                    return false;
+                song.asmLabel = arg;
                 break;
             case 'N':
-                g_compressionEnabled = false;
+                song.compressionEnabled = false;
+                break;
+            case 'O':
+                song.factorPatterns = true;
                 break;
             case 'P':
-                arg = GetArgument(argc, argv, i);
+                arg = GetArgument(args, i);
                 if (arg == nullptr)
-                    PrintUsage();
-                g_priority = std::stoi(arg);
+                    return false;
+                song.priority = std::stoi(arg);
                 break;
             case 'R':
-                arg = GetArgument(argc, argv, i);
+                arg = GetArgument(args, i);
                 if (arg == nullptr)
-                    PrintUsage();
-                g_reverb = std::stoi(arg);
+                    return false;
+                song.reverb = std::stoi(arg);
                 break;
             case 'V':
-                arg = GetArgument(argc, argv, i);
+                arg = GetArgument(args, i);
                 if (arg == nullptr)
-                    PrintUsage();
-                g_masterVolume = std::stoi(arg);
+                    return false;
+                song.masterVolume = std::stoi(arg);
                 break;
             case 'X':
-                g_clocksPerBeat = 2;
+                song.clocksPerBeat = 2;
                 break;
             default:
-                PrintUsage();
+                return false;
             }
         }
         else
         {
             if (inputFilename.empty())
-                inputFilename = argv[i];
+                inputFilename = option;
             else if (outputFilename.empty())
-                outputFilename = argv[i];
+                outputFilename = option;
             else
-                PrintUsage();
+                return false;
         }
     }
 
-    if (inputFilename.empty())
-        PrintUsage();
+    return !inputFilename.empty();
+}
 
+// Converts a MIDI file into song.output.
+static void ConvertSong(Song& song, const std::string& inputFilename, std::string& outputFilename)
+{
     if (GetExtension(inputFilename) != "mid")
         RaiseError("input filename extension is not \"mid\"");
 
@@ -208,26 +207,253 @@ int main(int argc, char** argv)
     if (GetExtension(outputFilename) != "s")
         RaiseError("output filename extension is not \"s\"");
 
-    if (g_asmLabel.empty())
-        g_asmLabel = BaseName(outputFilename);
+    if (song.asmLabel.empty())
+        song.asmLabel = BaseName(outputFilename);
 
-    g_inputFile = std::fopen(inputFilename.c_str(), "rb");
+    song.inputFile = std::fopen(inputFilename.c_str(), "rb");
 
-    if (g_inputFile == nullptr)
+    if (song.inputFile == nullptr)
         RaiseError("failed to open \"%s\" for reading", inputFilename.c_str());
 
-    g_outputFile = std::fopen(outputFilename.c_str(), "w");
+    ReadMidiFileHeader(song);
+    PrintAgbHeader(song);
+    ReadMidiTracks(song);
+    PrintAgbFooter(song);
+}
+
+// Writes the output, unless onlyIfChanged is set and the file already has
+// the same contents. Returns whether the file was written.
+static bool WriteOutput(const std::string& path, const std::string& contents, bool onlyIfChanged)
+{
+    if (onlyIfChanged)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string oldContents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        if (file && oldContents == contents)
+            return false;
+    }
+
+    FILE *fp = std::fopen(path.c_str(), "w");
+
+    if (fp == nullptr)
+        RaiseError("failed to open \"%s\" for writing", path.c_str());
+
+    std::fwrite(contents.data(), 1, contents.size(), fp);
+
+    if (std::fclose(fp) != 0)
+        RaiseError("failed to write \"%s\"", path.c_str());
+
+    return true;
+}
+
+static void PrintPatternSavings(const Song& song, const std::string& outputFilename)
+{
+    if (song.factorPatterns && song.compressionEnabled)
+    {
+        std::printf("%s: %d bytes, %d saved by patterns\n", outputFilename.c_str(), song.patternCompressedSize,
+                    song.wholeNoteCompressedSize - song.patternCompressedSize);
+    }
+}
+
+struct ConfigEntry
+{
+    std::string inputFilename;
+    std::string outputFilename;
+    std::vector<std::string> args;
+    std::string error;
+    bool written;
+    double milliseconds;
+    int size;
+    int savedByPatterns;
+};
+
+// Converts every song listed in a midi.cfg that has a .mid file. Returns the
+// exit status.
+static int ConvertConfig(const std::string& cfgPath, const std::vector<std::string>& extraArgs, int numThreads)
+{
+    std::ifstream cfg(cfgPath);
+
+    if (!cfg)
+    {
+        std::fprintf(stderr, "error: failed to open \"%s\" for reading\n", cfgPath.c_str());
+        return 1;
+    }
+
+    std::size_t slash = cfgPath.find_last_of("/\\");
+    std::string dir = (slash == std::string::npos) ? "" : cfgPath.substr(0, slash + 1);
+    std::vector<ConfigEntry> entries;
+    std::string line;
+    int numMissing = 0;
+
+    while (std::getline(cfg, line))
+    {
+        std::size_t colon = line.find(':');
+
+        if (colon == std::string::npos)
+            continue;
+
+        std::istringstream stream(line.substr(0, colon));
+        std::string name;
+
+        if (!(stream >> name))
+            continue;
+
+        ConfigEntry entry = {};
+        std::string arg;
+
+        entry.inputFilename = dir + name;
+        entry.outputFilename = dir + StripExtension(name) + ".s";
+
+        // Songs only listed for their options aren't built from MIDI.
+        if (!std::ifstream(entry.inputFilename))
+        {
+            numMissing++;
+            continue;
+        }
+
+        stream.clear();
+        stream.str(line.substr(colon + 1));
+
+        while (stream >> arg)
+            entry.args.push_back(arg);
+
+        entry.args.insert(entry.args.end(), extraArgs.begin(), extraArgs.end());
+        entries.push_back(entry);
+    }
 
-    if (g_outputFile == nullptr)
-        RaiseError("failed to open \"%s\" for writing", outputFilename.c_str());
+    auto startTime = std::chrono::steady_clock::now();
+    std::atomic<std::size_t> next(0);
 
-    ReadMidiFileHeader();
-    PrintAgbHeader();
-    ReadMidiTracks();
-    PrintAgbFooter();
+    auto worker = [&]() {
+        std::size_t i;
+
+        while ((i = next++) < entries.size())
+        {
+            ConfigEntry& entry = entries[i];
+            auto songStartTime = std::chrono::steady_clock::now();
+            Song song;
+            std::string inputFilename;
+            std::string outputFilename;
+            std::vector<std::string> args(entry.args);
+
+            args.push_back(entry.inputFilename);
+            args.push_back(entry.outputFilename);
+
+            try
+            {
+                if (!ParseArguments(args, song, inputFilename, outputFilename))
+                    RaiseError("invalid options");
+
+                ConvertSong(song, inputFilename, outputFilename);
+                entry.written = WriteOutput(outputFilename, song.output, true);
+                entry.size = song.patternCompressedSize;
+                entry.savedByPatterns = song.wholeNoteCompressedSize - song.patternCompressedSize;
+            }
+            catch (const std::exception& e)
+            {
+                entry.error = e.what();
+            }
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - songStartTime;
+            entry.milliseconds = elapsed.count();
+        }
+    };
+
+    if (numThreads < 1)
+        numThreads = 1;
+    if ((std::size_t)numThreads > entries.size())
+        numThreads = entries.size();
+
+    std::vector<std::thread> threads;
+
+    for (int i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    int numErrors = 0;
+    int numUnchanged = 0;
+
+    for (const ConfigEntry& entry : entries)
+    {
+        if (!entry.error.empty())
+        {
+            std::fprintf(stderr, "error: %s: %s\n", entry.inputFilename.c_str(), entry.error.c_str());
+            numErrors++;
+            continue;
+        }
+
+        if (!entry.written)
+            numUnchanged++;
+
+        std::printf("%s: %.1f ms%s", entry.outputFilename.c_str(), entry.milliseconds, entry.written ? "" : ", unchanged");
+
+        if (entry.size != 0)
+            std::printf(", %d bytes, %d saved by patterns", entry.size, entry.savedByPatterns);
+
+        std::printf("\n");
+    }
+
+    std::printf("mid2agb: converted %d songs in %.2fs, %d unchanged and not rewritten, %d listed without a .mid\n",
+                (int)entries.size() - numErrors, elapsed.count(), numUnchanged, numMissing);
+
+    return numErrors == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    if (!args.empty() && args[0] == "--cfg")
+    {
+        std::vector<std::string> extraArgs;
+        int numThreads = std::thread::hardware_concurrency();
+
+        if (args.size() < 2)
+            PrintUsage();
+
+        for (std::size_t i = 2; i < args.size(); i++)
+        {
+            if (args[i].compare(0, 2, "-j") == 0)
+            {
+                const char *arg = GetArgument(args, i);
+                if (arg == nullptr)
+                    PrintUsage();
+                numThreads = std::stoi(arg);
+            }
+            else
+            {
+                extraArgs.push_back(args[i]);
+            }
+        }
+
+        return ConvertConfig(args[1], extraArgs, numThreads);
+    }
+
+    Song song;
+    std::string inputFilename;
+    std::string outputFilename;
+
+    if (!ParseArguments(args, song, inputFilename, outputFilename))
+        PrintUsage();
+
+    try
+    {
+        ConvertSong(song, inputFilename, outputFilename);
+        WriteOutput(outputFilename, song.output, false);
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf(stderr, "error: %s\n", e.what());
+        return 1;
+    }
 
-    std::fclose(g_inputFile);
-    std::fclose(g_outputFile);
+    PrintPatternSavings(song, outputFilename);
 
     return 0;
 }
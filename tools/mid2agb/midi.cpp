@@ -23,9 +23,11 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <tuple>
 #include "midi.h"
-#include "main.h"
+#include "song.h"
 #include "error.h"
 #include "agb.h"
 #include "tables.h"
@@ -38,47 +40,31 @@ enum class MidiEventCategory
     Invalid,
 };
 
-MidiFormat g_midiFormat;
-std::int_fast32_t g_midiTrackCount;
-std::int16_t g_midiTimeDiv;
-
-int g_midiChan;
-std::int32_t g_initialWait;
-
-static long s_trackDataStart;
-static std::vector<Event> s_seqEvents;
-static std::vector<Event> s_trackEvents;
-static std::int32_t s_absoluteTime;
-static int s_blockCount = 0;
-static int s_minNote;
-static int s_maxNote;
-static int s_runningStatus;
-
-void Seek(long offset)
+void Seek(Song& song, long offset)
 {
-    if (std::fseek(g_inputFile, offset, SEEK_SET) != 0)
+    if (std::fseek(song.inputFile, offset, SEEK_SET) != 0)
         RaiseError("failed to seek to %l", offset);
 }
 
-void Skip(long offset)
+void Skip(Song& song, long offset)
 {
-    if (std::fseek(g_inputFile, offset, SEEK_CUR) != 0)
+    if (std::fseek(song.inputFile, offset, SEEK_CUR) != 0)
         RaiseError("failed to skip %l bytes", offset);
 }
 
-std::string ReadSignature()
+std::string ReadSignature(Song& song)
 {
     char signature[4];
 
-    if (std::fread(signature, 4, 1, g_inputFile) != 1)
+    if (std::fread(signature, 4, 1, song.inputFile) != 1)
         RaiseError("failed to read signature");
 
     return std::string(signature, 4);
 }
 
-std::uint32_t ReadInt8()
+std::uint32_t ReadInt8(Song& song)
 {
-    int c = std::fgetc(g_inputFile);
+    int c = std::fgetc(song.inputFile);
 
     if (c < 0)
         RaiseError("unexpected EOF");
@@ -86,41 +72,41 @@ std::uint32_t ReadInt8()
     return c;
 }
 
-std::uint32_t ReadInt16()
+std::uint32_t ReadInt16(Song& song)
 {
     std::uint32_t val = 0;
-    val |= ReadInt8() << 8;
-    val |= ReadInt8();
+    val |= ReadInt8(song) << 8;
+    val |= ReadInt8(song);
     return val;
 }
 
-std::uint32_t ReadInt24()
+std::uint32_t ReadInt24(Song& song)
 {
     std::uint32_t val = 0;
-    val |= ReadInt8() << 16;
-    val |= ReadInt8() << 8;
-    val |= ReadInt8();
+    val |= ReadInt8(song) << 16;
+    val |= ReadInt8(song) << 8;
+    val |= ReadInt8(song);
     return val;
 }
 
-std::uint32_t ReadInt32()
+std::uint32_t ReadInt32(Song& song)
 {
     std::uint32_t val = 0;
-    val |= ReadInt8() << 24;
-    val |= ReadInt8() << 16;
-    val |= ReadInt8() << 8;
-    val |= ReadInt8();
+    val |= ReadInt8(song) << 24;
+    val |= ReadInt8(song) << 16;
+    val |= ReadInt8(song) << 8;
+    val |= ReadInt8(song);
     return val;
 }
 
-std::uint32_t ReadVLQ()
+std::uint32_t ReadVLQ(Song& song)
 {
     std::uint32_t val = 0;
     std::uint32_t c;
 
     do
     {
-        c = ReadInt8();
+        c = ReadInt8(song);
         val <<= 7;
         val |= (c & 0x7F);
     } while (c & 0x80);
@@ -128,79 +114,79 @@ std::uint32_t ReadVLQ()
     return val;
 }
 
-void ReadMidiFileHeader()
+void ReadMidiFileHeader(Song& song)
 {
-    Seek(0);
+    Seek(song, 0);
 
-    if (ReadSignature() != "MThd")
+    if (ReadSignature(song) != "MThd")
         RaiseError("MIDI file header signature didn't match \"MThd\"");
 
-    std::uint32_t headerLength = ReadInt32();
+    std::uint32_t headerLength = ReadInt32(song);
 
     if (headerLength != 6)
         RaiseError("MIDI file header length isn't 6");
 
-    std::uint16_t midiFormat = ReadInt16();
+    std::uint16_t midiFormat = ReadInt16(song);
 
     if (midiFormat >= 2)
         RaiseError("unsupported MIDI format (%u)", midiFormat);
 
-    g_midiFormat = (MidiFormat)midiFormat;
-    g_midiTrackCount = ReadInt16();
-    g_midiTimeDiv = ReadInt16();
+    song.midiFormat = (MidiFormat)midiFormat;
+    song.midiTrackCount = ReadInt16(song);
+    song.midiTimeDiv = ReadInt16(song);
 
-    if (g_midiTimeDiv < 0)
-        RaiseError("unsupported MIDI time division (%d)", g_midiTimeDiv);
+    if (song.midiTimeDiv < 0)
+        RaiseError("unsupported MIDI time division (%d)", song.midiTimeDiv);
 }
 
-long ReadMidiTrackHeader(long offset)
+long ReadMidiTrackHeader(Song& song, long offset)
 {
-    Seek(offset);
+    Seek(song, offset);
 
-    if (ReadSignature() != "MTrk")
+    if (ReadSignature(song) != "MTrk")
         RaiseError("MIDI track header signature didn't match \"MTrk\"");
 
-    long size = ReadInt32();
+    long size = ReadInt32(song);
 
-    s_trackDataStart = std::ftell(g_inputFile);
+    song.trackDataStart = std::ftell(song.inputFile);
 
     return size + 8;
 }
 
-void StartTrack()
+void StartTrack(Song& song)
 {
-    Seek(s_trackDataStart);
-    s_absoluteTime = 0;
-    s_runningStatus = 0;
+    Seek(song, song.trackDataStart);
+    song.absoluteTime = 0;
+    song.runningStatus = 0;
 }
 
-void SkipEventData()
+void SkipEventData(Song& song)
 {
-    Skip(ReadVLQ());
+    Skip(song, ReadVLQ(song));
 }
 
-void DetermineEventCategory(MidiEventCategory& category, int& typeChan, int& size)
+void DetermineEventCategory(Song& song, MidiEventCategory& category, int& typeChan, int& size)
 {
-    typeChan = ReadInt8();
+    typeChan = ReadInt8(song);
 
     if (typeChan < 0x80)
     {
         // If data byte was found, use the running status.
-        ungetc(typeChan, g_inputFile);
-        typeChan = s_runningStatus;
+        ungetc(typeChan, song.inputFile);
+        typeChan = song.runningStatus;
     }
 
     if (typeChan == 0xFF)
     {
         category = MidiEventCategory::Meta;
         size = 0;
-        s_runningStatus = 0;
+        song.runningStatus = 0;
     }
     else if (typeChan >= 0xF0)
     {
         category = MidiEventCategory::SysEx;
         size = 0;
-        s_runningStatus = 0;
+        song.runningStatus = 0;
     }
     else if (typeChan >= 0x80)
     {
@@ -216,7 +202,7 @@ void DetermineEventCategory(MidiEventCategory& category, int& typeChan, int& siz
             size = 2;
             break;
         }
-        s_runningStatus = typeChan;
+        song.runningStatus = typeChan;
     }
     else
     {
@@ -224,52 +210,52 @@ void DetermineEventCategory(MidiEventCategory& category, int& typeChan, int& siz
     }
 }
 
-void MakeBlockEvent(Event& event, EventType type)
+void MakeBlockEvent(Song& song, Event& event, EventType type)
 {
     event.type = type;
-    event.param1 = s_blockCount++;
+    event.param1 = song.blockCount++;
     event.param2 = 0;
 }
 
-std::string ReadEventText()
+std::string ReadEventText(Song& song)
 {
     char buffer[2];
-    std::uint32_t length = ReadVLQ();
+    std::uint32_t length = ReadVLQ(song);
 
     if (length <= 2)
     {
-        if (fread(buffer, length, 1, g_inputFile) != 1)
+        if (fread(buffer, length, 1, song.inputFile) != 1)
             RaiseError("failed to read event text");
     }
     else
     {
-        Skip(length);
+        Skip(song, length);
         length = 0;
     }
 
     return std::string(buffer, length);
 }
 
-bool ReadSeqEvent(Event& event)
+bool ReadSeqEvent(Song& song, Event& event)
 {
-    s_absoluteTime += ReadVLQ();
-    event.time = s_absoluteTime;
+    song.absoluteTime += ReadVLQ(song);
+    event.time = song.absoluteTime;
 
     MidiEventCategory category;
     int typeChan;
     int size;
 
-    DetermineEventCategory(category, typeChan, size);
+    DetermineEventCategory(song, category, typeChan, size);
 
     if (category == MidiEventCategory::Control)
     {
-        Skip(size);
+        Skip(song, size);
         return false;
     }
 
     if (category == MidiEventCategory::SysEx)
     {
-        SkipEventData();
+        SkipEventData(song);
         return false;
     }
 
@@ -277,21 +263,21 @@ bool ReadSeqEvent(Event& event)
         RaiseError("invalid event");
 
     // meta event
-    int metaEventType = ReadInt8();
+    int metaEventType = ReadInt8(song);
 
     if (metaEventType >= 1 && metaEventType <= 7)
     {
         // text event
-        std::string text = ReadEventText();
+        std::string text = ReadEventText(song);
 
         if (text == "[")
-            MakeBlockEvent(event, EventType::LoopBegin);
+            MakeBlockEvent(song, event, EventType::LoopBegin);
         else if (text == "][")
-            MakeBlockEvent(event, EventType::LoopEndBegin);
+            MakeBlockEvent(song, event, EventType::LoopEndBegin);
         else if (text == "]")
-            MakeBlockEvent(event, EventType::LoopEnd);
+            MakeBlockEvent(song, event, EventType::LoopEnd);
         else if (text == ":")
-            MakeBlockEvent(event, EventType::Label);
+            MakeBlockEvent(song, event, EventType::Label);
         else
             return false;
     }
@@ -300,33 +286,33 @@ bool ReadSeqEvent(Event& event)
         switch (metaEventType)
         {
         case 0x2F: // end of track
-            SkipEventData();
+            SkipEventData(song);
             event.type = EventType::EndOfTrack;
             event.param1 = 0;
             event.param2 = 0;
             break;
         case 0x51: // tempo
-            if (ReadVLQ() != 3)
+            if (ReadVLQ(song) != 3)
                 RaiseError("invalid tempo size");
 
             event.type = EventType::Tempo;
             event.param1 = 0;
-            event.param2 = ReadInt24();
+            event.param2 = ReadInt24(song);
             break;
         case 0x58: // time signature
         {
-            if (ReadVLQ() != 4)
+            if (ReadVLQ(song) != 4)
                 RaiseError("invalid time signature size");
 
-            int numerator = ReadInt8();
-            int denominatorExponent = ReadInt8();
+            int numerator = ReadInt8(song);
+            int denominatorExponent = ReadInt8(song);
 
             if (denominatorExponent >= 16)
                 RaiseError("invalid time signature denominator");
 
-            Skip(2); // ignore other values
+            Skip(song, 2); // ignore other values
 
-            int clockTicks = 96 * numerator * g_clocksPerBeat;
+            int clockTicks = 96 * numerator * song.clocksPerBeat;
             int denominator = 1 << denominatorExponent;
             int timeSig = clockTicks / denominator;
 
@@ -339,7 +325,7 @@ bool ReadSeqEvent(Event& event)
             break;
         }
         default:
-            SkipEventData();
+            SkipEventData(song);
             return false;
         }
     }
@@ -347,17 +333,17 @@ bool ReadSeqEvent(Event& event)
     return true;
 }
 
-void ReadSeqEvents()
+void ReadSeqEvents(Song& song)
 {
-    StartTrack();
+    StartTrack(song);
 
     for (;;)
     {
         Event event = {};
 
-        if (ReadSeqEvent(event))
+        if (ReadSeqEvent(song, event))
         {
-            s_seqEvents.push_back(event);
+            song.seqEvents.push_back(event);
 
             if (event.type == EventType::EndOfTrack)
                 return;
@@ -365,23 +351,23 @@ void ReadSeqEvents()
     }
 }
 
-bool CheckNoteEnd(Event& event)
+bool CheckNoteEnd(Song& song, Event& event)
 {
-    event.param2 += ReadVLQ();
+    event.param2 += ReadVLQ(song);
 
     MidiEventCategory category;
     int typeChan;
     int size;
 
-    DetermineEventCategory(category, typeChan, size);
+    DetermineEventCategory(song, category, typeChan, size);
 
     if (category == MidiEventCategory::Control)
     {
         int chan = typeChan & 0xF;
 
-        if (chan != g_midiChan)
+        if (chan != song.midiChan)
         {
-            Skip(size);
+            Skip(song, size);
             return false;
         }
 
@@ -389,22 +375,22 @@ bool CheckNoteEnd(Event& event)
         {
         case 0x80: // note off
         {
-            int note = ReadInt8();
-            ReadInt8(); // ignore velocity
+            int note = ReadInt8(song);
+            ReadInt8(song); // ignore velocity
             if (note == event.note)
                 return true;
             break;
         }
         case 0x90: // note on
         {
-            int note = ReadInt8();
-            int velocity = ReadInt8();
+            int note = ReadInt8(song);
+            int velocity = ReadInt8(song);
             if (velocity == 0 && note == event.note)
                 return true;
             break;
         }
         default:
-            Skip(size);
+            Skip(song, size);
             break;
         }
 
@@ -413,14 +399,14 @@ bool CheckNoteEnd(Event& event)
 
     if (category == MidiEventCategory::SysEx)
     {
-        SkipEventData();
+        SkipEventData(song);
         return false;
     }
 
     if (category == MidiEventCategory::Meta)
     {
-        int metaEventType = ReadInt8();
-        SkipEventData();
+        int metaEventType = ReadInt8(song);
+        SkipEventData(song);
 
         if (metaEventType == 0x2F)
             RaiseError("note doesn't end");
@@ -431,40 +417,40 @@ bool CheckNoteEnd(Event& event)
     RaiseError("invalid event");
 }
 
-void FindNoteEnd(Event& event)
+void FindNoteEnd(Song& song, Event& event)
 {
     // Save the current file position and running status
     // which get modified by CheckNoteEnd.
-    long startPos = ftell(g_inputFile);
-    int savedRunningStatus = s_runningStatus;
+    long startPos = ftell(song.inputFile);
+    int savedRunningStatus = song.runningStatus;
 
     event.param2 = 0;
 
-    while (!CheckNoteEnd(event))
+    while (!CheckNoteEnd(song, event))
         ;
 
-    Seek(startPos);
-    s_runningStatus = savedRunningStatus;
+    Seek(song, startPos);
+    song.runningStatus = savedRunningStatus;
 }
 
-bool ReadTrackEvent(Event& event)
+bool ReadTrackEvent(Song& song, Event& event)
 {
-    s_absoluteTime += ReadVLQ();
-    event.time = s_absoluteTime;
+    song.absoluteTime += ReadVLQ(song);
+    event.time = song.absoluteTime;
 
     MidiEventCategory category;
     int typeChan;
     int size;
 
-    DetermineEventCategory(category, typeChan, size);
+    DetermineEventCategory(song, category, typeChan, size);
 
     if (category == MidiEventCategory::Control)
     {
         int chan = typeChan & 0xF;
 
-        if (chan != g_midiChan)
+        if (chan != song.midiChan)
         {
-            Skip(size);
+            Skip(song, size);
             return false;
         }
 
@@ -472,42 +458,42 @@ bool ReadTrackEvent(Event& event)
         {
         case 0x90: // note on
         {
-            int note = ReadInt8();
-            int velocity = ReadInt8();
+            int note = ReadInt8(song);
+            int velocity = ReadInt8(song);
 
             if (velocity != 0)
             {
                 event.type = EventType::Note;
                 event.note = note;
                 event.param1 = velocity;
-                FindNoteEnd(event);
+                FindNoteEnd(song, event);
                 if (event.param2 > 0)
                 {
-                    if (note < s_minNote)
-                        s_minNote = note;
-                    if (note > s_maxNote)
-                        s_maxNote = note;
+                    if (note < song.minNote)
+                        song.minNote = note;
+                    if (note > song.maxNote)
+                        song.maxNote = note;
                 }
             }
             break;
         }
         case 0xB0: // controller event
             event.type = EventType::Controller;
-            event.param1 = ReadInt8(); // controller index
-            event.param2 = ReadInt8(); // value
+            event.param1 = ReadInt8(song); // controller index
+            event.param2 = ReadInt8(song); // value
             break;
         case 0xC0: // instrument change
             event.type = EventType::InstrumentChange;
-            event.param1 = ReadInt8(); // instrument
+            event.param1 = ReadInt8(song); // instrument
             event.param2 = 0;
             break;
         case 0xE0: // pitch bend
             event.type = EventType::PitchBend;
-            event.param1 = ReadInt8();
-            event.param2 = ReadInt8();
+            event.param1 = ReadInt8(song);
+            event.param2 = ReadInt8(song);
             break;
         default:
-            Skip(size);
+            Skip(song, size);
             return false;
         }
 
@@ -516,14 +502,14 @@ bool ReadTrackEvent(Event& event)
 
     if (category == MidiEventCategory::SysEx)
     {
-        SkipEventData();
+        SkipEventData(song);
         return false;
     }
 
     if (category == MidiEventCategory::Meta)
     {
-        int metaEventType = ReadInt8();
-        SkipEventData();
+        int metaEventType = ReadInt8(song);
+        SkipEventData(song);
 
         if (metaEventType == 0x2F)
         {
@@ -539,22 +525,22 @@ bool ReadTrackEvent(Event& event)
     RaiseError("invalid event");
 }
 
-void ReadTrackEvents()
+void ReadTrackEvents(Song& song)
 {
-    StartTrack();
+    StartTrack(song);
 
-    s_trackEvents.clear();
+    song.trackEvents.clear();
 
-    s_minNote = 0xFF;
-    s_maxNote = 0;
+    song.minNote = 0xFF;
+    song.maxNote = 0;
 
     for (;;)
     {
         Event event = {};
 
-        if (ReadTrackEvent(event))
+        if (ReadTrackEvent(song, event))
         {
-            s_trackEvents.push_back(event);
+            song.trackEvents.push_back(event);
 
             if (event.type == EventType::EndOfTrack)
                 return;
@@ -597,53 +583,53 @@ bool EventCompare(const Event& event1, const Event& event2)
     return false;
 }
 
-std::unique_ptr<std::vector<Event>> MergeEvents()
+std::unique_ptr<std::vector<Event>> MergeEvents(Song& song)
 {
     std::unique_ptr<std::vector<Event>> events(new std::vector<Event>());
 
     unsigned trackEventPos = 0;
     unsigned seqEventPos = 0;
 
-    while (s_trackEvents[trackEventPos].type != EventType::EndOfTrack
-        && s_seqEvents[seqEventPos].type != EventType::EndOfTrack)
+    while (song.trackEvents[trackEventPos].type != EventType::EndOfTrack
+        && song.seqEvents[seqEventPos].type != EventType::EndOfTrack)
     {
-        if (EventCompare(s_trackEvents[trackEventPos], s_seqEvents[seqEventPos]))
-            events->push_back(s_trackEvents[trackEventPos++]);
+        if (EventCompare(song.trackEvents[trackEventPos], song.seqEvents[seqEventPos]))
+            events->push_back(song.trackEvents[trackEventPos++]);
         else
-            events->push_back(s_seqEvents[seqEventPos++]);
+            events->push_back(song.seqEvents[seqEventPos++]);
     }
 
-    while (s_trackEvents[trackEventPos].type != EventType::EndOfTrack)
-        events->push_back(s_trackEvents[trackEventPos++]);
+    while (song.trackEvents[trackEventPos].type != EventType::EndOfTrack)
+        events->push_back(song.trackEvents[trackEventPos++]);
 
-    while (s_seqEvents[seqEventPos].type != EventType::EndOfTrack)
-        events->push_back(s_seqEvents[seqEventPos++]);
+    while (song.seqEvents[seqEventPos].type != EventType::EndOfTrack)
+        events->push_back(song.seqEvents[seqEventPos++]);
 
     // Push the EndOfTrack event with the larger time.
-    if (EventCompare(s_trackEvents[trackEventPos], s_seqEvents[seqEventPos]))
-        events->push_back(s_seqEvents[seqEventPos]);
+    if (EventCompare(song.trackEvents[trackEventPos], song.seqEvents[seqEventPos]))
+        events->push_back(song.seqEvents[seqEventPos]);
     else
-        events->push_back(s_trackEvents[trackEventPos]);
+        events->push_back(song.trackEvents[trackEventPos]);
 
     return events;
 }
 
-void ConvertTimes(std::vector<Event>& events)
+void ConvertTimes(Song& song, std::vector<Event>& events)
 {
     for (Event& event : events)
     {
-        event.time = (24 * g_clocksPerBeat * event.time) / g_midiTimeDiv;
+        event.time = (24 * song.clocksPerBeat * event.time) / song.midiTimeDiv;
 
         if (event.type == EventType::Note)
         {
             event.param1 = g_noteVelocityLUT[event.param1];
 
-            std::uint32_t duration = (24 * g_clocksPerBeat * event.param2) / g_midiTimeDiv;
+            std::uint32_t duration = (24 * song.clocksPerBeat * event.param2) / song.midiTimeDiv;
 
             if (duration == 0)
                 duration = 1;
 
-            if (!g_exactGateTime && duration < 96)
+            if (!song.exactGateTime && duration < 96)
                 duration = g_noteDurationLUT[duration];
 
             event.param2 = duration;
@@ -651,14 +637,14 @@ void ConvertTimes(std::vector<Event>& events)
     }
 }
 
-std::unique_ptr<std::vector<Event>> InsertTimingEvents(std::vector<Event>& inEvents)
+std::unique_ptr<std::vector<Event>> InsertTimingEvents(Song& song, std::vector<Event>& inEvents)
 {
     std::unique_ptr<std::vector<Event>> outEvents(new std::vector<Event>());
 
     Event timingEvent = {};
     timingEvent.time = 0;
     timingEvent.type = EventType::TimeSignature;
-    timingEvent.param2 = 96 * g_clocksPerBeat;
+    timingEvent.param2 = 96 * song.clocksPerBeat;
 
     for (const Event& event : inEvents)
     {
@@ -670,7 +656,7 @@ std::unique_ptr<std::vector<Event>> InsertTimingEvents(std::vector<Event>& inEve
 
         if (event.type == EventType::TimeSignature)
         {
-            if (g_agbTrack == 1 && event.param2 != timingEvent.param2)
+            if (song.agbTrack == 1 && event.param2 != timingEvent.param2)
             {
                 Event originalTimingEvent = event;
                 originalTimingEvent.type = EventType::OriginalTimeSignature;
@@ -756,9 +742,9 @@ std::unique_ptr<std::vector<Event>> CreateTies(std::vector<Event>& inEvents)
     return outEvents;
 }
 
-void CalculateWaits(std::vector<Event>& events)
+void CalculateWaits(Song& song, std::vector<Event>& events)
 {
-    g_initialWait = events[0].time;
+    song.initialWait = events[0].time;
     int wholeNoteCount = 0;
 
     for (unsigned i = 0; i < events.size() && events[i].type != EventType::EndOfTrack; i++)
@@ -913,51 +899,369 @@ void Compress(std::vector<Event>& events)
     }
 }
 
-void ReadMidiTracks()
+// Calling a pattern takes PATT and a pointer, and ending one takes PEND.
+static const int kPatternCallSize = 5;
+static const int kPatternEndSize = 1;
+
+// Whether an event can be part of a pattern found by FactorPatterns.
+bool CanBeInPattern(const Event& event)
+{
+    switch (event.type)
+    {
+    case EventType::Label:
+    case EventType::LoopEnd:
+    case EventType::LoopEndBegin:
+    case EventType::LoopBegin:
+    case EventType::Pattern:
+    case EventType::PatternStart:
+    case EventType::PatternEnd:
+    case EventType::PatternCall:
+    case EventType::EndOfTrack:
+        return false;
+    case EventType::Controller:
+        // These print labels or set state that later events are printed
+        // with, which a PATT would skip over.
+        switch (event.param1)
+        {
+        case 0x0D:
+        case 0x0E:
+        case 0x0F:
+        case 0x11:
+        case 0x1E:
+            return false;
+        }
+        return true;
+    default:
+        return true;
+    }
+}
+
+// Gives equal events equal symbols. Events that can't be in a pattern (or
+// already are) get a symbol of their own, so no repeat can contain them.
+std::vector<int> SymbolizeEvents(std::vector<Event>& events)
+{
+    std::map<std::tuple<std::int32_t, EventType, std::uint8_t, std::uint8_t, std::int32_t>, int> symbols;
+    std::vector<int> text;
+    int nextSymbol = 0;
+    bool inPattern = false;
+
+    for (unsigned i = 0; events[i].type != EventType::EndOfTrack; i++)
+    {
+        const Event& event = events[i];
+
+        if (event.type == EventType::PatternStart || event.type == EventType::PatternCall)
+            inPattern = true;
+
+        if (inPattern || !CanBeInPattern(event))
+        {
+            text.push_back(nextSymbol++);
+        }
+        else
+        {
+            // Whole-note marks only differ by the number in their comment.
+            std::int32_t param2 = (event.type == EventType::WholeNoteMark) ? 0 : event.param2;
+            auto key = std::make_tuple(event.time, event.type, event.note, event.param1, param2);
+            auto it = symbols.find(key);
+
+            if (it == symbols.end())
+                it = symbols.emplace(key, nextSymbol++).first;
+
+            text.push_back(it->second);
+        }
+
+        if (event.type == EventType::PatternEnd)
+            inPattern = false;
+    }
+
+    return text;
+}
+
+// Sorts the suffixes of text by prefix doubling.
+std::vector<int> BuildSuffixArray(const std::vector<int>& text)
+{
+    int n = text.size();
+    std::vector<int> suffixes(n);
+    std::vector<int> rank(text);
+    std::vector<int> nextRank(n);
+
+    for (int i = 0; i < n; i++)
+        suffixes[i] = i;
+
+    for (int k = 1; n > 0; k *= 2)
+    {
+        auto key = [&](int i) { return std::make_pair(rank[i], i + k < n ? rank[i + k] : -1); };
+
+        std::sort(suffixes.begin(), suffixes.end(), [&](int a, int b) { return key(a) < key(b); });
+
+        nextRank[suffixes[0]] = 0;
+
+        for (int i = 1; i < n; i++)
+            nextRank[suffixes[i]] = nextRank[suffixes[i - 1]] + (key(suffixes[i - 1]) < key(suffixes[i]));
+
+        rank.swap(nextRank);
+
+        if (rank[suffixes[n - 1]] == n - 1)
+            break;
+    }
+
+    return suffixes;
+}
+
+// lcp[i] is the length of the common prefix of suffixes[i - 1] and suffixes[i] (Kasai's algorithm).
+std::vector<int> BuildLcpArray(const std::vector<int>& text, const std::vector<int>& suffixes)
+{
+    int n = text.size();
+    std::vector<int> rank(n);
+    std::vector<int> lcp(n, 0);
+
+    for (int i = 0; i < n; i++)
+        rank[suffixes[i]] = i;
+
+    for (int i = 0, h = 0; i < n; i++)
+    {
+        if (rank[i] == 0)
+        {
+            h = 0;
+            continue;
+        }
+
+        int j = suffixes[rank[i] - 1];
+
+        while (i + h < n && j + h < n && text[i + h] == text[j + h])
+            h++;
+
+        lcp[rank[i]] = h;
+
+        if (h > 0)
+            h--;
+    }
+
+    return lcp;
+}
+
+struct PatternCandidate
+{
+    int gain;
+    int length;
+    std::vector<int> positions;
+};
+
+// Estimates how many bytes factoring out the non-overlapping occurrences of
+// text[position, position + length) would save, from what each event takes
+// where it is now.
+void EvaluatePattern(const std::vector<int>& positions, int length, const std::vector<int>& byteOffsets, PatternCandidate& best)
+{
+    std::vector<int> chosen;
+    int gain = -kPatternEndSize;
+
+    for (int position : positions)
+    {
+        if (!chosen.empty() && position < chosen.back() + length)
+            continue;
+
+        // Each occurrence also starts over without running status.
+        gain -= 1;
+
+        if (!chosen.empty())
+            gain += byteOffsets[position + length] - byteOffsets[position] - kPatternCallSize;
+
+        chosen.push_back(position);
+    }
+
+    if (chosen.size() >= 2 && gain > best.gain)
+    {
+        best.gain = gain;
+        best.length = length;
+        best.positions = chosen;
+    }
+}
+
+// Finds the repeat that is estimated to save the most bytes by walking the
+// LCP intervals of the suffix array, each of which is a set of positions
+// sharing a prefix of the interval's length.
+PatternCandidate FindBestPattern(const std::vector<int>& text, const std::vector<int>& byteOffsets)
+{
+    std::vector<int> suffixes = BuildSuffixArray(text);
+    std::vector<int> lcp = BuildLcpArray(text, suffixes);
+    std::vector<std::pair<int, int>> stack = { { 0, 0 } };
+    PatternCandidate best = { 0, 0, {} };
+    int n = text.size();
+
+    for (int i = 1; i <= n; i++)
+    {
+        int depth = (i < n) ? lcp[i] : 0;
+        int start = i - 1;
+
+        while (depth < stack.back().first)
+        {
+            int length = stack.back().first;
+            start = stack.back().second;
+            stack.pop_back();
+
+            if (length < 2)
+                continue;
+
+            std::vector<int> positions(suffixes.begin() + start, suffixes.begin() + i);
+            std::sort(positions.begin(), positions.end());
+
+            EvaluatePattern(positions, length, byteOffsets, best);
+
+            // A shorter pattern may fit in every occurrence when the long one overlaps itself.
+            int minGap = length;
+
+            for (unsigned j = 1; j < positions.size(); j++)
+                minGap = std::min(minGap, positions[j] - positions[j - 1]);
+
+            if (minGap >= 2 && minGap < length)
+                EvaluatePattern(positions, minGap, byteOffsets, best);
+        }
+
+        if (depth > stack.back().first)
+            stack.emplace_back(depth, start);
+    }
+
+    return best;
+}
+
+// Makes the first occurrence of a pattern its definition and the others calls.
+void InsertPattern(std::vector<Event>& events, const PatternCandidate& pattern, int patternNum)
+{
+    std::vector<Event> outEvents;
+    unsigned next = 0;
+
+    outEvents.reserve(events.size() + 2 * pattern.positions.size());
+
+    for (unsigned i = 0; i < events.size(); i++)
+    {
+        if (next < pattern.positions.size() && (int)i == pattern.positions[next])
+        {
+            Event marker = {};
+            marker.type = (next == 0) ? EventType::PatternStart : EventType::PatternCall;
+            marker.param2 = patternNum;
+            outEvents.push_back(marker);
+        }
+
+        outEvents.push_back(events[i]);
+
+        if (next < pattern.positions.size() && (int)i == pattern.positions[next] + pattern.length - 1)
+        {
+            Event marker = {};
+            marker.type = EventType::PatternEnd;
+            outEvents.push_back(marker);
+            next++;
+        }
+    }
+
+    events.swap(outEvents);
+}
+
+// Repeatedly factors out the repeated run of events, of any length, that
+// saves the most bytes, as long as the track actually gets smaller.
+void FactorPatterns(Song& song, std::vector<Event>& events)
+{
+    std::vector<int> eventBytes;
+    int size = MeasureAgbTrack(song, events, &eventBytes);
+
+    for (int patternNum = 0;; patternNum++)
+    {
+        std::vector<int> text = SymbolizeEvents(events);
+        std::vector<int> byteOffsets(text.size() + 1, 0);
+
+        for (unsigned i = 0; i < text.size(); i++)
+            byteOffsets[i + 1] = byteOffsets[i] + eventBytes[i];
+
+        PatternCandidate pattern = FindBestPattern(text, byteOffsets);
+
+        if (pattern.gain <= 0)
+            break;
+
+        std::vector<Event> oldEvents(events);
+
+        InsertPattern(events, pattern, patternNum);
+
+        int newSize = MeasureAgbTrack(song, events, &eventBytes);
+
+        if (newSize >= size)
+        {
+            events.swap(oldEvents);
+            break;
+        }
+
+        size = newSize;
+    }
+}
+
+// Uses whichever of whole-note compression and FactorPatterns makes the
+// smaller track.
+void CompressPatterns(Song& song, std::vector<Event>& events)
+{
+    std::vector<Event> wholeNoteEvents(events);
+
+    Compress(wholeNoteEvents);
+
+    int wholeNoteSize = MeasureAgbTrack(song, wholeNoteEvents);
+
+    FactorPatterns(song, events);
+
+    int size = MeasureAgbTrack(song, events);
+
+    if (size >= wholeNoteSize)
+    {
+        events.swap(wholeNoteEvents);
+        size = wholeNoteSize;
+    }
+
+    song.wholeNoteCompressedSize += wholeNoteSize;
+    song.patternCompressedSize += size;
+}
+
+void ReadMidiTracks(Song& song)
 {
     long trackHeaderStart = 14;
 
-    ReadMidiTrackHeader(trackHeaderStart);
-    ReadSeqEvents();
+    ReadMidiTrackHeader(song, trackHeaderStart);
+    ReadSeqEvents(song);
 
-    g_agbTrack = 1;
+    song.agbTrack = 1;
 
-    for (int midiTrack = 0; midiTrack < g_midiTrackCount; midiTrack++)
+    for (int midiTrack = 0; midiTrack < song.midiTrackCount; midiTrack++)
     {
-        trackHeaderStart += ReadMidiTrackHeader(trackHeaderStart);
+        trackHeaderStart += ReadMidiTrackHeader(song, trackHeaderStart);
 
-        for (g_midiChan = 0; g_midiChan < 16; g_midiChan++)
+        for (song.midiChan = 0; song.midiChan < 16; song.midiChan++)
         {
-            ReadTrackEvents();
+            ReadTrackEvents(song);
 
-            if (s_minNote != 0xFF)
+            if (song.minNote != 0xFF)
             {
 #ifdef DEBUG
-                printf("Track%d = Midi-Ch.%d\n", g_agbTrack, g_midiChan + 1);
+                printf("Track%d = Midi-Ch.%d\n", song.agbTrack, song.midiChan + 1);
 #endif
 
-                std::unique_ptr<std::vector<Event>> events(MergeEvents());
+                std::unique_ptr<std::vector<Event>> events(MergeEvents(song));
 
                 // We don't need TEMPO in anything but track 1.
-                if (g_agbTrack == 1)
+                if (song.agbTrack == 1)
                 {
-                    auto it = std::remove_if(s_seqEvents.begin(), s_seqEvents.end(), [](const Event& event) { return event.type == EventType::Tempo; });
-                    s_seqEvents.erase(it, s_seqEvents.end());
+                    auto it = std::remove_if(song.seqEvents.begin(), song.seqEvents.end(), [](const Event& event) { return event.type == EventType::Tempo; });
+                    song.seqEvents.erase(it, song.seqEvents.end());
                 }
 
-                ConvertTimes(*events);
-                events = InsertTimingEvents(*events);
+                ConvertTimes(song, *events);
+                events = InsertTimingEvents(song, *events);
                 events = CreateTies(*events);
                 std::stable_sort(events->begin(), events->end(), EventCompare);
                 events = SplitTime(*events);
-                CalculateWaits(*events);
+                CalculateWaits(song, *events);
 
-                if (g_compressionEnabled)
+                if (song.compressionEnabled && song.factorPatterns)
+                    CompressPatterns(song, *events);
+                else if (song.compressionEnabled)
                     Compress(*events);
 
-                PrintAgbTrack(*events);
+                PrintAgbTrack(song, *events);
 
-                g_agbTrack++;
+                song.agbTrack++;
             }
         }
     }
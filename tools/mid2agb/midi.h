@@ -41,6 +41,9 @@ enum class EventType
     Pattern = 0x17,
     TimeSignature = 0x18,
     Tempo = 0x19,
+    PatternStart = 0x1A, // param2 is the pattern number
+    PatternEnd = 0x1B,
+    PatternCall = 0x1C, // param2 is the pattern number, followed by a copy of the pattern
     InstrumentChange = 0x21,
     Controller = 0x22,
     PitchBend = 0x23,
@@ -73,11 +76,10 @@ struct Event
     }
 };
 
-void ReadMidiFileHeader();
-void ReadMidiTracks();
+struct Song;
 
-extern int g_midiChan;
-extern std::int32_t g_initialWait;
+void ReadMidiFileHeader(Song& song);
+void ReadMidiTracks(Song& song);
 
 inline bool IsPatternBoundary(EventType type)
 {
@@ -0,0 +1,95 @@
+// Copyright(c) 2016 YamaArashi
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef SONG_H
+#define SONG_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "midi.h"
+
+// Everything about the conversion of one song: its options, the MIDI file
+// being read and the assembly being written. Nothing else is shared, so
+// several songs can be converted at once.
+struct Song
+{
+    Song() = default;
+    Song(const Song&) = delete;
+    ~Song()
+    {
+        if (inputFile != nullptr)
+            std::fclose(inputFile);
+    }
+
+    // Options
+    std::string asmLabel;
+    int masterVolume = 127;
+    int voiceGroup = 0;
+    int priority = 0;
+    int reverb = -1;
+    int clocksPerBeat = 1;
+    bool exactGateTime = false;
+    bool compressionEnabled = true;
+    bool factorPatterns = false;
+
+    FILE *inputFile = nullptr;
+    std::string output; // the .s file
+
+    // MIDI reader state
+    MidiFormat midiFormat = MidiFormat::SingleTrack;
+    std::int_fast32_t midiTrackCount = 0;
+    std::int16_t midiTimeDiv = 0;
+    int midiChan = 0;
+    std::int32_t initialWait = 0;
+    long trackDataStart = 0;
+    std::vector<Event> seqEvents;
+    std::vector<Event> trackEvents;
+    std::int32_t absoluteTime = 0;
+    int blockCount = 0;
+    int minNote = 0;
+    int maxNote = 0;
+    int runningStatus = 0;
+
+    // Sizes in bytes of the tracks converted with factorPatterns, compressed
+    // by whole note and by FactorPatterns.
+    int wholeNoteCompressedSize = 0;
+    int patternCompressedSize = 0;
+
+    // AGB writer state
+    int agbTrack = 0;
+    std::string lastOpName;
+    int blockNum = 0;
+    bool keepLastOpName = false;
+    int lastNote = 0;
+    int lastVelocity = 0;
+    bool noteChanged = false;
+    bool velocityChanged = false;
+    bool inPattern = false;
+    int extendedCommand = 0;
+    int memaccOp = 0;
+    int memaccParam1 = 0;
+    int memaccParam2 = 0;
+    bool measuring = false;
+    int byteCount = 0;
+};
+
+#endif // SONG_H
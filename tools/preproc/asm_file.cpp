@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <cstdarg>
 #include <stdexcept>
+#include <map>
 #include "preproc.h"
 #include "asm_file.h"
 #include "char_util.h"
@@ -0,0 +1,61 @@
+#!/bin/bash
+# Runs preproc once per text file (default: data/text/*.inc) with the text
+# charmap and with the compiled one from `preproc -C`, reporting the total
+# time for each and checking that the output matches. Most of a single
+# preproc invocation on a small file is spent loading the charmap, so this
+# is roughly what a full build pays per assembly or C file.
+#
+# Run from the repository root.
+
+PREPROC=${PREPROC:-tools/preproc/preproc}
+RUNS="${RUNS:-5}"
+TMP="$(mktemp -d)"
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]; then
+    set -- data/text/*.inc
+fi
+
+now_ns() {
+    date +%s%N
+}
+
+# Prints the fastest of $RUNS wall-clock times in milliseconds.
+best_ms() {
+    best=
+    for _ in $(seq "$RUNS"); do
+        start=$(now_ns)
+        "$@" || exit 1
+        elapsed=$((($(now_ns) - start) / 1000000))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+            best=$elapsed
+        fi
+    done
+    echo "$best"
+}
+
+# preproc picks the file type from the extension, so give each input a .s name.
+sources=()
+for src in "$@"; do
+    copy="$TMP/$(basename "$src" .inc).s"
+    cp "$src" "$copy"
+    sources+=("$copy")
+done
+
+run_all() {
+    for src in "${sources[@]}"; do
+        $PREPROC "$src" "$1" || return 1
+    done > "$2"
+}
+
+$PREPROC -C charmap.txt "$TMP/charmap.bin" || exit 1
+
+text=$(best_ms run_all charmap.txt "$TMP/text.s")
+compiled=$(best_ms run_all "$TMP/charmap.bin" "$TMP/compiled.s")
+
+if ! cmp -s "$TMP/text.s" "$TMP/compiled.s"; then
+    echo "output differs between charmap.txt and the compiled charmap!" >&2
+    exit 1
+fi
+
+echo "${#sources[@]} files: charmap.txt: ${text} ms, compiled charmap: ${compiled} ms"
@@ -0,0 +1,53 @@
+#!/bin/bash
+# Times preproc's INCBIN expansion on a C file (default:
+# src/data/graphics/pokemon.h, which INCBINs every Pokémon graphic).
+# If BASELINE names another preproc build, it is timed too and its output
+# must match.
+#
+# The incbin'd graphics must already be built. Run from the repository root.
+
+PREPROC=${PREPROC:-tools/preproc/preproc}
+BASELINE=${BASELINE:-}
+RUNS="${RUNS:-5}"
+TMP="$(mktemp -d)"
+trap 'rm -rf "$TMP"' EXIT
+
+src=${1:-src/data/graphics/pokemon.h}
+
+now_ns() {
+    date +%s%N
+}
+
+# Prints the fastest of $RUNS wall-clock times in milliseconds.
+best_ms() {
+    best=
+    for _ in $(seq "$RUNS"); do
+        start=$(now_ns)
+        "$@" || exit 1
+        elapsed=$((($(now_ns) - start) / 1000000))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+            best=$elapsed
+        fi
+    done
+    echo "$best"
+}
+
+# preproc picks the file type from the extension, so give the input a .c name.
+cp "$src" "$TMP/input.c"
+
+run() {
+    $1 "$TMP/input.c" charmap.txt > "$2"
+}
+
+current=$(best_ms run "$PREPROC" "$TMP/current.c")
+echo "$src: $PREPROC: ${current} ms, $(wc -c < "$TMP/current.c") bytes of output"
+
+if [ -n "$BASELINE" ]; then
+    baseline=$(best_ms run "$BASELINE" "$TMP/baseline.c")
+    echo "$src: $BASELINE: ${baseline} ms"
+
+    if ! cmp -s "$TMP/current.c" "$TMP/baseline.c"; then
+        echo "output differs from $BASELINE!" >&2
+        exit 1
+    fi
+fi
@@ -25,14 +25,20 @@
 #include <memory>
 #include <cstring>
 #include <cerrno>
+#include <algorithm>
+#include <vector>
+#include <sys/stat.h>
 #include "preproc.h"
 #include "c_file.h"
 #include "char_util.h"
 #include "utf8.h"
 #include "string_parser.h"
 #include "io.h"
+#include "incbin_cache.h"
 
-CFile::CFile(const char * filenameCStr, bool isStdin)
+static IncbinCache s_incbinCache;
+
+CFile::CFile(const char * filenameCStr, bool isStdin, const char * incbinAsmPath)
 {
     if (isStdin)
         m_filename = std::string{"<stdin>/"}.append(filenameCStr);
@@ -44,22 +50,94 @@ CFile::CFile(const char * filenameCStr, bool isStdin)
     m_pos = 0;
     m_lineNum = 1;
     m_isStdin = isStdin;
+    m_braceDepth = 0;
+    m_statementStart = 0;
+
+    if (incbinAsmPath != nullptr)
+    {
+        m_incbinAsm = std::fopen(incbinAsmPath, "w");
+
+        if (m_incbinAsm == nullptr)
+            FATAL_ERROR("Failed to open \"%s\" for writing.\n", incbinAsmPath);
+    }
+    else
+    {
+        m_incbinAsm = nullptr;
+    }
 }
 
-CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
+CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename)), m_output(std::move(other.m_output))
 {
     m_buffer = other.m_buffer;
     m_pos = other.m_pos;
     m_size = other.m_size;
     m_lineNum = other.m_lineNum;
     m_isStdin = other.m_isStdin;
+    m_braceDepth = other.m_braceDepth;
+    m_statementStart = other.m_statementStart;
+    m_incbinAsm = other.m_incbinAsm;
 
     other.m_buffer = NULL;
+    other.m_incbinAsm = nullptr;
 }
 
 CFile::~CFile()
 {
     free(m_buffer);
+
+    if (m_incbinAsm != nullptr)
+        std::fclose(m_incbinAsm);
+}
+
+// Output is collected a top-level declaration at a time, so that one
+// initialized with an INCBIN can still be rewritten when it's reached.
+void CFile::Put(char c)
+{
+    m_output += c;
+}
+
+void CFile::Print(const char* format, ...)
+{
+    char buffer[64];
+    std::va_list args;
+    std::va_list argsCopy;
+    va_start(args, format);
+    va_copy(argsCopy, args);
+    int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (length < 0)
+        FATAL_ERROR("Failed to format output.\n");
+
+    if ((std::size_t)length < sizeof(buffer))
+    {
+        m_output.append(buffer, length);
+    }
+    else
+    {
+        // Too long for the buffer, so format it again straight into the output.
+        std::size_t start = m_output.size();
+        m_output.resize(start + length + 1);
+        std::vsnprintf(&m_output[start], length + 1, format, argsCopy);
+        m_output.resize(start + length);
+    }
+
+    va_end(argsCopy);
+}
+
+void CFile::Flush()
+{
+    std::fwrite(m_output.data(), 1, m_output.size(), stdout);
+    m_output.clear();
+    m_statementStart = 0;
+}
+
+void CFile::EndStatement()
+{
+    if (m_output.size() >= 0x10000)
+        Flush();
+
+    m_statementStart = m_output.size();
 }
 
 void CFile::Preproc()
@@ -72,21 +150,21 @@ void CFile::Preproc()
         {
             if (m_buffer[m_pos] == stringChar)
             {
-                std::putchar(stringChar);
+                Put(stringChar);
                 m_pos++;
                 stringChar = 0;
             }
             else if (m_buffer[m_pos] == '\\' && m_buffer[m_pos + 1] == stringChar)
             {
-                std::putchar('\\');
-                std::putchar(stringChar);
+                Put('\\');
+                Put(stringChar);
                 m_pos += 2;
             }
             else
             {
                 if (m_buffer[m_pos] == '\n')
                     m_lineNum++;
-                std::putchar(m_buffer[m_pos]);
+                Put(m_buffer[m_pos]);
                 m_pos++;
             }
         }
@@ -100,7 +178,7 @@ void CFile::Preproc()
 
             char c = m_buffer[m_pos++];
 
-            std::putchar(c);
+            Put(c);
 
             if (c == '\n')
                 m_lineNum++;
@@ -108,8 +186,17 @@ void CFile::Preproc()
                 stringChar = '"';
             else if (c == '\'')
                 stringChar = '\'';
+            else if (c == '{')
+                m_braceDepth++;
+            else if (c == '}')
+                m_braceDepth--;
+
+            if (m_braceDepth == 0 && (c == ';' || c == '}'))
+                EndStatement();
         }
     }
+
+    Flush();
 }
 
 bool CFile::ConsumeHorizontalWhitespace()
@@ -129,7 +216,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos += 2;
         m_lineNum++;
-        std::putchar('\n');
+        Put('\n');
         return true;
     }
 
@@ -137,7 +224,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos++;
         m_lineNum++;
-        std::putchar('\n');
+        Put('\n');
         return true;
     }
 
@@ -180,7 +267,7 @@ void CFile::TryConvertString()
 
     SkipWhitespace();
 
-    std::printf("{ ");
+    Print("{ ");
 
     while (1)
     {
@@ -202,7 +289,7 @@ void CFile::TryConvertString()
             }
 
             for (int i = 0; i < length; i++)
-                printf("0x%02X, ", s[i]);
+                Print("0x%02X, ", s[i]);
         }
         else if (m_buffer[m_pos] == ')')
         {
@@ -221,9 +308,9 @@ void CFile::TryConvertString()
     }
 
     if (noTerminator)
-        std::printf(" }");
+        Print(" }");
     else
-        std::printf("0xFF }");
+        Print("0xFF }");
 }
 
 bool CFile::CheckIdentifier(const std::string& ident)
@@ -237,46 +324,87 @@ bool CFile::CheckIdentifier(const std::string& ident)
     return (i == ident.length());
 }
 
-std::unique_ptr<unsigned char[]> CFile::ReadWholeFile(const std::string& path, int& size)
+// "00" to "99", so numbers can be formatted two digits at a time.
+static const char kDigitPairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Writes value in decimal so that it ends just before end, and returns its start.
+static char *FormatDecimal(char *end, std::uint32_t value)
 {
-    FILE* fp = std::fopen(path.c_str(), "rb");
+    while (value >= 100)
+    {
+        end -= 2;
+        std::memcpy(end, &kDigitPairs[(value % 100) * 2], 2);
+        value /= 100;
+    }
 
-    if (fp == nullptr)
-        RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
+    if (value >= 10)
+    {
+        end -= 2;
+        std::memcpy(end, &kDigitPairs[value * 2], 2);
+    }
+    else
+    {
+        *--end = '0' + value;
+    }
 
-    std::fseek(fp, 0, SEEK_END);
+    return end;
+}
+
+// Appends the elements of an INCBIN as "N," for signed and "Nu," for unsigned
+// types. Like the compiler would, this reads the elements as little-endian
+// and only sign-extends 32-bit ones.
+static void AppendIncbinData(std::string& output, const unsigned char *data, std::size_t count, int size, bool isSigned)
+{
+    // Longest element: "-2147483648,"
+    const std::size_t maxElementLength = 12;
+    std::size_t start = output.size();
 
-    size = std::ftell(fp);
+    output.resize(start + count * maxElementLength);
 
-    std::unique_ptr<unsigned char[]> buffer = std::unique_ptr<unsigned char[]>(new unsigned char[size]);
+    char *out = &output[start];
+    char digits[10];
+    char *digitsEnd = digits + sizeof(digits);
+
+    for (std::size_t i = 0; i < count; i++, data += size)
+    {
+        std::uint32_t value;
+
+        switch (size)
+        {
+        case 1:
+            value = data[0];
+            break;
+        case 2:
+            value = data[0] | (data[1] << 8);
+            break;
+        default:
+            value = data[0] | (data[1] << 8) | (data[2] << 16) | ((std::uint32_t)data[3] << 24);
+            break;
+        }
 
-    std::rewind(fp);
+        if (isSigned && (value & 0x80000000))
+        {
+            *out++ = '-';
+            value = 0u - value;
+        }
 
-    if (std::fread(buffer.get(), size, 1, fp) != 1)
-        RaiseError("Failed to read \"%s\".\n", path.c_str());
+        char *digitsStart = FormatDecimal(digitsEnd, value);
 
-    std::fclose(fp);
+        std::memcpy(out, digitsStart, digitsEnd - digitsStart);
+        out += digitsEnd - digitsStart;
 
-    return buffer;
-}
+        if (!isSigned)
+            *out++ = 'u';
 
-int ExtractData(const std::unique_ptr<unsigned char[]>& buffer, int offset, int size)
-{
-    switch (size)
-    {
-    case 1:
-        return buffer[offset];
-    case 2:
-        return (buffer[offset + 1] << 8)
-            | buffer[offset];
-    case 4:
-        return (buffer[offset + 3] << 24)
-            | (buffer[offset + 2] << 16)
-            | (buffer[offset + 1] << 8)
-            | buffer[offset];
-    default:
-        FATAL_ERROR("Invalid size passed to ExtractData.\n");
+        *out++ = ',';
     }
+
+    output.resize(out - &output[0]);
 }
 
 void CFile::TryConvertIncbin()
@@ -315,7 +443,10 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("{");
+    if (m_incbinAsm != nullptr && m_braceDepth == 0 && TryWriteIncbinAsm(size))
+        return;
+
+    Print("{");
 
     while (true)
     {
@@ -351,25 +482,17 @@ void CFile::TryConvertIncbin()
 
         m_pos++;
 
-        int fileSize;
-        std::unique_ptr<unsigned char[]> buffer = ReadWholeFile(path, fileSize);
+        const IncbinFile *file = s_incbinCache.Get(path);
+
+        if (file == nullptr)
+            RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
+
+        int fileSize = file->size;
 
         if ((fileSize % size) != 0)
             RaiseError("Size %d doesn't evenly divide file size %d.\n", size, fileSize);
 
-        int count = fileSize / size;
-        int offset = 0;
-
-        for (int i = 0; i < count; i++)
-        {
-            int data = ExtractData(buffer, offset, size);
-            offset += size;
-
-            if (isSigned)
-                std::printf("%d,", data);
-            else
-                std::printf("%uu,", data);
-        }
+        AppendIncbinData(m_output, file->data, fileSize / size, size, isSigned);
 
         SkipWhitespace();
 
@@ -384,7 +507,222 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("}");
+    Print("}");
+}
+
+static bool IsIdentifier(const std::string& s)
+{
+    if (s.empty() || !IsIdentifierStartingChar(s[0]))
+        return false;
+
+    for (char c : s)
+        if (!IsIdentifierChar(c))
+            return false;
+
+    return true;
+}
+
+// Handles a top-level `[static] const TYPE NAME[]... = INCBIN_*("PATH", ...);`
+// declaration by declaring NAME as an extern array of the right size and
+// defining it with .incbin directives in the side assembly file, so the
+// compiler never sees the data. m_pos is just past the '(' of the INCBIN.
+// Returns false, without consuming any input, for anything that doesn't
+// look like that; the caller then expands the data as usual.
+bool CFile::TryWriteIncbinAsm(int size)
+{
+    long pos = m_pos;
+    int lines = 0;
+    std::vector<std::string> paths;
+
+    auto skipWhitespace = [&]() {
+        while (pos < m_size && (m_buffer[pos] == ' ' || m_buffer[pos] == '\t' || m_buffer[pos] == '\r' || m_buffer[pos] == '\n'))
+        {
+            if (m_buffer[pos] == '\n')
+                lines++;
+            pos++;
+        }
+    };
+
+    while (true)
+    {
+        skipWhitespace();
+
+        if (pos >= m_size || m_buffer[pos] != '"')
+            return false;
+
+        long startPos = ++pos;
+
+        while (pos < m_size && m_buffer[pos] != '"')
+        {
+            if (m_buffer[pos] == 0 || m_buffer[pos] == '\r' || m_buffer[pos] == '\n' || m_buffer[pos] == '\\')
+                return false;
+            pos++;
+        }
+
+        if (pos >= m_size)
+            return false;
+
+        paths.push_back(std::string(&m_buffer[startPos], pos - startPos));
+        pos++;
+
+        skipWhitespace();
+
+        if (pos >= m_size || m_buffer[pos] != ',')
+            break;
+
+        pos++;
+    }
+
+    if (pos >= m_size || m_buffer[pos] != ')')
+        return false;
+
+    pos++;
+    skipWhitespace();
+
+    if (pos >= m_size || m_buffer[pos] != ';')
+        return false;
+
+    pos++;
+
+    // The declaration is the last line of output since the previous one,
+    // up to the '=' (cpp line markers may come before it).
+    std::size_t equals = m_output.find_last_of('=');
+
+    if (equals == std::string::npos || equals < m_statementStart
+     || m_output.find_first_not_of(" \t\r\n", equals + 1) != std::string::npos)
+        return false;
+
+    std::size_t lineStart = m_output.find_last_of('\n', equals);
+    lineStart = (lineStart == std::string::npos || lineStart < m_statementStart) ? m_statementStart : lineStart + 1;
+
+    std::string declaration = m_output.substr(lineStart, equals - lineStart);
+    std::size_t end = declaration.find_last_not_of(" \t");
+
+    if (end == std::string::npos)
+        return false;
+
+    declaration.resize(end + 1);
+
+    // Trailing dimensions, of which the first must be empty.
+    std::size_t bracket = declaration.find('[');
+
+    if (bracket == std::string::npos || declaration.compare(bracket, 2, "[]") != 0)
+        return false;
+
+    long innerCount = 1;
+
+    for (std::size_t i = bracket + 2; i < declaration.length(); )
+    {
+        std::size_t close = declaration.find(']', i);
+
+        if (declaration[i] != '[' || close == std::string::npos)
+            return false;
+
+        char *numberEnd;
+        long dimension = std::strtol(&declaration[i + 1], &numberEnd, 0);
+
+        if (numberEnd != &declaration[close] || dimension <= 0)
+            return false;
+
+        innerCount *= dimension;
+        i = close + 1;
+    }
+
+    std::string innerDimensions = declaration.substr(bracket + 2);
+
+    // The specifiers and name, which must all be plain identifiers.
+    std::vector<std::string> words;
+    std::size_t wordPos = 0;
+
+    while ((wordPos = declaration.find_first_not_of(" \t", wordPos)) < bracket)
+    {
+        std::size_t wordEnd = std::min(declaration.find_first_of(" \t[", wordPos), bracket);
+        words.push_back(declaration.substr(wordPos, wordEnd - wordPos));
+        wordPos = wordEnd;
+    }
+
+    if (words.size() < 2)
+        return false;
+
+    std::string name = words.back();
+    words.pop_back();
+
+    bool isStatic = false;
+    bool isConst = false;
+    std::string specifiers;
+
+    for (const std::string& word : words)
+    {
+        if (!IsIdentifier(word))
+            return false;
+
+        if (word == "static")
+        {
+            isStatic = true;
+            continue;
+        }
+
+        if (word == "const")
+            isConst = true;
+
+        specifiers += word + " ";
+    }
+
+    if (!IsIdentifier(name) || !isConst)
+        return false;
+
+    // Everything checks out, so this is now an error if the data is bad.
+    m_pos = pos;
+
+    long totalSize = 0;
+
+    for (const std::string& path : paths)
+    {
+        struct stat st;
+
+        if (stat(path.c_str(), &st) != 0)
+            RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
+
+        if ((st.st_size % size) != 0)
+            RaiseError("Size %d doesn't evenly divide file size %d.\n", size, (int)st.st_size);
+
+        totalSize += st.st_size;
+    }
+
+    // Like brace elision in C, a partial last row is padded with zeros.
+    long rows = (totalSize / size + innerCount - 1) / innerCount;
+    long paddedSize = rows * innerCount * size;
+
+    // Newlines after the '=' are dropped with the declaration, so put them
+    // back after it along with those inside the INCBIN to keep line numbers.
+    int droppedLines = std::count(m_output.begin() + equals, m_output.end(), '\n');
+
+    m_output.resize(lineStart);
+    Print("extern ");
+    m_output += specifiers + name;
+    Print("[%ld]", rows);
+    m_output += innerDimensions + ";";
+
+    m_lineNum += lines;
+
+    for (int i = 0; i < droppedLines + lines; i++)
+        Put('\n');
+
+    std::fprintf(m_incbinAsm, "\t.section .rodata\n"
+                              "\t.align 2\n");
+    if (!isStatic)
+        std::fprintf(m_incbinAsm, "\t.global %s\n", name.c_str());
+    std::fprintf(m_incbinAsm, "\t.type %s, %%object\n"
+                              "\t.size %s, %ld\n"
+                              "%s:\n", name.c_str(), name.c_str(), paddedSize, name.c_str());
+    for (const std::string& path : paths)
+        std::fprintf(m_incbinAsm, "\t.incbin \"%s\"\n", path.c_str());
+    if (paddedSize > totalSize)
+        std::fprintf(m_incbinAsm, "\t.space %ld\n", paddedSize - totalSize);
+    std::fprintf(m_incbinAsm, "\n");
+
+    EndStatement();
+    return true;
 }
 
 // Reports a diagnostic message.
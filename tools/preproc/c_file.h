@@ -23,6 +23,7 @@
 
 #include <cstdarg>
 #include <cstdint>
+#include <cstdio>
 #include <string>
 #include <memory>
 #include "preproc.h"
@@ -30,7 +31,7 @@
 class CFile
 {
 public:
-    CFile(const char * filenameCStr, bool isStdin);
+    CFile(const char * filenameCStr, bool isStdin, const char * incbinAsmPath = nullptr);
     CFile(CFile&& other);
     CFile(const CFile&) = delete;
     ~CFile();
@@ -43,14 +44,22 @@ private:
     long m_lineNum;
     std::string m_filename;
     bool m_isStdin;
+    std::string m_output;
+    std::size_t m_statementStart;
+    int m_braceDepth;
+    std::FILE* m_incbinAsm;
 
+    void Put(char c);
+    void Print(const char* format, ...);
+    void Flush();
+    void EndStatement();
     bool ConsumeHorizontalWhitespace();
     bool ConsumeNewline();
     void SkipWhitespace();
     void TryConvertString();
-    std::unique_ptr<unsigned char[]> ReadWholeFile(const std::string& path, int& size);
     bool CheckIdentifier(const std::string& ident);
     void TryConvertIncbin();
+    bool TryWriteIncbinAsm(int size);
     void ReportDiagnostic(const char* type, const char* format, std::va_list args);
     void RaiseError(const char* format, ...);
     void RaiseWarning(const char* format, ...);
@@ -21,6 +21,12 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdarg>
+#include <cstring>
+#include <map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "preproc.h"
 #include "charmap.h"
 #include "char_util.h"
@@ -369,16 +375,139 @@ void CharmapReader::SkipWhitespace()
         m_pos++;
 }
 
-Charmap::Charmap(std::string filename)
+static const char kCompiledCharmapMagic[8] = { 'P', 'P', 'C', 'M', 'A', 'P', '0', '1' };
+
+static std::uint32_t TableSizeFor(std::size_t count)
+{
+    // Keep the load factor at or below 1/2 so probe sequences stay short.
+    std::uint32_t size = 16;
+
+    while (size < count * 2)
+        size *= 2;
+
+    return size;
+}
+
+template <typename T>
+static void AppendBytes(std::vector<unsigned char>& image, const T *data, std::size_t count)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+    image.insert(image.end(), bytes, bytes + count * sizeof(T));
+}
+
+Charmap::Charmap(std::string filename) : m_mappedImage(nullptr), m_imageSize(0)
+{
+    if (!TryMapCompiled(filename))
+        ParseText(filename);
+}
+
+Charmap::~Charmap()
+{
+    if (m_mappedImage != nullptr)
+        munmap(m_mappedImage, m_imageSize);
+}
+
+// Maps the file into memory if it's a compiled charmap.
+bool Charmap::TryMapCompiled(const std::string& filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
+
+    char magic[sizeof(kCompiledCharmapMagic)];
+    struct stat st;
+
+    if (read(fd, magic, sizeof(magic)) != sizeof(magic)
+     || std::memcmp(magic, kCompiledCharmapMagic, sizeof(magic)) != 0
+     || fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    void *image = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (image == MAP_FAILED)
+        FATAL_ERROR("Failed to map \"%s\".\n", filename.c_str());
+
+    m_mappedImage = image;
+    m_imageSize = st.st_size;
+    SetImage(static_cast<const unsigned char *>(image), st.st_size, filename);
+    return true;
+}
+
+static void CheckCompiled(bool valid, const std::string& filename)
+{
+    if (!valid)
+        FATAL_ERROR("\"%s\" is not a valid compiled charmap. Recompile it with `preproc -C`.\n", filename.c_str());
+}
+
+static bool IsPowerOfTwo(std::uint32_t n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+// Whether a sequence stored in a compiled charmap lies within its pool.
+static bool SequenceInPool(CharmapSequence sequence, std::uint32_t poolSize)
+{
+    return (sequence >> 5) + (sequence & 0x1F) <= poolSize;
+}
+
+// A compiled charmap may be truncated or corrupt, so the header and every
+// table entry are checked before anything reads through them.
+void Charmap::SetImage(const unsigned char *image, std::size_t size, const std::string& filename)
+{
+    CheckCompiled(size >= sizeof(CompiledCharmapHeader), filename);
+
+    m_header = reinterpret_cast<const CompiledCharmapHeader *>(image);
+
+    CheckCompiled(IsPowerOfTwo(m_header->charTableSize) && IsPowerOfTwo(m_header->constantTableSize), filename);
+
+    std::size_t charsOffset = sizeof(CompiledCharmapHeader);
+    CheckCompiled(m_header->charTableSize <= (size - charsOffset) / sizeof(CompiledCharmapChar), filename);
+
+    std::size_t constantsOffset = charsOffset + m_header->charTableSize * sizeof(CompiledCharmapChar);
+    CheckCompiled(m_header->constantTableSize <= (size - constantsOffset) / sizeof(CompiledCharmapConstant), filename);
+
+    std::size_t poolOffset = constantsOffset + m_header->constantTableSize * sizeof(CompiledCharmapConstant);
+    CheckCompiled(m_header->poolSize == size - poolOffset, filename);
+
+    m_chars = reinterpret_cast<const CompiledCharmapChar *>(image + charsOffset);
+    m_constants = reinterpret_cast<const CompiledCharmapConstant *>(image + constantsOffset);
+    m_pool = image + poolOffset;
+
+    std::uint32_t poolSize = m_header->poolSize;
+
+    for (int i = 0; i < 128; i++)
+        CheckCompiled(SequenceInPool(m_header->escapes[i], poolSize), filename);
+
+    for (std::uint32_t i = 0; i < m_header->charTableSize; i++)
+        CheckCompiled(SequenceInPool(m_chars[i].sequence, poolSize), filename);
+
+    for (std::uint32_t i = 0; i < m_header->constantTableSize; i++)
+    {
+        const CompiledCharmapConstant& constant = m_constants[i];
+        CheckCompiled(SequenceInPool(constant.sequence, poolSize)
+                   && constant.nameOffset <= poolSize
+                   && constant.nameLength <= poolSize - constant.nameOffset, filename);
+    }
+}
+
+void Charmap::ParseText(const std::string& filename)
 {
     CharmapReader reader(filename);
+    std::map<std::int32_t, std::string> chars;
+    std::string escapes[128];
+    std::map<std::string, std::string> constants;
 
     for (;;)
     {
         Lhs lhs = reader.ReadLhs();
 
         if (lhs.type == LhsType::None)
-            return;
+            break;
 
         reader.ExpectEqualsSign();
 
@@ -387,22 +516,98 @@ Charmap::Charmap(std::string filename)
         switch (lhs.type)
         {
         case LhsType::Char:
-            if (m_chars.find(lhs.code) != m_chars.end())
+            if (chars.find(lhs.code) != chars.end())
                 reader.RaiseError("redefining char");
-            m_chars[lhs.code] = sequence;
+            chars[lhs.code] = sequence;
             break;
         case LhsType::Escape:
-            if (m_escapes[lhs.code].length() != 0)
+            if (escapes[lhs.code].length() != 0)
                 reader.RaiseError("redefining escape");
-            m_escapes[lhs.code] = sequence;
+            escapes[lhs.code] = sequence;
             break;
         case LhsType::Constant:
-            if (m_constants.find(lhs.name) != m_constants.end())
+            if (constants.find(lhs.name) != constants.end())
                 reader.RaiseError("redefining constant");
-            m_constants[lhs.name] = sequence;
+            constants[lhs.name] = sequence;
             break;
         }
 
         reader.ExpectEmptyRestOfLine();
     }
+
+    std::vector<unsigned char> pool;
+
+    auto addToPool = [&pool](const std::string& s) -> std::uint32_t {
+        std::uint32_t offset = pool.size();
+        pool.insert(pool.end(), s.begin(), s.end());
+        return offset;
+    };
+
+    auto addSequence = [&addToPool](const std::string& s) -> CharmapSequence {
+        return s.empty() ? 0 : (addToPool(s) << 5) | s.length();
+    };
+
+    CompiledCharmapHeader header = {};
+    std::memcpy(header.magic, kCompiledCharmapMagic, sizeof(header.magic));
+    header.charTableSize = TableSizeFor(chars.size());
+    header.constantTableSize = TableSizeFor(constants.size());
+
+    for (int i = 0; i < 128; i++)
+        header.escapes[i] = addSequence(escapes[i]);
+
+    std::vector<CompiledCharmapChar> charTable(header.charTableSize, CompiledCharmapChar{ -1, 0 });
+
+    for (const auto& entry : chars)
+    {
+        std::uint32_t mask = header.charTableSize - 1;
+        std::uint32_t i = HashCode(entry.first) & mask;
+
+        while (charTable[i].code != -1)
+            i = (i + 1) & mask;
+
+        charTable[i].code = entry.first;
+        charTable[i].sequence = addSequence(entry.second);
+    }
+
+    std::vector<CompiledCharmapConstant> constantTable(header.constantTableSize, CompiledCharmapConstant{ 0, 0, 0, 0 });
+
+    for (const auto& entry : constants)
+    {
+        std::uint32_t hash = HashName(entry.first.data(), entry.first.length());
+        std::uint32_t mask = header.constantTableSize - 1;
+        std::uint32_t i = hash & mask;
+
+        while (constantTable[i].nameLength != 0)
+            i = (i + 1) & mask;
+
+        constantTable[i].hash = hash;
+        constantTable[i].nameOffset = addToPool(entry.first);
+        constantTable[i].nameLength = entry.first.length();
+        constantTable[i].sequence = addSequence(entry.second);
+    }
+
+    header.poolSize = pool.size();
+
+    AppendBytes(m_ownedImage, &header, 1);
+    AppendBytes(m_ownedImage, charTable.data(), charTable.size());
+    AppendBytes(m_ownedImage, constantTable.data(), constantTable.size());
+    AppendBytes(m_ownedImage, pool.data(), pool.size());
+
+    SetImage(m_ownedImage.data(), m_ownedImage.size(), filename);
+}
+
+void Charmap::WriteCompiled(std::string filename) const
+{
+    const unsigned char *image = reinterpret_cast<const unsigned char *>(m_header);
+    std::size_t size = m_mappedImage != nullptr ? m_imageSize : m_ownedImage.size();
+
+    FILE *fp = std::fopen(filename.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", filename.c_str());
+
+    if (std::fwrite(image, size, 1, fp) != 1)
+        FATAL_ERROR("Failed to write \"%s\".\n", filename.c_str());
+
+    std::fclose(fp);
 }
@@ -22,43 +22,122 @@
 #define CHARMAP_H
 
 #include <cstdint>
+#include <cstddef>
 #include <string>
-#include <map>
 #include <vector>
 
+// A charmap is kept as one flat image: a header, open-addressed hash tables
+// for chars and constants, a direct-indexed escape table and a pool holding
+// the byte sequences and constant names. The same layout is written out by
+// `preproc -C` as a compiled charmap, which is mapped straight into memory
+// instead of being parsed again. Compiled charmaps are specific to the
+// machine (byte order) and preproc version that wrote them.
+
+// A byte sequence: its offset in the pool shifted left by 5 bits, ORed
+// with its length (1-16). 0 means "not mapped".
+typedef std::uint32_t CharmapSequence;
+
+struct CompiledCharmapHeader
+{
+    char magic[8];
+    std::uint32_t charTableSize;     // power of two
+    std::uint32_t constantTableSize; // power of two
+    std::uint32_t poolSize;
+    CharmapSequence escapes[128];
+};
+
+struct CompiledCharmapChar
+{
+    std::int32_t code; // -1 if the slot is empty
+    CharmapSequence sequence;
+};
+
+struct CompiledCharmapConstant
+{
+    std::uint32_t hash;
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength; // 0 if the slot is empty
+    CharmapSequence sequence;
+};
+
 class Charmap
 {
 public:
     Charmap(std::string filename);
+    Charmap(const Charmap&) = delete;
+    ~Charmap();
 
-    std::string Char(std::int32_t code)
+    std::string Char(std::int32_t code) const
     {
-        auto it = m_chars.find(code);
+        std::uint32_t mask = m_header->charTableSize - 1;
 
-        if (it == m_chars.end())
-            return std::string();
+        for (std::uint32_t i = HashCode(code) & mask;; i = (i + 1) & mask)
+        {
+            if (m_chars[i].code == code)
+                return Sequence(m_chars[i].sequence);
+            if (m_chars[i].code == -1)
+                return std::string();
+        }
+    }
 
-        return it->second;
+    std::string Escape(unsigned char code) const
+    {
+        return code < 128 ? Sequence(m_header->escapes[code]) : std::string();
     }
 
-    std::string Escape(unsigned char code)
+    std::string Constant(const std::string& identifier) const
     {
-        return m_escapes[code];
+        std::uint32_t hash = HashName(identifier.data(), identifier.length());
+        std::uint32_t mask = m_header->constantTableSize - 1;
+
+        for (std::uint32_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            const CompiledCharmapConstant& entry = m_constants[i];
+
+            if (entry.nameLength == 0)
+                return std::string();
+
+            if (entry.hash == hash && entry.nameLength == identifier.length()
+             && identifier.compare(0, std::string::npos, reinterpret_cast<const char *>(&m_pool[entry.nameOffset]), entry.nameLength) == 0)
+                return Sequence(entry.sequence);
+        }
+    }
+
+    // Writes the charmap in compiled form.
+    void WriteCompiled(std::string filename) const;
+
+    static std::uint32_t HashCode(std::int32_t code)
+    {
+        return (static_cast<std::uint32_t>(code) * 2654435761u) >> 8;
     }
 
-    std::string Constant(std::string identifier)
+    static std::uint32_t HashName(const char *name, std::size_t length)
     {
-        auto it = m_constants.find(identifier);
+        std::uint32_t hash = 2166136261u;
 
-        if (it == m_constants.end())
-            return std::string();
+        for (std::size_t i = 0; i < length; i++)
+            hash = (hash ^ static_cast<unsigned char>(name[i])) * 16777619u;
 
-        return it->second;
+        return hash;
     }
+
 private:
-    std::map<std::int32_t, std::string> m_chars;
-    std::string m_escapes[128];
-    std::map<std::string, std::string> m_constants;
+    std::vector<unsigned char> m_ownedImage;
+    void *m_mappedImage;
+    std::size_t m_imageSize;
+    const CompiledCharmapHeader *m_header;
+    const CompiledCharmapChar *m_chars;
+    const CompiledCharmapConstant *m_constants;
+    const unsigned char *m_pool;
+
+    std::string Sequence(CharmapSequence sequence) const
+    {
+        return std::string(reinterpret_cast<const char *>(&m_pool[sequence >> 5]), sequence & 0x1F);
+    }
+
+    bool TryMapCompiled(const std::string& filename);
+    void ParseText(const std::string& filename);
+    void SetImage(const unsigned char *image, std::size_t size, const std::string& filename);
 };
 
 #endif // CHARMAP_H
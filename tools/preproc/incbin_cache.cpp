@@ -0,0 +1,53 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "preproc.h"
+#include "incbin_cache.h"
+
+IncbinCache::~IncbinCache()
+{
+    for (auto& file : m_files)
+    {
+        if (file.second.size != 0)
+            munmap(const_cast<unsigned char *>(file.second.data), file.second.size);
+    }
+}
+
+const IncbinFile *IncbinCache::Get(const std::string& path)
+{
+    auto it = m_files.find(path);
+
+    if (it != m_files.end())
+        return &it->second;
+
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    IncbinFile file = { nullptr, 0 };
+
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    // mmap rejects empty mappings, and an empty file needs no data anyway.
+    if (st.st_size != 0)
+    {
+        void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED)
+            FATAL_ERROR("Failed to map \"%s\".\n", path.c_str());
+
+        file.data = static_cast<const unsigned char *>(data);
+        file.size = st.st_size;
+    }
+
+    close(fd);
+
+    return &m_files.emplace(path, file).first->second;
+}
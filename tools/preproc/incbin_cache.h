@@ -0,0 +1,31 @@
+#ifndef INCBIN_CACHE_H
+#define INCBIN_CACHE_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+struct IncbinFile
+{
+    const unsigned char *data;
+    std::size_t size;
+};
+
+// Files referenced by INCBINs, each mapped into memory the first time it's
+// requested and kept until the process exits, so a file that's INCBIN'd
+// several times is only opened and read once.
+class IncbinCache
+{
+public:
+    IncbinCache() = default;
+    IncbinCache(const IncbinCache&) = delete;
+    ~IncbinCache();
+
+    // Returns nullptr if the file can't be opened.
+    const IncbinFile *Get(const std::string& path);
+
+private:
+    std::unordered_map<std::string, IncbinFile> m_files;
+};
+
+#endif // INCBIN_CACHE_H
@@ -113,9 +113,9 @@ void PreprocAsmFile(std::string filename, bool isStdin, bool doEnum)
     }
 }
 
-void PreprocCFile(const char * filename, bool isStdin)
+void PreprocCFile(const char * filename, bool isStdin, const char * incbinAsmPath)
 {
-    CFile cFile(filename, isStdin);
+    CFile cFile(filename, isStdin, incbinAsmPath);
     cFile.Preproc();
 }
 
@@ -142,7 +142,14 @@ const char* GetFileExtension(const char* filename)
 
 static void UsageAndExit(const char *program)
 {
-    std::fprintf(stderr, "Usage: %s [-i] [-e] SRC_FILE CHARMAP_FILE\nwhere -i denotes if input is from stdin\n      -e enables enum handling\n", program);
+    std::fprintf(stderr, "Usage: %s [-i] [-e] [-b INCBIN_ASM_FILE] SRC_FILE CHARMAP_FILE\n"
+                         "       %s -C CHARMAP_FILE OUTPUT_FILE\n"
+                         "where -i denotes if input is from stdin\n"
+                         "      -e enables enum handling\n"
+                         "      -b turns top-level `const T name[] = INCBIN_*(...);` declarations in a C file\n"
+                         "         into extern declarations, with the data as .incbin directives in INCBIN_ASM_FILE\n"
+                         "      -C compiles a text charmap into a binary one that loads without parsing\n"
+                         "CHARMAP_FILE may be either a text charmap or a compiled one.\n", program, program);
     std::exit(EXIT_FAILURE);
 }
 
@@ -153,9 +160,12 @@ int main(int argc, char **argv)
     const char *charmap = NULL;
     bool isStdin = false;
     bool doEnum = false;
+    bool compileCharmap = false;
+    const char *incbinAsm = nullptr;
 
-    /* preproc [-i] [-e] SRC_FILE CHARMAP_FILE */
-    while ((opt = getopt(argc, argv, "ie")) != -1)
+    /* preproc [-i] [-e] [-b INCBIN_ASM_FILE] SRC_FILE CHARMAP_FILE
+       preproc -C CHARMAP_FILE OUTPUT_FILE */
+    while ((opt = getopt(argc, argv, "ieCb:")) != -1)
     {
         switch (opt)
         {
@@ -165,6 +175,12 @@ int main(int argc, char **argv)
         case 'e':
             doEnum = true;
             break;
+        case 'C':
+            compileCharmap = true;
+            break;
+        case 'b':
+            incbinAsm = optarg;
+            break;
         default:
             UsageAndExit(argv[0]);
             break;
@@ -174,6 +190,15 @@ int main(int argc, char **argv)
     if (optind + 2 != argc)
         UsageAndExit(argv[0]);
 
+    if (compileCharmap)
+    {
+        if (isStdin || doEnum || incbinAsm)
+            UsageAndExit(argv[0]);
+
+        Charmap(argv[optind + 0]).WriteCompiled(argv[optind + 1]);
+        return 0;
+    }
+
     source = argv[optind + 0];
     charmap = argv[optind + 1];
 
@@ -186,13 +211,15 @@ int main(int argc, char **argv)
 
     if ((extension[0] == 's') && extension[1] == 0)
     {
+        if (incbinAsm)
+            FATAL_ERROR("-b is invalid for assembly sources\n");
         PreprocAsmFile(source, isStdin, doEnum);
     }
     else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0)
     {
         if (doEnum)
             FATAL_ERROR("-e is invalid for C sources\n");
-        PreprocCFile(source, isStdin);
+        PreprocCFile(source, isStdin, incbinAsm);
     }
     else
     {
@@ -3,197 +3,205 @@
 #include <cstdint>
 #include <vector>
 #include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "ramscrgen.h"
 #include "elf.h"
 
 #define SHN_COMMON 0xFFF2
 
-static std::string s_elfPath;
-static std::string s_archiveFilePath;
-static std::string s_archiveObjectPath;
+// The ELF structures that are read, laid out as they are in a 32-bit
+// little-endian file so that they can be copied straight out of it.
+struct ElfSectionHeader
+{
+    std::uint32_t name;
+    std::uint32_t type;
+    std::uint32_t flags;
+    std::uint32_t addr;
+    std::uint32_t offset;
+    std::uint32_t size;
+    std::uint32_t link;
+    std::uint32_t info;
+    std::uint32_t addralign;
+    std::uint32_t entsize;
+};
+
+struct ElfSymbol
+{
+    std::uint32_t name;
+    std::uint32_t value;
+    std::uint32_t size;
+    std::uint8_t info;
+    std::uint8_t other;
+    std::uint16_t sectionIndex;
+};
 
-static FILE *s_file;
+static_assert(sizeof(ElfSectionHeader) == 40, "ElfSectionHeader must match the ELF layout");
+static_assert(sizeof(ElfSymbol) == 16, "ElfSymbol must match the ELF layout");
 
-static std::uint32_t s_sectionHeaderOffset;
-static int s_sectionHeaderEntrySize;
-static int s_sectionCount;
-static int s_shstrtabIndex;
+// An object file mapped into memory for as long as it's being read.
+class ElfFile
+{
+public:
+    ElfFile(const std::string& path);
+    ElfFile(const ElfFile&) = delete;
+    ~ElfFile();
 
-static std::uint32_t s_symtabOffset;
-static std::uint32_t s_strtabOffset;
-static std::uint32_t s_pseudoCommonSectionIndex;
+    std::vector<std::pair<std::string, std::uint32_t>> GetCommonSymbols();
 
-static std::uint32_t s_symbolCount;
-static std::uint32_t s_elfFileOffset;
+private:
+    std::string m_path;
+    const unsigned char *m_data;
+    std::size_t m_size;
 
-struct Symbol
-{
-    std::uint32_t nameOffset;
-    std::uint32_t size;
+    template <typename T>
+    T Read(std::uint32_t offset, std::uint32_t index = 0);
+    std::string ReadString(std::uint32_t tableOffset, std::uint32_t offset);
 };
 
-static void Seek(long offset)
+ElfFile::ElfFile(const std::string& path) : m_path(path), m_data(nullptr), m_size(0)
 {
-    if (std::fseek(s_file, s_elfFileOffset + offset, SEEK_SET) != 0)
-        FATAL_ERROR("error: failed to seek to %ld in \"%s\"", offset, s_elfPath.c_str());
-}
+    int fd = open(path.c_str(), O_RDONLY);
 
-static void Skip(long offset)
-{
-    if (std::fseek(s_file, offset, SEEK_CUR) != 0)
-        FATAL_ERROR("error: failed to skip %ld bytes in \"%s\"", offset, s_elfPath.c_str());
-}
+    if (fd < 0)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
 
-static std::uint32_t ReadInt8()
-{
-    int c = std::fgetc(s_file);
+    struct stat st;
 
-    if (c < 0)
-        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", s_elfPath.c_str());
+    if (fstat(fd, &st) != 0)
+        FATAL_ERROR("error: failed to stat \"%s\"\n", path.c_str());
 
-    return c;
-}
+    if (st.st_size != 0)
+    {
+        void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
 
-static std::uint32_t ReadInt16()
-{
-    std::uint32_t val = 0;
-    val |= ReadInt8();
-    val |= ReadInt8() << 8;
-    return val;
+        if (data == MAP_FAILED)
+            FATAL_ERROR("error: failed to map \"%s\"\n", path.c_str());
+
+        m_data = static_cast<const unsigned char *>(data);
+        m_size = st.st_size;
+    }
+
+    close(fd);
 }
 
-static std::uint32_t ReadInt32()
+ElfFile::~ElfFile()
 {
-    std::uint32_t val = 0;
-    val |= ReadInt8();
-    val |= ReadInt8() << 8;
-    val |= ReadInt8() << 16;
-    val |= ReadInt8() << 24;
-    return val;
+    if (m_size != 0)
+        munmap(const_cast<unsigned char *>(m_data), m_size);
 }
 
-static std::string ReadString()
+// Reads entry "index" of a table of Ts starting at "offset".
+template <typename T>
+T ElfFile::Read(std::uint32_t offset, std::uint32_t index)
 {
-    std::string s;
-    char c;
+    std::uint64_t start = offset + (std::uint64_t)index * sizeof(T);
+    T value;
 
-    while ((c = ReadInt8()) != 0)
-        s += c;
+    if (start + sizeof(T) > m_size)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", m_path.c_str());
 
-    return s;
+    std::memcpy(&value, m_data + start, sizeof(T));
+    return value;
 }
 
-static void VerifyElfIdent()
+std::string ElfFile::ReadString(std::uint32_t tableOffset, std::uint32_t offset)
 {
-    char expectedMagic[4] = { 0x7F, 'E', 'L', 'F' };
-    char magic[4];
+    std::uint64_t start = (std::uint64_t)tableOffset + offset;
 
-    if (std::fread(magic, 4, 1, s_file) != 1)
-        FATAL_ERROR("error: failed to read ELF magic from \"%s\"\n", s_elfPath.c_str());
+    if (start >= m_size)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", m_path.c_str());
 
-    if (std::memcmp(magic, expectedMagic, 4) != 0)
-        FATAL_ERROR("error: ELF magic did not match in \"%s\"\n", s_elfPath.c_str());
+    const void *end = std::memchr(m_data + start, 0, m_size - start);
 
-    if (std::fgetc(s_file) != 1)
-        FATAL_ERROR("error: \"%s\" not 32-bit ELF\n", s_elfPath.c_str());
+    if (end == nullptr)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", m_path.c_str());
 
-    if (std::fgetc(s_file) != 1)
-        FATAL_ERROR("error: \"%s\" not little-endian ELF\n", s_elfPath.c_str());
+    return std::string(reinterpret_cast<const char *>(m_data + start), static_cast<const unsigned char *>(end) - (m_data + start));
 }
 
-static void ReadElfHeader()
+std::vector<std::pair<std::string, std::uint32_t>> ElfFile::GetCommonSymbols()
 {
-    Seek(0x20);
-    s_sectionHeaderOffset = ReadInt32();
-    Seek(0x2E);
-    s_sectionHeaderEntrySize = ReadInt16();
-    s_sectionCount = ReadInt16();
-    s_shstrtabIndex = ReadInt16();
-}
+    static const unsigned char expectedMagic[4] = { 0x7F, 'E', 'L', 'F' };
 
-static std::string GetSectionName(std::uint32_t shstrtabOffset, int index)
-{
-    Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * index);
-    std::uint32_t nameOffset = ReadInt32();
-    Seek(shstrtabOffset + nameOffset);
-    return ReadString();
-}
+    if (m_size < 0x34)
+        FATAL_ERROR("error: failed to read ELF header from \"%s\"\n", m_path.c_str());
 
-static void FindTableOffsets()
-{
-    s_symtabOffset = 0;
-    s_strtabOffset = 0;
-    s_pseudoCommonSectionIndex = 0;
+    if (std::memcmp(m_data, expectedMagic, 4) != 0)
+        FATAL_ERROR("error: ELF magic did not match in \"%s\"\n", m_path.c_str());
+
+    if (m_data[4] != 1)
+        FATAL_ERROR("error: \"%s\" not 32-bit ELF\n", m_path.c_str());
+
+    if (m_data[5] != 1)
+        FATAL_ERROR("error: \"%s\" not little-endian ELF\n", m_path.c_str());
+
+    std::uint32_t sectionHeaderOffset = Read<std::uint32_t>(0x20);
+    std::uint16_t sectionHeaderEntrySize = Read<std::uint16_t>(0x2E);
+    std::uint16_t sectionCount = Read<std::uint16_t>(0x30);
+    std::uint16_t shstrtabIndex = Read<std::uint16_t>(0x32);
+
+    if (sectionHeaderEntrySize != sizeof(ElfSectionHeader))
+        FATAL_ERROR("error: unexpected section header size in \"%s\"\n", m_path.c_str());
 
-    Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * s_shstrtabIndex + 0x10);
-    std::uint32_t shstrtabOffset = ReadInt32();
+    std::uint32_t shstrtabOffset = Read<ElfSectionHeader>(sectionHeaderOffset, shstrtabIndex).offset;
+    const ElfSectionHeader *symtab = nullptr;
+    const ElfSectionHeader *strtab = nullptr;
+    std::uint32_t pseudoCommonSectionIndex = 0;
+    std::vector<ElfSectionHeader> sections(sectionCount);
 
-    for (int i = 0; i < s_sectionCount; i++)
+    for (std::uint32_t i = 0; i < sectionCount; i++)
     {
-        std::string name = GetSectionName(shstrtabOffset, i);
+        sections[i] = Read<ElfSectionHeader>(sectionHeaderOffset, i);
+
+        std::string name = ReadString(shstrtabOffset, sections[i].name);
 
         if (name == ".symtab")
         {
-            if (s_symtabOffset)
-                FATAL_ERROR("error: mutiple .symtab sections found in \"%s\"\n", s_elfPath.c_str());
-            Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * i + 0x10);
-            s_symtabOffset = ReadInt32();
-            std::uint32_t size = ReadInt32();
-            s_symbolCount = size / 16;
+            if (symtab)
+                FATAL_ERROR("error: mutiple .symtab sections found in \"%s\"\n", m_path.c_str());
+            symtab = &sections[i];
         }
         else if (name == ".strtab")
         {
-            if (s_strtabOffset)
-                FATAL_ERROR("error: mutiple .strtab sections found in \"%s\"\n", s_elfPath.c_str());
-            Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * i + 0x10);
-            s_strtabOffset = ReadInt32();
-        } else if (name == "common_data") {
-            if (s_pseudoCommonSectionIndex) {
-                FATAL_ERROR("error: mutiple common_data sections found in \"%s\"\n", s_elfPath.c_str());
-            }
-            s_pseudoCommonSectionIndex = i;
+            if (strtab)
+                FATAL_ERROR("error: mutiple .strtab sections found in \"%s\"\n", m_path.c_str());
+            strtab = &sections[i];
+        }
+        else if (name == "common_data")
+        {
+            if (pseudoCommonSectionIndex)
+                FATAL_ERROR("error: mutiple common_data sections found in \"%s\"\n", m_path.c_str());
+            pseudoCommonSectionIndex = i;
         }
     }
 
-    if (!s_symtabOffset)
-        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", s_elfPath.c_str());
+    if (!symtab || !symtab->offset)
+        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", m_path.c_str());
 
-    if (!s_strtabOffset)
-        FATAL_ERROR("error: couldn't find .strtab section in \"%s\"\n", s_elfPath.c_str());
-}
-
-static std::vector<std::pair<std::string, std::uint32_t>> GetCommonSymbols_Shared()
-{
-    VerifyElfIdent();
-    ReadElfHeader();
-    FindTableOffsets();
+    if (!strtab || !strtab->offset)
+        FATAL_ERROR("error: couldn't find .strtab section in \"%s\"\n", m_path.c_str());
 
     std::vector<std::pair<std::string, std::uint32_t>> commonSymbols;
 
-    if (s_pseudoCommonSectionIndex) {
-        std::vector<Symbol> commonSymbolVec;
-    
-        Seek(s_symtabOffset);
-    
-        for (std::uint32_t i = 0; i < s_symbolCount; i++)
-        {
-            Symbol sym;
-            sym.nameOffset = ReadInt32();
-            Skip(4);
-            sym.size = ReadInt32();
-            Skip(2);
-            std::uint16_t sectionIndex = ReadInt16();
-            if (sectionIndex == s_pseudoCommonSectionIndex)
-                commonSymbolVec.push_back(sym);
-        }
-    
-        for (const Symbol& sym : commonSymbolVec)
+    if (pseudoCommonSectionIndex)
+    {
+        std::uint32_t symbolCount = symtab->size / sizeof(ElfSymbol);
+
+        for (std::uint32_t i = 0; i < symbolCount; i++)
         {
-            Seek(s_strtabOffset + sym.nameOffset);
-            std::string name = ReadString();
-            if (name == "$d" || name == "") {
+            ElfSymbol sym = Read<ElfSymbol>(symtab->offset, i);
+
+            if (sym.sectionIndex != pseudoCommonSectionIndex)
                 continue;
-            }
+
+            std::string name = ReadString(strtab->offset, sym.name);
+
+            if (name == "$d" || name == "")
+                continue;
+
             commonSymbols.emplace_back(name, sym.size);
         }
     }
@@ -203,15 +211,10 @@ static std::vector<std::pair<std::string, std::uint32_t>> GetCommonSymbols_Share
 
 std::vector<std::pair<std::string, std::uint32_t>> GetCommonSymbols(std::string sourcePath, std::string path)
 {
-    s_elfFileOffset = 0;
     if (path[0] == '*')
         FATAL_ERROR("error: library common syms are unsupported (filename: \"%s\")\n", path.c_str());
 
-    s_elfPath = sourcePath + "/" + path;
-    s_file = std::fopen(s_elfPath.c_str(), "rb");
-
-    if (s_file == NULL)
-        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+    ElfFile file(sourcePath + "/" + path);
 
-    return GetCommonSymbols_Shared();
+    return file.GetCommonSymbols();
 }
@@ -24,10 +24,17 @@
 #include "ramscrgen.h"
 #include "sym_file.h"
 #include "elf.h"
+#include "sym_cache.h"
 
-void HandleCommonInclude(std::string filename, std::string sourcePath, std::string symOrderPath, std::string lang)
+// Where the COMMON symbols of the objects in sourcePath are cached between runs.
+static std::string GetCommonSymbolCachePath(std::string sourcePath)
 {
-    auto commonSymbols = GetCommonSymbols(sourcePath, filename);
+    return sourcePath + "/sym_common.cache";
+}
+
+void HandleCommonInclude(CommonSymbolCache& cache, std::string filename, std::string sourcePath, std::string symOrderPath, std::string lang)
+{
+    const CommonSymbols& commonSymbols = cache.Get(sourcePath, filename);
 
     for (const auto& commonSym : commonSymbols)
     {
@@ -47,6 +54,10 @@ void HandleCommonInclude(std::string filename, std::string sourcePath, std::stri
 void ConvertSymFile(std::string filename, std::string sectionName, std::string lang, bool common, std::string sourcePath, std::string commonSymPath, std::string libSourcePath)
 {
     SymFile symFile(filename);
+    CommonSymbolCache cache;
+
+    if (common)
+        cache.Load(GetCommonSymbolCachePath(sourcePath));
 
     while (!symFile.IsAtEnd())
     {
@@ -62,7 +73,7 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
             symFile.ExpectEmptyRestOfLine();
             printf(". = ALIGN(4);\n");
             if (common)
-                HandleCommonInclude(incFilename, incFilename[0] == '*' ? libSourcePath : sourcePath, commonSymPath, lang);
+                HandleCommonInclude(cache, incFilename, incFilename[0] == '*' ? libSourcePath : sourcePath, commonSymPath, lang);
             else
                 printf("%s(%s);\n", incFilename.c_str(), sectionName.c_str());
             break;
@@ -103,6 +114,9 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
         }
         }
     }
+
+    if (common)
+        cache.Save(GetCommonSymbolCachePath(sourcePath));
 }
 
 int main(int argc, char **argv)
@@ -0,0 +1,124 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+#include "ramscrgen.h"
+#include "elf.h"
+#include "sym_cache.h"
+
+static const char *const kCacheMagic = "ramscrgen-common 1";
+
+CommonSymbolCache::CommonSymbolCache() : m_cacheTime(0), m_startTime(std::time(nullptr)), m_changed(false)
+{
+}
+
+// The cache is a text file: a header line with the time the run that wrote
+// it started, then for each object a line of tab-separated
+// "path mtime size symbol-count" followed by its symbols as "name size",
+// one per line.
+void CommonSymbolCache::Load(const std::string& path)
+{
+    std::ifstream cache(path);
+    std::string line;
+
+    if (!std::getline(cache, line) || line.compare(0, std::strlen(kCacheMagic), kCacheMagic) != 0)
+        return;
+
+    m_cacheTime = std::strtoll(line.c_str() + std::strlen(kCacheMagic), nullptr, 10);
+
+    while (std::getline(cache, line))
+    {
+        std::size_t tab = line.find('\t');
+
+        if (tab == std::string::npos)
+            break;
+
+        std::string objectPath = line.substr(0, tab);
+        Record record;
+        long long mtime, size;
+        int numSymbols;
+
+        if (std::sscanf(line.c_str() + tab, "\t%lld\t%lld\t%d", &mtime, &size, &numSymbols) != 3)
+            break;
+
+        record.mtime = mtime;
+        record.size = size;
+
+        for (int i = 0; i < numSymbols && std::getline(cache, line); i++)
+        {
+            std::size_t space = line.rfind(' ');
+
+            if (space == std::string::npos)
+                break;
+
+            record.symbols.emplace_back(line.substr(0, space), std::strtoul(line.c_str() + space + 1, nullptr, 16));
+        }
+
+        if ((int)record.symbols.size() != numSymbols)
+            break;
+
+        m_cached[objectPath] = record;
+    }
+}
+
+void CommonSymbolCache::Save(const std::string& path) const
+{
+    if (!m_changed && m_used.size() == m_cached.size())
+        return;
+
+    std::string tmpPath = path + ".tmp";
+    FILE *fp = std::fopen(tmpPath.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for writing\n", tmpPath.c_str());
+
+    std::fprintf(fp, "%s %lld\n", kCacheMagic, (long long)m_startTime);
+
+    for (const auto& object : m_used)
+    {
+        const Record& record = object.second;
+
+        std::fprintf(fp, "%s\t%lld\t%lld\t%d\n", object.first.c_str(),
+                     (long long)record.mtime, (long long)record.size, (int)record.symbols.size());
+        for (const auto& symbol : record.symbols)
+            std::fprintf(fp, "%s %lX\n", symbol.first.c_str(), (unsigned long)symbol.second);
+    }
+
+    if (std::fclose(fp) != 0 || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        FATAL_ERROR("error: failed to write \"%s\"\n", path.c_str());
+}
+
+const CommonSymbols& CommonSymbolCache::Get(const std::string& sourcePath, const std::string& path)
+{
+    std::string objectPath = sourcePath + "/" + path;
+    auto used = m_used.find(objectPath);
+
+    if (used != m_used.end())
+        return used->second.symbols;
+
+    auto cached = m_cached.find(objectPath);
+    struct stat st;
+    Record record = Record();
+
+    if (path[0] != '*' && stat(objectPath.c_str(), &st) == 0)
+    {
+        record.mtime = st.st_mtime;
+        record.size = st.st_size;
+    }
+
+    // An object modified in the same second the last run started may have
+    // changed after it was read, so only trust older mtimes.
+    if (cached != m_cached.end() && cached->second.size == record.size
+     && cached->second.mtime == record.mtime && record.mtime < m_cacheTime)
+    {
+        record.symbols = cached->second.symbols;
+    }
+    else
+    {
+        record.symbols = GetCommonSymbols(sourcePath, path);
+        m_changed = true;
+    }
+
+    return m_used.emplace(objectPath, std::move(record)).first->second.symbols;
+}
@@ -0,0 +1,44 @@
+#ifndef SYM_CACHE_H
+#define SYM_CACHE_H
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+typedef std::vector<std::pair<std::string, std::uint32_t>> CommonSymbols;
+
+// The COMMON symbols of each object file, saved between runs so that only
+// the objects that were rebuilt since the last run are read again.
+class CommonSymbolCache
+{
+public:
+    CommonSymbolCache();
+
+    // Loads the cache of a previous run. A missing or outdated cache is
+    // treated as empty.
+    void Load(const std::string& path);
+
+    // Saves the objects looked up this run, if any of them had to be read.
+    void Save(const std::string& path) const;
+
+    const CommonSymbols& Get(const std::string& sourcePath, const std::string& path);
+
+private:
+    struct Record
+    {
+        std::int64_t mtime;
+        std::int64_t size;
+        CommonSymbols symbols;
+    };
+
+    std::unordered_map<std::string, Record> m_cached;
+    std::unordered_map<std::string, Record> m_used;
+    std::int64_t m_cacheTime;
+    std::int64_t m_startTime;
+    bool m_changed;
+};
+
+#endif // SYM_CACHE_H
@@ -0,0 +1,326 @@
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <queue>
+#include <thread>
+#include <sys/stat.h>
+#include "source_file.h"
+#include "include_graph.h"
+
+static const char *const kDatabaseMagic = "scaninc-db 1";
+
+void ParallelFor(std::size_t count, int numThreads, const std::function<void(std::size_t)>& func)
+{
+    std::atomic<std::size_t> next(0);
+
+    auto worker = [&]() {
+        std::size_t i;
+
+        while ((i = next++) < count)
+            func(i);
+    };
+
+    if (numThreads < 1)
+        numThreads = 1;
+    if ((std::size_t)numThreads > count)
+        numThreads = count;
+
+    std::vector<std::thread> threads;
+
+    for (int i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+static std::uint64_t HashContents(const std::string& contents)
+{
+    // FNV-1a
+    std::uint64_t hash = 14695981039346656037ull;
+
+    for (unsigned char c : contents)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+static bool ReadContents(const std::string& path, std::string& contents)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file)
+        return false;
+
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+IncludeGraph::IncludeGraph() : m_databaseTime(0), m_startTime(std::time(nullptr)), m_numLexed(0), m_numReused(0)
+{
+}
+
+// The database is a text file: a header line with the time the run that
+// wrote it started, then for each file a line of tab-separated
+// "path mtime size hash incbin-count include-count" followed by its
+// incbins and includes, one per line. A missing or outdated database is
+// treated as empty.
+void IncludeGraph::LoadDatabase(const std::string& path)
+{
+    std::ifstream db(path);
+    std::string line;
+
+    if (!std::getline(db, line) || line.compare(0, std::strlen(kDatabaseMagic), kDatabaseMagic) != 0)
+        return;
+
+    m_databaseTime = std::strtoll(line.c_str() + std::strlen(kDatabaseMagic), nullptr, 10);
+
+    while (std::getline(db, line))
+    {
+        std::size_t tab = line.find('\t');
+
+        if (tab == std::string::npos)
+            break;
+
+        std::string filePath = line.substr(0, tab);
+        FileRecord record;
+        unsigned long long hash;
+        long long mtime, size;
+        int numIncbins, numIncludes;
+
+        if (std::sscanf(line.c_str() + tab, "\t%lld\t%lld\t%llx\t%d\t%d", &mtime, &size, &hash, &numIncbins, &numIncludes) != 5)
+            break;
+
+        record.mtime = mtime;
+        record.size = size;
+        record.hash = hash;
+
+        for (int i = 0; i < numIncbins && std::getline(db, line); i++)
+            record.incbins.insert(line);
+        for (int i = 0; i < numIncludes && std::getline(db, line); i++)
+            record.includes.insert(line);
+
+        m_database[filePath] = record;
+    }
+}
+
+void IncludeGraph::SaveDatabase(const std::string& path) const
+{
+    std::string tmpPath = path + ".tmp";
+    FILE *fp = std::fopen(tmpPath.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", tmpPath.c_str());
+
+    std::fprintf(fp, "%s %lld\n", kDatabaseMagic, (long long)m_startTime);
+
+    for (const auto& file : m_files)
+    {
+        const FileRecord& record = file.second;
+
+        std::fprintf(fp, "%s\t%lld\t%lld\t%llx\t%d\t%d\n", file.first.c_str(),
+                     (long long)record.mtime, (long long)record.size, (unsigned long long)record.hash,
+                     (int)record.incbins.size(), (int)record.includes.size());
+        for (const std::string& incbin : record.incbins)
+            std::fprintf(fp, "%s\n", incbin.c_str());
+        for (const std::string& include : record.includes)
+            std::fprintf(fp, "%s\n", include.c_str());
+    }
+
+    if (std::fclose(fp) != 0 || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        FATAL_ERROR("Failed to write \"%s\".\n", path.c_str());
+}
+
+int IncludeGraph::AddIncludeDirs(const std::vector<std::string>& includeDirs)
+{
+    for (std::size_t i = 0; i < m_includeDirs.size(); i++)
+    {
+        if (m_includeDirs[i] == includeDirs)
+            return i;
+    }
+
+    m_includeDirs.push_back(includeDirs);
+    return m_includeDirs.size() - 1;
+}
+
+// Caches both hits and misses, since most includes miss in every directory
+// but one and the same headers are looked up from many files.
+bool IncludeGraph::CanOpenFile(const std::string& path)
+{
+    auto it = m_canOpenFile.find(path);
+
+    if (it != m_canOpenFile.end())
+        return it->second;
+
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp != NULL)
+        std::fclose(fp);
+
+    m_canOpenFile[path] = fp != NULL;
+    return fp != NULL;
+}
+
+void IncludeGraph::ResolveIncludes(int includeDirsId, const std::string& path)
+{
+    const FileRecord& file = m_files.at(path);
+    std::string filePath(path);
+    SourceFileType fileType = GetFileType(filePath);
+    std::vector<std::string> includeDirs = m_includeDirs[includeDirsId];
+    std::vector<std::string>& resolved = m_resolvedIncludes[std::make_pair(includeDirsId, path)];
+
+    includeDirs.push_back(GetDir(filePath));
+    for (auto include : file.includes)
+    {
+        bool exists = false;
+        std::string includePath("");
+        for (auto includeDir : includeDirs)
+        {
+            includePath = includeDir + include;
+            if (CanOpenFile(includePath))
+            {
+                exists = true;
+                break;
+            }
+        }
+        if (!exists && (fileType == SourceFileType::Asm || fileType == SourceFileType::Inc))
+        {
+            includePath = include;
+            if (CanOpenFile(includePath))
+                exists = true;
+        }
+        if (exists)
+            resolved.push_back(includePath);
+    }
+}
+
+FileRecord IncludeGraph::LexFile(const std::string& path)
+{
+    auto cached = m_database.find(path);
+    struct stat st;
+    FileRecord record = FileRecord();
+
+    if (stat(path.c_str(), &st) == 0)
+    {
+        record.mtime = st.st_mtime;
+        record.size = st.st_size;
+    }
+
+    if (cached != m_database.end() && cached->second.size == record.size)
+    {
+        // A file modified in the same second the last run started may have
+        // changed after it was read, so only trust older mtimes.
+        if (cached->second.mtime == record.mtime && record.mtime < m_databaseTime)
+        {
+            m_numReused++;
+            return cached->second;
+        }
+    }
+
+    std::string contents;
+
+    if (ReadContents(path, contents))
+        record.hash = HashContents(contents);
+
+    if (cached != m_database.end() && cached->second.hash == record.hash && cached->second.size == record.size)
+    {
+        m_numReused++;
+        record.incbins = cached->second.incbins;
+        record.includes = cached->second.includes;
+        return record;
+    }
+
+    SourceFile file(path);
+
+    m_numLexed++;
+    record.incbins = file.GetIncbins();
+    record.includes = file.GetIncludes();
+    return record;
+}
+
+void IncludeGraph::LexFiles(const std::vector<std::string>& paths, int numThreads)
+{
+    std::vector<FileRecord> files(paths.size());
+
+    ParallelFor(paths.size(), numThreads, [&](std::size_t i) {
+        files[i] = LexFile(paths[i]);
+    });
+
+    for (std::size_t i = 0; i < paths.size(); i++)
+        m_files[paths[i]] = std::move(files[i]);
+}
+
+void IncludeGraph::Build(const std::vector<std::pair<int, std::string>>& roots, int numThreads)
+{
+    std::set<std::pair<int, std::string>> queued(roots.begin(), roots.end());
+    std::vector<std::pair<int, std::string>> pending(queued.begin(), queued.end());
+
+    // Breadth-first: lex every file of the current level in parallel, then
+    // resolve their includes (which only touches the caches) to get the next.
+    while (!pending.empty())
+    {
+        std::set<std::string> unlexed;
+
+        for (const auto& node : pending)
+        {
+            if (m_files.find(node.second) == m_files.end())
+                unlexed.insert(node.second);
+        }
+
+        LexFiles(std::vector<std::string>(unlexed.begin(), unlexed.end()), numThreads);
+
+        std::vector<std::pair<int, std::string>> next;
+
+        for (const auto& node : pending)
+        {
+            ResolveIncludes(node.first, node.second);
+
+            for (const std::string& include : m_resolvedIncludes[node])
+            {
+                auto child = std::make_pair(node.first, include);
+
+                if (queued.insert(child).second)
+                    next.push_back(child);
+            }
+        }
+
+        pending.swap(next);
+    }
+}
+
+Dependencies IncludeGraph::Scan(int includeDirsId, const std::string& root) const
+{
+    Dependencies dependencies;
+    std::queue<std::string> filesToProcess;
+
+    filesToProcess.push(root);
+
+    while (!filesToProcess.empty())
+    {
+        std::string filePath = filesToProcess.front();
+        const FileRecord& file = m_files.at(filePath);
+        filesToProcess.pop();
+
+        for (auto incbin : file.incbins)
+        {
+            dependencies.all.insert(incbin);
+        }
+        for (const std::string& path : m_resolvedIncludes.at(std::make_pair(includeDirsId, filePath)))
+        {
+            dependencies.includes.insert(path);
+            if (dependencies.all.insert(path).second)
+            {
+                filesToProcess.push(path);
+            }
+        }
+    }
+
+    return dependencies;
+}
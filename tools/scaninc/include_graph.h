@@ -0,0 +1,81 @@
+#ifndef INCLUDE_GRAPH_H
+#define INCLUDE_GRAPH_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// What scaninc knows about a lexed file. This is also what the dependency
+// database stores, so unchanged files don't need to be lexed again.
+struct FileRecord
+{
+    std::int64_t mtime;
+    std::int64_t size;
+    std::uint64_t hash; // of the contents
+    std::set<std::string> incbins;
+    std::set<std::string> includes;
+};
+
+struct Dependencies
+{
+    std::set<std::string> all; // includes and incbins
+    std::set<std::string> includes;
+};
+
+// The include graph of a set of source files. Each file is lexed at most once
+// and its includes are resolved once per list of include directories it's
+// reached with, so any number of scans can share the work on common headers.
+class IncludeGraph
+{
+public:
+    IncludeGraph();
+
+    // Loads the records of a previous run. Files whose size and mtime or
+    // content hash still match their record are not lexed again.
+    void LoadDatabase(const std::string& path);
+
+    // Saves the records of every file in the graph.
+    void SaveDatabase(const std::string& path) const;
+
+    // Returns the id of a list of include directories, registering it if needed.
+    int AddIncludeDirs(const std::vector<std::string>& includeDirs);
+
+    // Lexes every file reachable from the roots, up to numThreads at a time.
+    // Each root is paired with the id of the include directories to scan it with.
+    void Build(const std::vector<std::pair<int, std::string>>& roots, int numThreads);
+
+    // Returns the dependencies of a root that was passed to Build.
+    Dependencies Scan(int includeDirsId, const std::string& root) const;
+
+    std::size_t NumFiles() const { return m_files.size(); }
+    std::size_t NumPathProbes() const { return m_canOpenFile.size(); }
+    int NumLexed() const { return m_numLexed; }
+    int NumReused() const { return m_numReused; }
+
+private:
+    bool CanOpenFile(const std::string& path);
+    void ResolveIncludes(int includeDirsId, const std::string& path);
+    void LexFiles(const std::vector<std::string>& paths, int numThreads);
+    FileRecord LexFile(const std::string& path);
+
+    std::vector<std::vector<std::string>> m_includeDirs;
+    std::unordered_map<std::string, FileRecord> m_files;
+    std::unordered_map<std::string, FileRecord> m_database;
+    std::int64_t m_databaseTime;
+    std::int64_t m_startTime;
+    std::atomic<int> m_numLexed;
+    std::atomic<int> m_numReused;
+    std::map<std::pair<int, std::string>, std::vector<std::string>> m_resolvedIncludes;
+    std::unordered_map<std::string, bool> m_canOpenFile;
+};
+
+// Runs func(0) ... func(count - 1) on up to numThreads threads.
+void ParallelFor(std::size_t count, int numThreads, const std::function<void(std::size_t)>& func);
+
+#endif // INCLUDE_GRAPH_H
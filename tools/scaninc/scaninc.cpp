@@ -20,43 +20,31 @@
 
 #include <cstdio>
 #include <cstdlib>
-#include <list>
-#include <queue>
-#include <set>
+#include <cstring>
 #include <string>
 #include <iostream>
-#include <tuple>
 #include <fstream>
+#include <thread>
 #include "scaninc.h"
-#include "source_file.h"
+#include "include_graph.h"
 
-bool CanOpenFile(std::string path)
-{
-    FILE *fp = std::fopen(path.c_str(), "rb");
-
-    if (fp == NULL)
-        return false;
-
-    std::fclose(fp);
-    return true;
-}
+const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n"
+                          "       scaninc --all [-j THREADS] [--db DATABASE_PATH] LIST_PATH\n"
+                          "LIST_PATH has the arguments of one `scaninc -M` run per line, with \"\" for an empty\n"
+                          "argument. All of them are scanned together, lexing each file only once.\n"
+                          "DATABASE_PATH keeps what each file includes between runs, so only files that\n"
+                          "changed since the last run are lexed.\n";
 
-const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n";
-
-int main(int argc, char **argv)
+struct ScanArgs
 {
-    std::queue<std::string> filesToProcess;
-    std::set<std::string> dependencies;
-    std::set<std::string> dependencies_includes;
-
     std::vector<std::string> includeDirs;
-
     bool makeformat = false;
     std::string make_outfile;
+    std::string path;
+};
 
-    argc--;
-    argv++;
-
+static bool ParseScanArgs(int argc, char **argv, ScanArgs& args)
+{
     while (argc > 1)
     {
         std::string arg(argv[0]);
@@ -73,114 +61,194 @@ int main(int argc, char **argv)
             {
                 includeDir += '/';
             }
-            includeDirs.push_back(includeDir);
+            args.includeDirs.push_back(includeDir);
         }
         else if(arg.substr(0, 2) == "-M")
         {
-            makeformat = true;
+            args.makeformat = true;
             argc--;
             argv++;
-            make_outfile = std::string(argv[0]);
+            args.make_outfile = std::string(argv[0]);
         }
         else
         {
-            FATAL_ERROR(USAGE);
+            return false;
         }
         argc--;
         argv++;
     }
 
-    if (argc != 1) {
-        FATAL_ERROR(USAGE);
+    if (argc != 1)
+        return false;
+
+    args.path = std::string(argv[0]);
+    return true;
+}
+
+static void PrintDependencies(const Dependencies& dependencies)
+{
+    for (const std::string &path : dependencies.all)
+    {
+        std::printf("%s\n", path.c_str());
     }
+    std::cout << std::endl;
+}
 
-    std::string initialPath(argv[0]);
+static void WriteMakeRules(const std::string& make_outfile, const Dependencies& dependencies)
+{
+    // Write out make rules to a file
+    std::ofstream output(make_outfile);
 
-    filesToProcess.push(initialPath);
+    if (!output)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", make_outfile.c_str());
 
-    while (!filesToProcess.empty())
+    // Print a make rule for the object file
+    size_t ext_pos = make_outfile.find_last_of(".");
+    auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
+    output << object_file.c_str() << ":";
+    for (const std::string &path : dependencies.all)
     {
-        std::string filePath = filesToProcess.front();
-        SourceFile file(filePath);
-        filesToProcess.pop();
+        output << " " << path;
+    }
+    output << '\n';
 
-        includeDirs.push_back(file.GetSrcDir());
-        for (auto incbin : file.GetIncbins())
-        {
-            dependencies.insert(incbin);
-        }
-        for (auto include : file.GetIncludes())
-        {
-            bool exists = false;
-            std::string path("");
-            for (auto includeDir : includeDirs)
-            {
-                path = includeDir + include;
-                if (CanOpenFile(path))
-                {
-                    exists = true;
-                    break;
-                }
-            }
-            if (!exists && (file.FileType() == SourceFileType::Asm || file.FileType() == SourceFileType::Inc))
-            {
-                path = include;
-                if (CanOpenFile(path))
-                    exists = true;
-            }
-            if (!exists)
-                continue;
+    // Dependency list rule.
+    // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
+    output << make_outfile.c_str() << ":";
+    for (const std::string &path : dependencies.includes)
+    {
+        output << " " << path;
+    }
+    output << '\n';
 
-            dependencies_includes.insert(path);
-            bool inserted = dependencies.insert(path).second;
-            if (inserted && exists)
-            {
-                filesToProcess.push(path);
-            }
-        }
-        includeDirs.pop_back();
+    // Dummy rules
+    // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
+    for (const std::string &path : dependencies.all)
+    {
+        output << path << ":\n";
     }
 
-    if(!makeformat)
+    output.flush();
+    output.close();
+}
+
+// Splits a line of the --all list into arguments. "" stands for an empty one.
+static std::vector<std::string> SplitArgs(const std::string& line)
+{
+    std::vector<std::string> args;
+    std::size_t pos = 0;
+
+    for (;;)
     {
-        for (const std::string &path : dependencies)
-        {
-            std::printf("%s\n", path.c_str());
-        }
-        std::cout << std::endl;
+        pos = line.find_first_not_of(" \t\r", pos);
+        if (pos == std::string::npos)
+            break;
+
+        std::size_t end = line.find_first_of(" \t\r", pos);
+        std::string arg = line.substr(pos, end - pos);
+        args.push_back(arg == "\"\"" ? std::string() : arg);
+        pos = end;
     }
-    else
+
+    return args;
+}
+
+static void ScanAll(const char *listPath, int numThreads, const char *databasePath)
+{
+    std::ifstream list(listPath);
+
+    if (!list)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", listPath);
+
+    IncludeGraph graph;
+    std::vector<ScanArgs> jobs;
+    std::vector<std::pair<int, std::string>> roots;
+    std::string line;
+    int lineNum = 0;
+
+    while (std::getline(list, line))
     {
-        // Write out make rules to a file
-        std::ofstream output(make_outfile);
-
-        // Print a make rule for the object file
-        size_t ext_pos = make_outfile.find_last_of(".");
-        auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
-        output << object_file.c_str() << ":";
-        for (const std::string &path : dependencies)
-        {
-            output << " " << path;
-        }
-        output << '\n';
+        lineNum++;
 
-        // Dependency list rule.
-        // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
-        output << make_outfile.c_str() << ":";
-        for (const std::string &path : dependencies_includes)
-        {
-            output << " " << path;
-        }
-        output << '\n';
+        std::vector<std::string> lineArgs = SplitArgs(line);
+
+        if (lineArgs.empty() || lineArgs[0][0] == '#')
+            continue;
+
+        std::vector<char *> argv;
+        for (std::string& arg : lineArgs)
+            argv.push_back(&arg[0]);
+
+        ScanArgs args;
+        if (!ParseScanArgs(argv.size(), argv.data(), args) || !args.makeformat)
+            FATAL_ERROR("%s:%d: expected `-M DEPENDENCY_OUT_PATH [-I INCLUDE_PATH]... FILE_PATH`\n", listPath, lineNum);
+
+        roots.emplace_back(graph.AddIncludeDirs(args.includeDirs), args.path);
+        jobs.push_back(args);
+    }
+
+    if (databasePath != nullptr)
+        graph.LoadDatabase(databasePath);
+
+    graph.Build(roots, numThreads);
+
+    if (databasePath != nullptr)
+        graph.SaveDatabase(databasePath);
+
+    ParallelFor(jobs.size(), numThreads, [&](std::size_t i) {
+        WriteMakeRules(jobs[i].make_outfile, graph.Scan(roots[i].first, roots[i].second));
+    });
 
-        // Dummy rules
-        // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
-        for (const std::string &path : dependencies)
+    std::printf("scaninc: wrote %zu dependency files from %zu files (%d lexed, %d reused), probed %zu paths\n",
+                jobs.size(), graph.NumFiles(), graph.NumLexed(), graph.NumReused(), graph.NumPathProbes());
+}
+
+int main(int argc, char **argv)
+{
+    argc--;
+    argv++;
+
+    if (argc > 0 && std::strcmp(argv[0], "--all") == 0)
+    {
+        int numThreads = std::thread::hardware_concurrency();
+        const char *databasePath = nullptr;
+
+        argc--;
+        argv++;
+
+        while (argc > 2)
         {
-            output << path << ":\n";
+            if (std::strcmp(argv[0], "-j") == 0)
+                numThreads = std::atoi(argv[1]);
+            else if (std::strcmp(argv[0], "--db") == 0)
+                databasePath = argv[1];
+            else
+                FATAL_ERROR(USAGE);
+            argc -= 2;
+            argv += 2;
         }
 
-        output.flush();
-        output.close();
+        if (argc != 1 || numThreads < 1)
+            FATAL_ERROR(USAGE);
+
+        ScanAll(argv[0], numThreads, databasePath);
+        return 0;
     }
+
+    ScanArgs args;
+
+    if (!ParseScanArgs(argc, argv, args))
+        FATAL_ERROR(USAGE);
+
+    IncludeGraph graph;
+    int includeDirsId = graph.AddIncludeDirs(args.includeDirs);
+
+    graph.Build({ std::make_pair(includeDirsId, args.path) }, 1);
+
+    Dependencies dependencies = graph.Scan(includeDirsId, args.path);
+
+    if(!args.makeformat)
+        PrintDependencies(dependencies);
+    else
+        WriteMakeRules(args.make_outfile, dependencies);
 }
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 #include <vector>
 
@@ -10,10 +11,14 @@
 #include <cassert>
 #include <cstring>
 #include <chrono>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <thread>
 
 #include "wav_file.h"
 
-static void agb_out(std::ofstream& ofs, const char *msg, ...) {
+static void agb_out(std::ostream& ofs, const char *msg, ...) {
     char buf[256];
     va_list args;
     va_start(args, msg);
@@ -22,7 +27,7 @@ static void agb_out(std::ofstream& ofs, const char *msg, ...) {
     ofs << buf;
 }
 
-static void data_write(std::ofstream& ofs, uint32_t& block_pos, int data, bool hex) {
+static void data_write(std::ostream& ofs, uint32_t& block_pos, int data, bool hex) {
     if (block_pos++ == 0) {
         if (hex)
             agb_out(ofs, "\n    .byte   0x%02X", data);
@@ -53,7 +58,7 @@ const T& clamp(const T& v, const T& lo, const T& hi) {
     return (v < lo) ? lo : (hi < v) ? hi : v;
 }
 
-static void convert_uncompressed(wav_file& wf, std::ofstream& ofs)
+static void convert_uncompressed(wav_file& wf, std::ostream& ofs)
 {
     int loop_sample = 0;
 
@@ -91,21 +96,6 @@ static void convert_uncompressed_bin(wav_file& wf, std::vector<uint8_t>& data)
     }
 }
 
-static uint32_t wav_loop_start;
-static bool wav_loop_start_override = false;
-static uint32_t wav_loop_end;
-static bool wav_loop_end_override = false;
-static double wav_tune;
-static bool wav_tune_override = false;
-static uint8_t wav_key;
-static bool wav_key_override = false;
-static uint32_t wav_rate;
-static bool wav_rate_override = false;
-
-static bool dpcm_verbose = false;
-static bool dpcm_lookahead_fast = false;
-static bool dpcm_include_padding = true;
-static size_t dpcm_enc_lookahead = 3;
 static const size_t DPCM_BLK_SIZE = 0x40;
 static const std::vector<int8_t> dpcmLookupTable = { 
     0, 1, 4, 9, 16, 25, 36, 49, -64, -49, -36, -25, -16, -9, -4, -1 
@@ -150,9 +140,27 @@ static const std::vector<std::vector<size_t>> dpcmFastLookupTable = {
 
 static int squared(int x) { return x * x; }
 
-static void dpcm_lookahead(
+static int quantize_sample(double ds)
+{
+    // TODO apply dither noise
+    return clamp(static_cast<int>(floor(ds * 128.0)), -128, 127);
+}
+
+static const int DPCM_MIN_LEVEL = -128;
+static const int DPCM_MAX_LEVEL = 127;
+static const int DPCM_NUM_LEVELS = DPCM_MAX_LEVEL - DPCM_MIN_LEVEL + 1;
+// room on both sides of the levels for the largest deltas in dpcmLookupTable
+static const int DPCM_LEVEL_PAD = 64;
+// larger than the error of any lookahead window, for levels out of range
+static const int DPCM_UNREACHABLE = 1 << 28;
+
+/*
+ * The fast search only tries the one to three deltas closest to each sample,
+ * so a depth-first search of the lookahead window stays cheap.
+ */
+static void dpcm_lookahead_fast_search(
         int& minimumError, size_t& minimumErrorIndex,
-        const double *sampleBuf, const size_t lookahead, const int prevLevel)
+        const int *samples, const size_t lookahead, const int prevLevel)
 {
     if (lookahead == 0) {
         minimumError = 0;
@@ -161,43 +169,125 @@ static void dpcm_lookahead(
 
     minimumError = std::numeric_limits<int>::max();
     minimumErrorIndex = dpcmLookupTable.size();
-    const int s = clamp(static_cast<int>(floor(sampleBuf[0] * 128.0)), -128, 127);
-    const std::vector<size_t> indexCandicateSet = dpcm_lookahead_fast? dpcmFastLookupTable[s - prevLevel + 255]: dpcmIndexTable;
+    const int s = samples[0];
 
-    for (auto i : indexCandicateSet) {
+    for (auto i : dpcmFastLookupTable[s - prevLevel + 255]) {
         int newLevel = prevLevel + dpcmLookupTable[i];
+        if (newLevel < DPCM_MIN_LEVEL || newLevel > DPCM_MAX_LEVEL)
+            continue;
 
-        int recMinimumError;
-        size_t recMinimumErrorIndex;
-
-        // TODO apply dither noise
         int errorEstimation = squared(s - newLevel);
         if (errorEstimation >= minimumError)
             continue;
 
-        dpcm_lookahead(recMinimumError, recMinimumErrorIndex,
-                sampleBuf + 1, lookahead - 1, newLevel);
+        int recMinimumError;
+        size_t recMinimumErrorIndex;
+        dpcm_lookahead_fast_search(recMinimumError, recMinimumErrorIndex,
+                samples + 1, lookahead - 1, newLevel);
 
         // TODO weigh the error squared
-        int error = squared(s - newLevel) + recMinimumError;
+        int error = errorEstimation + recMinimumError;
         if (error < minimumError) {
-            if (newLevel <= 127 && newLevel >= -128) {
-                minimumError = error;
-                minimumErrorIndex = i;
-            }
+            minimumError = error;
+            minimumErrorIndex = i;
         }
     }
 }
 
-static double calculate_snr(const std::vector<double>& uncompressedData, const std::vector<int>& decompressedData)
+/*
+ * The full search tries all 16 deltas for every sample, which is too many
+ * paths to follow one by one. But the least error of samples j.. only depends
+ * on the level output for sample j - 1, so it's computed backwards from the
+ * end of the window for all 256 levels at once. For each delta that's a
+ * shifted elementwise minimum, which the compiler vectorizes.
+ */
+static size_t dpcm_full_search(const int *samples, const size_t lookahead, const int prevLevel)
 {
-    int sum_son = 0;
-    int sum_mum = 0;
+    // total[DPCM_LEVEL_PAD + level - DPCM_MIN_LEVEL]: error of outputting level
+    // for sample j plus the least error of the samples after it, with padding
+    // so that out of range levels are never the least
+    int total[DPCM_LEVEL_PAD + DPCM_NUM_LEVELS + DPCM_LEVEL_PAD];
+    // least[level - DPCM_MIN_LEVEL]: least error of samples j.. after outputting level
+    int least[DPCM_NUM_LEVELS];
+    int *levels = total + DPCM_LEVEL_PAD;
+
+    if (lookahead > 1) {
+        std::fill(total, levels, DPCM_UNREACHABLE);
+        std::fill(levels + DPCM_NUM_LEVELS, std::end(total), DPCM_UNREACHABLE);
+    }
+
+    for (size_t j = lookahead; j-- > 1; ) {
+        const int s = samples[j];
+
+        if (j == lookahead - 1) {
+            for (int l = 0; l < DPCM_NUM_LEVELS; l++)
+                levels[l] = squared(s - (l + DPCM_MIN_LEVEL));
+        } else {
+            for (int l = 0; l < DPCM_NUM_LEVELS; l++)
+                levels[l] = squared(s - (l + DPCM_MIN_LEVEL)) + least[l];
+        }
+
+        // For the sample after the first, only the levels the first can
+        // reach are needed, which is cheaper to do below one at a time.
+        if (j == 1)
+            break;
+
+        std::fill(std::begin(least), std::end(least), DPCM_UNREACHABLE);
+        for (int8_t delta : dpcmLookupTable) {
+            const int *shifted = levels + delta;
+            for (int l = 0; l < DPCM_NUM_LEVELS; l++)
+                least[l] = shifted[l] < least[l] ? shifted[l] : least[l];
+        }
+    }
+
+    int minimumError = std::numeric_limits<int>::max();
+    size_t minimumErrorIndex = dpcmLookupTable.size();
+
+    for (auto i : dpcmIndexTable) {
+        int newLevel = prevLevel + dpcmLookupTable[i];
+        if (newLevel < DPCM_MIN_LEVEL || newLevel > DPCM_MAX_LEVEL)
+            continue;
+
+        // TODO weigh the error squared
+        int error = squared(samples[0] - newLevel);
+        if (lookahead > 1) {
+            int recMinimumError = DPCM_UNREACHABLE;
+            for (int8_t delta : dpcmLookupTable)
+                recMinimumError = std::min(recMinimumError, levels[newLevel - DPCM_MIN_LEVEL + delta]);
+            error += recMinimumError;
+        }
+        if (error < minimumError) {
+            minimumError = error;
+            minimumErrorIndex = i;
+        }
+    }
+
+    return minimumErrorIndex;
+}
+
+// Returns the index into dpcmLookupTable of the first delta from prevLevel
+// that minimizes the squared error over the next `lookahead` samples.
+static size_t dpcm_best_index(const int *samples, const size_t lookahead, const int prevLevel, bool fast)
+{
+    if (fast) {
+        int minimumError;
+        size_t minimumErrorIndex;
+        dpcm_lookahead_fast_search(minimumError, minimumErrorIndex, samples, lookahead, prevLevel);
+        return minimumErrorIndex;
+    }
+
+    return dpcm_full_search(samples, lookahead, prevLevel);
+}
+
+static double calculate_snr(const std::vector<int>& uncompressedData, const std::vector<int>& decompressedData)
+{
+    int64_t sum_son = 0;
+    int64_t sum_mum = 0;
 
     assert(uncompressedData.size() == decompressedData.size());
 
     for (size_t i = 0; i < uncompressedData.size(); i++) {
-        const int s = clamp(static_cast<int>(floor(uncompressedData[i] * 128.0)), -128, 127) + 128;
+        const int s = uncompressedData[i] + 128;
         sum_son += s * s;
         const int sub = decompressedData[i] + 128 - s;
         sum_mum += sub * sub;
@@ -210,169 +300,176 @@ static double calculate_snr(const std::vector<double>& uncompressedData, const s
     return 10 * std::log10((double)sum_son / sum_mum);
 }
 
-template<typename InitialSampleWriter, typename CompressedDataWriter>
-static void convert_dpcm_impl(wav_file& wf, InitialSampleWriter writeInitialSample, CompressedDataWriter writeCompressedData)
+struct dpcm_block {
+    int samples[DPCM_BLK_SIZE];
+    // the first sample as is, then a nibble per sample for the rest
+    uint8_t data[1 + DPCM_BLK_SIZE / 2];
+    size_t dataSize;
+    // the samples as the hardware will decode them, for the SNR
+    int decoded[DPCM_BLK_SIZE];
+    size_t numSamples;
+};
+
+static void encode_dpcm_block(dpcm_block& block, const convert_options& opts)
 {
-    int minimumError;
-    size_t minimumErrorIndex;
+    int s = block.samples[0];
+
+    block.data[0] = static_cast<uint8_t>(s);
+    block.dataSize = 1;
+    block.decoded[0] = s;
+
+    uint8_t outData = 0;
+
+    // Every byte holds the delta of an even sample in its high nibble and
+    // that of the next odd sample in its low one. The first sample is output
+    // as is, so the first byte only holds a delta for the second. A trailing
+    // even sample without a following odd one isn't output.
+    for (size_t i = 1; i < block.numSamples; i++) {
+        size_t index = dpcm_best_index(&block.samples[i],
+                std::min(opts.dpcm_lookahead, DPCM_BLK_SIZE - i), s, opts.dpcm_lookahead_fast);
+        s += dpcmLookupTable[index];
+        block.decoded[i] = s;
+
+        if (i % 2 == 0) {
+            outData = static_cast<uint8_t>((index & 0xF) << 4);
+        } else {
+            outData |= static_cast<uint8_t>(index & 0xF);
+            block.data[block.dataSize++] = outData;
+        }
+    }
+}
 
-    std::vector<double> uncompressedData;
-    std::vector<int> decompressedData;
+// Each block starts over from a literal sample, so they're all encoded independently.
+static void encode_dpcm_blocks(std::vector<dpcm_block>& blocks, const convert_options& opts)
+{
+    size_t numThreads = opts.dpcm_threads != 0 ? opts.dpcm_threads : std::thread::hardware_concurrency();
+    numThreads = clamp<size_t>(numThreads, 1, blocks.size());
+
+    std::atomic<size_t> nextBlock(0);
+    auto worker = [&]() {
+        size_t i;
+        while ((i = nextBlock++) < blocks.size())
+            encode_dpcm_block(blocks[i], opts);
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+}
 
+template<typename InitialSampleWriter, typename CompressedDataWriter>
+static void convert_dpcm_impl(wav_file& wf, const convert_options& opts, InitialSampleWriter writeInitialSample, CompressedDataWriter writeCompressedData)
+{
     const auto startTime = std::chrono::high_resolution_clock::now();
 
-    for (size_t i = 0; i < wf.loopEnd; i += DPCM_BLK_SIZE) {
+    std::vector<dpcm_block> blocks((wf.loopEnd + DPCM_BLK_SIZE - 1) / DPCM_BLK_SIZE);
+
+    for (size_t b = 0; b < blocks.size(); b++) {
         double ds[DPCM_BLK_SIZE];
+        size_t i = b * DPCM_BLK_SIZE;
         size_t samples_in_block = std::min(DPCM_BLK_SIZE, wf.loopEnd - i);
         wf.readData(i, ds, samples_in_block);
         // Pad remaining samples in block with zeros if needed
         for (size_t j = samples_in_block; j < DPCM_BLK_SIZE; j++) {
             ds[j] = 0.0;
         }
-        if (dpcm_verbose) {
-            uncompressedData.insert(uncompressedData.end(), std::begin(ds), std::end(ds));
+        for (size_t j = 0; j < DPCM_BLK_SIZE; j++) {
+            blocks[b].samples[j] = quantize_sample(ds[j]);
         }
-        // TODO apply dither noise
-        int s = clamp(static_cast<int>(floor(ds[0] * 128.0)), -128, 127);
+        blocks[b].numSamples = opts.dpcm_include_padding ? DPCM_BLK_SIZE : samples_in_block;
+    }
 
-        writeInitialSample(s);
-        if (dpcm_verbose) {
-            decompressedData.push_back(s);
-        }
+    encode_dpcm_blocks(blocks, opts);
+
+    std::vector<int> uncompressedData;
+    std::vector<int> decompressedData;
 
-        size_t innerLoopCount = 1;
-        size_t samples_to_process = dpcm_include_padding ? DPCM_BLK_SIZE : samples_in_block;
-        uint8_t outData = 0;
-        size_t sampleBufReadLen;
-
-        goto initial_loop_enter;
-
-        do {
-            if (innerLoopCount >= samples_to_process)
-                break;
-            sampleBufReadLen = std::min(dpcm_enc_lookahead, DPCM_BLK_SIZE - innerLoopCount);
-            dpcm_lookahead(
-                    minimumError, minimumErrorIndex,
-                    &ds[innerLoopCount], sampleBufReadLen, s);
-            outData = static_cast<uint8_t>((minimumErrorIndex & 0xF) << 4);
-            s += dpcmLookupTable[minimumErrorIndex];
-            if (dpcm_verbose) {
-                decompressedData.push_back(s);
-            }
-            innerLoopCount += 1;
-initial_loop_enter:
-            if (innerLoopCount >= samples_to_process)
-                break;
-            sampleBufReadLen = std::min(dpcm_enc_lookahead, DPCM_BLK_SIZE - innerLoopCount);
-            dpcm_lookahead(
-                    minimumError, minimumErrorIndex,
-                    &ds[innerLoopCount], sampleBufReadLen, s);
-            outData |= static_cast<uint8_t>(minimumErrorIndex & 0xF);
-            s += dpcmLookupTable[minimumErrorIndex];
-            innerLoopCount += 1;
-            if (dpcm_verbose) {
-                decompressedData.push_back(s);
-            }
-            writeCompressedData(outData);
-        } while (innerLoopCount < DPCM_BLK_SIZE);
+    for (const dpcm_block& block : blocks) {
+        writeInitialSample(static_cast<int8_t>(block.data[0]));
+        for (size_t i = 1; i < block.dataSize; i++)
+            writeCompressedData(block.data[i]);
+
+        if (opts.dpcm_verbose) {
+            uncompressedData.insert(uncompressedData.end(), block.samples, block.samples + block.numSamples);
+            decompressedData.insert(decompressedData.end(), block.decoded, block.decoded + block.numSamples);
+        }
     }
 
     const auto endTime = std::chrono::high_resolution_clock::now();
 
-    if (dpcm_verbose) {
+    if (opts.dpcm_verbose) {
         const auto dur = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
         const double durSecs = static_cast<double>(dur.count()) / 1000000000.0;
-        printf("SNR: %.2fdB, run time: %.2fs\n", calculate_snr(uncompressedData, decompressedData), durSecs);
+        printf("SNR: %.2fdB, run time: %.3fs\n", calculate_snr(uncompressedData, decompressedData), durSecs);
     }
 }
 
-static void convert_dpcm(wav_file& wf, std::ofstream& ofs)
+static void convert_dpcm(wav_file& wf, std::ostream& ofs, const convert_options& opts)
 {
     uint32_t block_pos = 0;
-    convert_dpcm_impl(wf,
+    convert_dpcm_impl(wf, opts,
         [&](int s) { data_write(ofs, block_pos, s, false); },
         [&](uint8_t outData) { data_write(ofs, block_pos, outData, true); });
 }
 
-static void convert_dpcm_bin(wav_file& wf, std::vector<uint8_t>& data)
+static void convert_dpcm_bin(wav_file& wf, std::vector<uint8_t>& data, const convert_options& opts)
 {
-    convert_dpcm_impl(wf,
+    convert_dpcm_impl(wf, opts,
         [&](int s) { bin_write_u8(data, static_cast<uint8_t>(s)); },
         [&](uint8_t outData) { bin_write_u8(data, outData); });
 }
 
-void enable_dpcm_verbose()
-{
-    dpcm_verbose = true;
-}
-
-void enable_dpcm_lookahead_fast()
-{
-    dpcm_lookahead_fast = true;
-}
-
-void disable_dpcm_padding()
-{
-    dpcm_include_padding = false;
-}
-
-void set_dpcm_lookahead(size_t lookahead)
-{
-    dpcm_enc_lookahead = clamp<size_t>(lookahead, 1, 8);
-}
-
-void set_wav_loop_start(uint32_t start)
+// Unless only_if_changed is set and the file already holds exactly data,
+// writes data to it. Returns whether it did.
+static bool write_output(const std::string& path, const std::string& data,
+        std::ios::openmode mode, bool only_if_changed)
 {
-    wav_loop_start = start;
-    wav_loop_start_override = true;
-}
-
-void set_wav_loop_end(uint32_t end)
-{
-    wav_loop_end = end;
-    wav_loop_end_override = true;
-}
-
-void set_wav_tune(double tune)
-{
-    wav_tune = tune;
-    wav_tune_override = true;
-}
-
-void set_wav_key(uint8_t key)
-{
-    wav_key = key;
-    wav_key_override = true;
-}
+    if (only_if_changed) {
+        std::ifstream fin(path, std::ios::in | std::ios::binary);
+        if (fin.is_open()) {
+            std::string old_data((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+            if (old_data == data)
+                return false;
+        }
+    }
 
-void set_wav_rate(uint32_t rate)
-{
-    wav_rate = rate;
-    wav_rate_override = true;
+    std::ofstream fout(path, std::ios::out | mode);
+    if (!fout.is_open()) {
+        perror("ofstream");
+        throw std::runtime_error("unable to open output file");
+    }
+    fout.write(data.data(), data.size());
+    fout.close();
+    return true;
 }
 
-void convert(const std::string& wav_file_str, const std::string& out_file_str,
-        const std::string& sym, cmp_type ct, out_type ot)
+convert_result convert(const std::string& wav_file_str, const std::string& out_file_str,
+        const std::string& sym, cmp_type ct, out_type ot, const convert_options& opts)
 {
     wav_file wf(wav_file_str);
+    convert_result result;
 
     // check command line overrides
-    if (wav_loop_start_override) {
-        wf.loopStart = std::min(wav_loop_start, wf.loopEnd);
+    if (opts.loop_start) {
+        wf.loopStart = std::min(*opts.loop_start, wf.loopEnd);
         wf.loopEnabled = true;
     }
-    if (wav_loop_end_override) {
-        wf.loopEnd = std::min(wav_loop_end, wf.loopEnd);
+    if (opts.loop_end) {
+        wf.loopEnd = std::min(*opts.loop_end, wf.loopEnd);
     }
-    if (wav_tune_override) {
-        wf.tuning = wav_tune;
+    if (opts.tune) {
+        wf.tuning = *opts.tune;
     }
-    if (wav_key_override) {
-        wf.midiKey = wav_key;
+    if (opts.key) {
+        wf.midiKey = *opts.key;
     }
-    if (wav_rate_override) {
-        wf.sampleRate = wav_rate;
+    if (opts.rate) {
+        wf.sampleRate = *opts.rate;
     }
+    result.samples = wf.loopEnd;
 
     uint8_t fmt;
     if (ct == cmp_type::none)
@@ -425,25 +522,16 @@ void convert(const std::string& wav_file_str, const std::string& out_file_str,
         if (ct == cmp_type::none)
             convert_uncompressed_bin(wf, bin_data);
         else if (ct == cmp_type::dpcm)
-            convert_dpcm_bin(wf, bin_data);
+            convert_dpcm_bin(wf, bin_data, opts);
         else
             throw std::runtime_error("convert: invalid compression type");
 
         // Write binary file
-        std::ofstream fout(out_file_str, std::ios::out | std::ios::binary);
-        if (!fout.is_open()) {
-            perror("ofstream");
-            throw std::runtime_error("unable to open output file");
-        }
-        fout.write(reinterpret_cast<const char*>(bin_data.data()), bin_data.size());
-        fout.close();
+        result.written = write_output(out_file_str,
+                std::string(bin_data.begin(), bin_data.end()), std::ios::binary, opts.only_if_changed);
     } else {
         // Assembly output mode
-        std::ofstream fout(out_file_str, std::ios::out);
-        if (!fout.is_open()) {
-            perror("ofstream");
-            throw std::runtime_error("unable to open output file");
-        }
+        std::ostringstream fout;
 
         agb_out(fout, "    .section .rodata\n");
         agb_out(fout, "    .global %s\n", sym.c_str());
@@ -456,11 +544,13 @@ void convert(const std::string& wav_file_str, const std::string& out_file_str,
         if (ct == cmp_type::none)
             convert_uncompressed(wf, fout);
         else if (ct == cmp_type::dpcm)
-            convert_dpcm(wf, fout);
+            convert_dpcm(wf, fout, opts);
         else
             throw std::runtime_error("convert: invalid compression type");
 
         agb_out(fout, "\n\n    .end\n");
-        fout.close();
+        result.written = write_output(out_file_str, fout.str(), std::ios::openmode(), opts.only_if_changed);
     }
+
+    return result;
 }
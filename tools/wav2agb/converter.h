@@ -3,6 +3,7 @@
 #include <string>
 #include <algorithm>
 #include <cstdint>
+#include <optional>
 
 enum class cmp_type {
     none, dpcm
@@ -12,15 +13,25 @@ enum class out_type {
     assembly, binary
 };
 
-void enable_dpcm_verbose();
-void enable_dpcm_lookahead_fast();
-void disable_dpcm_padding();
-void set_dpcm_lookahead(size_t lookahead);
-void set_wav_loop_start(uint32_t start);
-void set_wav_loop_end(uint32_t end);
-void set_wav_tune(double tune);
-void set_wav_key(uint8_t key);
-void set_wav_rate(uint32_t rate);
+struct convert_options {
+    bool dpcm_verbose = false;
+    bool dpcm_lookahead_fast = false;
+    bool dpcm_include_padding = true;
+    size_t dpcm_lookahead = 3;
+    size_t dpcm_threads = 0; // 0 for one per core
+    bool only_if_changed = false; // leave outputs that already match alone
+    // overrides of what the .wav file says
+    std::optional<uint32_t> loop_start;
+    std::optional<uint32_t> loop_end;
+    std::optional<double> tune;
+    std::optional<uint8_t> key;
+    std::optional<uint32_t> rate;
+};
+
+struct convert_result {
+    size_t samples = 0;
+    bool written = false;
+};
 
-void convert(const std::string&, const std::string&,
-        const std::string& sym, cmp_type ct, out_type ot);
+convert_result convert(const std::string&, const std::string&,
+        const std::string& sym, cmp_type ct, out_type ot, const convert_options& opts);
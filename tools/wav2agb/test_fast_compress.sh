@@ -1,9 +1,40 @@
 #!/bin/sh
+# Benchmarks DPCM compression of the given .wav files at each lookahead, with
+# both the full and the fast search, reporting the average SNR and the
+# seconds spent per file.
+#
+# WAV2AGB overrides the wav2agb to run, LOOKAHEADS the lookaheads to try and
+# JOBS the number of compression threads.
 
-for l in $(seq 1 8)
+WAV2AGB=${WAV2AGB:-wav2agb}
+LOOKAHEADS=${LOOKAHEADS:-1 2 3 4 5 6 7 8}
+
+if [ $# -eq 0 ]
+then
+    echo "usage: $0 FILE.wav..." >&2
+    exit 1
+fi
+
+out=$(mktemp)
+trap 'rm -f "$out"' EXIT
+
+for l in $LOOKAHEADS
 do
-    echo lookahead="$l":
-    wav2agb "$1" -c -l "$l" --verbose
-    echo lookahead="$l" fast:
-    wav2agb "$1" -f -l "$l" --verbose
+    for mode in c f
+    do
+        for f in "$@"
+        do
+            "$WAV2AGB" "$f" "$out" -b -"$mode" -l "$l" ${JOBS:+-j "$JOBS"} --verbose || exit 1
+        done | awk -v l="$l" -v mode="$mode" '
+            # SNR: 12.34dB, run time: 0.123s
+            {
+                snr += substr($2, 1, length($2) - 3)
+                secs += substr($5, 1, length($5) - 1)
+                n++
+            }
+            END {
+                if (n > 0)
+                    printf "lookahead=%d%s: %d files, average SNR %.2fdB, %.3fs per file\n", l, mode == "f" ? " fast" : "", n, snr / n, secs / n
+            }'
+    done
 done
@@ -5,6 +5,12 @@
 #include <cassert>
 
 #include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
 
 #include "converter.h"
 #include "wav_file.h"
@@ -13,12 +19,14 @@ static void usage() {
     fprintf(stderr, "wav2agb\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "Usage: wav2agb [options] <input.wav> [<output>]\n");
+    fprintf(stderr, "       wav2agb --batch [-j <threads>] <list>\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "-s, --symbol <sym>       | symbol name for wave header (default: file name)\n");
     fprintf(stderr, "-l, --lookahead <amount> | DPCM compression lookahead 1..8 (default: 3)\n");
     fprintf(stderr, "-c, --compress           | compress output with DPCM\n");
     fprintf(stderr, "-f, --fast-compress      | compress output with DPCM fast\n");
+    fprintf(stderr, "-j, --jobs <threads>     | DPCM compression threads (default: one per core)\n");
     fprintf(stderr, "--no-pad                 | omit trailing padding in compressed output\n");
     fprintf(stderr, "-b, --binary             | output raw binary instead of assembly\n");
     fprintf(stderr, "--loop-start <pos>       | override loop start (integer)\n");
@@ -27,6 +35,10 @@ static void usage() {
     fprintf(stderr, "--key <key>              | override midi key (int)\n");
     fprintf(stderr, "--rate <rate>            | override base samplerate (int)\n");
     fprintf(stderr, "--set-agbl <loop-end>    | adds the custom agbl chunk to the given input .wav file\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "--batch converts every file in <list>, each line of which holds the\n");
+    fprintf(stderr, "options and files of one conversion, on <threads> threads (default:\n");
+    fprintf(stderr, "one per core). Outputs that wouldn't change aren't rewritten.\n");
     exit(1);
 }
 
@@ -101,144 +113,250 @@ static std::string filename_without_dir(const std::string& str) {
     }
 }
 
-static cmp_type arg_compress = cmp_type::none;
-static out_type arg_output_type = out_type::assembly;
-static std::string arg_sym;
-static bool arg_input_file_read = false;
-static bool arg_output_file_read = false;
-static std::string arg_input_file;
-static std::string arg_output_file;
-static bool arg_set_agbl = false;
-static int32_t arg_agbl_value = 0;
+struct arguments {
+    cmp_type compress = cmp_type::none;
+    out_type output_type = out_type::assembly;
+    std::string sym;
+    bool input_file_read = false;
+    bool output_file_read = false;
+    std::string input_file;
+    std::string output_file;
+    bool set_agbl = false;
+    int32_t agbl_value = 0;
+    convert_options options;
+};
 
-int main(int argc, char *argv[]) {
-    try {
-        if (argc == 1)
-            usage();
+static arguments parse_arguments(const std::vector<std::string>& args) {
+    arguments arg;
 
-        for (int i = 1; i < argc; i++) {
-            std::string st(argv[i]);
-            if (st == "-s" || st == "--symbol") {
-                if (++i >= argc)
-                    die("-s: missing symbol name\n");
-                arg_sym = argv[i];
-                fix_str(arg_sym);
-            } else if (st == "-c" || st == "--compress") {
-                arg_compress = cmp_type::dpcm;
-            } else if (st == "-f" || st == "--compress-fast") {
-                arg_compress = cmp_type::dpcm;
-                enable_dpcm_lookahead_fast();
-            } else if (st == "--no-pad") {
-                disable_dpcm_padding();
-            } else if (st == "-b" || st == "--binary") {
-                arg_output_type = out_type::binary;
-            } else if (st == "--verbose") {
-                enable_dpcm_verbose();
-            } else if (st == "-l" || st == "--lookahead") {
-                if (++i >= argc)
-                    die("-l: missing parameter");
-                set_dpcm_lookahead(std::stoul(argv[i], nullptr, 10));
-            } else if (st == "--version") {
-                version();
-            } else if (st == "--loop-start") {
-                if (++i >= argc)
-                    die("--loop-start: missing parameter");
-                uint32_t start = static_cast<uint32_t>(std::stoul(argv[i], nullptr, 10));
-                set_wav_loop_start(start);
-            } else if (st == "--loop-end") {
-                if (++i >= argc)
-                    die("--loop-end: missing parameter");
-                uint32_t end = static_cast<uint32_t>(std::stoul(argv[i], nullptr, 10));
-                set_wav_loop_end(end);
-            } else if (st == "--tune") {
-                if (++i >= argc)
-                    die("--tune: missing parameter");
-                double tune = std::stod(argv[i], nullptr);
-                set_wav_tune(tune);
-            } else if (st == "--key") {
-                if (++i >= argc)
-                    die("--key: missing parameter");
-                int key = std::stoi(argv[i], nullptr, 10);
-                if (key < 0) key = 0;
-                if (key > 127) key = 127;
-                set_wav_key(static_cast<uint8_t>(key));
-            } else if (st == "--rate") {
-                if (++i >= argc)
-                    die("--rate: missing parameter");
-                uint32_t rate = static_cast<uint32_t>(std::stoul(argv[i], nullptr, 10));
-                set_wav_rate(rate);
-            } else if (st == "--set-agbl") {
-                if (++i >= argc)
-                    die("--set-agbl: missing parameter");
-                arg_agbl_value = std::stoi(argv[i], nullptr, 10);
-                arg_set_agbl = true;
+    for (size_t i = 0; i < args.size(); i++) {
+        const std::string& st = args[i];
+        if (st == "-s" || st == "--symbol") {
+            if (++i >= args.size())
+                die("-s: missing symbol name\n");
+            arg.sym = args[i];
+            fix_str(arg.sym);
+        } else if (st == "-c" || st == "--compress") {
+            arg.compress = cmp_type::dpcm;
+        } else if (st == "-f" || st == "--compress-fast") {
+            arg.compress = cmp_type::dpcm;
+            arg.options.dpcm_lookahead_fast = true;
+        } else if (st == "--no-pad") {
+            arg.options.dpcm_include_padding = false;
+        } else if (st == "-b" || st == "--binary") {
+            arg.output_type = out_type::binary;
+        } else if (st == "--verbose") {
+            arg.options.dpcm_verbose = true;
+        } else if (st == "-l" || st == "--lookahead") {
+            if (++i >= args.size())
+                die("-l: missing parameter");
+            arg.options.dpcm_lookahead = std::clamp<size_t>(std::stoul(args[i], nullptr, 10), 1, 8);
+        } else if (st == "-j" || st == "--jobs") {
+            if (++i >= args.size())
+                die("-j: missing parameter");
+            arg.options.dpcm_threads = std::stoul(args[i], nullptr, 10);
+        } else if (st == "--version") {
+            version();
+        } else if (st == "--loop-start") {
+            if (++i >= args.size())
+                die("--loop-start: missing parameter");
+            arg.options.loop_start = static_cast<uint32_t>(std::stoul(args[i], nullptr, 10));
+        } else if (st == "--loop-end") {
+            if (++i >= args.size())
+                die("--loop-end: missing parameter");
+            arg.options.loop_end = static_cast<uint32_t>(std::stoul(args[i], nullptr, 10));
+        } else if (st == "--tune") {
+            if (++i >= args.size())
+                die("--tune: missing parameter");
+            arg.options.tune = std::stod(args[i], nullptr);
+        } else if (st == "--key") {
+            if (++i >= args.size())
+                die("--key: missing parameter");
+            int key = std::stoi(args[i], nullptr, 10);
+            if (key < 0) key = 0;
+            if (key > 127) key = 127;
+            arg.options.key = static_cast<uint8_t>(key);
+        } else if (st == "--rate") {
+            if (++i >= args.size())
+                die("--rate: missing parameter");
+            arg.options.rate = static_cast<uint32_t>(std::stoul(args[i], nullptr, 10));
+        } else if (st == "--set-agbl") {
+            if (++i >= args.size())
+                die("--set-agbl: missing parameter");
+            arg.agbl_value = std::stoi(args[i], nullptr, 10);
+            arg.set_agbl = true;
+        } else {
+            size_t file_arg = i;
+            if (st == "--") {
+                if (++file_arg >= args.size())
+                    die("--: missing file name\n");
+                i = file_arg;
+            }
+            if (!arg.input_file_read) {
+                arg.input_file = args[file_arg];
+                if (arg.input_file.size() < 1)
+                    die("empty input file name\n");
+                arg.input_file_read = true;
+            } else if (!arg.output_file_read) {
+                arg.output_file = args[file_arg];
+                if (arg.output_file.size() < 1)
+                    die("empty output file name\n");
+                arg.output_file_read = true;
             } else {
-                if (st == "--") {
-                    if (++i >= argc)
-                        die("--: missing file name\n");
-                }
-                if (!arg_input_file_read) {
-                    arg_input_file = argv[i];
-                    if (arg_input_file.size() < 1)
-                        die("empty input file name\n");
-                    arg_input_file_read = true;
-                } else if (!arg_output_file_read) {
-                    arg_output_file = argv[i];
-                    if (arg_output_file.size() < 1)
-                        die("empty output file name\n");
-                    arg_output_file_read = true;
-                } else {
-                    die("Too many files specified\n");
-                }
+                die("Too many files specified\n");
             }
         }
+    }
 
-        // check arguments
-        if (!arg_input_file_read) {
-            die("No input file specified\n");
+    // check arguments
+    if (!arg.input_file_read) {
+        die("No input file specified\n");
+    }
+
+    if (!arg.output_file_read) {
+        // create output file name if none is provided
+        if (arg.set_agbl) {
+            arg.output_file = arg.input_file;
+        } else if (arg.output_type == out_type::binary) {
+            arg.output_file = filename_without_ext(arg.input_file) + ".bin";
+        } else {
+            arg.output_file = filename_without_ext(arg.input_file) + ".s";
         }
+        arg.output_file_read = true;
+    }
 
-        if (!arg_output_file_read) {
-            // create output file name if none is provided
-            if (arg_set_agbl) {
-                arg_output_file = arg_input_file;
-            } else if (arg_output_type == out_type::binary) {
-                arg_output_file = filename_without_ext(arg_input_file) + ".bin";
-            } else {
-                arg_output_file = filename_without_ext(arg_input_file) + ".s";
+    if (arg.sym.size() == 0) {
+        arg.sym = filename_without_dir(filename_without_ext(arg.output_file));
+        fix_str(arg.sym);
+    }
+
+    return arg;
+}
+
+static std::vector<std::string> split_args(const std::string& line) {
+    std::vector<std::string> args;
+    size_t pos = 0;
+
+    while ((pos = line.find_first_not_of(" \t\r", pos)) != std::string::npos) {
+        size_t end = line.find_first_of(" \t\r", pos);
+        std::string arg = line.substr(pos, end - pos);
+        args.push_back(arg == "\"\"" ? std::string() : arg);
+        pos = end;
+    }
+
+    return args;
+}
+
+/*
+ * Converts every file in a list, whose lines each hold the arguments of one
+ * wav2agb run, on up to num_threads threads. Each file is compressed on a
+ * single thread since there's a whole list of them to spread across cores,
+ * and outputs that wouldn't change aren't rewritten.
+ */
+static int convert_batch(const std::string& list_path, size_t num_threads) {
+    std::ifstream list(list_path);
+    if (!list.is_open())
+        die("%s: unable to open batch list\n", list_path.c_str());
+
+    std::vector<arguments> jobs;
+    std::string line;
+    for (int line_num = 1; std::getline(list, line); line_num++) {
+        std::vector<std::string> args = split_args(line);
+        if (args.empty() || args[0][0] == '#')
+            continue;
+        arguments arg = parse_arguments(args);
+        if (arg.set_agbl)
+            die("%s:%d: --set-agbl can't be used in a batch\n", list_path.c_str(), line_num);
+        arg.options.dpcm_threads = 1;
+        arg.options.only_if_changed = true;
+        jobs.push_back(arg);
+    }
+
+    if (num_threads == 0)
+        num_threads = std::thread::hardware_concurrency();
+    num_threads = std::clamp<size_t>(num_threads, 1, std::max<size_t>(jobs.size(), 1));
+
+    const auto start_time = std::chrono::steady_clock::now();
+    std::atomic<size_t> next_job(0);
+    std::atomic<size_t> num_samples(0);
+    std::atomic<size_t> num_unchanged(0);
+    std::atomic<bool> failed(false);
+
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next_job++) < jobs.size()) {
+            const arguments& job = jobs[i];
+            try {
+                convert_result result = convert(job.input_file, job.output_file, job.sym,
+                        job.compress, job.output_type, job.options);
+                num_samples += result.samples;
+                if (!result.written)
+                    num_unchanged++;
+            } catch (const std::exception& e) {
+                fprintf(stderr, "%s: %s\n", job.input_file.c_str(), e.what());
+                failed = true;
             }
-            arg_output_file_read = true;
         }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
 
-        if (arg_sym.size() == 0) {
-            arg_sym = filename_without_dir(filename_without_ext(arg_output_file));
-            fix_str(arg_sym);
+    const std::chrono::duration<double> secs = std::chrono::steady_clock::now() - start_time;
+    printf("wav2agb: converted %zu files, %zu samples in %.2fs (%.0f samples/s), %zu unchanged and not rewritten\n",
+            jobs.size(), num_samples.load(), secs.count(), num_samples / std::max(secs.count(), 1e-9),
+            num_unchanged.load());
+
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        if (argc == 1)
+            usage();
+
+        if (std::string(argv[1]) == "--batch") {
+            size_t num_threads = 0;
+            int i = 2;
+            if (i + 1 < argc && (std::string(argv[i]) == "-j" || std::string(argv[i]) == "--jobs")) {
+                num_threads = std::stoul(argv[i + 1], nullptr, 10);
+                i += 2;
+            }
+            if (i + 1 != argc)
+                die("--batch: expected a single list file\n");
+            return convert_batch(argv[i], num_threads);
         }
 
-        if (arg_set_agbl) {
+        arguments arg = parse_arguments(std::vector<std::string>(argv + 1, argv + argc));
+
+        if (arg.set_agbl) {
             // Parse the WAV file once to get both chunks and metadata
-            wav_file wav(arg_input_file);
+            wav_file wav(arg.input_file);
 
             // Calculate actual loop-end value
             uint32_t loop_end_value;
-            if (arg_agbl_value < 0) {
+            if (arg.agbl_value < 0) {
                 // Negative value: offset from end of samples
-                int64_t calculated = static_cast<int64_t>(wav.numSamples) + arg_agbl_value;
+                int64_t calculated = static_cast<int64_t>(wav.numSamples) + arg.agbl_value;
                 if (calculated < 0) {
                     die("--set-agbl: negative offset %d exceeds total samples %u\n",
-                        arg_agbl_value, wav.numSamples);
+                        arg.agbl_value, wav.numSamples);
                 }
                 loop_end_value = static_cast<uint32_t>(calculated);
             } else {
                 // Positive value: use directly
-                loop_end_value = static_cast<uint32_t>(arg_agbl_value);
+                loop_end_value = static_cast<uint32_t>(arg.agbl_value);
             }
 
-            write_wav_with_agbl_chunk(arg_output_file, wav.chunks, loop_end_value);
+            write_wav_with_agbl_chunk(arg.output_file, wav.chunks, loop_end_value);
             return 0;
         }
 
-        convert(arg_input_file, arg_output_file, arg_sym, arg_compress, arg_output_type);
+        convert(arg.input_file, arg.output_file, arg.sym, arg.compress, arg.output_type, arg.options);
         return 0;
     } catch (const std::exception& e) {
         fprintf(stderr, "std lib error:\n%s\n", e.what());